@@ -178,6 +178,12 @@ macro(dune_probe_functions)
     "pthread.h"
     DUNE_SYS_HAS_PTHREAD_COND)
 
+  dune_test_function(pthread_setaffinity_np
+    "int"
+    "pthread_t;size_t;cpu_set_t*"
+    "pthread.h"
+    DUNE_SYS_HAS_PTHREAD_SETAFFINITY_NP)
+
   dune_test_function(pthread_rwlock_init
     "int"
     "pthread_rwlock_t*;pthread_rwlockattr_t*"
@@ -238,6 +244,12 @@ macro(dune_probe_functions)
     "sys/mman.h;sys/types.h"
     DUNE_SYS_HAS_MUNLOCKALL)
 
+  dune_test_function(posix_openpt
+    "int"
+    "int"
+    "cstdlib;fcntl.h"
+    DUNE_SYS_HAS_POSIX_OPENPT)
+
   dune_test_function(round
     "double"
     "double"
@@ -700,6 +712,18 @@ macro(dune_probe_functions)
     ""
     DUNE_SYS_HAS___SYNC_SUB_AND_FETCH)
 
+  dune_test_function(__sync_bool_compare_and_swap
+    "bool"
+    "long long*;long long;long long"
+    ""
+    DUNE_SYS_HAS___SYNC_BOOL_COMPARE_AND_SWAP)
+
+  dune_test_function(__sync_synchronize
+    "void"
+    ""
+    ""
+    DUNE_SYS_HAS___SYNC_SYNCHRONIZE)
+
   dune_test_function(fork
     "pid_t"
     ""
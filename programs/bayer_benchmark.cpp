@@ -0,0 +1,135 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+//! Benchmark configuration.
+struct BenchmarkSetup
+{
+  //! Image width.
+  int width;
+  //! Image height.
+  int height;
+  //! Number of iterations per measurement.
+  unsigned iterations;
+  //! Bayer mosaic.
+  std::vector<uint8_t> bayer;
+  //! Output buffer (large enough for RGB24).
+  std::vector<uint8_t> output;
+};
+
+//! Measure decoding throughput.
+//! @param[in] setup benchmark configuration.
+//! @param[in] decoder configured decoder.
+//! @param[in] yuv true to decode to YUV 4:2:0, false for RGB24.
+//! @return throughput in megapixels per second.
+static double
+measure(BenchmarkSetup& setup, Media::BayerDecoder& decoder, bool yuv)
+{
+  int w = setup.width;
+  int h = setup.height;
+  int cs = ((w + 1) / 2) * ((h + 1) / 2);
+  uint8_t* out = &setup.output[0];
+
+  double start = Clock::get();
+  for (unsigned i = 0; i < setup.iterations; ++i)
+  {
+    if (yuv)
+      decoder.decodeToYUV420(&setup.bayer[0], out, out + w * h, out + w * h + cs, w, h);
+    else
+      decoder.decodeToRGB24(&setup.bayer[0], out, w, h);
+  }
+  double elapsed = Clock::get() - start;
+
+  return (double)w * h * setup.iterations / elapsed / 1e6;
+}
+
+int
+main(int argc, char** argv)
+{
+  BenchmarkSetup setup;
+  setup.width = (argc > 1) ? std::atoi(argv[1]) : 1600;
+  setup.height = (argc > 2) ? std::atoi(argv[2]) : 1200;
+  setup.iterations = (argc > 3) ? std::atoi(argv[3]) : 20;
+  unsigned threads = (argc > 4) ? std::atoi(argv[4]) : 4;
+
+  if (setup.width < 8 || setup.height < 8 || setup.iterations == 0 || threads == 0)
+  {
+    std::fprintf(stderr, "Usage: %s [width] [height] [iterations] [threads]\n", argv[0]);
+    return 1;
+  }
+
+  setup.bayer.resize(setup.width * setup.height);
+  setup.output.resize(setup.width * setup.height * 3);
+  for (size_t i = 0; i < setup.bayer.size(); ++i)
+    setup.bayer[i] = (uint8_t)((i * 2654435761U) >> 24);
+
+  const Media::BayerDecoder::Method methods[] =
+  {
+    Media::BayerDecoder::METHOD_NEAREST,
+    Media::BayerDecoder::METHOD_BILINEAR,
+    Media::BayerDecoder::METHOD_HQLINEAR
+  };
+
+  const char* names[] = {"nearest", "bilinear", "hqlinear"};
+
+  std::printf("%dx%d, %u iterations, SIMD: %s\n", setup.width, setup.height,
+              setup.iterations, Media::BayerDecoder::hasSIMD() ? "yes" : "no");
+  std::printf("%-10s %-8s %10s %10s %10s\n", "method", "output", "scalar",
+              "vector", String::str("%u threads", threads).c_str());
+
+  for (unsigned m = 0; m < 3; ++m)
+  {
+    Media::BayerDecoder decoder(Media::BayerDecoder::TILE_GBRG, methods[m]);
+
+    for (unsigned yuv = 0; yuv < 2; ++yuv)
+    {
+      decoder.setThreads(1);
+      decoder.setVectorized(false);
+      double scalar = measure(setup, decoder, yuv != 0);
+      decoder.setVectorized(true);
+      double vector = measure(setup, decoder, yuv != 0);
+      decoder.setThreads(threads);
+      double threaded = measure(setup, decoder, yuv != 0);
+
+      std::printf("%-10s %-8s %8.1f MP/s %8.1f MP/s %8.1f MP/s\n", names[m],
+                  yuv ? "YUV420" : "RGB24", scalar, vector, threaded);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,119 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+int
+main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr, "Usage: %s <fps> [encoders] [seconds] [width] [height] [folder]\n", argv[0]);
+    std::fprintf(stderr, "  Use 0 fps to capture as fast as possible.\n");
+    return 1;
+  }
+
+  double fps = std::atof(argv[1]);
+  unsigned encoders = (argc > 2) ? std::atoi(argv[2]) : 2;
+  double duration = (argc > 3) ? std::atof(argv[3]) : 10.0;
+  unsigned width = (argc > 4) ? std::atoi(argv[4]) : 1600;
+  unsigned height = (argc > 5) ? std::atoi(argv[5]) : 1200;
+  Path folder = (argc > 6) ? Path(argv[6]) : Path();
+
+  if (!folder.empty())
+    folder.create();
+
+  // Synthetic source: a precomputed Bayer mosaic copied into each
+  // frame, standing in for the sensor DMA.
+  std::vector<uint8_t> mosaic(width * height);
+  for (size_t i = 0; i < mosaic.size(); ++i)
+    mosaic[i] = (uint8_t)((i * 2654435761U) >> 24);
+
+  FramePool pool(encoders * 4, width * height);
+  FramePipeline pipeline(pool, encoders);
+  pipeline.setQuality(80);
+  pipeline.start();
+
+  double start = Clock::get();
+  double next = start;
+  unsigned captured = 0;
+
+  while (Clock::get() - start < duration)
+  {
+    if (fps > 0)
+    {
+      double delay = next - Clock::get();
+      if (delay > 0)
+        Delay::wait(delay);
+      next += 1.0 / fps;
+    }
+    else if (pool.getAvailable() == 0)
+    {
+      // Free running: wait for the pipeline instead of dropping.
+      Delay::wait(0.001);
+      continue;
+    }
+
+    ImageFrame* frame = pipeline.acquire();
+    if (frame == NULL)
+      continue;
+
+    std::memcpy(frame->getData(), &mosaic[0], mosaic.size());
+    frame->setImage(width, height, ImageFrame::FMT_BAYER_GBRG);
+    frame->setTimeStamp(Clock::getSinceEpoch());
+    frame->getExif().setTime(frame->getTimeStamp());
+    frame->getExif().setPosition(Angles::radians(41.18), Angles::radians(-8.70), 0);
+    if (!folder.empty())
+      frame->setPath((folder / String::str("%06u.jpg", captured)).c_str());
+
+    pipeline.submit(frame);
+    ++captured;
+  }
+
+  pipeline.flush(30.0);
+  FramePipeline::Statistics stats = pipeline.getStatistics();
+  double elapsed = Clock::get() - start;
+
+  std::printf("%ux%u, %u encoders, %.1f s\n", width, height, encoders, elapsed);
+  std::printf("captured: %u, dropped: %u, completed: %u, failed: %u\n",
+              stats.submitted, stats.dropped, stats.completed, stats.failed);
+  std::printf("sustained: %.2f fps, %.2f MB/s\n", stats.completed / elapsed,
+              stats.bytes / elapsed / 1e6);
+
+  return 0;
+}
@@ -233,9 +233,9 @@ class Message:
             f.body('value = static_cast<{0}>(val);'.format(value.get('type')))
             public.append(f)
 
-        # fieldsToJSON()
+        # writeJSONFields()
         if self.has_fields():
-            f = Function('fieldsToJSON', 'void', [Var('os__', 'std::ostream&'), Var('nindent__', 'unsigned')], const = True)
+            f = Function('writeJSONFields', 'void', [Var('w__', 'JSONWriter&')], const = True)
             f.add_body(self.fields_to_json())
             public.append(f)
 
@@ -318,9 +318,9 @@ class Message:
         lines = []
         for field in self._node.findall('field'):
             if field.get('type').startswith('message'):
-                lines.append('{0}.toJSON(os__, "{0}", nindent__);'.format(get_name(field)))
+                lines.append('{0}.toJSON(w__, "{0}");'.format(get_name(field)))
             else:
-                lines.append('IMC::toJSON(os__, "{0}", {0}, nindent__);'.format(get_name(field)))
+                lines.append('w__.field("{0}", {0});'.format(get_name(field)))
         return '\n'.join(lines)
 
     def validate(field):
@@ -538,7 +538,7 @@ hpp.add_isoc_headers('ostream', 'string', 'vector')
 hpp.add_dune_headers('Config.hpp', 'IMC/Message.hpp',
                      'IMC/InlineMessage.hpp', 'IMC/MessageList.hpp',
                      'IMC/Enumerations.hpp', 'IMC/Bitfields.hpp',
-                     'IMC/SuperTypes.hpp', 'IMC/JSON.hpp')
+                     'IMC/SuperTypes.hpp', 'IMC/JSONWriter.hpp')
 
 ################################################################################
 # Definitions.cpp                                                              #
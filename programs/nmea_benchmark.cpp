@@ -0,0 +1,263 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+//! Number of heap allocations.
+static size_t s_allocations = 0;
+
+void*
+operator new(size_t size)
+{
+  ++s_allocations;
+  void* ptr = std::malloc(size ? size : 1);
+  if (ptr == NULL)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete(void* ptr, size_t) noexcept
+{
+  std::free(ptr);
+}
+
+//! Load sentences from a text file or a device capture file.
+static void
+loadSentences(const char* path, std::vector<std::string>& lines)
+{
+  std::string data;
+
+  try
+  {
+    IO::CaptureReader reader(path);
+    IO::CaptureRecord rec;
+    while (reader.read(rec))
+    {
+      if (rec.direction == IO::CaptureRecord::DIR_INPUT && !rec.data.empty())
+        data.append((const char*)&rec.data[0], rec.data.size());
+    }
+  }
+  catch (std::exception&)
+  {
+    std::ifstream ifs(path, std::ios::binary);
+    data.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+  }
+
+  std::vector<std::string> parts;
+  String::split(data, "\n", parts);
+  for (size_t i = 0; i < parts.size(); ++i)
+  {
+    if (parts[i].find_first_of("$!") != std::string::npos)
+      lines.push_back(parts[i]);
+  }
+}
+
+//! Append a checksum to a sentence.
+static std::string
+seal(const std::string& body)
+{
+  uint8_t csum = 0;
+  for (size_t i = 1; i < body.size(); ++i)
+    csum ^= body[i];
+
+  return body + String::str("*%02X\r\n", csum);
+}
+
+//! Create a synthetic stream from a 10 Hz receiver.
+static void
+createSentences(std::vector<std::string>& lines)
+{
+  for (unsigned i = 0; i < 2000; ++i)
+  {
+    unsigned s = i / 10;
+    double lat = 4107.0 + i * 1e-4;
+    double lon = 841.0 + i * 1e-4;
+
+    lines.push_back(seal(String::str("$GPGGA,12%02u%02u.%u0,%011.6f,N,%012.6f,W,1,%02u,0.9,45.4,M,50.1,M,,",
+                                     s / 60 % 60, s % 60, i % 10, lat, lon, 5 + i % 7)));
+    lines.push_back(seal(String::str("$GPVTG,%0.2f,T,,M,%0.3f,N,%0.3f,K,A", i * 0.1, 1.2, 2.2)));
+    lines.push_back(seal(String::str("$GPHDT,%0.2f,T", i * 0.17)));
+    if (i % 10 == 0)
+      lines.push_back(seal(String::str("$GPZDA,12%02u%02u.00,18,10,2026,00,00", s / 60 % 60, s % 60)));
+  }
+}
+
+//! Parse sentences the way drivers used to: split into strings and
+//! convert with lexical casts.
+static double
+parseLegacy(const std::vector<std::string>& lines)
+{
+  double sum = 0;
+
+  for (size_t n = 0; n < lines.size(); ++n)
+  {
+    const std::string& line = lines[n];
+    size_t sidx = line.find('$');
+    size_t eidx = line.rfind('*');
+    if (sidx == std::string::npos || eidx == std::string::npos || sidx >= eidx)
+      continue;
+
+    uint8_t ccsum = 0;
+    for (size_t i = sidx + 1; i < eidx; ++i)
+      ccsum ^= line[i];
+
+    unsigned rcsum = 0;
+    if (std::sscanf(&line[0] + eidx + 1, "%02X", &rcsum) != 1 || ccsum != rcsum)
+      continue;
+
+    std::vector<std::string> parts;
+    String::split(line.substr(sidx + 1, eidx - sidx - 1), ",", parts);
+
+    if (String::endsWith(parts[0], "GGA") && parts.size() >= 15)
+    {
+      int deg = 0;
+      double min = 0;
+      double height = 0;
+      unsigned sats = 0;
+      if (std::sscanf(parts[2].c_str(), "%02d%lf", &deg, &min) == 2)
+        sum += deg + min / 60.0;
+      if (std::sscanf(parts[4].c_str(), "%03d%lf", &deg, &min) == 2)
+        sum += deg + min / 60.0;
+      if (castLexical(parts[9], height))
+        sum += height;
+      // Leading zeros would be taken as an octal prefix.
+      size_t zeros = parts[7].find_first_not_of('0');
+      if (zeros != std::string::npos && castLexical(parts[7].substr(zeros), sats))
+        sum += sats;
+    }
+    else if (parts.size() >= 3)
+    {
+      double value = 0;
+      if (castLexical(parts[1], value))
+        sum += value;
+    }
+  }
+
+  return sum;
+}
+
+//! Parse sentences with the in-place tokenizer.
+static double
+parseTokenizer(const std::vector<std::string>& lines)
+{
+  NMEATokenizer stn;
+  double sum = 0;
+
+  for (size_t n = 0; n < lines.size(); ++n)
+  {
+    if (stn.parse(lines[n]) != NMEATokenizer::NMEA_OK)
+      continue;
+
+    if (stn.matches(0, "??GGA") && stn.getFieldCount() >= 15)
+    {
+      double value = 0;
+      unsigned sats = 0;
+      if (stn.readLatitude(2, value))
+        sum += value;
+      if (stn.readLongitude(4, value))
+        sum += -value;
+      if (stn.readNumber(9, value))
+        sum += value;
+      if (stn.readDecimal(7, sats))
+        sum += sats;
+    }
+    else if (stn.getFieldCount() >= 3)
+    {
+      double value = 0;
+      if (stn.readNumber(1, value))
+        sum += value;
+    }
+  }
+
+  return sum;
+}
+
+//! Time a parser.
+static void
+run(const char* name, double (*parser)(const std::vector<std::string>&),
+    const std::vector<std::string>& lines, unsigned passes)
+{
+  size_t allocations = s_allocations;
+  double sum = 0;
+  double start = Clock::get();
+
+  for (unsigned i = 0; i < passes; ++i)
+    sum += parser(lines);
+
+  double elapsed = Clock::get() - start;
+  double count = (double)lines.size() * passes;
+
+  std::printf("%-10s %10.0f sentences/s %8.1f ns/sentence %6.2f allocations/sentence (checksum %0.3f)\n",
+              name, count / elapsed, elapsed * 1e9 / count,
+              (s_allocations - allocations) / count, sum / passes);
+}
+
+int
+main(int argc, char** argv)
+{
+  std::vector<std::string> lines;
+
+  if (argc > 1)
+    loadSentences(argv[1], lines);
+  else
+    createSentences(lines);
+
+  if (lines.empty())
+  {
+    std::fprintf(stderr, "Usage: %s [NMEA text file | device capture file] [passes]\n", argv[0]);
+    return 1;
+  }
+
+  unsigned passes = (argc > 2) ? std::atoi(argv[2]) : 50;
+  std::printf("%u sentences, %u passes\n", (unsigned)lines.size(), passes);
+
+  run("legacy", parseLegacy, lines, passes);
+  run("tokenizer", parseTokenizer, lines, passes);
+
+  return 0;
+}
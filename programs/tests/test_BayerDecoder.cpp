@@ -0,0 +1,151 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Compare vectorized and reference output of a decoder.
+//! @param[in] decoder decoder.
+//! @param[in] bayer bayer mosaic.
+//! @param[in] w width.
+//! @param[in] h height.
+//! @return true if both outputs are identical.
+static bool
+compareRGB(Media::BayerDecoder& decoder, const uint8_t* bayer, int w, int h)
+{
+  std::vector<uint8_t> ref(w * h * 3, 0xaa);
+  std::vector<uint8_t> vec(w * h * 3, 0x55);
+
+  decoder.setVectorized(false);
+  decoder.decodeToRGB24(bayer, &ref[0], w, h);
+  decoder.setVectorized(true);
+  decoder.decodeToRGB24(bayer, &vec[0], w, h);
+
+  return ref == vec;
+}
+
+//! Compare vectorized and reference YUV 4:2:0 output of a decoder.
+static bool
+compareYUV(Media::BayerDecoder& decoder, const uint8_t* bayer, int w, int h)
+{
+  int cs = ((w + 1) / 2) * ((h + 1) / 2);
+  std::vector<uint8_t> ref(w * h + 2 * cs, 0xaa);
+  std::vector<uint8_t> vec(w * h + 2 * cs, 0x55);
+
+  decoder.setVectorized(false);
+  decoder.decodeToYUV420(bayer, &ref[0], &ref[w * h], &ref[w * h + cs], w, h);
+  decoder.setVectorized(true);
+  decoder.decodeToYUV420(bayer, &vec[0], &vec[w * h], &vec[w * h + cs], w, h);
+
+  return ref == vec;
+}
+
+int
+main(void)
+{
+  Test test("Media::BayerDecoder");
+
+  const Media::BayerDecoder::Tile tiles[] =
+  {
+    Media::BayerDecoder::TILE_GBRG,
+    Media::BayerDecoder::TILE_GRBG,
+    Media::BayerDecoder::TILE_RGGB,
+    Media::BayerDecoder::TILE_BGGR
+  };
+
+  const Media::BayerDecoder::Method methods[] =
+  {
+    Media::BayerDecoder::METHOD_NEAREST,
+    Media::BayerDecoder::METHOD_BILINEAR,
+    Media::BayerDecoder::METHOD_HQLINEAR
+  };
+
+  const char* names[] = {"nearest", "bilinear", "hqlinear"};
+
+  // Even and odd sizes, with widths that do and do not fill vectors.
+  const int sizes[][2] = {{64, 48}, {37, 23}, {8, 8}, {161, 120}};
+
+  std::vector<uint8_t> bayer(161 * 120);
+  Math::Random::Generator* prng = Math::Random::Factory::create(Math::Random::Factory::c_default, 1);
+  for (size_t i = 0; i < bayer.size(); ++i)
+    bayer[i] = prng->random() & 0xff;
+  delete prng;
+
+  for (unsigned m = 0; m < 3; ++m)
+  {
+    bool rgb = true;
+    bool yuv = true;
+
+    for (unsigned t = 0; t < 4; ++t)
+    {
+      Media::BayerDecoder decoder(tiles[t], methods[m]);
+
+      for (unsigned s = 0; s < 4; ++s)
+      {
+        rgb = rgb && compareRGB(decoder, &bayer[0], sizes[s][0], sizes[s][1]);
+        yuv = yuv && compareYUV(decoder, &bayer[0], sizes[s][0], sizes[s][1]);
+      }
+    }
+
+    test.boolean(String::str("%s RGB24 matches reference", names[m]).c_str(), rgb);
+    test.boolean(String::str("%s YUV420 matches reference", names[m]).c_str(), yuv);
+  }
+
+  {
+    Media::BayerDecoder decoder(Media::BayerDecoder::TILE_GBRG,
+                                Media::BayerDecoder::METHOD_HQLINEAR);
+    decoder.setThreads(4);
+    test.boolean("threaded RGB24 matches reference", compareRGB(decoder, &bayer[0], 161, 120)
+                 && compareRGB(decoder, &bayer[0], 37, 23));
+    test.boolean("threaded YUV420 matches reference", compareYUV(decoder, &bayer[0], 161, 120)
+                 && compareYUV(decoder, &bayer[0], 37, 23));
+  }
+
+  {
+    // Flat gray mosaic must decode to neutral chroma.
+    std::vector<uint8_t> gray(32 * 16, 100);
+    std::vector<uint8_t> yuv(32 * 16 + 2 * 16 * 8);
+    Media::BayerDecoder decoder(Media::BayerDecoder::TILE_RGGB,
+                                Media::BayerDecoder::METHOD_NEAREST);
+    decoder.decodeToYUV420(&gray[0], &yuv[0], &yuv[32 * 16], &yuv[32 * 16 + 16 * 8], 32, 16);
+    test.boolean("gray mosaic has neutral chroma", yuv[0] == 100 && yuv[32 * 16] == 128
+                 && yuv[32 * 16 + 16 * 8] == 128);
+  }
+
+  return test.getReturnValue();
+}
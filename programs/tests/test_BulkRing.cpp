@@ -0,0 +1,91 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Concurrency/BulkRing.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE::Concurrency;
+
+int
+main(void)
+{
+  Test test("Concurrency::BulkRing");
+
+  BulkRing ring("test-bulk-ring", 4096);
+  std::vector<char> payload(1000);
+  std::vector<char> data;
+  BulkRing::Handle first;
+  BulkRing::Handle handle;
+
+  for (unsigned i = 0; i < payload.size(); ++i)
+    payload[i] = (char)i;
+
+  test.boolean("write()", ring.write(&payload[0], payload.size(), first));
+  test.boolean("fetch()", BulkRing::fetch(first, data) && data == payload);
+
+  std::vector<char> encoded;
+  BulkRing::encode(first, encoded);
+  test.boolean("encode() / decode()", BulkRing::decode(encoded, handle)
+               && handle.ring == first.ring
+               && handle.size == first.size
+               && handle.position == first.position);
+  test.boolean("decode() rejects payloads", !BulkRing::decode(payload, handle));
+  test.boolean("write() rejects large payloads",
+               !ring.write(&payload[0], 3000, handle));
+
+  // Pinned payloads are never overwritten.
+  {
+    BulkRing::Access access(first);
+    bool rejected = false;
+    for (unsigned i = 0; i < 8 && !rejected; ++i)
+      rejected = !ring.write(&payload[0], payload.size(), handle);
+
+    test.boolean("write() respects pins", rejected && access.isValid()
+                 && std::memcmp(access.getData(), &payload[0], payload.size()) == 0);
+  }
+
+  // Unpinned payloads are overwritten when the ring wraps.
+  for (unsigned i = 0; i < 8; ++i)
+    ring.write(&payload[0], payload.size(), handle);
+
+  test.boolean("fetch() detects overwritten payloads", !BulkRing::fetch(first, data));
+  test.boolean("fetch() latest", BulkRing::fetch(handle, data) && data == payload);
+
+  handle.ring = 0;
+  test.boolean("fetch() unknown ring", !BulkRing::fetch(handle, data));
+
+  return test.getReturnValue();
+}
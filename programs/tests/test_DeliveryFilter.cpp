@@ -0,0 +1,130 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Task that counts consumed messages.
+class CountingTask: public Tasks::Task
+{
+public:
+  unsigned count;
+
+  CountingTask(Tasks::Context& ctx, const IMC::DeliveryFilter& filter):
+    Tasks::Task("CountingTask", ctx),
+    count(0)
+  {
+    bind<IMC::EstimatedState>(this, filter);
+  }
+
+  void
+  consume(const IMC::EstimatedState* msg)
+  {
+    (void)msg;
+    ++count;
+  }
+
+  void
+  poll(void)
+  {
+    waitForMessages(0.0);
+  }
+
+  void
+  onMain(void)
+  { }
+};
+
+static IMC::EstimatedState
+makeState(uint16_t src, uint8_t src_ent, uint16_t dst)
+{
+  IMC::EstimatedState msg;
+  msg.setSource(src);
+  msg.setSourceEntity(src_ent);
+  msg.setDestination(dst);
+  return msg;
+}
+
+int
+main(void)
+{
+  Test test("IMC::DeliveryFilter");
+
+  IMC::EstimatedState a = makeState(0x10, 3, 0xFFFF);
+  IMC::EstimatedState b = makeState(0x20, 4, 0x30);
+
+  test.boolean("empty filter", IMC::DeliveryFilter().isEmpty()
+               && IMC::DeliveryFilter().matches(&a) && IMC::DeliveryFilter().matches(&b));
+
+  IMC::DeliveryFilter sources = IMC::DeliveryFilter().source(0x20).source(0x05);
+  test.boolean("source systems", !sources.matches(&a) && sources.matches(&b));
+
+  IMC::DeliveryFilter entities = IMC::DeliveryFilter().sourceEntity(3);
+  test.boolean("source entities", entities.matches(&a) && !entities.matches(&b));
+
+  IMC::DeliveryFilter dst = IMC::DeliveryFilter().destination(0x31);
+  test.boolean("destination", dst.matches(&a) && !dst.matches(&b));
+
+  IMC::DeliveryFilter local = IMC::DeliveryFilter().localOnly();
+  local.setLocalSystem(0x10);
+  test.boolean("local only", local.isLocalOnly() && local.matches(&a) && !local.matches(&b));
+
+  IMC::DeliveryFilter all = IMC::DeliveryFilter().source(0x20).sourceEntity(3);
+  test.boolean("all criteria must match", !all.matches(&a) && !all.matches(&b));
+
+  {
+    Tasks::Context ctx;
+    ctx.resolver.id(0x10);
+
+    CountingTask filtered(ctx, IMC::DeliveryFilter().localOnly());
+    CountingTask plain(ctx, IMC::DeliveryFilter());
+
+    for (unsigned i = 0; i < 10; ++i)
+    {
+      ctx.mbus.dispatch(&a);
+      ctx.mbus.dispatch(&b);
+    }
+
+    filtered.poll();
+    plain.poll();
+
+    test.boolean("bus applies filter", filtered.count == 10 && plain.count == 20);
+    test.boolean("bus counts avoided deliveries",
+                 ctx.mbus.getFilteredCount(&filtered) == 10
+                 && ctx.mbus.getFilteredCount(&plain) == 0
+                 && ctx.mbus.getFilteredCount() == 10);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,291 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Capture file used by the tests.
+static const char* c_file = "test_DeviceReplay.cap";
+
+//! In-memory device echoing written data back.
+class EchoHandle: public IO::Handle
+{
+private:
+  std::vector<uint8_t> m_data;
+
+  IO::NativeHandle
+  doGetNative(void) const
+  {
+    return 0;
+  }
+
+  size_t
+  doWrite(const uint8_t* data, size_t data_size)
+  {
+    m_data.insert(m_data.end(), data, data + data_size);
+    return data_size;
+  }
+
+  size_t
+  doRead(uint8_t* data, size_t data_size)
+  {
+    size_t rv = std::min(data_size, m_data.size());
+    std::copy(m_data.begin(), m_data.begin() + rv, data);
+    m_data.erase(m_data.begin(), m_data.begin() + rv);
+    return rv;
+  }
+
+  void
+  doFlushInput(void)
+  {
+    m_data.clear();
+  }
+};
+
+//! Create a capture with input chunks spaced in time, interleaved
+//! with output chunks that must not be replayed.
+//! @param[in] chunks number of input chunks.
+//! @param[in] period time between input chunks.
+//! @return expected replayed data.
+static std::string
+createCapture(unsigned chunks, double period)
+{
+  std::string expected;
+  IO::CaptureWriter writer(c_file);
+
+  for (unsigned i = 0; i < chunks; ++i)
+  {
+    std::string in = String::str("$GPZDA,%u*00\r\n", i);
+    std::string out = String::str("query %u\r\n", i);
+
+    writer.write(IO::CaptureRecord::DIR_OUTPUT, (const uint8_t*)out.data(), out.size());
+    writer.write(IO::CaptureRecord::DIR_INPUT, (const uint8_t*)in.data(), in.size());
+    expected += in;
+
+    if (period > 0 && i + 1 < chunks)
+      Time::Delay::wait(period);
+  }
+
+  return expected;
+}
+
+//! Read from a handle until a number of bytes is received.
+//! @param[in] handle I/O handle.
+//! @param[in] size number of bytes.
+//! @param[in] timeout maximum time to wait.
+//! @return received data.
+static std::string
+receive(IO::Handle& handle, size_t size, double timeout)
+{
+  std::string data;
+  uint8_t bfr[256];
+  double deadline = Time::Clock::get() + timeout;
+
+  while (data.size() < size && Time::Clock::get() < deadline)
+  {
+    if (!IO::Poll::poll(handle, 0.1))
+      continue;
+
+    size_t rv = handle.read(bfr, sizeof(bfr));
+    data.append((const char*)bfr, rv);
+  }
+
+  return data;
+}
+
+int
+main(void)
+{
+  Test test("DeviceReplay");
+
+  {
+    std::string expected = createCapture(3, 0.0);
+
+    IO::CaptureReader reader(c_file);
+    IO::CaptureRecord rec;
+    std::string in;
+    unsigned outputs = 0;
+    double last = 0;
+    bool ordered = true;
+
+    while (reader.read(rec))
+    {
+      if (rec.time < last)
+        ordered = false;
+      last = rec.time;
+
+      if (rec.direction == IO::CaptureRecord::DIR_INPUT)
+        in.append((const char*)&rec.data[0], rec.data.size());
+      else
+        ++outputs;
+    }
+
+    test.boolean("capture input round trip", in == expected);
+    test.boolean("capture output records", outputs == 3);
+    test.boolean("capture times ordered", ordered && last > 0);
+
+    // Truncated trailing record is ignored.
+    std::FILE* f = std::fopen(c_file, "ab");
+    std::fwrite("\x00\x01\x02", 1, 3, f);
+    std::fclose(f);
+
+    unsigned count = 0;
+    reader.rewind();
+    while (reader.read(rec))
+      ++count;
+    test.boolean("capture ignores truncated record", count == 6);
+  }
+
+  {
+    std::FILE* f = std::fopen(c_file, "wb");
+    std::fputs("$GPGGA,,,,,,0,,,,,,,,*66\r\n", f);
+    std::fclose(f);
+
+    bool rejected = false;
+    try
+    {
+      IO::CaptureReader reader(c_file);
+    }
+    catch (std::exception&)
+    {
+      rejected = true;
+    }
+
+    test.boolean("capture rejects foreign files", rejected);
+  }
+
+  {
+    IO::RecordingHandle* handle = new IO::RecordingHandle(new EchoHandle, c_file);
+    uint8_t bfr[16];
+    handle->write((const uint8_t*)"ping", 4);
+    size_t rv = handle->read(bfr, sizeof(bfr));
+
+    test.boolean("recording handle forwards data", rv == 4 && std::memcmp(bfr, "ping", 4) == 0);
+    test.boolean("recording handle counts output",
+                 handle->getBytes(IO::CaptureRecord::DIR_OUTPUT) == 4);
+    test.boolean("recording handle counts input",
+                 handle->getBytes(IO::CaptureRecord::DIR_INPUT) == 4);
+    delete handle;
+
+    IO::CaptureReader reader(c_file);
+    IO::CaptureRecord rec;
+    bool first = reader.read(rec) && rec.direction == IO::CaptureRecord::DIR_OUTPUT;
+    bool second = reader.read(rec) && rec.direction == IO::CaptureRecord::DIR_INPUT;
+    test.boolean("recording handle writes capture", first && second && !reader.read(rec));
+  }
+
+  {
+    std::string expected = createCapture(200, 0.0);
+
+    Hardware::DeviceReplay replay(c_file, 0);
+    uint16_t port = replay.listenTCP();
+
+    Network::TCPSocket sock;
+    sock.connect(Network::Address::Loopback, port);
+    replay.start();
+
+    std::string data = receive(sock, expected.size(), 5.0);
+    test.boolean("TCP replay at maximum speed", data == expected);
+
+    // Data written by the client is discarded.
+    sock.write((const uint8_t*)"ignored", 7);
+
+    double deadline = Time::Clock::get() + 2.0;
+    while (!replay.isFinished() && Time::Clock::get() < deadline)
+      Time::Delay::wait(0.01);
+
+    test.boolean("TCP replay finished", replay.isFinished());
+    test.boolean("TCP replay byte count", replay.getBytes() == expected.size());
+  }
+
+#if defined(DUNE_SYS_HAS_POSIX_OPENPT)
+  {
+    std::string expected = createCapture(200, 0.0);
+
+    Hardware::DeviceReplay replay(c_file, 0);
+    Hardware::SerialPort uart(replay.openTerminal(), 115200);
+    replay.start();
+
+    std::string data = receive(uart, expected.size(), 5.0);
+    test.boolean("terminal replay at maximum speed", data == expected);
+  }
+#endif
+
+  {
+    std::string expected = createCapture(3, 0.1);
+
+    Hardware::DeviceReplay replay(c_file, 1.0);
+    uint16_t port = replay.listenTCP();
+
+    Network::TCPSocket sock;
+    sock.connect(Network::Address::Loopback, port);
+    replay.start();
+
+    std::string data = receive(sock, expected.size(), 5.0);
+    Time::Delay::wait(0.05);
+
+    test.boolean("real time replay data", data == expected);
+    test.boolean("real time replay timing",
+                 replay.getElapsed() > 0.18 && replay.getElapsed() < 0.5);
+  }
+
+  {
+    createCapture(3, 0.1);
+
+    Hardware::DeviceReplay replay(c_file, 4.0);
+    uint16_t port = replay.listenTCP();
+
+    Network::TCPSocket sock;
+    sock.connect(Network::Address::Loopback, port);
+    replay.start();
+
+    receive(sock, 1, 5.0);
+    double deadline = Time::Clock::get() + 2.0;
+    while (!replay.isFinished() && Time::Clock::get() < deadline)
+      Time::Delay::wait(0.01);
+
+    test.boolean("accelerated replay timing", replay.getElapsed() < 0.15);
+  }
+
+  std::remove(c_file);
+
+  return test.getReturnValue();
+}
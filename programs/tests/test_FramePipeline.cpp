@@ -0,0 +1,155 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Fill frame with a synthetic Bayer pattern.
+static void
+fillFrame(ImageFrame* frame, unsigned w, unsigned h, unsigned seed)
+{
+  frame->setImage(w, h, ImageFrame::FMT_BAYER_GBRG);
+  uint8_t* data = frame->getData();
+  for (unsigned i = 0; i < w * h; ++i)
+    data[i] = (uint8_t)(i * 7 + seed);
+  frame->setTimeStamp(Clock::getSinceEpoch());
+}
+
+//! Read file contents.
+static std::string
+readFile(const Path& path)
+{
+  std::ifstream ifs(path.c_str(), std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+int
+main(void)
+{
+  Test test("Media::FramePipeline");
+
+  {
+    Exif exif;
+    exif.setCamera("LSTS", "Test");
+    exif.setTime(0);
+    exif.setPosition(Angles::radians(41.5), Angles::radians(-8.5), 10.0);
+    std::vector<uint8_t> data;
+    exif.build(data);
+    std::string str(data.begin(), data.end());
+    test.boolean("Exif header", str.compare(0, 10, std::string("Exif\0\0II*\0", 10)) == 0);
+    test.boolean("Exif strings", str.find("LSTS") != std::string::npos
+                 && str.find("1970:01:01 00:00:00") != std::string::npos);
+    test.boolean("Exif GPS references", str.find(std::string("N\0", 2)) != std::string::npos
+                 && str.find(std::string("W\0", 2)) != std::string::npos);
+  }
+
+  {
+    FramePool pool(2, 64);
+    ImageFrame* a = pool.acquire();
+    ImageFrame* b = pool.acquire();
+    ImageFrame* c = pool.acquire();
+    test.boolean("pool exhaustion is counted", a && b && !c && pool.getDropped() == 1);
+    pool.release(a);
+    test.boolean("released frames are reused", pool.acquire() == a);
+  }
+
+  const unsigned w = 64;
+  const unsigned h = 48;
+  Path dir = Path("/tmp") / String::str("dune-frame-pipeline-%u", (unsigned)getpid());
+  dir.create();
+
+  {
+    FramePool pool(3, w * h);
+    FramePipeline pipeline(pool, 2);
+    pipeline.setQuality(80);
+
+    // Not started: frames stay in flight and capture must drop.
+    for (unsigned i = 0; i < 4; ++i)
+    {
+      ImageFrame* frame = pipeline.acquire();
+      if (frame != NULL)
+      {
+        fillFrame(frame, w, h, i);
+        pipeline.submit(frame);
+      }
+    }
+
+    FramePipeline::Statistics stats = pipeline.getStatistics();
+    test.boolean("backpressure drops frames", stats.submitted == 3 && stats.dropped == 1);
+
+    pipeline.start();
+    test.boolean("queued frames are flushed", pipeline.flush(5.0));
+
+    unsigned written = 0;
+    while (written < 20)
+    {
+      ImageFrame* frame = pipeline.acquire();
+      if (frame == NULL)
+      {
+        Delay::wait(0.001);
+        continue;
+      }
+
+      fillFrame(frame, w, h, written);
+      frame->setPath((dir / String::str("%u.jpg", written)).c_str());
+      frame->getExif().setComment("synthetic");
+      pipeline.submit(frame);
+      ++written;
+    }
+
+    test.boolean("all frames complete", pipeline.flush(10.0));
+    stats = pipeline.getStatistics();
+    test.boolean("statistics are consistent", stats.submitted == 23 && stats.completed == 23
+                 && stats.encoded == 23 && stats.failed == 0 && stats.fps > 0);
+    test.boolean("frames return to pool", pool.getAvailable() == 3);
+    test.boolean("mean luma is reported", pipeline.getMeanLuma() >= 0);
+
+    std::string jpg = readFile(dir / "19.jpg");
+    test.boolean("image is a JPEG", jpg.size() > 4 && (uint8_t)jpg[0] == 0xff
+                 && (uint8_t)jpg[1] == 0xd8);
+    test.boolean("image carries Exif", jpg.size() > 10 && (uint8_t)jpg[3] == 0xe1
+                 && jpg.compare(6, 4, "Exif") == 0 && jpg.find("synthetic") != std::string::npos);
+    test.boolean("bytes are accounted", stats.bytes > 20 * jpg.size() / 2);
+  }
+
+  dir.remove(Path::MODE_RECURSIVE);
+
+  return test.getReturnValue();
+}
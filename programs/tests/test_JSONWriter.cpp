@@ -0,0 +1,184 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/IMC/Definitions.hpp>
+#include <DUNE/IMC/JSONWriter.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Get the text of a field value.
+static std::string
+value(const std::string& json, const char* label)
+{
+  std::string key = std::string("\"") + label + "\": \"";
+  size_t begin = json.find(key);
+  if (begin == std::string::npos)
+    return "";
+
+  begin += key.size();
+  return json.substr(begin, json.find('"', begin) - begin);
+}
+
+int
+main(void)
+{
+  Test test("IMC::JSONWriter");
+
+  // Same text through the stream and buffer interfaces.
+  {
+    IMC::EstimatedState msg;
+    msg.setTimeStamp(1500000000.25);
+    msg.setSource(0x1234);
+    msg.lat = 0.71;
+    msg.depth = 1.5f;
+
+    std::ostringstream os;
+    msg.toJSON(os);
+
+    std::string str;
+    IMC::JSONWriter writer(str);
+    msg.toJSON(writer);
+
+    test.boolean("toJSON(std::ostream&) == toJSON(JSONWriter&)", os.str() == str);
+    test.boolean("header", str.compare(0, 32, "{\n  \"abbrev\": \"EstimatedState\",\n") == 0
+                 && value(str, "timestamp") == "1500000000.25"
+                 && value(str, "src") == "4660");
+    test.boolean("shortest double", value(str, "lat") == "0.71");
+    test.boolean("shortest float", value(str, "depth") == "1.5");
+    test.boolean("layout", str.find(",\n  \"lon\": \"0\"") != std::string::npos
+                 && str.compare(str.size() - 3, 3, "\n}\n") == 0);
+  }
+
+  // Floating point values read back to the same value.
+  {
+    std::srand(1);
+    bool ok = true;
+    std::string str;
+    IMC::JSONWriter writer(str);
+    IMC::EstimatedState msg;
+
+    for (unsigned i = 0; i < 10000 && ok; ++i)
+    {
+      msg.lat = (std::rand() - RAND_MAX / 2) * 1e-9 * std::rand();
+      msg.phi = (float)((double)std::rand() / std::rand());
+
+      str.clear();
+      writer.write(msg);
+      ok = std::strtod(value(str, "lat").c_str(), NULL) == msg.lat
+        && std::strtof(value(str, "phi").c_str(), NULL) == msg.phi;
+    }
+
+    test.boolean("round trip", ok);
+  }
+
+  // Integer limits.
+  {
+    std::string str;
+    IMC::JSONWriter writer(str);
+    writer.field("a", std::numeric_limits<int64_t>::min());
+    writer.field("b", std::numeric_limits<uint64_t>::max());
+    writer.field("c", (int8_t)-128);
+    writer.field("d", (uint8_t)0);
+    test.boolean("integers", value(str, "a") == "-9223372036854775808"
+                 && value(str, "b") == "18446744073709551615"
+                 && value(str, "c") == "-128"
+                 && value(str, "d") == "0");
+  }
+
+  // Strings and raw data.
+  {
+    IMC::LogBookEntry msg;
+    msg.text = "a \"b\" \\ c\nd\te\x01";
+    std::string str;
+    IMC::JSONWriter writer(str);
+    writer.write(msg);
+    test.boolean("escaping", str.find("\"text\": \"a \\\"b\\\" \\\\ c\\nd\\te\\u0001\"") != std::string::npos);
+
+    IMC::DevDataBinary data;
+    data.value.push_back((char)0x0a);
+    data.value.push_back((char)0xff);
+    str.clear();
+    writer.write(data);
+    test.boolean("raw data", value(str, "value") == "0AFF");
+  }
+
+  // Nested messages.
+  {
+    IMC::PlanSpecification spec;
+    spec.plan_id = "p";
+    IMC::PlanManeuver man;
+    man.maneuver_id = "m";
+    spec.maneuvers.push_back(man);
+
+    IMC::PlanControl pc;
+    pc.arg.set(spec);
+
+    std::string str;
+    IMC::JSONWriter writer(str);
+    writer.write(pc);
+    test.boolean("inline message", str.find(",\n  \"arg\": {\n    \"abbrev\": \"PlanSpecification\",\n    \"plan_id\": \"p\"") != std::string::npos);
+    test.boolean("message list", str.find(",\n    \"maneuvers\": [{\n      \"abbrev\": \"PlanManeuver\",\n      \"maneuver_id\": \"m\"") != std::string::npos);
+    test.boolean("null message", str.find("\"data\": \"null\"") != std::string::npos);
+
+    std::ostringstream os;
+    pc.arg.toJSON(os, "arg", 2);
+    test.boolean("InlineMessage::toJSON(std::ostream&)", str.find(os.str()) != std::string::npos);
+  }
+
+  // Field selection.
+  {
+    IMC::EstimatedState msg;
+    std::vector<std::string> fields;
+    fields.push_back("lat");
+    fields.push_back("depth");
+
+    std::string str;
+    IMC::JSONWriter writer(str);
+    writer.select(fields);
+    writer.write(msg);
+    test.boolean("select()", str.find("\"timestamp\"") != std::string::npos
+                 && str.find("\"lat\"") != std::string::npos
+                 && str.find("\"depth\"") != std::string::npos
+                 && str.find("\"lon\"") == std::string::npos);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,119 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+static bool
+near(double a, double b)
+{
+  return std::fabs(a - b) < 1e-9;
+}
+
+int
+main(void)
+{
+  Test test("Time::JitterMonitor");
+
+  {
+    Time::JitterMonitor j;
+    test.boolean("empty monitor", j.getCycles() == 0 && j.getMeanPeriod() == 0
+                 && j.getJitterRMS() == 0 && j.getMeanLatency() == 0);
+  }
+
+  {
+    // Perfect 10 ms loop.
+    Time::JitterMonitor j;
+    for (unsigned i = 0; i < 100; ++i)
+    {
+      double t = 1.0 + i * 0.01;
+      j.update(0.01, t, t, t + 0.002);
+    }
+
+    test.boolean("cycles counted", j.getCycles() == 100);
+    test.boolean("mean period of perfect loop", near(j.getMeanPeriod(), 0.01));
+    test.boolean("no jitter in perfect loop", j.getMaximumJitter() < 1e-9 && j.getJitterRMS() < 1e-9);
+    test.boolean("no latency in perfect loop", j.getMaximumLatency() == 0);
+    test.boolean("execution time", near(j.getMaximumExecution(), 0.002));
+    test.boolean("no deadline misses", j.getDeadlineMisses() == 0);
+  }
+
+  {
+    // One late wake-up that overruns the next release.
+    Time::JitterMonitor j;
+    j.update(0.01, 1.00, 1.000, 1.001);
+    j.update(0.01, 1.01, 1.013, 1.022);
+    j.update(0.01, 1.02, 1.022, 1.023);
+
+    test.boolean("maximum latency", near(j.getMaximumLatency(), 0.003));
+    test.boolean("mean latency", near(j.getMeanLatency(), (0.003 + 0.002) / 3));
+    test.boolean("maximum jitter", near(j.getMaximumJitter(), 0.003));
+    test.boolean("RMS jitter", near(j.getJitterRMS(), std::sqrt((0.003 * 0.003 + 0.001 * 0.001) / 2)));
+    test.boolean("mean period", near(j.getMeanPeriod(), 0.011));
+    test.boolean("deadline miss", j.getDeadlineMisses() == 1);
+    test.boolean("maximum execution", near(j.getMaximumExecution(), 0.009));
+
+    j.reset();
+    test.boolean("reset", j.getCycles() == 0 && j.getDeadlineMisses() == 0
+                 && j.getMaximumJitter() == 0);
+  }
+
+  {
+    // Real loop driven by the system clock.
+    Time::JitterMonitor j;
+    double period = 0.005;
+    double next = Time::Clock::get() + period;
+    for (unsigned i = 0; i < 50; ++i)
+    {
+      double now = Time::Clock::get();
+      if (next > now)
+        Time::Delay::wait(next - now);
+      double scheduled = next;
+      next += period;
+      double start = Time::Clock::get();
+      j.update(period, scheduled, start, Time::Clock::get());
+    }
+
+    test.boolean("clock driven loop period", std::fabs(j.getMeanPeriod() - period) < period * 0.5);
+    test.boolean("clock driven loop latency is positive", j.getMaximumLatency() >= 0);
+  }
+
+  System::Resources::prefaultStack(64 * 1024);
+  test.boolean("stack prefault", true);
+
+  return test.getReturnValue();
+}
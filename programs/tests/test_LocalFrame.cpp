@@ -0,0 +1,174 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Test program for DUNE::Coordinates::LocalFrame.                          *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Coordinates/LocalFrame.hpp>
+#include <DUNE/Coordinates/WGS84.hpp>
+#include <DUNE/Math/Angles.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE::Coordinates;
+using namespace DUNE::Math;
+using DUNE::Time::Clock;
+
+//! Number of points per reference.
+static const size_t c_points = 20000;
+
+//! Reference points (degrees, degrees, meters).
+static const double c_refs[][3] =
+{
+  {41.184, -8.706, 0.0},
+  {-33.9, 151.2, 25.0},
+  {78.2, 15.6, -10.0},
+  {0.0, 0.0, 0.0}
+};
+
+int
+main(void)
+{
+  Test test("DUNE::Coordinates::LocalFrame");
+
+  std::vector<double> lat(c_points), lon(c_points), hae(c_points);
+  std::vector<double> n(c_points), e(c_points), d(c_points);
+  std::vector<double> lat2(c_points), lon2(c_points), hae2(c_points);
+
+  bool to_ok = true;
+  bool from_ok = true;
+  bool batch_ok = true;
+
+  for (size_t r = 0; r < sizeof(c_refs) / sizeof(c_refs[0]); ++r)
+  {
+    double rlat = Angles::radians(c_refs[r][0]);
+    double rlon = Angles::radians(c_refs[r][1]);
+    double rhae = c_refs[r][2];
+    LocalFrame frame(rlat, rlon, rhae);
+
+    for (size_t i = 0; i < c_points; ++i)
+    {
+      n[i] = ((double)(i % 200) - 100.0) * 37.5;
+      e[i] = ((double)(i / 200) - 50.0) * 81.25;
+      d[i] = ((double)(i % 7) - 3.0) * 2.5;
+    }
+
+    for (size_t i = 0; i < c_points; ++i)
+    {
+      double a = rlat;
+      double b = rlon;
+      double h = rhae;
+      WGS84::displace(n[i], e[i], d[i], &a, &b, &h);
+
+      frame.fromNED(n[i], e[i], d[i], &lat[i], &lon[i], &hae[i]);
+      if (a != lat[i] || b != lon[i] || h != hae[i])
+        from_ok = false;
+
+      double x, y, z, x2, y2, z2;
+      WGS84::displacement(rlat, rlon, rhae, a, b, h, &x, &y, &z);
+      frame.toNED(a, b, h, &x2, &y2, &z2);
+      if (x != x2 || y != y2 || z != z2)
+        to_ok = false;
+    }
+
+    frame.fromNED(c_points, &n[0], &e[0], &d[0], &lat2[0], &lon2[0], &hae2[0]);
+    for (size_t i = 0; i < c_points; ++i)
+    {
+      if (lat2[i] != lat[i] || lon2[i] != lon[i] || hae2[i] != hae[i])
+        batch_ok = false;
+    }
+
+    std::vector<double> n2(c_points), e2(c_points), d2(c_points);
+    frame.toNED(c_points, &lat[0], &lon[0], &hae[0], &n2[0], &e2[0], &d2[0]);
+    for (size_t i = 0; i < c_points; ++i)
+    {
+      double x, y, z;
+      WGS84::displacement(rlat, rlon, rhae, lat[i], lon[i], hae[i], &x, &y, &z);
+      if (x != n2[i] || y != e2[i] || z != d2[i])
+        batch_ok = false;
+    }
+  }
+
+  test.boolean("toNED() equals WGS84::displacement()", to_ok);
+  test.boolean("fromNED() equals WGS84::displace()", from_ok);
+  test.boolean("batch conversions equal scalar", batch_ok);
+
+  // Throughput.
+  // Reference is read through volatile storage so that the compiler
+  // cannot hoist its conversion out of the loop, as happens in real
+  // callers that get it from a message or a member variable.
+  volatile double rlat = Angles::radians(c_refs[0][0]);
+  volatile double rlon = Angles::radians(c_refs[0][1]);
+  LocalFrame frame(rlat, rlon);
+  unsigned rounds = 50;
+
+  double t0 = Clock::get();
+  for (unsigned k = 0; k < rounds; ++k)
+  {
+    for (size_t i = 0; i < c_points; ++i)
+      WGS84::displacement((double)rlat, (double)rlon, 0.0, lat[i], lon[i], hae[i], &n[i], &e[i], &d[i]);
+  }
+  double t_wgs84 = Clock::get() - t0;
+
+  t0 = Clock::get();
+  for (unsigned k = 0; k < rounds; ++k)
+    frame.toNED(c_points, &lat[0], &lon[0], &hae[0], &n[0], &e[0], &d[0]);
+  double t_frame = Clock::get() - t0;
+
+  t0 = Clock::get();
+  for (unsigned k = 0; k < rounds; ++k)
+  {
+    for (size_t i = 0; i < c_points; ++i)
+    {
+      lat2[i] = rlat;
+      lon2[i] = rlon;
+      WGS84::displace(n[i], e[i], &lat2[i], &lon2[i]);
+    }
+  }
+  double t_displace = Clock::get() - t0;
+
+  t0 = Clock::get();
+  for (unsigned k = 0; k < rounds; ++k)
+    frame.fromNED(c_points, &n[0], &e[0], NULL, &lat2[0], &lon2[0]);
+  double t_from = Clock::get() - t0;
+
+  double total = (double)rounds * c_points;
+  fprintf(stderr, "  WGS84::displacement: %.0f points/s\n", total / t_wgs84);
+  fprintf(stderr, "  LocalFrame::toNED:   %.0f points/s\n", total / t_frame);
+  fprintf(stderr, "  WGS84::displace:     %.0f points/s\n", total / t_displace);
+  fprintf(stderr, "  LocalFrame::fromNED: %.0f points/s\n", total / t_from);
+
+  return test.getReturnValue();
+}
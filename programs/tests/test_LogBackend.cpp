@@ -0,0 +1,113 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstring>
+#include <cstdarg>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Tasks/LogBackend.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE::Tasks::LogBackend;
+
+//! Format a message directly and through pack()/unpack().
+//! @return true if both results match.
+static bool
+roundTrip(const char* format, ...)
+{
+  char direct[1024];
+  char deferred[1024];
+  char record[LogBackend::c_record_max_size];
+
+  std::va_list ap;
+  va_start(ap, format);
+  std::vsnprintf(direct, sizeof(direct), format, ap);
+  va_end(ap);
+
+  va_start(ap, format);
+  size_t size = LogBackend::pack(record, sizeof(record), format, ap);
+  va_end(ap);
+
+  if (size == 0)
+    return false;
+
+  LogBackend::unpack(record, size, deferred, sizeof(deferred));
+  return std::strcmp(direct, deferred) == 0;
+}
+
+//! Test if a format is rejected by pack().
+static bool
+rejected(const char* format, ...)
+{
+  char record[LogBackend::c_record_max_size];
+
+  std::va_list ap;
+  va_start(ap, format);
+  size_t size = LogBackend::pack(record, sizeof(record), format, ap);
+  va_end(ap);
+
+  return size == 0;
+}
+
+int
+main(void)
+{
+  Test test("Tasks::LogBackend");
+
+  test.boolean("literal", roundTrip("no arguments, 100%% literal"));
+  test.boolean("integers", roundTrip("%d %i %5u %-4x|%X %o %+d", -7, 42, 3u, 255u, 0xbeefu, 8u, 9));
+  test.boolean("length modifiers", roundTrip("%hhd %hu %ld %llu %zu %lld",
+                                             300, 70000, -123456789L,
+                                             18446744073709551615ULL,
+                                             (size_t)12345, -1LL));
+  test.boolean("floating point", roundTrip("%.2f %e %g %10.3f %Lf", 3.14159, 1e-9, 2.5, -0.5,
+                                           (long double)1.25));
+  test.boolean("strings", roundTrip("'%s' '%10s' '%-6s' '%.3s' %c", "abc", "right", "left",
+                                    "truncated", 'z'));
+  test.boolean("null string", roundTrip("%s", (const char*)NULL));
+  test.boolean("star width and precision", roundTrip("%*d|%-*.*f|%.*s", 6, 12, 9, 2, 1.0 / 3.0,
+                                                     2, "xyz"));
+  test.boolean("pointer", roundTrip("%p", (void*)&test));
+
+  std::string large(1500, 'x');
+  test.boolean("large string", roundTrip("%s", large.c_str()));
+  std::string huge(LogBackend::c_record_max_size, 'y');
+  test.boolean("oversized record rejected", rejected("%s %s", huge.c_str(), huge.c_str()));
+  test.boolean("%n rejected", rejected("%d%n", 1, (int*)NULL));
+  test.boolean("incomplete specification rejected", rejected("%l"));
+
+  test.boolean("not running by default", !LogBackend::isRunning());
+
+  return test.getReturnValue();
+}
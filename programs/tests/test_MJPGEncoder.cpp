@@ -0,0 +1,265 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Temporary video file.
+static const char* c_file = "test_MJPGEncoder.avi";
+
+//! Size of frame number i.
+static size_t
+frameSize(unsigned i, size_t base)
+{
+  return base + (i * 7) % 13;
+}
+
+//! Content of frame number i.
+static std::vector<uint8_t>
+frameData(unsigned i, size_t base)
+{
+  std::vector<uint8_t> data(frameSize(i, base));
+  for (size_t j = 0; j < data.size(); ++j)
+    data[j] = (uint8_t)(i + j);
+  return data;
+}
+
+static std::vector<uint8_t>
+readFile(void)
+{
+  std::ifstream ifs(c_file, std::ios::binary);
+  return std::vector<uint8_t>((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+}
+
+static uint32_t
+u32(const std::vector<uint8_t>& f, uint64_t pos)
+{
+  uint32_t v = 0;
+  if (pos + 4 <= f.size())
+    std::memcpy(&v, &f[pos], 4);
+  return v;
+}
+
+static uint64_t
+u64(const std::vector<uint8_t>& f, uint64_t pos)
+{
+  uint64_t v = 0;
+  if (pos + 8 <= f.size())
+    std::memcpy(&v, &f[pos], 8);
+  return v;
+}
+
+static bool
+fourcc(const std::vector<uint8_t>& f, uint64_t pos, const char* id)
+{
+  return pos + 4 <= f.size() && std::memcmp(&f[pos], id, 4) == 0;
+}
+
+static uint64_t
+find(const std::vector<uint8_t>& f, const char* id)
+{
+  for (uint64_t i = 0; i + 4 <= f.size(); ++i)
+  {
+    if (fourcc(f, i, id))
+      return i;
+  }
+
+  return 0;
+}
+
+//! Summary of a parsed file.
+struct Layout
+{
+  //! Number of RIFF segments.
+  unsigned segments;
+  //! Frames in the first segment according to 'avih'.
+  uint32_t riff_frames;
+  //! Frames according to 'dmlh'.
+  uint32_t total_frames;
+  //! Frames referenced by standard indexes.
+  uint32_t indexed_frames;
+  //! Standard indexes.
+  uint32_t indexes;
+  //! Entries of the legacy index.
+  uint32_t idx1_entries;
+  //! True if all indexed frames have the expected content.
+  bool frames_ok;
+  //! True if all RIFF segments fit in the file.
+  bool sizes_ok;
+};
+
+static Layout
+parse(const std::vector<uint8_t>& f, size_t base)
+{
+  Layout l;
+  std::memset(&l, 0, sizeof(l));
+  l.frames_ok = true;
+  l.sizes_ok = true;
+
+  // RIFF segments.
+  uint64_t pos = 0;
+  while (fourcc(f, pos, "RIFF"))
+  {
+    uint32_t size = u32(f, pos + 4);
+    if (!fourcc(f, pos + 8, (l.segments == 0) ? "AVI " : "AVIX"))
+      l.sizes_ok = false;
+    if (pos + 8 + size > f.size())
+      l.sizes_ok = false;
+
+    if (l.segments == 0)
+    {
+      uint64_t idx1 = find(f, "idx1");
+      if (idx1 > 0 && idx1 < pos + 8 + size)
+        l.idx1_entries = u32(f, idx1 + 4) / 16;
+    }
+
+    ++l.segments;
+    pos += 8 + size;
+  }
+
+  uint64_t avih = find(f, "avih");
+  l.riff_frames = u32(f, avih + 8 + 16);
+  uint64_t dmlh = find(f, "dmlh");
+  l.total_frames = u32(f, dmlh + 8);
+
+  // Super index and standard indexes.
+  uint64_t indx = find(f, "indx");
+  l.indexes = u32(f, indx + 12);
+  for (uint32_t i = 0; i < l.indexes; ++i)
+  {
+    uint64_t entry = indx + 32 + i * 16;
+    uint64_t ix = u64(f, entry);
+    uint32_t duration = u32(f, entry + 12);
+    if (!fourcc(f, ix, "ix00") || u32(f, ix + 12) != duration)
+    {
+      l.frames_ok = false;
+      continue;
+    }
+
+    uint64_t ix_base = u64(f, ix + 20);
+    for (uint32_t j = 0; j < duration; ++j)
+    {
+      uint64_t data = ix_base + u32(f, ix + 32 + j * 8);
+      uint32_t size = u32(f, ix + 32 + j * 8 + 4);
+      std::vector<uint8_t> expected = frameData(l.indexed_frames, base);
+
+      if (!fourcc(f, data - 8, "00dc") || u32(f, data - 4) != size
+          || size < expected.size() || data + expected.size() > f.size()
+          || std::memcmp(&f[data], &expected[0], expected.size()) != 0)
+        l.frames_ok = false;
+
+      ++l.indexed_frames;
+    }
+  }
+
+  return l;
+}
+
+static void
+encode(Media::MJPG::Encoder& encoder, unsigned count, size_t base)
+{
+  for (unsigned i = 0; i < count; ++i)
+  {
+    std::vector<uint8_t> data = frameData(encoder.getFrameCount(), base);
+    encoder.encode(&data[0], data.size(), i * 0.1);
+  }
+}
+
+int
+main(void)
+{
+  Test test("Media::MJPG::Encoder");
+
+  {
+    {
+      Media::MJPG::Encoder encoder(c_file, 640, 480, 10);
+      encode(encoder, 50, 1000);
+    }
+
+    Layout l = parse(readFile(), 1000);
+    test.boolean("single segment", l.segments == 1 && l.sizes_ok);
+    test.boolean("frame counts", l.riff_frames == 50 && l.total_frames == 50);
+    test.boolean("standard index", l.indexes == 1 && l.indexed_frames == 50 && l.frames_ok);
+    test.boolean("legacy index", l.idx1_entries == 50);
+  }
+
+  {
+    {
+      Media::MJPG::Encoder encoder(c_file, 640, 480, 10);
+      encoder.setSegmentSize(1024 * 1024);
+      encode(encoder, 300, 16 * 1024);
+      test.boolean("segments reported", encoder.getSegmentCount() == 5);
+    }
+
+    Layout l = parse(readFile(), 16 * 1024);
+    test.boolean("OpenDML segments", l.segments == 5 && l.sizes_ok);
+    test.boolean("first segment frames", l.riff_frames > 0 && l.riff_frames < 300 && l.idx1_entries == l.riff_frames);
+    test.boolean("total frames", l.total_frames == 300);
+    test.boolean("segment indexes", l.indexes == 5 && l.indexed_frames == 300 && l.frames_ok);
+  }
+
+  {
+    {
+      Media::MJPG::Encoder encoder(c_file, 64, 48, 25);
+      encode(encoder, 5000, 64);
+    }
+
+    Layout l = parse(readFile(), 64);
+    test.boolean("full standard index rolls over", l.segments == 1 && l.indexes == 2
+                 && l.indexed_frames == 5000 && l.frames_ok);
+  }
+
+  {
+    Media::MJPG::Encoder encoder(c_file, 640, 480, 10);
+    encoder.setCheckpointInterval(10);
+    encode(encoder, 25, 1000);
+
+    // Inspect the file while it is still being written.
+    Layout l = parse(readFile(), 1000);
+    test.boolean("partial file headers", l.segments == 1 && l.sizes_ok);
+    test.boolean("partial file indexed up to checkpoint", l.total_frames == 20
+                 && l.indexed_frames == 20 && l.frames_ok);
+  }
+
+  std::remove(c_file);
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,152 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/IMC/Definitions.hpp>
+#include <DUNE/IMC/MessagePool.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Thread that creates messages to be released by the main thread.
+class Producer: public Concurrency::Thread
+{
+public:
+  std::vector<IMC::Message*> messages;
+
+  void
+  run(void)
+  {
+    for (unsigned i = 0; i < 1000; ++i)
+    {
+      IMC::Temperature* temp = new IMC::Temperature;
+      temp->value = (float)i;
+      messages.push_back(temp);
+
+      IMC::EstimatedState* state = new IMC::EstimatedState;
+      state->lat = i;
+      messages.push_back(state);
+    }
+  }
+};
+
+int
+main(void)
+{
+  Test test("IMC::MessagePool");
+
+  test.boolean("getClassSize()", IMC::MessagePool::getClassCount() > 0
+               && IMC::MessagePool::getClassSize(0) > 0
+               && IMC::MessagePool::getClassSize(IMC::MessagePool::getClassCount() - 1)
+               >= sizeof(IMC::EstimatedState));
+
+  // Objects are usable and distinct.
+  {
+    std::vector<char*> ptrs;
+    bool ok = true;
+    for (unsigned i = 0; i < 300; ++i)
+    {
+      char* ptr = static_cast<char*>(IMC::MessagePool::allocate(48));
+      std::memset(ptr, (int)(i % 256), 48);
+      ptrs.push_back(ptr);
+    }
+
+    for (unsigned i = 0; i < ptrs.size(); ++i)
+    {
+      for (unsigned j = 0; j < 48; ++j)
+        ok = ok && ptrs[i][j] == (char)(i % 256);
+      IMC::MessagePool::release(ptrs[i], 48);
+    }
+
+    test.boolean("allocate() / release()", ok);
+  }
+
+  // Oversize objects use the system allocator.
+  {
+    IMC::MessagePool::Statistics before;
+    IMC::MessagePool::getStatistics(before);
+    void* ptr = IMC::MessagePool::allocate(64 * 1024);
+    std::memset(ptr, 0, 64 * 1024);
+    IMC::MessagePool::release(ptr, 64 * 1024);
+    IMC::MessagePool::Statistics after;
+    IMC::MessagePool::getStatistics(after);
+    test.boolean("oversize objects", !IMC::MessagePool::isEnabled()
+                 || after.oversize == before.oversize + 1);
+  }
+
+  // Messages released by another thread.
+  {
+    IMC::MessagePool::Statistics before;
+    IMC::MessagePool::getStatistics(before);
+
+    Producer producer;
+    producer.start();
+    producer.join();
+
+    bool ok = producer.messages.size() == 2000;
+    for (unsigned i = 0; ok && i < producer.messages.size(); i += 2)
+    {
+      ok = static_cast<IMC::Temperature*>(producer.messages[i])->value == (float)(i / 2)
+      && static_cast<IMC::EstimatedState*>(producer.messages[i + 1])->lat == i / 2;
+    }
+
+    for (unsigned i = 0; i < producer.messages.size(); ++i)
+      delete producer.messages[i];
+
+    test.boolean("messages across threads", ok);
+
+    IMC::MessagePool::Statistics after;
+    IMC::MessagePool::getStatistics(after);
+#if defined(DUNE_USING_MESSAGE_POOL)
+    if (IMC::MessagePool::isEnabled())
+    {
+      test.boolean("statistics", after.allocations >= before.allocations + 2000
+                   && after.releases >= before.releases + 2000
+                   && after.reserved >= 2000
+                   && after.hits <= after.allocations);
+    }
+#endif
+
+    // Objects released by the consumer are reused.
+    IMC::Message* msg = new IMC::Temperature;
+    IMC::MessagePool::Statistics reuse;
+    IMC::MessagePool::getStatistics(reuse);
+    delete msg;
+    test.boolean("reuse", reuse.reserved == after.reserved);
+  }
+
+  return test.getReturnValue();
+}
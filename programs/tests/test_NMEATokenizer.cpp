@@ -0,0 +1,235 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Sentence handler counting calls.
+struct Handlers
+{
+  unsigned gga;
+  unsigned psat;
+
+  Handlers(void):
+    gga(0),
+    psat(0)
+  { }
+
+  void
+  onGGA(const NMEATokenizer& stn)
+  {
+    (void)stn;
+    ++gga;
+  }
+
+  void
+  onPSAT(const NMEATokenizer& stn)
+  {
+    if (stn.isEqual(1, "HPR"))
+      ++psat;
+  }
+};
+
+//! Append a valid checksum to a sentence.
+static std::string
+seal(const std::string& body)
+{
+  uint8_t csum = 0;
+  for (size_t i = 1; i < body.size(); ++i)
+    csum ^= body[i];
+
+  return body + String::str("*%02X\r\n", csum);
+}
+
+int
+main(void)
+{
+  Test test("NMEATokenizer");
+
+  std::string gga = seal("$GPGGA,123519.25,4807.038,N,01131.000,W,1,08,0.9,545.4,M,46.9,M,,");
+
+  {
+    NMEATokenizer stn;
+    std::string noisy = "noise" + gga;
+    test.boolean("valid sentence", stn.parse(noisy) == NMEATokenizer::NMEA_OK);
+    test.boolean("field count", stn.getFieldCount() == 15);
+    test.boolean("sentence code", stn.isEqual(0, "GPGGA"));
+    test.boolean("code pattern", stn.matches(0, "G?GGA") && !stn.matches(0, "G?GG") && !stn.matches(0, "G?GGAX"));
+    test.boolean("empty trailing field", stn.isEmpty(14) && stn.isEmpty(15));
+
+    std::string value;
+    stn.getString(10, value);
+    test.boolean("field string", value == "M");
+
+    double time = 0;
+    test.boolean("time of day", stn.readTime(1, time) && std::fabs(time - 45319.25) < 1e-9);
+
+    double lat = 0;
+    double lon = 0;
+    test.boolean("latitude", stn.readLatitude(2, lat) && std::fabs(lat - (48 + 7.038 / 60)) < 1e-12);
+    test.boolean("longitude", stn.readLongitude(4, lon) && std::fabs(lon + (11 + 31.0 / 60)) < 1e-12);
+    test.boolean("latitude hemisphere", !stn.readLatitude(4, lat));
+
+    uint8_t sats = 0;
+    float hdop = 0;
+    test.boolean("decimal with leading zero", stn.readDecimal(7, sats) && sats == 8);
+    test.boolean("number", stn.readNumber(8, hdop) && std::fabs(hdop - 0.9f) < 1e-6);
+    test.boolean("number is not decimal", !stn.readDecimal(8, sats));
+    test.boolean("empty field is not a number", !stn.readNumber(13, hdop));
+  }
+
+  {
+    NMEATokenizer stn;
+    std::string bad = gga;
+    bad[10] = '9';
+    test.boolean("checksum mismatch", stn.parse(bad) == NMEATokenizer::NMEA_CHECKSUM_MISMATCH);
+    test.boolean("no fields after failure", stn.getFieldCount() == 0);
+    test.boolean("missing checksum", stn.parse("$GPHDT,1.0,T") == NMEATokenizer::NMEA_NO_CHECKSUM);
+    test.boolean("optional checksum", stn.parse("$GPHDT,1.0,T", false) == NMEATokenizer::NMEA_OK);
+    test.boolean("malformed checksum", stn.parse("$GPHDT,1.0,T*G1") == NMEATokenizer::NMEA_INVALID_CHECKSUM);
+    test.boolean("misplaced checksum", stn.parse("$GPHDT,1.0*,T", false) == NMEATokenizer::NMEA_INVALID_CHECKSUM);
+    test.boolean("missing start", stn.parse("GPHDT,1.0,T*00") == NMEATokenizer::NMEA_NO_START);
+    std::string vdm = seal("!AIVDM,1,1,,A,13u?etPv2;0n:dDPwUM1U1Cb069D,0");
+    test.boolean("encapsulated sentence", stn.parse(vdm) == NMEATokenizer::NMEA_OK);
+
+    std::string many = "$P";
+    for (unsigned i = 0; i < NMEATokenizer::c_max_fields; ++i)
+      many += ",1";
+    test.boolean("too many fields", stn.parse(many, false) == NMEATokenizer::NMEA_TOO_MANY_FIELDS);
+  }
+
+  {
+    NMEATokenizer stn;
+    stn.parse("$PTEST,300,-129,4294967296,+7,1e3,-2.5E-2,.5,5.,abc,1e", false);
+
+    uint8_t u8 = 0;
+    int8_t i8 = 0;
+    uint32_t u32 = 0;
+    int i = 0;
+    double d = 0;
+    test.boolean("decimal overflow", !stn.readDecimal(1, u8) && !stn.readDecimal(2, i8) && !stn.readDecimal(3, u32));
+    test.boolean("decimal sign", stn.readDecimal(4, i) && i == 7);
+    test.boolean("exponent", stn.readNumber(5, d) && d == 1000.0);
+    test.boolean("negative exponent", stn.readNumber(6, d) && d == -0.025);
+    test.boolean("leading dot", stn.readNumber(7, d) && d == 0.5);
+    test.boolean("trailing dot", stn.readNumber(8, d) && d == 5.0);
+    test.boolean("not a number", !stn.readNumber(9, d));
+    test.boolean("incomplete exponent", !stn.readNumber(10, d));
+  }
+
+  {
+    Math::Random::Generator* prng = Math::Random::Factory::create(Math::Random::Factory::c_default, 42);
+    bool exact = true;
+    for (unsigned n = 0; n < 10000; ++n)
+    {
+      std::string str = String::str("%0.*f", (int)(n % 9), prng->uniform(-20000.0, 20000.0));
+      double expected = std::strtod(str.c_str(), NULL);
+      double value = 0;
+      const char* end = NMEATokenizer::parseNumber(str.data(), str.data() + str.size(), value);
+      if (end != str.data() + str.size() || value != expected)
+        exact = false;
+    }
+    delete prng;
+
+    test.boolean("numbers match strtod", exact);
+  }
+
+  {
+    Handlers h;
+    NMEADispatcher<Handlers> dispatcher(&h);
+    dispatcher.add("G?GGA", &Handlers::onGGA);
+    dispatcher.add("PSAT", &Handlers::onPSAT);
+
+    std::string gn = seal("$GNGGA,,,,,,0,,,,,,,,");
+    std::string hpr = seal("$PSAT,HPR,,1.0,2.0,3.0,N");
+    std::string vtg = seal("$GPVTG,,T,,M,,N,,K");
+
+    NMEATokenizer stn;
+    stn.parse(gga);
+    bool a = dispatcher.dispatch(stn);
+    stn.parse(gn);
+    bool b = dispatcher.dispatch(stn);
+    stn.parse(hpr);
+    bool c = dispatcher.dispatch(stn);
+    stn.parse(vtg);
+    bool d = dispatcher.dispatch(stn);
+
+    test.boolean("dispatch by pattern", a && b && c && !d);
+    test.boolean("dispatch handlers", h.gga == 2 && h.psat == 1);
+  }
+
+  {
+    NMEAReader reader(gga);
+    std::string time;
+    double lat = 0;
+    std::string h;
+    unsigned quality = 0;
+    reader >> time >> lat >> h;
+    reader.skip().skip() >> quality;
+    test.boolean("reader code", std::strcmp(reader.code(), "GPGGA") == 0);
+    test.boolean("reader fields", time == "123519.25" && lat == 4807.038 && h == "N" && quality == 1);
+
+    bool thrown = false;
+    try
+    {
+      NMEAReader bad("$GPHDT,1.0,T*00");
+    }
+    catch (Parsers::ChecksumMismatch&)
+    {
+      thrown = true;
+    }
+    test.boolean("reader checksum mismatch", thrown);
+
+    thrown = false;
+    try
+    {
+      NMEAReader end("$GPHDT,1.0");
+      double v = 0;
+      end >> v >> v;
+    }
+    catch (Parsers::ReaderError&)
+    {
+      thrown = true;
+    }
+    test.boolean("reader end of sentence", thrown);
+  }
+
+  return test.getReturnValue();
+}
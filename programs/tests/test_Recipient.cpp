@@ -0,0 +1,132 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Task that records consumed messages.
+class RecordingTask: public Tasks::Task
+{
+public:
+  //! Values of consumed EstimatedState messages.
+  std::vector<double> states;
+  //! Values of consumed Temperature messages.
+  std::vector<double> temperatures;
+  //! Order of consumption (message identifiers).
+  std::vector<unsigned> order;
+
+  RecordingTask(Tasks::Context& ctx):
+    Tasks::Task("RecordingTask", ctx)
+  {
+    bind<IMC::EstimatedState>(this, Tasks::BF_CONFLATE);
+    bind<IMC::Temperature>(this);
+  }
+
+  void
+  consume(const IMC::EstimatedState* msg)
+  {
+    states.push_back(msg->x);
+    order.push_back(msg->getId());
+  }
+
+  void
+  consume(const IMC::Temperature* msg)
+  {
+    temperatures.push_back(msg->value);
+    order.push_back(msg->getId());
+  }
+
+  void
+  poll(void)
+  {
+    waitForMessages(0.0);
+  }
+
+  void
+  onMain(void)
+  { }
+};
+
+int
+main(void)
+{
+  Test test("Tasks::Recipient");
+
+  Tasks::Context ctx;
+  RecordingTask task(ctx);
+
+  IMC::Temperature temp;
+  temp.value = 1.0;
+  ctx.mbus.dispatch(&temp);
+
+  for (unsigned i = 0; i < 5; ++i)
+  {
+    IMC::EstimatedState state;
+    state.setSource(0x10);
+    state.x = i;
+    ctx.mbus.dispatch(&state);
+
+    state.setSource(0x20);
+    state.x = 100 + i;
+    ctx.mbus.dispatch(&state);
+
+    temp.value = 2.0 + i;
+    ctx.mbus.dispatch(&temp);
+  }
+
+  task.poll();
+
+  test.boolean("FIFO messages are all consumed", task.temperatures.size() == 6
+               && task.temperatures.front() == 1.0 && task.temperatures.back() == 6.0);
+  test.boolean("one conflated message per source", task.states.size() == 2);
+  test.boolean("conflated messages hold latest value", task.states.size() == 2
+               && task.states[0] == 4 && task.states[1] == 104);
+  test.boolean("conflated messages keep first position", task.order.size() == 8
+               && task.order[1] == IMC::EstimatedState::getIdStatic()
+               && task.order[2] == IMC::EstimatedState::getIdStatic()
+               && task.order[3] == IMC::Temperature::getIdStatic());
+
+  IMC::EstimatedState state;
+  state.setSource(0x10);
+  state.x = 7;
+  ctx.mbus.dispatch(&state);
+  task.poll();
+  test.boolean("conflation restarts after consumption", task.states.size() == 3
+               && task.states[2] == 7);
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,199 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+#include <string>
+#include <sstream>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Thread going through the synchronized startup phases.
+class StartupRunner: public Concurrency::Thread
+{
+public:
+  //! Time at which each synchronized phase was left.
+  double left[Tasks::Startup::PHASE_COUNT];
+  //! Result of each arrival.
+  bool ok[Tasks::Startup::PHASE_COUNT];
+  //! Late tasks reported.
+  std::vector<std::string> late;
+
+  StartupRunner(Tasks::Startup& startup, unsigned index, double delay, bool quit = false):
+    m_startup(startup),
+    m_index(index),
+    m_delay(delay),
+    m_quit(quit)
+  {
+    for (unsigned i = 0; i < Tasks::Startup::PHASE_COUNT; ++i)
+    {
+      left[i] = -1;
+      ok[i] = true;
+    }
+  }
+
+private:
+  Tasks::Startup& m_startup;
+  unsigned m_index;
+  double m_delay;
+  bool m_quit;
+
+  void
+  run(void)
+  {
+    for (unsigned i = Tasks::Startup::PHASE_RESOLVE; i < Tasks::Startup::PHASE_COUNT; ++i)
+    {
+      double begin = Time::Clock::get();
+      Time::Delay::wait(m_delay);
+
+      if (m_quit && i == Tasks::Startup::PHASE_ACQUIRE)
+      {
+        m_startup.leave(m_index);
+        return;
+      }
+
+      ok[i] = m_startup.arrive(m_index, (Tasks::Startup::Phase)i, begin, late);
+      left[i] = Time::Clock::get();
+    }
+  }
+};
+
+int
+main(void)
+{
+  Test test("Tasks::Startup");
+
+  {
+    double epoch = Time::Clock::get();
+    Tasks::Startup startup;
+    startup.setTimeout(5.0);
+
+    std::vector<StartupRunner*> runners;
+    for (unsigned i = 0; i < 3; ++i)
+    {
+      unsigned index = startup.add(String::str("Task%u", i));
+      runners.push_back(new StartupRunner(startup, index, 0.01 + 0.03 * i));
+    }
+
+    test.boolean("startup incomplete before running", !startup.isComplete());
+
+    for (unsigned i = 0; i < runners.size(); ++i)
+      runners[i]->start();
+    for (unsigned i = 0; i < runners.size(); ++i)
+      runners[i]->join();
+
+    std::vector<Tasks::Startup::Entry> entries = startup.getEntries();
+
+    bool barrier = true;
+    bool ok = true;
+    for (unsigned i = 0; i < runners.size(); ++i)
+    {
+      for (unsigned p = Tasks::Startup::PHASE_RESOLVE; p < Tasks::Startup::PHASE_COUNT; ++p)
+      {
+        ok = ok && runners[i]->ok[p];
+        for (unsigned j = 0; j < entries.size(); ++j)
+        {
+          if (runners[i]->left[p] - epoch < entries[j].end[p])
+            barrier = false;
+        }
+      }
+    }
+
+    test.boolean("no task leaves a phase before all finish it", barrier);
+    test.boolean("no phase timed out", ok);
+    test.boolean("all phases recorded", entries.size() == 3
+                 && entries[2].completed == Tasks::Startup::PHASE_COUNT
+                 && entries[2].end[Tasks::Startup::PHASE_INITIALIZE]
+                 > entries[2].begin[Tasks::Startup::PHASE_INITIALIZE]);
+    test.boolean("startup complete", startup.isComplete());
+
+    std::ostringstream os;
+    startup.writeCSV(os);
+    std::string csv = os.str();
+    test.boolean("timeline lists all tasks and phases",
+                 csv.find("task,phase,begin,duration") == 0
+                 && csv.find("Task2,initialize,") != std::string::npos
+                 && csv.find("Task0,resolve,") != std::string::npos);
+
+    for (unsigned i = 0; i < runners.size(); ++i)
+      delete runners[i];
+  }
+
+  {
+    Tasks::Startup startup;
+    startup.setTimeout(5.0);
+
+    StartupRunner a(startup, startup.add("A"), 0.01);
+    StartupRunner b(startup, startup.add("B"), 0.01, true);
+    a.start();
+    b.start();
+    a.join();
+    b.join();
+
+    test.boolean("tasks leaving do not hold others", a.ok[Tasks::Startup::PHASE_INITIALIZE]
+                 && a.left[Tasks::Startup::PHASE_INITIALIZE] > 0);
+    test.boolean("startup complete with tasks leaving", startup.isComplete());
+  }
+
+  {
+    Tasks::Startup startup;
+    startup.setTimeout(0.2);
+
+    StartupRunner a(startup, startup.add("A"), 0.0);
+    startup.add("Stuck");
+    a.start();
+    a.join();
+
+    test.boolean("phase times out", !a.ok[Tasks::Startup::PHASE_RESOLVE]);
+    test.boolean("late tasks reported", a.late.size() >= 1 && a.late[0] == "Stuck");
+    test.boolean("startup incomplete while a task is stuck", !startup.isComplete());
+  }
+
+  {
+    Tasks::Startup startup;
+    startup.setTimeout(0);
+
+    StartupRunner a(startup, startup.add("A"), 0.0);
+    startup.add("Stuck");
+    a.start();
+    Time::Delay::wait(0.1);
+    startup.abort();
+    a.join();
+
+    test.boolean("abort releases waiting tasks", a.left[Tasks::Startup::PHASE_INITIALIZE] > 0);
+  }
+
+  return test.getReturnValue();
+}
@@ -29,6 +29,7 @@
 
 // ISO C++ 98 headers.
 #include <iostream>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
@@ -57,6 +58,24 @@ public:
   }
 };
 
+class ThreadB: public Thread
+{
+public:
+  int m_cpu;
+
+  ThreadB(void):
+    m_cpu(-1)
+  { }
+
+  void
+  run(void)
+  {
+#if defined(DUNE_OS_LINUX)
+    m_cpu = sched_getcpu();
+#endif
+  }
+};
+
 int
 main(void)
 {
@@ -76,7 +95,23 @@ main(void)
       test.failed(DUNE::Utils::String::str("run: %s", e.what()).c_str());
     }
   }
-
+#if defined(DUNE_SYS_HAS_PTHREAD_SETAFFINITY_NP) && defined(DUNE_OS_LINUX)
+  {
+    try
+    {
+      ThreadB thread;
+      std::vector<unsigned> cpus(1, 0);
+      thread.setAffinity(cpus);
+      thread.start();
+      thread.join();
+      test.boolean("setAffinity()", thread.m_cpu == 0);
+    }
+    catch (std::exception& e)
+    {
+      test.failed(DUNE::Utils::String::str("setAffinity: %s", e.what()).c_str());
+    }
+  }
+#endif
 
   // {
   //   try
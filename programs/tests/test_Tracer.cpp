@@ -0,0 +1,253 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+// POSIX headers.
+#include <unistd.h>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Task deriving a message from each consumed message.
+template <typename In, typename Out>
+class RelayTask: public Tasks::Task
+{
+public:
+  RelayTask(const std::string& name, Tasks::Context& ctx):
+    Tasks::Task(name, ctx)
+  {
+    setEntityLabel(name);
+    reserveEntities();
+    bind<In>(this);
+  }
+
+  void
+  consume(const In* msg)
+  {
+    (void)msg;
+    dispatch(m_out);
+  }
+
+  void
+  poll(void)
+  {
+    waitForMessages(0.0);
+  }
+
+  void
+  onMain(void)
+  { }
+
+private:
+  Out m_out;
+};
+
+//! Task producing messages from a timer or from cached inputs.
+class SourceTask: public Tasks::Task
+{
+public:
+  IMC::TraceContext last;
+
+  SourceTask(Tasks::Context& ctx):
+    Tasks::Task("Source", ctx)
+  {
+    setEntityLabel("Source");
+    reserveEntities();
+    last.trace = 0;
+    last.span = 0;
+    bind<IMC::DesiredHeading>(this);
+  }
+
+  void
+  consume(const IMC::DesiredHeading* msg)
+  {
+    last = msg->getTraceContext();
+  }
+
+  void
+  sample(IMC::Message& msg)
+  {
+    dispatch(msg);
+  }
+
+  void
+  derive(IMC::Message& msg)
+  {
+    Tasks::Tracer::Cause cause(last);
+    dispatch(msg);
+  }
+
+  void
+  poll(void)
+  {
+    waitForMessages(0.0);
+  }
+
+  void
+  onMain(void)
+  { }
+};
+
+//! Read a trace file.
+static bool
+readTrace(const std::string& file, std::vector<Tasks::Tracer::Event>& events,
+          std::map<unsigned, std::string>& labels)
+{
+  std::FILE* fd = std::fopen(file.c_str(), "rb");
+  if (fd == NULL)
+    return false;
+
+  char magic[8];
+  bool ok = std::fread(magic, sizeof(magic), 1, fd) == 1
+  && std::memcmp(magic, Tasks::Tracer::c_magic, sizeof(magic)) == 0;
+
+  Tasks::Tracer::Event ev;
+  while (ok && std::fread(&ev, sizeof(ev), 1, fd) == 1)
+  {
+    if (ev.type != Tasks::Tracer::EV_LABEL)
+    {
+      events.push_back(ev);
+      continue;
+    }
+
+    std::string label(ev.trace, 0);
+    ok = std::fread(&label[0], 1, ev.trace, fd) == ev.trace;
+    labels[ev.entity] = label;
+  }
+
+  std::fclose(fd);
+  return ok;
+}
+
+//! Find an event of a given type and span.
+static const Tasks::Tracer::Event*
+findEvent(const std::vector<Tasks::Tracer::Event>& events, unsigned type, uint32_t span)
+{
+  for (size_t i = 0; i < events.size(); ++i)
+  {
+    if (events[i].type == type && events[i].span == span)
+      return &events[i];
+  }
+
+  return NULL;
+}
+
+int
+main(void)
+{
+  Test test("Tasks::Tracer");
+
+  FileSystem::Path file = FileSystem::Path("/tmp") / String::str("dune-tracer-%u.bin", (unsigned)getpid());
+
+  Tasks::Context ctx;
+  ctx.resolver.id(0x10);
+
+  SourceTask source(ctx);
+  RelayTask<IMC::EulerAngles, IMC::EstimatedState> nav("Navigation", ctx);
+  RelayTask<IMC::EstimatedState, IMC::DesiredHeading> ctl("Controller", ctx);
+
+  IMC::EulerAngles euler;
+  source.sample(euler);
+  test.boolean("not traced while stopped", euler.getTraceContext().trace == 0);
+
+  Tasks::Tracer::start(file.str(), ctx.entities);
+  test.boolean("running", Tasks::Tracer::isRunning());
+
+  source.sample(euler);
+  IMC::TraceContext root = euler.getTraceContext();
+  test.boolean("root message starts a trace", root.trace != 0 && root.trace == root.span);
+
+  nav.poll();
+  ctl.poll();
+  source.poll();
+  test.boolean("trace propagated to last hop", source.last.trace == root.trace
+               && source.last.span != root.span);
+
+  IMC::RelativeHumidity other;
+  source.sample(other);
+  test.boolean("cause cleared after consumption",
+               other.getTraceContext().trace == other.getTraceContext().span
+               && other.getTraceContext().trace != root.trace);
+
+  IMC::SetThrusterActuation act;
+  source.derive(act);
+  test.boolean("explicit cause", act.getTraceContext().trace == root.trace);
+
+  Tasks::Tracer::stop();
+  test.boolean("stopped", !Tasks::Tracer::isRunning());
+
+  std::vector<Tasks::Tracer::Event> events;
+  std::map<unsigned, std::string> labels;
+  test.boolean("trace file", readTrace(file.str(), events, labels));
+
+  const Tasks::Tracer::Event* d_euler = findEvent(events, Tasks::Tracer::EV_DISPATCH, root.span);
+  const Tasks::Tracer::Event* d_head = findEvent(events, Tasks::Tracer::EV_DISPATCH, source.last.span);
+  const Tasks::Tracer::Event* d_state = (d_head == NULL) ? NULL
+  : findEvent(events, Tasks::Tracer::EV_DISPATCH, d_head->parent);
+  const Tasks::Tracer::Event* d_act = findEvent(events, Tasks::Tracer::EV_DISPATCH,
+                                                act.getTraceContext().span);
+
+  test.boolean("root dispatch", d_euler != NULL && d_euler->parent == 0
+               && d_euler->id == IMC::EulerAngles::getIdStatic()
+               && d_euler->entity == source.getEntityId());
+  test.boolean("chain", d_state != NULL && d_head != NULL
+               && d_state->id == IMC::EstimatedState::getIdStatic()
+               && d_state->parent == root.span
+               && d_state->entity == nav.getEntityId()
+               && d_head->id == IMC::DesiredHeading::getIdStatic()
+               && d_head->trace == root.trace);
+  test.boolean("derived dispatch", d_act != NULL && d_act->parent == source.last.span);
+
+  const Tasks::Tracer::Event* q_euler = findEvent(events, Tasks::Tracer::EV_DEQUEUE, root.span);
+  const Tasks::Tracer::Event* c_euler = findEvent(events, Tasks::Tracer::EV_CONSUME, root.span);
+  test.boolean("dequeue and consume", q_euler != NULL && c_euler != NULL
+               && d_euler != NULL && d_state != NULL
+               && q_euler->entity == nav.getEntityId()
+               && d_euler->time <= q_euler->time
+               && q_euler->time <= d_state->time
+               && d_state->time <= c_euler->time);
+
+  test.boolean("entity labels", labels[nav.getEntityId()] == "Navigation"
+               && labels[ctl.getEntityId()] == "Controller");
+
+  file.remove();
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,208 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Math/Constants.hpp>
+#include <DUNE/Simulation/UAVBatch.hpp>
+#include <DUNE/Simulation/UAVModel.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE::Simulation;
+
+static UAVModel
+createModel(UAVModel::Type type, unsigned index)
+{
+  UAVModel model(type);
+  model.setCtrl(1.0 + 0.01 * index, 3.0);
+  model.setAltCtrl(2.0);
+  if (index % 2)
+  {
+    model.setBankRateLim(0.3);
+    model.setAccelLim(1.5);
+    model.setVertSlopeLim(0.2);
+  }
+
+  double pos[6] = {index * 10.0, - (index * 5.0), -100, 0, 0, index * 0.01};
+  double vel[6] = {18, 1, 0, 0, 0, 0};
+  double wind[3] = {index % 3 * 1.5, -1.0, 0.1 * (index % 2)};
+  model.setWind(wind);
+  model.setPosition(pos, 6);
+  model.setVelocity(vel, 6);
+
+  model.commandBank(0.2 + 0.01 * index);
+  model.commandAirspeed(20 + index % 5);
+  if (index % 4)
+    model.commandAlt(120 + index);
+  else
+    model.commandFPA(0.05);
+
+  return model;
+}
+
+static bool
+sameState(const UAVModel& model, const UAVBatch& batch, size_t index)
+{
+  UAVModel::State state;
+  batch.getState(index, state);
+  return std::memcmp(model.getPosition(), state.position, sizeof(state.position)) == 0
+  && std::memcmp(model.getVelocity(), state.velocity, sizeof(state.velocity)) == 0
+  && std::memcmp(&model.getState().airspeed, &state.airspeed, sizeof(state.airspeed)) == 0;
+}
+
+int
+main(void)
+{
+  Test test("Simulation::UAVModel");
+
+  UAVModel::Type types[] =
+  {
+    UAVModel::TYPE_3DOF,
+    UAVModel::TYPE_4DOF_ALT,
+    UAVModel::TYPE_4DOF_BANK,
+    UAVModel::TYPE_5DOF
+  };
+  const char* names[] = {"3DOF", "4DOF_alt", "4DOF_bank", "5DOF"};
+
+  for (unsigned t = 0; t < 4; ++t)
+  {
+    std::vector<UAVModel> models;
+    UAVBatch batch(types[t]);
+
+    for (unsigned i = 0; i < 37; ++i)
+    {
+      models.push_back(createModel(types[t], i));
+      batch.add(models.back());
+    }
+
+    bool same = true;
+    for (unsigned step = 0; step < 500; ++step)
+    {
+      if (step == 250)
+      {
+        for (unsigned i = 0; i < models.size(); i += 3)
+        {
+          models[i].commandBank(-0.3);
+          batch.commandBank(i, -0.3);
+          models[i].commandAlt(80);
+          batch.commandAlt(i, 80);
+        }
+      }
+
+      double timestep = (step % 7 == 0) ? 1.5 : 0.02;
+      for (unsigned i = 0; i < models.size(); ++i)
+        models[i].update(timestep);
+      batch.update(timestep);
+
+      for (unsigned i = 0; i < models.size() && same; ++i)
+        same = sameState(models[i], batch, i);
+    }
+
+    char desc[64];
+    std::sprintf(desc, "batch matches model (%s)", names[t]);
+    test.boolean(desc, same);
+  }
+
+  // Missing commands and parameters.
+  {
+    UAVModel model(UAVModel::TYPE_4DOF_ALT);
+    test.boolean("no airspeed command", model.update(0.1) == UAVModel::STATUS_NO_AIRSPEED_CMD);
+    model.commandAirspeed(20);
+    test.boolean("no altitude command", model.update(0.1) == UAVModel::STATUS_NO_ALTITUDE_CMD);
+    model.commandAlt(100);
+    test.boolean("no altitude time constant", model.update(0.1) == UAVModel::STATUS_NO_ALT_TIME_CST);
+    model.setAltCtrl(2.0);
+    test.boolean("valid commands", model.update(0.1) == UAVModel::STATUS_OK);
+
+    UAVModel bank(UAVModel::TYPE_4DOF_BANK);
+    bank.commandAirspeed(20);
+    test.boolean("no bank time constant", bank.update(0.1) == UAVModel::STATUS_NO_PARAMETERS);
+
+    UAVBatch batch(UAVModel::TYPE_4DOF_BANK);
+    batch.add(bank);
+    batch.add(createModel(UAVModel::TYPE_4DOF_BANK, 0));
+    test.boolean("batch update count", batch.update(0.1) == 1
+                 && batch.getStatus(0) == UAVModel::STATUS_NO_PARAMETERS
+                 && batch.getStatus(1) == UAVModel::STATUS_OK);
+
+    bool mismatch = false;
+    try
+    {
+      batch.add(model);
+    }
+    catch (...)
+    {
+      mismatch = true;
+    }
+    test.boolean("batch rejects other types", mismatch);
+  }
+
+  // Coordinated turn: one full turn returns to the starting point.
+  {
+    const double bank = 0.3;
+    const double airspeed = 20;
+    UAVModel model(UAVModel::TYPE_3DOF);
+    double vel[6] = {airspeed, 0, 0, 0, 0, 0};
+    model.setVelocity(vel, 6);
+    model.commandBank(bank);
+    model.commandAirspeed(airspeed);
+    model.update(0.01);
+
+    double rate = DUNE::Math::c_gravity * std::tan(bank) / airspeed;
+    test.boolean("turn rate", std::fabs(model.getVelocity()[5] - rate) < 1e-12);
+
+    double x = model.getPosition()[0];
+    double y = model.getPosition()[1];
+    double period = 2 * DUNE::Math::c_pi / rate;
+    double max_offset = 0;
+    for (unsigned i = 0; i < 1000; ++i)
+    {
+      model.update(period / 1000);
+      double dx = model.getPosition()[0] - x;
+      double dy = model.getPosition()[1] - y;
+      max_offset = std::max(max_offset, std::sqrt(dx * dx + dy * dy));
+    }
+
+    double dx = model.getPosition()[0] - x;
+    double dy = model.getPosition()[1] - y;
+    double radius = airspeed * airspeed / (DUNE::Math::c_gravity * std::tan(bank));
+    test.boolean("turn closes", std::sqrt(dx * dx + dy * dy) < 1e-3 * radius);
+    test.boolean("turn diameter", std::fabs(max_offset - 2 * radius) < 1e-3 * radius);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,108 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstdio>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+int
+main(void)
+{
+  Test test("Coordinates::WMM");
+
+  try
+  {
+    double t0 = Clock::get();
+    Coordinates::WMM first;
+    double t1 = Clock::get();
+    Coordinates::WMM second;
+    double t2 = Clock::get();
+
+    std::fprintf(stderr, "  first instance %0.3f ms, second instance %0.3f ms\n",
+                (t1 - t0) * 1e3, (t2 - t1) * 1e3);
+
+    double lat = Angles::radians(41.1850);
+    double lon = Angles::radians(-8.7060);
+    test.boolean("instances share the geoid", first.height(lat, lon) == second.height(lat, lon));
+    test.boolean("geoid height", std::fabs(first.height(lat, lon) - 55.0) < 5.0);
+
+    // Compare interpolated and exact declination over an operating area.
+    double max_error = 0;
+    for (unsigned i = 0; i < 40; ++i)
+    {
+      for (unsigned j = 0; j < 40; ++j)
+      {
+        double la = Angles::radians(41.0 + i * 0.013);
+        double lo = Angles::radians(-9.0 + j * 0.017);
+        double h = i * 25.0;
+        double error = std::fabs(first.declination(la, lo, h) - first.exactDeclination(la, lo, h));
+        if (error > max_error)
+          max_error = error;
+      }
+    }
+
+    std::fprintf(stderr, "  maximum interpolation error %0.6f deg\n", Angles::degrees(max_error));
+    test.boolean("interpolated declination", Angles::degrees(max_error) < 0.01);
+
+    double other = Angles::radians(-33.9);
+    double east = Angles::radians(151.2);
+    test.boolean("declination away from area", std::fabs(first.declination(other, east) - first.exactDeclination(other, east)) < Angles::radians(0.01));
+
+    double pole = Angles::radians(86.0);
+    test.boolean("declination near magnetic pole", std::fabs(first.declination(pole, Angles::radians(-160.0)) - first.exactDeclination(pole, Angles::radians(-160.0))) < Angles::radians(0.5));
+
+    unsigned count = 2000;
+    double sum = 0;
+    double b0 = Clock::get();
+    for (unsigned i = 0; i < count; ++i)
+      sum += second.exactDeclination(lat + i * 1e-7, lon);
+    double b1 = Clock::get();
+    for (unsigned i = 0; i < count; ++i)
+      sum += second.declination(lat + i * 1e-7, lon);
+    double b2 = Clock::get();
+
+    std::fprintf(stderr, "  exact %0.3f us, memoized %0.3f us per query (%0.1f)\n",
+                (b1 - b0) * 1e6 / count, (b2 - b1) * 1e6 / count, sum);
+    test.boolean("memoized declination is faster", (b2 - b1) < (b1 - b0));
+  }
+  catch (std::exception& e)
+  {
+    test.failed(e.what());
+  }
+
+  return test.getReturnValue();
+}
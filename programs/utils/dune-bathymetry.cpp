@@ -0,0 +1,141 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Utility program to convert bathymetry data to a binary tiled grid.       *
+//***************************************************************************
+
+// ISO C++ headers
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// DUNE headers
+#include <DUNE/Coordinates/WGS84.hpp>
+#include <DUNE/Math/Angles.hpp>
+#include <DUNE/Simulation/BathymetryGrid.hpp>
+#include <DUNE/Utils/String.hpp>
+
+using DUNE::Coordinates::WGS84;
+using DUNE::Math::Angles;
+using DUNE::Simulation::BathymetryGrid;
+
+//! Read an XYZ file with 'latitude longitude depth' lines (decimal
+//! degrees). The reference point is the center of the covered area.
+static void
+readXYZ(const std::string& path, double& lat, double& lon,
+        std::vector<BathymetryGrid::Sample>& samples)
+{
+  std::ifstream ifs(path.c_str());
+  if (!ifs)
+    throw std::runtime_error("unable to open " + path);
+
+  std::vector<double> lats;
+  std::vector<double> lons;
+  std::vector<double> depths;
+  double lat_min = 0, lat_max = 0, lon_min = 0, lon_max = 0;
+
+  std::string line;
+  while (std::getline(ifs, line))
+  {
+    std::vector<double> v;
+    DUNE::Utils::String::split(DUNE::Utils::String::trim(line), " ", v);
+    if (v.size() < 3)
+      continue;
+
+    if (lats.empty())
+    {
+      lat_min = lat_max = v[0];
+      lon_min = lon_max = v[1];
+    }
+
+    lat_min = std::min(lat_min, v[0]);
+    lat_max = std::max(lat_max, v[0]);
+    lon_min = std::min(lon_min, v[1]);
+    lon_max = std::max(lon_max, v[1]);
+
+    lats.push_back(Angles::radians(v[0]));
+    lons.push_back(Angles::radians(v[1]));
+    depths.push_back(v[2]);
+  }
+
+  lat = Angles::radians((lat_min + lat_max) / 2.0);
+  lon = Angles::radians((lon_min + lon_max) / 2.0);
+
+  samples.resize(lats.size());
+  for (size_t i = 0; i < lats.size(); ++i)
+  {
+    WGS84::displacement(lat, lon, 0, lats[i], lons[i], 0,
+                        &samples[i].x, &samples[i].y);
+    samples[i].depth = depths[i];
+  }
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc < 3)
+  {
+    std::cerr << "Usage: " << argv[0] << " <input.ini|input.xyz> <output"
+              << BathymetryGrid::c_extension << "> [resolution] [fill radius]"
+              << std::endl;
+    return 1;
+  }
+
+  std::string input(argv[1]);
+  std::string output(argv[2]);
+  double resolution = (argc > 3) ? std::atof(argv[3]) : 2.0;
+  double radius = (argc > 4) ? std::atof(argv[4]) : 10.0;
+
+  try
+  {
+    double lat = 0;
+    double lon = 0;
+    std::vector<BathymetryGrid::Sample> samples;
+
+    if (DUNE::Utils::String::endsWith(input, ".xyz"))
+      readXYZ(input, lat, lon, samples);
+    else
+      BathymetryGrid::readConfig(input, lat, lon, samples);
+
+    BathymetryGrid grid(lat, lon, samples, resolution, radius);
+    grid.save(output);
+
+    std::cout << "samples: " << samples.size() << std::endl
+              << "nodes: " << grid.getRows() << " x " << grid.getColumns() << std::endl
+              << "resolution: " << grid.getResolution() << " m" << std::endl;
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
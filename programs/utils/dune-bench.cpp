@@ -0,0 +1,727 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Utility program to benchmark hot paths of the DUNE library.              *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// ISO C++ 11 headers.
+#include <functional>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+//! Sink for benchmark results, prevents the compiler from removing
+//! the benchmarked code.
+static volatile uint64_t s_sink = 0;
+
+//! Benchmarked operation, runs the operation the given number of times.
+typedef std::function<void(uint64_t)> Operation;
+
+//! Benchmark definition.
+struct Benchmark
+{
+  //! Benchmark name.
+  std::string name;
+  //! Bytes processed per operation (0 if not applicable).
+  double bytes;
+  //! Minimum measurement time scale.
+  double scale;
+  //! Operation.
+  Operation run;
+};
+
+//! Benchmark result.
+struct Result
+{
+  //! Benchmark name.
+  std::string name;
+  //! Iterations per measurement.
+  uint64_t iterations;
+  //! Best time per operation (ns).
+  double ns_per_op;
+  //! Throughput (MB/s, 0 if not applicable).
+  double mb_per_s;
+};
+
+//! Task counting consumed messages, used to benchmark the bus.
+class Subscriber: public Tasks::Task
+{
+public:
+  uint64_t count;
+
+  Subscriber(Tasks::Context& ctx):
+    Tasks::Task("Subscriber", ctx),
+    count(0)
+  {
+    bind<IMC::EstimatedState>(this);
+  }
+
+  void
+  consume(const IMC::EstimatedState* msg)
+  {
+    count += msg->getSource();
+  }
+
+  void
+  drain(void)
+  {
+    waitForMessages(0.0);
+  }
+
+  void
+  onMain(void)
+  { }
+};
+
+//! Measure a benchmark: the iteration count is calibrated until a
+//! measurement lasts the minimum time and the best of three
+//! measurements is kept.
+static Result
+measure(const Benchmark& bench, double min_time)
+{
+  const uint64_t target = (uint64_t)(min_time * bench.scale * 1e9);
+  uint64_t n = 1;
+  uint64_t elapsed = 0;
+
+  while (true)
+  {
+    uint64_t begin = Clock::getNsec();
+    bench.run(n);
+    elapsed = Clock::getNsec() - begin;
+
+    if (elapsed >= target)
+      break;
+
+    if (elapsed < target / 100)
+      n *= 10;
+    else
+      n = (uint64_t)(n * (1.2 * target / elapsed)) + 1;
+  }
+
+  for (unsigned i = 0; i < 2; ++i)
+  {
+    uint64_t begin = Clock::getNsec();
+    bench.run(n);
+    uint64_t dt = Clock::getNsec() - begin;
+    if (dt < elapsed)
+      elapsed = dt;
+  }
+
+  Result r;
+  r.name = bench.name;
+  r.iterations = n;
+  r.ns_per_op = (double)elapsed / n;
+  r.mb_per_s = (bench.bytes > 0) ? (bench.bytes * 1e3 / r.ns_per_op) : 0;
+  return r;
+}
+
+static void
+add(std::vector<Benchmark>& list, const std::string& name, double bytes, Operation op, double scale = 1.0)
+{
+  Benchmark b;
+  b.name = name;
+  b.bytes = bytes;
+  b.scale = scale;
+  b.run = op;
+  list.push_back(b);
+}
+
+//! IMC serialization, deserialization and JSON formatting of every
+//! message type.
+static void
+addIMC(std::vector<Benchmark>& list)
+{
+  static std::vector<IMC::Message*> s_msgs;
+  static std::vector<IMC::Message*> s_outs;
+  static std::vector<uint8_t> s_bfr(65535);
+
+  std::vector<uint32_t> ids;
+  IMC::Factory::getIds(ids);
+
+  for (size_t i = 0; i < ids.size(); ++i)
+  {
+    IMC::Message* msg = IMC::Factory::produce(ids[i]);
+    if (msg == NULL)
+      continue;
+
+    s_msgs.push_back(msg);
+    s_outs.push_back(IMC::Factory::produce(ids[i]));
+  }
+
+  for (size_t i = 0; i < s_msgs.size(); ++i)
+  {
+    const IMC::Message* msg = s_msgs[i];
+    IMC::Message* out = s_outs[i];
+    std::string abbrev = msg->getName();
+    uint16_t size = IMC::Packet::serialize(msg, &s_bfr[0], s_bfr.size());
+
+    add(list, "imc.serialize." + abbrev, size, [msg](uint64_t n)
+        {
+          uint8_t bfr[65535];
+          for (uint64_t k = 0; k < n; ++k)
+            s_sink += IMC::Packet::serialize(msg, bfr, sizeof(bfr));
+        }, 0.1);
+
+    std::vector<uint8_t> data(&s_bfr[0], &s_bfr[0] + size);
+    add(list, "imc.deserialize." + abbrev, size, [data, out](uint64_t n)
+        {
+          for (uint64_t k = 0; k < n; ++k)
+          {
+            IMC::Packet::deserialize(&data[0], data.size(), out);
+            s_sink += out->getTimeStamp() > 0;
+          }
+        }, 0.1);
+
+    add(list, "imc.json." + abbrev, 0, [msg](uint64_t n)
+        {
+          std::ostringstream os;
+          for (uint64_t k = 0; k < n; ++k)
+          {
+            os.str("");
+            msg->toJSON(os);
+            s_sink += os.tellp();
+          }
+        }, 0.1);
+  }
+
+  add(list, "imc.serialize.all", 0, [](uint64_t n)
+      {
+        for (uint64_t k = 0; k < n; ++k)
+        {
+          for (size_t i = 0; i < s_msgs.size(); ++i)
+            s_sink += IMC::Packet::serialize(s_msgs[i], &s_bfr[0], s_bfr.size());
+        }
+      });
+
+  add(list, "imc.deserialize.all", 0, [](uint64_t n)
+      {
+        for (uint64_t k = 0; k < n; ++k)
+        {
+          for (size_t i = 0; i < s_msgs.size(); ++i)
+          {
+            uint16_t size = IMC::Packet::serialize(s_msgs[i], &s_bfr[0], s_bfr.size());
+            IMC::Packet::deserialize(&s_bfr[0], size, s_outs[i]);
+          }
+        }
+      });
+}
+
+//! Bus dispatch with a varying number of subscribers.
+static void
+addBus(std::vector<Benchmark>& list)
+{
+  static const unsigned c_subscribers[] = {1, 4, 16, 64};
+
+  for (unsigned i = 0; i < sizeof(c_subscribers) / sizeof(c_subscribers[0]); ++i)
+  {
+    unsigned count = c_subscribers[i];
+    add(list, String::str("imc.bus.dispatch.%u", count), 0, [count](uint64_t n)
+        {
+          Tasks::Context ctx;
+          std::vector<Subscriber*> subs;
+          for (unsigned s = 0; s < count; ++s)
+            subs.push_back(new Subscriber(ctx));
+
+          IMC::EstimatedState msg;
+          msg.setSource(1);
+
+          for (uint64_t k = 0; k < n; ++k)
+          {
+            ctx.mbus.dispatch(&msg);
+
+            if ((k & 255) == 255 || k + 1 == n)
+            {
+              for (unsigned s = 0; s < count; ++s)
+                subs[s]->drain();
+            }
+          }
+
+          for (unsigned s = 0; s < count; ++s)
+          {
+            s_sink += subs[s]->count;
+            delete subs[s];
+          }
+        });
+  }
+}
+
+//! CRC-16 of buffers of several sizes.
+static void
+addCRC16(std::vector<Benchmark>& list)
+{
+  static const unsigned c_sizes[] = {64, 1024, 65535};
+  static std::vector<uint8_t> s_data(65535);
+  for (size_t i = 0; i < s_data.size(); ++i)
+    s_data[i] = (uint8_t)(i * 31 + 7);
+
+  for (unsigned i = 0; i < sizeof(c_sizes) / sizeof(c_sizes[0]); ++i)
+  {
+    uint16_t size = (uint16_t)c_sizes[i];
+    add(list, String::str("crc16.%u", size), size, [size](uint64_t n)
+        {
+          for (uint64_t k = 0; k < n; ++k)
+            s_sink += Algorithms::CRC16::compute(&s_data[0], size, (uint16_t)k);
+        });
+  }
+}
+
+//! Compression methods on a log-like data block.
+static void
+addCompression(std::vector<Benchmark>& list)
+{
+  static const Compression::Methods c_methods[] =
+  {
+    Compression::METHOD_ZLIB,
+    Compression::METHOD_GZIP,
+    Compression::METHOD_BZIP2
+  };
+
+  static std::string s_text;
+  while (s_text.size() < 64 * 1024)
+    s_text += String::str("$GPGGA,%06u.00,4111.1000,N,00842.3600,W,1,08,0.9,%u.0,M,52.0,M,,*47\r\n",
+                          (unsigned)s_text.size(), (unsigned)(s_text.size() % 997));
+  s_text.resize(64 * 1024);
+
+  for (unsigned i = 0; i < sizeof(c_methods) / sizeof(c_methods[0]); ++i)
+  {
+    Compression::Methods method = c_methods[i];
+    std::string name = Compression::Factory::method(method);
+
+    add(list, "compression." + name + ".compress", s_text.size(), [method](uint64_t n)
+        {
+          Compression::Compressor* c = Compression::Factory::compressor(method);
+          std::vector<char> src(s_text.begin(), s_text.end());
+          std::vector<char> dst(src.size() * 2 + 1024);
+          for (uint64_t k = 0; k < n; ++k)
+          {
+            c->compress(&dst[0], dst.size(), &src[0], src.size());
+            s_sink += c->compressed();
+          }
+          delete c;
+        });
+
+    add(list, "compression." + name + ".decompress", s_text.size(), [method](uint64_t n)
+        {
+          Compression::Compressor* c = Compression::Factory::compressor(method);
+          std::vector<char> src(s_text.begin(), s_text.end());
+          std::vector<char> packed(src.size() * 2 + 1024);
+          c->compress(&packed[0], packed.size(), &src[0], src.size());
+          packed.resize(c->compressed());
+          delete c;
+
+          std::vector<char> dst(src.size() + 1024);
+          for (uint64_t k = 0; k < n; ++k)
+          {
+            Compression::Decompressor* d = Compression::Factory::decompressor(method);
+            d->decompress(&dst[0], dst.size(), &packed[0], packed.size());
+            s_sink += d->decompressed();
+            delete d;
+          }
+        });
+  }
+}
+
+//! Matrix kernels at sizes typical of navigation filters.
+static void
+addMatrix(std::vector<Benchmark>& list)
+{
+  static const unsigned c_sizes[] = {3, 6, 12};
+
+  for (unsigned i = 0; i < sizeof(c_sizes) / sizeof(c_sizes[0]); ++i)
+  {
+    unsigned size = c_sizes[i];
+    Math::Matrix a(size, size);
+    for (unsigned r = 0; r < size; ++r)
+    {
+      for (unsigned c = 0; c < size; ++c)
+        a(r, c) = (r == c) ? size + 1.0 : 1.0 / (1.0 + r + 2 * c);
+    }
+
+    add(list, String::str("math.matrix.multiply.%u", size), 0, [a](uint64_t n)
+        {
+          Math::Matrix b = a;
+          for (uint64_t k = 0; k < n; ++k)
+          {
+            Math::Matrix c = a * b;
+            s_sink += c(0, 0) > 0;
+          }
+        });
+
+    add(list, String::str("math.matrix.transpose.%u", size), 0, [a](uint64_t n)
+        {
+          for (uint64_t k = 0; k < n; ++k)
+          {
+            Math::Matrix t = transpose(a);
+            s_sink += t(0, 0) > 0;
+          }
+        });
+
+    add(list, String::str("math.matrix.inverse.%u", size), 0, [a](uint64_t n)
+        {
+          for (uint64_t k = 0; k < n; ++k)
+          {
+            Math::Matrix inv = inverse(a);
+            s_sink += inv(0, 0) > 0;
+          }
+        });
+
+    add(list, String::str("math.matrix.covariance.%u", size), 0, [a, size](uint64_t n)
+        {
+          // Covariance propagation step: F * P * F' + Q.
+          Math::Matrix p = a;
+          Math::Matrix q(size, size, 0.01);
+          for (uint64_t k = 0; k < n; ++k)
+          {
+            Math::Matrix r = a * p * transpose(a) + q;
+            s_sink += r(0, 0) > 0;
+          }
+        });
+  }
+}
+
+//! WGS-84 conversions.
+static void
+addWGS84(std::vector<Benchmark>& list)
+{
+  static const double c_lat = Angles::radians(41.1850);
+  static const double c_lon = Angles::radians(-8.7060);
+
+  add(list, "wgs84.toECEF", 0, [](uint64_t n)
+      {
+        double x, y, z;
+        for (uint64_t k = 0; k < n; ++k)
+        {
+          WGS84::toECEF(c_lat + k * 1e-9, c_lon, 10.0, &x, &y, &z);
+          s_sink += x > 0;
+        }
+      });
+
+  add(list, "wgs84.fromECEF", 0, [](uint64_t n)
+      {
+        double x, y, z;
+        WGS84::toECEF(c_lat, c_lon, 10.0, &x, &y, &z);
+        for (uint64_t k = 0; k < n; ++k)
+        {
+          double lat, lon, hae;
+          WGS84::fromECEF(x + k * 1e-3, y, z, &lat, &lon, &hae);
+          s_sink += lat > 0;
+        }
+      });
+
+  add(list, "wgs84.displacement", 0, [](uint64_t n)
+      {
+        for (uint64_t k = 0; k < n; ++k)
+        {
+          double north, east, down;
+          WGS84::displacement(c_lat, c_lon, 0.0, c_lat + 1e-4 + k * 1e-12, c_lon + 1e-4, 5.0, &north, &east, &down);
+          s_sink += north > 0;
+        }
+      });
+
+  add(list, "wgs84.displace", 0, [](uint64_t n)
+      {
+        for (uint64_t k = 0; k < n; ++k)
+        {
+          double lat = c_lat;
+          double lon = c_lon;
+          double hae = 0.0;
+          WGS84::displace(100.0 + k * 1e-6, 50.0, 2.0, &lat, &lon, &hae);
+          s_sink += lat > 0;
+        }
+      });
+}
+
+//! NMEA sentence parsing.
+static void
+addNMEA(std::vector<Benchmark>& list)
+{
+  static const std::string c_gga = "$GPGGA,123519.00,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*69";
+  double bytes = c_gga.size();
+
+  add(list, "nmea.tokenizer.gga", bytes, [](uint64_t n)
+      {
+        Parsers::NMEATokenizer stn;
+        for (uint64_t k = 0; k < n; ++k)
+        {
+          double lat = 0;
+          double hdop = 0;
+          if (stn.parse(c_gga) == Parsers::NMEATokenizer::NMEA_OK)
+          {
+            stn.readLatitude(2, lat);
+            stn.readNumber(8, hdop);
+          }
+          s_sink += lat > 0 && hdop > 0;
+        }
+      });
+
+  add(list, "nmea.reader.gga", bytes, [](uint64_t n)
+      {
+        for (uint64_t k = 0; k < n; ++k)
+        {
+          Parsers::NMEAReader stn(c_gga);
+          std::string time;
+          double lat = 0;
+          stn >> time >> lat;
+          s_sink += lat > 0;
+        }
+      });
+}
+
+//! Write results as JSON, one benchmark per line.
+static void
+writeJSON(std::ostream& os, const std::vector<Result>& results, double min_time)
+{
+  os << "{\n"
+     << "  \"program\": \"dune-bench\",\n"
+     << "  \"version\": \"" << getFullVersion() << "\",\n"
+     << "  \"min_time\": " << min_time << ",\n"
+     << "  \"results\": [\n";
+
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    const Result& r = results[i];
+    os << String::str("    {\"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %0.3f, \"mb_per_s\": %0.3f}%s\n",
+                      r.name.c_str(), (unsigned long long)r.iterations, r.ns_per_op, r.mb_per_s,
+                      (i + 1 < results.size()) ? "," : "");
+  }
+
+  os << "  ]\n}\n";
+}
+
+//! Load the time per operation of a results file written by
+//! writeJSON().
+static bool
+loadBaseline(const char* file, std::map<std::string, double>& baseline)
+{
+  std::ifstream ifs(file);
+  if (!ifs)
+    return false;
+
+  std::string line;
+  while (std::getline(ifs, line))
+  {
+    size_t name = line.find("\"name\": \"");
+    size_t ns = line.find("\"ns_per_op\": ");
+    if (name == std::string::npos || ns == std::string::npos)
+      continue;
+
+    name += 9;
+    size_t end = line.find('"', name);
+    if (end == std::string::npos)
+      continue;
+
+    baseline[line.substr(name, end - name)] = std::atof(line.c_str() + ns + 13);
+  }
+
+  return true;
+}
+
+//! Compare results against a baseline.
+//! @return number of regressions.
+static unsigned
+compare(const std::vector<Result>& results, const std::map<std::string, double>& baseline, double threshold)
+{
+  unsigned regressions = 0;
+
+  std::fprintf(stderr, "%-48s %14s %14s %9s\n", "benchmark", "baseline (ns)", "current (ns)", "change");
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    std::map<std::string, double>::const_iterator itr = baseline.find(results[i].name);
+    if (itr == baseline.end() || itr->second <= 0)
+    {
+      std::fprintf(stderr, "%-48s %14s %14.3f %9s\n", results[i].name.c_str(), "-", results[i].ns_per_op, "new");
+      continue;
+    }
+
+    double change = 100.0 * (results[i].ns_per_op - itr->second) / itr->second;
+    const char* flag = "";
+    if (change > threshold)
+    {
+      flag = "  REGRESSION";
+      ++regressions;
+    }
+    else if (change < -threshold)
+    {
+      flag = "  improved";
+    }
+
+    std::fprintf(stderr, "%-48s %14.3f %14.3f %+8.1f%%%s\n", results[i].name.c_str(),
+                 itr->second, results[i].ns_per_op, change, flag);
+  }
+
+  std::fprintf(stderr, "%u regression(s) above %0.1f%%\n", regressions, threshold);
+  return regressions;
+}
+
+static void
+usage(void)
+{
+  std::cerr << "Usage:\n\tdune-bench [options]\n"
+            << "Options:\n"
+            << "\t-f filter : only run benchmarks whose name contains filter\n"
+            << "\t-l : list benchmarks and exit\n"
+            << "\t-m seconds : minimum measurement time (default is 0.1)\n"
+            << "\t-o file : write JSON results to file (default is standard output)\n"
+            << "\t-c file : compare results against a baseline JSON file\n"
+            << "\t-t percent : regression threshold for -c (default is 10)\n\n"
+            << "With -c the exit status is 2 if any benchmark regressed.\n";
+}
+
+int
+main(int argc, char** argv)
+{
+  std::string filter;
+  const char* output = NULL;
+  const char* baseline_file = NULL;
+  double min_time = 0.1;
+  double threshold = 10.0;
+  bool list_only = false;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "-l") == 0)
+    {
+      list_only = true;
+      continue;
+    }
+
+    if (argv[i][0] != '-' || i + 1 >= argc)
+    {
+      usage();
+      return 1;
+    }
+
+    char* aux;
+    if (std::strcmp(argv[i], "-f") == 0)
+    {
+      filter = argv[++i];
+    }
+    else if (std::strcmp(argv[i], "-o") == 0)
+    {
+      output = argv[++i];
+    }
+    else if (std::strcmp(argv[i], "-c") == 0)
+    {
+      baseline_file = argv[++i];
+    }
+    else if (std::strcmp(argv[i], "-m") == 0)
+    {
+      min_time = std::strtod(argv[++i], &aux);
+      if (*aux != 0 || min_time <= 0)
+      {
+        std::cerr << "Invalid minimum time: " << argv[i] << std::endl;
+        return 1;
+      }
+    }
+    else if (std::strcmp(argv[i], "-t") == 0)
+    {
+      threshold = std::strtod(argv[++i], &aux);
+      if (*aux != 0 || threshold < 0)
+      {
+        std::cerr << "Invalid threshold: " << argv[i] << std::endl;
+        return 1;
+      }
+    }
+    else
+    {
+      usage();
+      return 1;
+    }
+  }
+
+  std::map<std::string, double> baseline;
+  if (baseline_file != NULL && !loadBaseline(baseline_file, baseline))
+  {
+    std::cerr << "ERROR: unable to read baseline " << baseline_file << std::endl;
+    return 1;
+  }
+
+  std::vector<Benchmark> benchmarks;
+  addIMC(benchmarks);
+  addBus(benchmarks);
+  addCRC16(benchmarks);
+  addCompression(benchmarks);
+  addMatrix(benchmarks);
+  addWGS84(benchmarks);
+  addNMEA(benchmarks);
+
+  std::vector<Result> results;
+  for (size_t i = 0; i < benchmarks.size(); ++i)
+  {
+    if (!filter.empty() && benchmarks[i].name.find(filter) == std::string::npos)
+      continue;
+
+    if (list_only)
+    {
+      std::cout << benchmarks[i].name << std::endl;
+      continue;
+    }
+
+    try
+    {
+      Result r = measure(benchmarks[i], min_time);
+      std::fprintf(stderr, "%-48s %12.3f ns/op\n", r.name.c_str(), r.ns_per_op);
+      results.push_back(r);
+    }
+    catch (std::exception& e)
+    {
+      std::cerr << "ERROR: " << benchmarks[i].name << ": " << e.what() << std::endl;
+    }
+  }
+
+  if (list_only)
+    return 0;
+
+  if (output != NULL)
+  {
+    std::ofstream ofs(output);
+    writeJSON(ofs, results, min_time);
+  }
+  else
+  {
+    writeJSON(std::cout, results, min_time);
+  }
+
+  if (baseline_file != NULL && compare(results, baseline, threshold) > 0)
+    return 2;
+
+  return 0;
+}
@@ -0,0 +1,137 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Utility program to serve raw device stream captures to drivers.          *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+static void
+usage(void)
+{
+  std::cerr << "Usage:\n\tdune-devreplay [options] file\n"
+            << "Options:\n\t-s speed : replay speed (0 for maximum speed, default is 1.0)\n"
+            << "\t-p port : serve through a TCP server on the given port (default)\n"
+            << "\t-t : serve through a pseudo-terminal\n\n"
+            << "Point the driver to tcp://127.0.0.1:PORT or to the printed terminal.\n";
+}
+
+int
+main(int argc, char** argv)
+{
+  double speed = 1.0;
+  unsigned port = 0;
+  bool terminal = false;
+  int i = 1;
+
+  for (; i < argc && argv[i][0] == '-'; ++i)
+  {
+    if (std::strcmp(argv[i], "-t") == 0)
+    {
+      terminal = true;
+      continue;
+    }
+
+    if (i + 1 >= argc)
+    {
+      usage();
+      return 1;
+    }
+
+    char* aux;
+    if (std::strcmp(argv[i], "-s") == 0)
+    {
+      speed = std::strtod(argv[++i], &aux);
+      if (*aux != 0 || speed < 0)
+      {
+        std::cerr << "Invalid speed setting: " << argv[i] << std::endl;
+        return 1;
+      }
+    }
+    else if (std::strcmp(argv[i], "-p") == 0)
+    {
+      port = std::strtoul(argv[++i], &aux, 10);
+      if (*aux != 0 || port > 65535)
+      {
+        std::cerr << "Invalid port: " << argv[i] << std::endl;
+        return 1;
+      }
+    }
+    else
+    {
+      usage();
+      return 1;
+    }
+  }
+
+  if (i + 1 != argc)
+  {
+    usage();
+    return 1;
+  }
+
+  try
+  {
+    Hardware::DeviceReplay replay(argv[i], speed);
+
+    if (terminal)
+      std::cout << "serving on " << replay.openTerminal() << std::endl;
+    else
+      std::cout << "serving on tcp://127.0.0.1:" << replay.listenTCP(port) << std::endl;
+
+    if (terminal)
+    {
+      std::cout << "press enter after opening the terminal" << std::endl;
+      std::cin.get();
+    }
+
+    replay.start();
+
+    while (!replay.isFinished())
+      Delay::wait(0.1);
+
+    double elapsed = replay.getElapsed();
+    std::cout << "served " << replay.getBytes() << " bytes in "
+              << elapsed << " s" << std::endl;
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,369 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Utility program to compute message chain latencies from trace files.     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+//! Maximum number of hops of a chain.
+static const unsigned c_max_hops = 64;
+//! Number of histogram bins (powers of two of microseconds).
+static const unsigned c_bins = 24;
+
+//! Delivery of a message to a task.
+struct Delivery
+{
+  //! Dequeue time.
+  uint64_t dequeue;
+  //! Consume time.
+  uint64_t consume;
+};
+
+//! Dispatched message.
+struct Span
+{
+  //! Trace identifier.
+  uint32_t trace;
+  //! Parent span.
+  uint32_t parent;
+  //! Message identifier.
+  uint16_t id;
+  //! Source entity.
+  uint16_t entity;
+  //! Dispatch time.
+  uint64_t dispatch;
+  //! Deliveries by consumer entity.
+  std::map<uint16_t, Delivery> deliveries;
+};
+
+//! Hop statistics.
+struct Hop
+{
+  //! Name of the hop.
+  std::string name;
+  //! Accumulated queueing time (ns).
+  double queue;
+  //! Accumulated handling time (ns).
+  double handling;
+};
+
+//! Chain statistics.
+struct Chain
+{
+  //! End-to-end latencies (ns).
+  std::vector<uint64_t> latencies;
+  //! Hops.
+  std::vector<Hop> hops;
+};
+
+static std::map<unsigned, std::string> s_labels;
+
+static std::string
+getLabel(unsigned eid)
+{
+  std::map<unsigned, std::string>::const_iterator itr = s_labels.find(eid);
+  if (itr != s_labels.end())
+    return itr->second;
+  return String::str("entity %u", eid);
+}
+
+static bool
+load(const char* file, std::map<uint32_t, Span>& spans)
+{
+  std::FILE* fd = std::fopen(file, "rb");
+  if (fd == NULL)
+  {
+    std::cerr << "ERROR: unable to open " << file << std::endl;
+    return false;
+  }
+
+  char magic[sizeof(Tasks::Tracer::c_magic)];
+  if (std::fread(magic, sizeof(magic), 1, fd) != 1
+      || std::memcmp(magic, Tasks::Tracer::c_magic, sizeof(magic)) != 0)
+  {
+    std::cerr << "ERROR: " << file << " is not a trace file" << std::endl;
+    std::fclose(fd);
+    return false;
+  }
+
+  Tasks::Tracer::Event ev;
+  while (std::fread(&ev, sizeof(ev), 1, fd) == 1)
+  {
+    switch (ev.type)
+    {
+      case Tasks::Tracer::EV_DISPATCH:
+        {
+          Span& span = spans[ev.span];
+          span.trace = ev.trace;
+          span.parent = ev.parent;
+          span.id = ev.id;
+          span.entity = ev.entity;
+          span.dispatch = ev.time;
+        }
+        break;
+
+      case Tasks::Tracer::EV_DEQUEUE:
+        spans[ev.span].deliveries[ev.entity].dequeue = ev.time;
+        break;
+
+      case Tasks::Tracer::EV_CONSUME:
+        spans[ev.span].deliveries[ev.entity].consume = ev.time;
+        break;
+
+      case Tasks::Tracer::EV_LABEL:
+        {
+          std::string label(ev.trace, 0);
+          if (std::fread(&label[0], 1, ev.trace, fd) != ev.trace)
+            break;
+          s_labels[ev.entity] = label;
+        }
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  std::fclose(fd);
+  return true;
+}
+
+static void
+usage(void)
+{
+  std::cerr << "Usage:\n\tdune-tracestat [options] <LatencyTrace.bin>\n"
+            << "Options:\n"
+            << "\t-n hops : minimum number of messages in a chain (default is 2)\n"
+            << "\t-e label : only chains ending at the task with the given entity label\n"
+            << "\t-m abbrev : only chains ending with the given message\n"
+            << "\t-H : print latency histograms\n";
+}
+
+static double
+percentile(const std::vector<uint64_t>& sorted, double p)
+{
+  size_t index = (size_t)(p * (sorted.size() - 1) + 0.5);
+  return sorted[index] / 1e6;
+}
+
+int
+main(int argc, char** argv)
+{
+  unsigned min_hops = 2;
+  std::string entity;
+  std::string message;
+  bool histogram = false;
+  const char* file = NULL;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "-H") == 0)
+      histogram = true;
+    else if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+      min_hops = std::atoi(argv[++i]);
+    else if (std::strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+      entity = argv[++i];
+    else if (std::strcmp(argv[i], "-m") == 0 && i + 1 < argc)
+      message = argv[++i];
+    else if (argv[i][0] != '-' && file == NULL)
+      file = argv[i];
+    else
+    {
+      usage();
+      return 1;
+    }
+  }
+
+  if (file == NULL)
+  {
+    usage();
+    return 1;
+  }
+
+  std::map<uint32_t, Span> spans;
+  if (!load(file, spans))
+    return 1;
+
+  std::map<std::string, Chain> chains;
+  std::map<uint32_t, Span>::const_iterator itr = spans.begin();
+  for (; itr != spans.end(); ++itr)
+  {
+    const Span& last = itr->second;
+    if (last.dispatch == 0)
+      continue;
+
+    // Rebuild the path from the root of the trace.
+    std::vector<const Span*> path;
+    const Span* span = &last;
+    while (span != NULL && path.size() < c_max_hops)
+    {
+      path.push_back(span);
+      if (span->parent == 0)
+        break;
+
+      std::map<uint32_t, Span>::const_iterator parent = spans.find(span->parent);
+      span = (parent == spans.end() || parent->second.dispatch == 0) ? NULL : &parent->second;
+    }
+
+    // Incomplete chains (events lost or emitted before the start
+    // of the trace) are ignored.
+    if (path.back()->parent != 0 || path.size() < min_hops)
+      continue;
+
+    std::reverse(path.begin(), path.end());
+
+    if (!message.empty() && IMC::Factory::getAbbrevFromId(last.id) != message)
+      continue;
+
+    std::string prefix;
+    for (size_t i = 0; i < path.size(); ++i)
+    {
+      if (i > 0)
+        prefix += " > ";
+      prefix += IMC::Factory::getAbbrevFromId(path[i]->id);
+    }
+
+    std::map<uint16_t, Delivery>::const_iterator d = last.deliveries.begin();
+    for (; d != last.deliveries.end(); ++d)
+    {
+      if (d->second.dequeue == 0 || d->second.consume == 0)
+        continue;
+
+      std::string consumer = getLabel(d->first);
+      if (!entity.empty() && consumer != entity)
+        continue;
+
+      Chain& chain = chains[prefix + " @ " + consumer];
+      if (chain.hops.empty())
+      {
+        chain.hops.resize(path.size());
+        for (size_t i = 0; i < path.size(); ++i)
+        {
+          unsigned to = (i + 1 < path.size()) ? path[i + 1]->entity : d->first;
+          chain.hops[i].name = IMC::Factory::getAbbrevFromId(path[i]->id) + " -> " + getLabel(to);
+          chain.hops[i].queue = 0;
+          chain.hops[i].handling = 0;
+        }
+      }
+
+      for (size_t i = 0; i < path.size(); ++i)
+      {
+        uint64_t dequeue;
+        uint64_t done;
+        if (i + 1 < path.size())
+        {
+          std::map<uint16_t, Delivery>::const_iterator h = path[i]->deliveries.find(path[i + 1]->entity);
+          dequeue = (h == path[i]->deliveries.end() || h->second.dequeue == 0)
+          ? path[i]->dispatch : h->second.dequeue;
+          done = path[i + 1]->dispatch;
+        }
+        else
+        {
+          dequeue = d->second.dequeue;
+          done = d->second.consume;
+        }
+
+        chain.hops[i].queue += (double)(int64_t)(dequeue - path[i]->dispatch);
+        chain.hops[i].handling += (double)(int64_t)(done - dequeue);
+      }
+
+      chain.latencies.push_back(d->second.consume - path[0]->dispatch);
+    }
+  }
+
+  if (chains.empty())
+  {
+    std::cerr << "no complete chains found" << std::endl;
+    return 0;
+  }
+
+  // Most frequent chains first.
+  std::vector<std::pair<size_t, std::string> > order;
+  std::map<std::string, Chain>::iterator c = chains.begin();
+  for (; c != chains.end(); ++c)
+    order.push_back(std::make_pair(c->second.latencies.size(), c->first));
+  std::sort(order.rbegin(), order.rend());
+
+  for (size_t k = 0; k < order.size(); ++k)
+  {
+    Chain& chain = chains[order[k].second];
+    std::vector<uint64_t>& lat = chain.latencies;
+    std::sort(lat.begin(), lat.end());
+    double n = lat.size();
+
+    std::printf("%s\n", order[k].second.c_str());
+    std::printf("  samples: %zu  min: %0.3f ms  p50: %0.3f ms  p90: %0.3f ms  p99: %0.3f ms  max: %0.3f ms\n",
+                lat.size(), lat.front() / 1e6, percentile(lat, 0.5), percentile(lat, 0.9),
+                percentile(lat, 0.99), lat.back() / 1e6);
+
+    std::printf("  %-48s %14s %14s\n", "hop", "queue (ms)", "handling (ms)");
+    for (size_t i = 0; i < chain.hops.size(); ++i)
+      std::printf("  %-48s %14.3f %14.3f\n", chain.hops[i].name.c_str(),
+                  chain.hops[i].queue / n / 1e6, chain.hops[i].handling / n / 1e6);
+
+    if (histogram)
+    {
+      std::vector<unsigned> bins(c_bins, 0);
+      unsigned peak = 0;
+      for (size_t i = 0; i < lat.size(); ++i)
+      {
+        unsigned bin = 0;
+        for (uint64_t us = lat[i] / 1000; us > 1 && bin + 1 < c_bins; us >>= 1)
+          ++bin;
+        peak = std::max(peak, ++bins[bin]);
+      }
+
+      for (unsigned i = 0; i < c_bins; ++i)
+      {
+        if (bins[i] == 0)
+          continue;
+
+        std::string bar((size_t)(40.0 * bins[i] / peak + 0.5), '#');
+        std::printf("  [%9u, %9u) us %-40s %u\n", i ? (1u << i) : 0, 1u << (i + 1), bar.c_str(), bins[i]);
+      }
+    }
+
+    std::printf("\n");
+  }
+
+  return 0;
+}
@@ -55,6 +55,7 @@ namespace DUNE
 #include <DUNE/Concurrency/TSQueue.hpp>
 #include <DUNE/Concurrency/Process.hpp>
 #include <DUNE/Concurrency/SharedMemory.hpp>
+#include <DUNE/Concurrency/BulkRing.hpp>
 #include <DUNE/Concurrency/Semaphore.hpp>
 
 #endif
@@ -0,0 +1,287 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <map>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/BulkRing.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Time/Delay.hpp>
+
+#if defined(DUNE_SYS_HAS___SYNC_BOOL_COMPARE_AND_SWAP) && defined(DUNE_SYS_HAS___SYNC_SYNCHRONIZE)
+#  define DUNE_BULK_RING_ATOMICS
+#endif
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    //! Magic string at the start of an encoded handle.
+    static const char c_handle_magic[8] = {'D', 'U', 'N', 'E', 'B', 'L', 'K', '1'};
+    //! Alignment of payloads.
+    static const unsigned c_align = 8;
+    //! Size reserved for the control block.
+    static const unsigned c_control_size = 128;
+
+    struct BulkRing::Control
+    {
+      //! Magic string, allows other processes to validate the area.
+      char magic[8];
+      //! Capacity of the payload area.
+      uint32_t capacity;
+      //! Padding.
+      uint32_t reserved0;
+      //! End of the stream region reserved by the producer.
+      volatile uint64_t reserved;
+      //! Pinned positions (offset by one, zero means free).
+      volatile uint64_t pins[c_max_pins];
+    };
+
+    //! Registry of rings of this process.
+    static Mutex&
+    registryLock(void)
+    {
+      static Mutex lock;
+      return lock;
+    }
+
+    static std::map<uint32_t, BulkRing*>&
+    registry(void)
+    {
+      static std::map<uint32_t, BulkRing*> rings;
+      return rings;
+    }
+
+    static inline void
+    memoryBarrier(void)
+    {
+#if defined(DUNE_BULK_RING_ATOMICS)
+      __sync_synchronize();
+#endif
+    }
+
+    BulkRing::Access::Access(const Handle& handle):
+      m_ring(NULL),
+      m_slot(-1),
+      m_data(NULL),
+      m_size(0)
+    {
+      ScopedMutex l(registryLock());
+
+      std::map<uint32_t, BulkRing*>::iterator itr = registry().find(handle.ring);
+      if (itr == registry().end())
+        return;
+
+      m_slot = itr->second->pin(handle);
+      if (m_slot < 0)
+        return;
+
+      m_ring = itr->second;
+      m_data = m_ring->m_data + (handle.position % m_ring->m_capacity);
+      m_size = handle.size;
+    }
+
+    BulkRing::Access::~Access(void)
+    {
+      if (m_ring != NULL)
+        m_ring->unpin(m_slot);
+    }
+
+    BulkRing::BulkRing(const char* name, unsigned capacity):
+      m_shm(name, c_control_size + capacity),
+      m_ctl(NULL),
+      m_data(NULL),
+      m_capacity(capacity),
+      m_rejected(0)
+    {
+      m_shm.create();
+
+      char* base = static_cast<char*>(*m_shm);
+      if (base == NULL)
+      {
+        m_local.resize(c_control_size + capacity);
+        base = &m_local[0];
+      }
+
+      std::memset(base, 0, c_control_size);
+      m_ctl = reinterpret_cast<Control*>(base);
+      std::memcpy(m_ctl->magic, c_handle_magic, sizeof(m_ctl->magic));
+      m_ctl->capacity = capacity;
+      m_ctl->reserved = capacity;
+      m_data = base + c_control_size;
+
+      ScopedMutex l(registryLock());
+      static uint32_t next_id = 0;
+      m_id = ++next_id;
+      registry()[m_id] = this;
+    }
+
+    BulkRing::~BulkRing(void)
+    {
+      {
+        ScopedMutex l(registryLock());
+        registry().erase(m_id);
+      }
+
+      // Wait for consumers still reading payloads.
+      for (unsigned i = 0; i < c_max_pins; ++i)
+      {
+        while (m_ctl->pins[i] != 0)
+          Time::Delay::waitMsec(1);
+      }
+    }
+
+    bool
+    BulkRing::write(const void* data, unsigned size, Handle& handle)
+    {
+#if defined(DUNE_BULK_RING_ATOMICS)
+      if (size == 0 || size > m_capacity / 2)
+      {
+        ++m_rejected;
+        return false;
+      }
+
+      // Payloads are never split: skip to the start of the ring when
+      // the payload does not fit before its end.
+      uint64_t previous = m_ctl->reserved;
+      uint64_t start = previous;
+      unsigned offset = start % m_capacity;
+      if (offset + size > m_capacity)
+        start += m_capacity - offset;
+
+      uint64_t end = start + ((size + c_align - 1) / c_align) * c_align;
+      uint64_t floor = end - m_capacity;
+
+      // Publish reservation before checking pins: a consumer pinning
+      // concurrently either sees the reservation or is seen here.
+      m_ctl->reserved = end;
+      memoryBarrier();
+
+      for (unsigned i = 0; i < c_max_pins; ++i)
+      {
+        uint64_t pin = m_ctl->pins[i];
+        if (pin != 0 && (pin - 1) < floor)
+        {
+          m_ctl->reserved = previous;
+          memoryBarrier();
+          ++m_rejected;
+          return false;
+        }
+      }
+
+      std::memcpy(m_data + (start % m_capacity), data, size);
+      memoryBarrier();
+
+      handle.ring = m_id;
+      handle.size = size;
+      handle.position = start;
+      return true;
+#else
+      (void)data;
+      (void)size;
+      (void)handle;
+      ++m_rejected;
+      return false;
+#endif
+    }
+
+    int
+    BulkRing::pin(const Handle& handle)
+    {
+#if defined(DUNE_BULK_RING_ATOMICS)
+      if (handle.size > m_capacity)
+        return -1;
+
+      for (unsigned i = 0; i < c_max_pins; ++i)
+      {
+        if (!__sync_bool_compare_and_swap(&m_ctl->pins[i], 0, handle.position + 1))
+          continue;
+
+        // Payload is valid if it was not reached by the producer.
+        if (handle.position + m_capacity >= m_ctl->reserved)
+          return i;
+
+        unpin(i);
+        return -1;
+      }
+#else
+      (void)handle;
+#endif
+
+      return -1;
+    }
+
+    void
+    BulkRing::unpin(int slot)
+    {
+      memoryBarrier();
+      m_ctl->pins[slot] = 0;
+    }
+
+    bool
+    BulkRing::fetch(const Handle& handle, std::vector<char>& data)
+    {
+      Access access(handle);
+      if (!access.isValid())
+        return false;
+
+      data.assign(access.getData(), access.getData() + access.getSize());
+      return true;
+    }
+
+    void
+    BulkRing::encode(const Handle& handle, std::vector<char>& data)
+    {
+      data.resize(c_handle_size);
+      std::memcpy(&data[0], c_handle_magic, sizeof(c_handle_magic));
+      std::memcpy(&data[8], &handle.ring, sizeof(handle.ring));
+      std::memcpy(&data[12], &handle.size, sizeof(handle.size));
+      std::memcpy(&data[16], &handle.position, sizeof(handle.position));
+    }
+
+    bool
+    BulkRing::decode(const std::vector<char>& data, Handle& handle)
+    {
+      if (data.size() != c_handle_size)
+        return false;
+
+      if (std::memcmp(&data[0], c_handle_magic, sizeof(c_handle_magic)) != 0)
+        return false;
+
+      std::memcpy(&handle.ring, &data[8], sizeof(handle.ring));
+      std::memcpy(&handle.size, &data[12], sizeof(handle.size));
+      std::memcpy(&handle.position, &data[16], sizeof(handle.position));
+      return true;
+    }
+  }
+}
@@ -0,0 +1,231 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_CONCURRENCY_BULK_RING_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_BULK_RING_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/SharedMemory.hpp>
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM BulkRing;
+
+    //! Single producer ring buffer for bulk payloads (sonar pings,
+    //! images, etc) backed by a shared memory area.
+    //!
+    //! Producers store a payload once and pass around a small Handle
+    //! instead of the payload itself. Payloads are overwritten when
+    //! the ring wraps, so consumers must pin a payload (see Access)
+    //! before reading it; the producer refuses to overwrite pinned
+    //! payloads and write() fails instead, leaving the caller to
+    //! fall back to sending the payload inline.
+    class BulkRing
+    {
+    public:
+      //! Reference to a payload stored in a ring.
+      struct Handle
+      {
+        //! Ring identifier.
+        uint32_t ring;
+        //! Payload size in bytes.
+        uint32_t size;
+        //! Absolute position of the payload in the ring's stream.
+        uint64_t position;
+      };
+
+      //! Scoped access to a payload. While an instance is valid
+      //! the producer will not overwrite the referenced payload.
+      class Access
+      {
+      public:
+        //! Pin the payload referenced by a handle.
+        //! @param[in] handle payload handle.
+        Access(const Handle& handle);
+
+        //! Unpin payload.
+        ~Access(void);
+
+        //! Test if the payload is still available.
+        //! @return true if payload can be read, false otherwise.
+        bool
+        isValid(void) const
+        {
+          return m_data != NULL;
+        }
+
+        //! Get pointer to payload.
+        //! @return pointer to payload or NULL if not available.
+        const char*
+        getData(void) const
+        {
+          return m_data;
+        }
+
+        //! Get payload size.
+        //! @return payload size in bytes.
+        unsigned
+        getSize(void) const
+        {
+          return m_size;
+        }
+
+      private:
+        //! Pinned ring.
+        BulkRing* m_ring;
+        //! Pin slot.
+        int m_slot;
+        //! Payload.
+        const char* m_data;
+        //! Payload size.
+        unsigned m_size;
+
+        //! Non-copyable.
+        Access(const Access&);
+
+        //! Non-assignable.
+        Access&
+        operator=(const Access&);
+      };
+
+      //! Maximum number of payloads pinned at the same time.
+      static const unsigned c_max_pins = 8;
+      //! Size of an encoded handle.
+      static const unsigned c_handle_size = 24;
+
+      //! Create ring.
+      //! @param[in] name shared memory area name.
+      //! @param[in] capacity ring capacity in bytes.
+      BulkRing(const char* name, unsigned capacity);
+
+      //! Destroy ring. Blocks until all pinned payloads are released.
+      ~BulkRing(void);
+
+      //! Store a payload.
+      //! @param[in] data payload.
+      //! @param[in] size payload size in bytes.
+      //! @param[out] handle handle of the stored payload.
+      //! @return true if payload was stored, false if the payload is
+      //! too large or would overwrite a pinned payload.
+      bool
+      write(const void* data, unsigned size, Handle& handle);
+
+      //! Get ring capacity.
+      //! @return capacity in bytes.
+      unsigned
+      getCapacity(void) const
+      {
+        return m_capacity;
+      }
+
+      //! Get name of the shared memory area.
+      //! @return shared memory area name.
+      const char*
+      getName(void)
+      {
+        return m_shm.getName();
+      }
+
+      //! Get number of payloads that could not be stored.
+      //! @return number of rejected writes.
+      unsigned
+      getRejected(void) const
+      {
+        return m_rejected;
+      }
+
+      //! Copy the payload referenced by a handle.
+      //! @param[in] handle payload handle.
+      //! @param[out] data payload.
+      //! @return true if payload was copied, false if no longer available.
+      static bool
+      fetch(const Handle& handle, std::vector<char>& data);
+
+      //! Encode a handle into a byte vector, replacing its contents.
+      //! @param[in] handle payload handle.
+      //! @param[out] data encoded handle.
+      static void
+      encode(const Handle& handle, std::vector<char>& data);
+
+      //! Decode a handle from a byte vector.
+      //! @param[in] data byte vector.
+      //! @param[out] handle payload handle.
+      //! @return true if data holds an encoded handle, false otherwise.
+      static bool
+      decode(const std::vector<char>& data, Handle& handle);
+
+    private:
+      //! Control block at the start of the shared memory area.
+      struct Control;
+
+      //! Shared memory area.
+      SharedMemory m_shm;
+      //! Local storage when shared memory is not available.
+      std::vector<char> m_local;
+      //! Control block.
+      Control* m_ctl;
+      //! Payload storage.
+      char* m_data;
+      //! Capacity in bytes.
+      unsigned m_capacity;
+      //! Ring identifier.
+      uint32_t m_id;
+      //! Number of rejected writes.
+      unsigned m_rejected;
+
+      //! Pin a payload.
+      //! @param[in] handle payload handle.
+      //! @return pin slot or -1 if payload is no longer available.
+      int
+      pin(const Handle& handle);
+
+      //! Release a pin slot.
+      //! @param[in] slot pin slot.
+      void
+      unpin(int slot);
+
+      //! Non-copyable.
+      BulkRing(const BulkRing&);
+
+      //! Non-assignable.
+      BulkRing&
+      operator=(const BulkRing&);
+    };
+  }
+}
+
+#endif
@@ -29,11 +29,13 @@
 
 // ISO C++ 98 headers.
 #include <cassert>
+#include <cerrno>
 #include <iostream>
 #include <limits>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/Exceptions.hpp>
 #include <DUNE/Utils/String.hpp>
 #include <DUNE/Streams/Terminal.hpp>
 #include <DUNE/Concurrency/Exceptions.hpp>
@@ -195,6 +197,41 @@ namespace DUNE
 #endif
     }
 
+    void
+    Thread::setAffinity(const std::vector<unsigned>& cpus)
+    {
+#if defined(DUNE_SYS_HAS_PTHREAD_SETAFFINITY_NP)
+      cpu_set_t set;
+      CPU_ZERO(&set);
+
+      if (cpus.empty())
+      {
+        for (unsigned i = 0; i < CPU_SETSIZE; ++i)
+          CPU_SET(i, &set);
+      }
+
+      for (size_t i = 0; i < cpus.size(); ++i)
+      {
+        if (cpus[i] >= CPU_SETSIZE)
+          throw ThreadError("invalid processor index", EINVAL);
+
+        CPU_SET(cpus[i], &set);
+      }
+
+      int rv = 0;
+      if (isRunning())
+        rv = pthread_setaffinity_np(m_handle, sizeof(set), &set);
+      else
+        rv = pthread_attr_setaffinity_np(&m_attr, sizeof(set), &set);
+
+      if (rv != 0)
+        throw ThreadError("unable to set thread affinity", rv);
+#else
+      (void)cpus;
+      throw NotImplemented("Thread::setAffinity");
+#endif
+    }
+
     unsigned
     Thread::getPriorityImpl(void)
     {
@@ -32,6 +32,7 @@
 
 // ISO C++ 98 headers.
 #include <string>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -74,6 +75,14 @@ namespace DUNE
       int
       getProcessorUsage(void);
 
+      //! Restrict the set of processors on which this thread is
+      //! allowed to run. If the thread is not running the affinity is
+      //! applied when it is started.
+      //! @param[in] cpus processor indices, an empty list allows all
+      //! processors.
+      void
+      setAffinity(const std::vector<unsigned>& cpus);
+
     protected:
       void
       startImpl(void);
@@ -0,0 +1,123 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/Coordinates/LocalFrame.hpp>
+
+namespace DUNE
+{
+  namespace Coordinates
+  {
+    void
+    LocalFrame::reset(double lat, double lon, double hae)
+    {
+      m_lat = lat;
+      m_lon = lon;
+      m_hae = hae;
+
+      WGS84::toECEF(lat, lon, hae, &m_x, &m_y, &m_z);
+
+      m_slat = std::sin(lat);
+      m_clat = std::cos(lat);
+      m_slon = std::sin(lon);
+      m_clon = std::cos(lon);
+
+      // Same latitude as WGS84::displace().
+      double p = std::sqrt(m_x * m_x + m_y * m_y);
+#if defined(DUNE_ELLIPSOIDAL_DISPLACE)
+      double rn = c_wgs84_a / std::sqrt(1 - c_wgs84_e2 * (m_slat * m_slat));
+      double phi = std::atan2(m_z, p * (1 - c_wgs84_e2 * rn / (rn + hae)));
+#else
+      double phi = std::atan2(m_z, p);
+#endif
+      m_sphi = std::sin(phi);
+      m_cphi = std::cos(phi);
+
+      // Products are grouped as in WGS84::displacement() and
+      // WGS84::displace() so that results are bit-for-bit identical.
+      m_n_x = -m_slat * m_clon;
+      m_n_y = m_slat * m_slon;
+      m_e_x = -m_slon;
+      m_d_x = -m_clat * m_clon;
+      m_d_y = m_clat * m_slon;
+
+      m_x_e = -m_slon;
+      m_x_n = m_clon * m_sphi;
+      m_x_d = m_clon * m_cphi;
+      m_y_n = m_slon * m_sphi;
+      m_y_d = m_slon * m_cphi;
+    }
+
+    void
+    LocalFrame::toNED(size_t count, const double* lat, const double* lon, const double* hae,
+                      double* n, double* e, double* d) const
+    {
+      for (size_t i = 0; i < count; ++i)
+      {
+        double x;
+        double y;
+        double z;
+        WGS84::toECEF(lat[i], lon[i], (hae == NULL) ? 0.0 : hae[i], &x, &y, &z);
+
+        double ox = x - m_x;
+        double oy = y - m_y;
+        double oz = z - m_z;
+
+        n[i] = m_n_x * ox - m_n_y * oy + m_clat * oz;
+        e[i] = m_e_x * ox + m_clon * oy;
+
+        if (d != NULL)
+          d[i] = m_d_x * ox - m_d_y * oy - m_slat * oz;
+      }
+    }
+
+    void
+    LocalFrame::fromNED(size_t count, const double* n, const double* e, const double* d,
+                        double* lat, double* lon, double* hae) const
+    {
+      for (size_t i = 0; i < count; ++i)
+      {
+        double di = (d == NULL) ? 0.0 : d[i];
+        double x = m_x;
+        double y = m_y;
+        double z = m_z;
+
+        x += m_x_e * e[i] - m_x_n * n[i] - m_x_d * di;
+        y += m_clon * e[i] - m_y_n * n[i] - m_y_d * di;
+        z += m_cphi * n[i] - m_sphi * di;
+
+        double h;
+        WGS84::fromECEF(x, y, z, &lat[i], &lon[i], (hae == NULL) ? &h : &hae[i]);
+      }
+    }
+  }
+}
@@ -0,0 +1,220 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_COORDINATES_LOCAL_FRAME_HPP_INCLUDED_
+#define DUNE_COORDINATES_LOCAL_FRAME_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Coordinates/WGS84.hpp>
+
+namespace DUNE
+{
+  namespace Coordinates
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LocalFrame;
+
+    //! North-East-Down local tangent plane anchored at a WGS-84
+    //! reference point. The ECEF position of the reference point and
+    //! the terms of the rotation between ECEF and NED are computed
+    //! once, so converting many points relative to the same
+    //! reference is considerably cheaper than calling
+    //! WGS84::displacement() or WGS84::displace(). Results are
+    //! identical to those of the WGS84 routines.
+    class LocalFrame
+    {
+    public:
+      //! Constructor.
+      //! @param[in] lat reference latitude (rad).
+      //! @param[in] lon reference longitude (rad).
+      //! @param[in] hae reference height above WGS-84 ellipsoid (m).
+      LocalFrame(double lat = 0.0, double lon = 0.0, double hae = 0.0)
+      {
+        reset(lat, lon, hae);
+      }
+
+      //! Change the reference point.
+      //! @param[in] lat reference latitude (rad).
+      //! @param[in] lon reference longitude (rad).
+      //! @param[in] hae reference height above WGS-84 ellipsoid (m).
+      void
+      reset(double lat, double lon, double hae = 0.0);
+
+      //! Get reference latitude.
+      //! @return latitude (rad).
+      double
+      getLatitude(void) const
+      {
+        return m_lat;
+      }
+
+      //! Get reference longitude.
+      //! @return longitude (rad).
+      double
+      getLongitude(void) const
+      {
+        return m_lon;
+      }
+
+      //! Get reference height.
+      //! @return height above WGS-84 ellipsoid (m).
+      double
+      getHeight(void) const
+      {
+        return m_hae;
+      }
+
+      //! Compute North-East-Down displacement of a WGS-84
+      //! coordinate relative to the reference point.
+      //! @see WGS84::displacement().
+      //! @param[in] lat WGS-84 latitude (rad).
+      //! @param[in] lon WGS-84 longitude (rad).
+      //! @param[in] hae height above WGS-84 ellipsoid (m).
+      //! @param[out] n storage for North offset.
+      //! @param[out] e storage for East offset.
+      //! @param[out] d storage for Down offset.
+      void
+      toNED(double lat, double lon, double hae,
+            double* n, double* e, double* d = NULL) const
+      {
+        double x;
+        double y;
+        double z;
+        WGS84::toECEF(lat, lon, hae, &x, &y, &z);
+
+        double ox = x - m_x;
+        double oy = y - m_y;
+        double oz = z - m_z;
+
+        if (n != NULL)
+          *n = m_n_x * ox - m_n_y * oy + m_clat * oz;
+
+        if (e != NULL)
+          *e = m_e_x * ox + m_clon * oy;
+
+        if (d != NULL)
+          *d = m_d_x * ox - m_d_y * oy - m_slat * oz;
+      }
+
+      //! Compute the WGS-84 coordinate of a point given by its
+      //! North-East-Down offsets relative to the reference point.
+      //! @see WGS84::displace().
+      //! @param[in] n North offset (m).
+      //! @param[in] e East offset (m).
+      //! @param[in] d Down offset (m).
+      //! @param[out] lat WGS-84 latitude (rad).
+      //! @param[out] lon WGS-84 longitude (rad).
+      //! @param[out] hae height above WGS-84 ellipsoid (m).
+      void
+      fromNED(double n, double e, double d,
+              double* lat, double* lon, double* hae) const
+      {
+        double x = m_x;
+        double y = m_y;
+        double z = m_z;
+
+        x += m_x_e * e - m_x_n * n - m_x_d * d;
+        y += m_clon * e - m_y_n * n - m_y_d * d;
+        z += m_cphi * n - m_sphi * d;
+
+        WGS84::fromECEF(x, y, z, lat, lon, hae);
+      }
+
+      //! Compute the WGS-84 coordinate of a point given by its
+      //! North-East offsets relative to the reference point.
+      //! @param[in] n North offset (m).
+      //! @param[in] e East offset (m).
+      //! @param[out] lat WGS-84 latitude (rad).
+      //! @param[out] lon WGS-84 longitude (rad).
+      void
+      fromNE(double n, double e, double* lat, double* lon) const
+      {
+        double hae;
+        fromNED(n, e, 0.0, lat, lon, &hae);
+      }
+
+      //! Convert an array of WGS-84 coordinates to North-East-Down
+      //! offsets.
+      //! @param[in] count number of points.
+      //! @param[in] lat WGS-84 latitudes (rad).
+      //! @param[in] lon WGS-84 longitudes (rad).
+      //! @param[in] hae heights above WGS-84 ellipsoid (m), or NULL
+      //! if all points are on the ellipsoid.
+      //! @param[out] n storage for North offsets.
+      //! @param[out] e storage for East offsets.
+      //! @param[out] d storage for Down offsets, may be NULL.
+      void
+      toNED(size_t count, const double* lat, const double* lon, const double* hae,
+            double* n, double* e, double* d = NULL) const;
+
+      //! Convert an array of North-East-Down offsets to WGS-84
+      //! coordinates.
+      //! @param[in] count number of points.
+      //! @param[in] n North offsets (m).
+      //! @param[in] e East offsets (m).
+      //! @param[in] d Down offsets (m), or NULL if all offsets are
+      //! zero.
+      //! @param[out] lat storage for WGS-84 latitudes.
+      //! @param[out] lon storage for WGS-84 longitudes.
+      //! @param[out] hae storage for heights above WGS-84 ellipsoid,
+      //! may be NULL.
+      void
+      fromNED(size_t count, const double* n, const double* e, const double* d,
+              double* lat, double* lon, double* hae = NULL) const;
+
+    private:
+      //! Reference latitude.
+      double m_lat;
+      //! Reference longitude.
+      double m_lon;
+      //! Reference height.
+      double m_hae;
+      //! ECEF coordinates of the reference point.
+      double m_x, m_y, m_z;
+      //! Sine and cosine of reference latitude.
+      double m_slat, m_clat;
+      //! Sine and cosine of reference longitude.
+      double m_slon, m_clon;
+      //! Sine and cosine of the reference latitude used by
+      //! WGS84::displace() (geocentric or ellipsoidal).
+      double m_sphi, m_cphi;
+      //! ECEF to NED rotation terms.
+      double m_n_x, m_n_y, m_e_x, m_d_x, m_d_y;
+      //! NED to ECEF rotation terms.
+      double m_x_e, m_x_n, m_x_d, m_y_n, m_y_d;
+    };
+  }
+}
+
+#endif
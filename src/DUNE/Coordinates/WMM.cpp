@@ -30,11 +30,17 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <cmath>
-#include <cstdlib>
+#include <map>
+#include <stdexcept>
+#include <string>
 
 // DUNE headers.
 #include <DUNE/Coordinates/WMM.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/FileSystem/MappedFile.hpp>
 #include <DUNE/Math/Angles.hpp>
 #include <DUNE/Time/BrokenDown.hpp>
 
@@ -47,15 +53,176 @@ namespace DUNE
   {
     static const unsigned c_num_geoid_cols = 1441;
     static const unsigned c_num_geoid_rows = 721;
+    //! Spacing of the declination grid (degrees).
+    static const double c_grid_step = 0.05;
+    //! Height spacing of the declination grid (m).
+    static const double c_grid_height = 1000.0;
+    //! Maximum number of memoized grid nodes.
+    static const size_t c_grid_nodes = 4096;
+    //! Maximum spread of the four nodes of a grid cell above which
+    //! the declination is computed exactly (degrees). Protects
+    //! against interpolating across the +/-180 wrap near the
+    //! magnetic poles.
+    static const double c_grid_spread = 5.0;
 
     struct WMMData
     {
+      FileSystem::MappedFile* egm;
       MAGtype_Geoid geoid;
       MAGtype_Ellipsoid ellip;
       MAGtype_MagneticModel* mm;
       MAGtype_MagneticModel* timed_mm;
+      //! Memoized declination grid nodes (degrees).
+      std::map<uint64_t, double> grid;
+      //! Mutex protecting the grid.
+      Concurrency::Mutex grid_lock;
     };
 
+    //! Model data shared by all instances, indexed by data directory.
+    class WMMRegistry
+    {
+    public:
+      ~WMMRegistry(void)
+      {
+        std::map<std::string, WMMData*>::iterator itr = m_data.begin();
+        for (; itr != m_data.end(); ++itr)
+        {
+          MAG_FreeMagneticModelMemory(itr->second->timed_mm);
+          MAG_FreeMagneticModelMemory(itr->second->mm);
+          delete itr->second->egm;
+          delete itr->second;
+        }
+      }
+
+      WMMData*
+      get(const FileSystem::Path& root)
+      {
+        Concurrency::ScopedMutex l(m_lock);
+
+        std::map<std::string, WMMData*>::iterator itr = m_data.find(root.str());
+        if (itr != m_data.end())
+          return itr->second;
+
+        WMMData* data = load(root);
+        m_data[root.str()] = data;
+        return data;
+      }
+
+    private:
+      //! Loaded data.
+      std::map<std::string, WMMData*> m_data;
+      //! Mutex protecting the loaded data.
+      Concurrency::Mutex m_lock;
+
+      static WMMData*
+      load(const FileSystem::Path& root)
+      {
+        FileSystem::Path egmfile(root / "wmm/egm9615.bin");
+        FileSystem::Path wmmfile(root / "wmm/wmm.cof");
+
+        if (!egmfile.isFile())
+          throw std::runtime_error(egmfile.str() + " not found");
+
+        if (!wmmfile.isFile())
+          throw std::runtime_error(wmmfile.str() + " not found");
+
+        // Map geoid data.
+        FileSystem::MappedFile* egm = new FileSystem::MappedFile(egmfile.str());
+        if (egm->size() < c_num_geoid_cols * c_num_geoid_rows * sizeof(float))
+        {
+          delete egm;
+          throw std::runtime_error("unable to extract geoid");
+        }
+
+        egm->adviseRandom();
+
+        WMMData* data = new WMMData;
+        data->egm = egm;
+
+        // Initialization
+        data->mm = MAG_robustReadMagModels(wmmfile.c_str());
+
+        int num_terms = ((data->mm->nMax + 1) * (data->mm->nMax + 2) / 2);
+        data->timed_mm = MAG_AllocateModelMemory(num_terms);
+        MAG_SetDefaults(&data->ellip, &data->geoid);
+
+        // The geoid buffer is only read by the model.
+        data->geoid.GeoidHeightBuffer = (float*)egm->data();
+        data->geoid.Geoid_Initialized = 1;
+
+        // Adjust magnetic model according to date
+        char dummy[100];
+        Time::BrokenDown now;
+        MAGtype_Date date;
+        date.Year = now.year;
+        date.Month = now.month;
+        date.Day = now.day;
+        MAG_DateToYear(&date, dummy);
+        MAG_TimelyModifyMagneticModel(date, data->mm, data->timed_mm);
+
+        return data;
+      }
+    };
+
+    //! Process-wide model data.
+    static WMMRegistry s_registry;
+
+    //! Compute the exact declination.
+    //! @param[in] data model data.
+    //! @param[in] lat latitude (degrees).
+    //! @param[in] lon longitude (degrees).
+    //! @param[in] h height (m).
+    //! @return declination (degrees).
+    static double
+    computeDeclination(WMMData* data, double lat, double lon, double h)
+    {
+      MAGtype_CoordGeodetic geo;
+      MAGtype_CoordSpherical sph;
+      MAGtype_GeoMagneticElements gme;
+
+      geo.phi = lat;
+      geo.lambda = lon;
+      geo.UseGeoid = false;
+      geo.HeightAboveEllipsoid = h * 1e-03;
+
+      MAG_GeodeticToSpherical(data->ellip, geo, &sph);
+      MAG_Geomag(data->ellip, sph, geo, data->timed_mm, &gme);
+      MAG_CalculateGridVariation(geo, &gme);
+
+      return gme.Decl;
+    }
+
+    //! Retrieve a memoized grid node, computing it if needed.
+    //! @param[in] data model data.
+    //! @param[in] i latitude index.
+    //! @param[in] j longitude index.
+    //! @param[in] k height index.
+    //! @return declination (degrees).
+    static double
+    gridNode(WMMData* data, long i, long j, long k)
+    {
+      uint64_t key = ((uint64_t)(i + 0x8000) << 40)
+      | ((uint64_t)(j + 0x8000) << 20)
+      | (uint64_t)(k + 0x8000);
+
+      std::map<uint64_t, double>::const_iterator itr = data->grid.find(key);
+      if (itr != data->grid.end())
+        return itr->second;
+
+      if (data->grid.size() >= c_grid_nodes)
+        data->grid.clear();
+
+      double lat = i * c_grid_step;
+      if (lat > 90.0)
+        lat = 90.0;
+      else if (lat < -90.0)
+        lat = -90.0;
+
+      double value = computeDeclination(data, lat, j * c_grid_step, k * c_grid_height);
+      data->grid[key] = value;
+      return value;
+    }
+
     WMM::WMM(void)
     {
       init(FileSystem::Path::applicationFile().dirname() / "../etc");
@@ -69,54 +236,11 @@ namespace DUNE
     void
     WMM::init(const FileSystem::Path& root)
     {
-      m_data = new WMMData;
-      FileSystem::Path egmfile(root / "wmm/egm9615.bin");
-      FileSystem::Path wmmfile(root / "wmm/wmm.cof");
-
-      if (!egmfile.isFile())
-        throw std::runtime_error(egmfile.str() + " not found");
-
-      if (!wmmfile.isFile())
-        throw std::runtime_error(wmmfile.str() + " not found");
-
-      // Initialization
-      m_data->mm = MAG_robustReadMagModels(wmmfile.c_str());
-
-      int num_terms = ((m_data->mm->nMax + 1) * (m_data->mm->nMax + 2) / 2);
-      m_data->timed_mm = MAG_AllocateModelMemory(num_terms);
-      MAG_SetDefaults(&m_data->ellip, &m_data->geoid);
-
-      // Read geoid data
-      /* Set EGM96 Geoid parameters */
-      unsigned n = c_num_geoid_cols * c_num_geoid_rows;
-      m_data->geoid.GeoidHeightBuffer = (float *) std::malloc((n + 1) * sizeof(float));
-      std::FILE* file = std::fopen(egmfile.c_str(), "rb");
-      size_t rv = std::fread(m_data->geoid.GeoidHeightBuffer, sizeof(float), n, file);
-      if (rv != n)
-        throw std::runtime_error("unable to extract geoid");
-      std::fclose(file);
-
-      //m_data->geoid.GeoidHeightBuffer = GeoidHeightBuffer;
-      m_data->geoid.Geoid_Initialized = 1;
-
-      // Adjust magnetic model according to date
-      char dummy[100];
-      Time::BrokenDown now;
-      MAGtype_Date date;
-      date.Year = now.year;
-      date.Month = now.month;
-      date.Day = now.day;
-      MAG_DateToYear(&date, dummy);
-      MAG_TimelyModifyMagneticModel(date, m_data->mm, m_data->timed_mm);
+      m_data = s_registry.get(root);
     }
 
     WMM::~WMM(void)
-    {
-      MAG_FreeMagneticModelMemory(m_data->timed_mm);
-      MAG_FreeMagneticModelMemory(m_data->mm);
-      std::free(m_data->geoid.GeoidHeightBuffer);
-      delete m_data;
-    }
+    { }
 
     double
     WMM::height(double lat, double lon)
@@ -130,20 +254,43 @@ namespace DUNE
     double
     WMM::declination(double lat, double lon, double h)
     {
-      MAGtype_CoordGeodetic geo;
-      MAGtype_CoordSpherical sph;
-      MAGtype_GeoMagneticElements gme;
+      double y = Math::Angles::degrees(lat) / c_grid_step;
+      double x = Math::Angles::degrees(lon) / c_grid_step;
+      long i = (long)std::floor(y);
+      long j = (long)std::floor(x);
+      long k = (long)std::floor(h / c_grid_height + 0.5);
+      double dy = y - i;
+      double dx = x - j;
 
-      geo.phi = Math::Angles::degrees(lat);
-      geo.lambda = Math::Angles::degrees(lon);
-      geo.UseGeoid = false;
-      geo.HeightAboveEllipsoid = h * 1e-03;
+      double d00 = 0;
+      double d01 = 0;
+      double d10 = 0;
+      double d11 = 0;
 
-      MAG_GeodeticToSpherical(m_data->ellip, geo, &sph);
-      MAG_Geomag(m_data->ellip, sph, geo, m_data->timed_mm, &gme);
-      MAG_CalculateGridVariation(geo, &gme);
+      {
+        Concurrency::ScopedMutex l(m_data->grid_lock);
+        d00 = gridNode(m_data, i, j, k);
+        d01 = gridNode(m_data, i, j + 1, k);
+        d10 = gridNode(m_data, i + 1, j, k);
+        d11 = gridNode(m_data, i + 1, j + 1, k);
+      }
 
-      return Math::Angles::radians(gme.Decl);
+      double lo = std::min(std::min(d00, d01), std::min(d10, d11));
+      double hi = std::max(std::max(d00, d01), std::max(d10, d11));
+      if (hi - lo > c_grid_spread)
+        return exactDeclination(lat, lon, h);
+
+      double d0 = d00 + dx * (d01 - d00);
+      double d1 = d10 + dx * (d11 - d10);
+
+      return Math::Angles::radians(d0 + dy * (d1 - d0));
+    }
+
+    double
+    WMM::exactDeclination(double lat, double lon, double h)
+    {
+      double decl = computeDeclination(m_data, Math::Angles::degrees(lat), Math::Angles::degrees(lon), h);
+      return Math::Angles::radians(decl);
     }
   }
 }
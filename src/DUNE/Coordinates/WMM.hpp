@@ -46,6 +46,12 @@ namespace DUNE
     struct WMMData;
 
     //! World-magnetic model 2010-2015 interface class.
+    //!
+    //! Model data is loaded once per data directory and shared by
+    //! all instances in the process: the EGM96 geoid grid is mapped
+    //! read-only into memory and the magnetic model is adjusted to
+    //! the current date when first loaded. Instances are therefore
+    //! cheap to create and may be used concurrently.
     class WMM
     {
     public:
@@ -72,6 +78,8 @@ namespace DUNE
       height(double lat, double lon);
 
       //! Get magnetic declination for given latitude and longitude (in radians).
+      //! The value is interpolated from a memoized grid of exact
+      //! declinations around the queried area.
       //! @param[in] lat WGS84 latitude
       //! @param[in] lon WGS84 longitude
       //! @param[in] height optional height argument (defaults to 0)
@@ -79,11 +87,27 @@ namespace DUNE
       double
       declination(double lat, double lon, double height = 0);
 
+      //! Get magnetic declination for given latitude and longitude
+      //! (in radians) by evaluating the full spherical-harmonic model.
+      //! @param[in] lat WGS84 latitude
+      //! @param[in] lon WGS84 longitude
+      //! @param[in] height optional height argument (defaults to 0)
+      //! @return magnetic declination
+      double
+      exactDeclination(double lat, double lon, double height = 0);
+
     private:
       void
       init(const FileSystem::Path& root);
 
       WMMData* m_data;
+
+      //! Non-copyable.
+      WMM(const WMM&);
+
+      //! Non-assignable.
+      WMM&
+      operator=(const WMM&);
     };
   }
 }
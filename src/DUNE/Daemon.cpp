@@ -33,6 +33,8 @@
 #include <cstddef>
 #include <limits>
 #include <queue>
+#include <fstream>
+#include <algorithm>
 
 // DUNE headers.
 #include <DUNE/Daemon.hpp>
@@ -40,7 +42,10 @@
 #include <DUNE/I18N.hpp>
 #include <DUNE/Tasks/Factory.hpp>
 #include <DUNE/Tasks/Manager.hpp>
+#include <DUNE/Tasks/LogBackend.hpp>
+#include <DUNE/Tasks/Tracer.hpp>
 #include <DUNE/FileSystem/Path.hpp>
+#include <DUNE/Time/Clock.hpp>
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Utils/String.hpp>
 
@@ -50,7 +55,8 @@ namespace DUNE
     DUNE::Tasks::Task("Daemon", ctx),
     m_tman(NULL),
     m_fs_capacity(0),
-    call_reboot(false)
+    call_reboot(false),
+    m_startup_reported(false)
   {
     // Retrieve known IMC addresses.
     std::vector<std::string> addrs = m_ctx.config.options("IMC Addresses");
@@ -136,6 +142,31 @@ namespace DUNE
     m_ctx.config.get("General", "CPU Usage - Moving Average Samples", "10", m_cpu_avg_samples);
     m_cpu_avg = new Math::MovingAverage<double>(m_cpu_avg_samples);
 
+    // Asynchronous logging.
+    bool log_async = true;
+    double log_rate = 0;
+    m_ctx.config.get("General", "Asynchronous Logging", "true", log_async);
+    m_ctx.config.get("General", "Log Book Entries Per Second", "20", log_rate);
+    if (log_async)
+      Tasks::LogBackend::start(log_rate);
+
+    // Causal latency tracing.
+    bool tracing = false;
+    m_ctx.config.get("General", "Latency Tracing", "false", tracing);
+    if (tracing)
+    {
+      try
+      {
+        FileSystem::Path file = m_ctx.dir_log / "LatencyTrace.bin";
+        Tasks::Tracer::start(file.str(), m_ctx.entities);
+        inf(DTR("latency trace file: '%s'"), file.c_str());
+      }
+      catch (std::exception& e)
+      {
+        err("%s", e.what());
+      }
+    }
+
     m_tman = new DUNE::Tasks::Manager(m_ctx);
 
     bind<IMC::RestartSystem>(this);
@@ -147,8 +178,16 @@ namespace DUNE
   Daemon::~Daemon(void)
   {
     m_ctx.mbus.pause();
+    debug("deliveries avoided by filters: %u", m_ctx.mbus.getFilteredCount());
     delete m_tman;
     delete m_cpu_avg;
+    if (Tasks::Tracer::isRunning())
+    {
+      Tasks::Tracer::stop();
+      if (Tasks::Tracer::getDropped() > 0)
+        war(DTR("latency trace events dropped: %u"), Tasks::Tracer::getDropped());
+    }
+    Tasks::LogBackend::stop();
     inf(DTR("clean shutdown"));
   }
 
@@ -320,6 +359,71 @@ namespace DUNE
     dispatch(qpcs);
   }
 
+  void
+  Daemon::reportStartup(void)
+  {
+    typedef Tasks::Startup Startup;
+
+    Startup& startup = m_tman->getStartup();
+    std::vector<Startup::Entry> entries = startup.getEntries();
+
+    std::string slowest;
+    double slowest_duration = -1;
+    double ready = 0;
+
+    for (unsigned i = 0; i < entries.size(); ++i)
+    {
+      const Startup::Entry& entry = entries[i];
+      std::ostringstream text;
+      double total = 0;
+
+      for (unsigned j = 0; j < Startup::PHASE_COUNT; ++j)
+      {
+        if (entry.end[j] < 0)
+          continue;
+
+        double duration = entry.end[j] - entry.begin[j];
+        total += duration;
+        ready = std::max(ready, entry.end[j]);
+
+        text << (j == 0 ? "" : ", ")
+             << Startup::getPhaseName(static_cast<Startup::Phase>(j)) << " "
+             << Utils::String::str("%0.3f s", duration);
+      }
+
+      if (entry.left)
+        text << " (" << DTR("did not complete startup") << ")";
+
+      if (total > slowest_duration)
+      {
+        slowest = entry.name;
+        slowest_duration = total;
+      }
+
+      IMC::LogBookEntry lbe;
+      lbe.type = IMC::LogBookEntry::LBET_INFO;
+      lbe.htime = Time::Clock::getSinceEpoch();
+      lbe.context = entry.name;
+      lbe.text = Utils::String::str(DTR("startup: %s"), text.str().c_str());
+      dispatch(lbe);
+    }
+
+    try
+    {
+      FileSystem::Path file = m_ctx.dir_log / "Startup.csv";
+      std::ofstream ofs(file.c_str());
+      startup.writeCSV(ofs);
+    }
+    catch (std::exception& e)
+    {
+      err(DTR("failed to write startup timeline: %s"), e.what());
+    }
+
+    if (!slowest.empty())
+      inf(DTR("startup completed in %0.3f s, slowest task: %s (%0.3f s)"),
+          ready, slowest.c_str(), slowest_duration);
+  }
+
   void
   Daemon::onMain(void)
   {
@@ -327,6 +431,12 @@ namespace DUNE
     {
       waitForMessages(1.0);
 
+      if (!m_startup_reported && m_tman->getStartup().isComplete())
+      {
+        m_startup_reported = true;
+        reportStartup();
+      }
+
       if (m_periodic_counter.overflow())
       {
         m_periodic_counter.reset();
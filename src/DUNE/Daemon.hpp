@@ -110,12 +110,19 @@ namespace DUNE
     Math::MovingAverage<double>* m_cpu_avg;
     //! Signal system reboot
     bool call_reboot;
+    //! True if the startup timeline was already reported.
+    bool m_startup_reported;
 
     void
     measureCpuUsage(void);
 
     void
     dispatchPeriodic(void);
+
+    //! Write the startup timeline of all tasks to the log folder
+    //! and report it with log book entries.
+    void
+    reportStartup(void);
   };
 }
 
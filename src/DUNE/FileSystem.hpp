@@ -40,6 +40,7 @@ namespace DUNE
 #include <DUNE/FileSystem/Path.hpp>
 #include <DUNE/FileSystem/Directory.hpp>
 #include <DUNE/FileSystem/FileLock.hpp>
+#include <DUNE/FileSystem/MappedFile.hpp>
 #include <DUNE/FileSystem/Exceptions.hpp>
 
 #endif
@@ -0,0 +1,144 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cerrno>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/FileSystem/MappedFile.hpp>
+#include <DUNE/FileSystem/Exceptions.hpp>
+
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_STAT_H)
+#  include <sys/stat.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_FCNTL_H)
+#  include <fcntl.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_MMAN_H)
+#  include <sys/mman.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_MMAP) && defined(DUNE_SYS_HAS_SYS_MMAN_H) && defined(DUNE_SYS_HAS_STRUCT_STAT)
+#  define DUNE_MAPPED_FILE_USE_MMAP
+#endif
+
+namespace DUNE
+{
+  namespace FileSystem
+  {
+    MappedFile::MappedFile(const std::string& path):
+      m_path(path),
+      m_data(NULL),
+      m_size(0),
+      m_mapped(false)
+    {
+#if defined(DUNE_MAPPED_FILE_USE_MMAP)
+      int fd = ::open(path.c_str(), O_RDONLY);
+      if (fd == -1)
+        throw FileReadError(path);
+
+      struct stat st;
+      if (fstat(fd, &st) == -1)
+      {
+        ::close(fd);
+        throw FileReadError(path);
+      }
+
+      m_size = st.st_size;
+      if (m_size == 0)
+      {
+        ::close(fd);
+        throw FileReadError(path, "file is empty");
+      }
+
+      void* ptr = mmap(NULL, m_size, PROT_READ, MAP_SHARED, fd, 0);
+      ::close(fd);
+
+      if (ptr == MAP_FAILED)
+        throw FileReadError(path);
+
+      m_data = static_cast<uint8_t*>(ptr);
+      m_mapped = true;
+#else
+      std::FILE* fd = std::fopen(path.c_str(), "rb");
+      if (fd == NULL)
+        throw FileReadError(path);
+
+      std::fseek(fd, 0, SEEK_END);
+      long size = std::ftell(fd);
+      std::fseek(fd, 0, SEEK_SET);
+
+      if (size <= 0)
+      {
+        std::fclose(fd);
+        throw FileReadError(path, "file is empty");
+      }
+
+      m_size = size;
+      m_data = new uint8_t[m_size];
+
+      if (std::fread(m_data, 1, m_size, fd) != m_size)
+      {
+        std::fclose(fd);
+        delete [] m_data;
+        throw FileReadError(path, "short read");
+      }
+
+      std::fclose(fd);
+#endif
+    }
+
+    MappedFile::~MappedFile(void)
+    {
+#if defined(DUNE_MAPPED_FILE_USE_MMAP)
+      if (m_mapped)
+        munmap(m_data, m_size);
+#else
+      delete [] m_data;
+#endif
+    }
+
+    void
+    MappedFile::adviseRandom(void)
+    {
+#if defined(DUNE_MAPPED_FILE_USE_MMAP) && defined(MADV_RANDOM)
+      madvise(m_data, m_size, MADV_RANDOM);
+#endif
+    }
+  }
+}
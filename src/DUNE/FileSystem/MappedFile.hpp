@@ -27,99 +27,82 @@
 // Author: Ricardo Martins                                                  *
 //***************************************************************************
 
-#ifndef VISION_DFK51BG02H_FRAME_HPP_INCLUDED_
-#define VISION_DFK51BG02H_FRAME_HPP_INCLUDED_
+#ifndef DUNE_FILE_SYSTEM_MAPPED_FILE_HPP_INCLUDED_
+#define DUNE_FILE_SYSTEM_MAPPED_FILE_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
-#include <cstring>
+#include <cstddef>
+#include <string>
 
 // DUNE headers.
-#include <DUNE/DUNE.hpp>
+#include <DUNE/Config.hpp>
 
-// Import namespaces.
-using DUNE_NAMESPACES;
-
-namespace Vision
+namespace DUNE
 {
-  namespace DFK51BG02H
+  namespace FileSystem
   {
-    //! Container for raw picture data.
-    class Frame
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM MappedFile;
+
+    //! Read-only view of a file mapped into the address space of the
+    //! process. Pages are loaded on demand by the operating system,
+    //! which makes random access to very large files cheap. On
+    //! systems without mmap() the file is read into memory.
+    class MappedFile
     {
     public:
       //! Constructor.
-      //! @param[in] capacity frame capacity in bytes.
-      Frame(unsigned capacity):
-        m_capacity(capacity),
-        m_data(NULL),
-        m_tstamp(-1),
-        m_pkt_count(0)
-      {
-        m_data = new uint8_t[m_capacity];
-        for (unsigned i = 0; i < m_capacity; ++i)
-          m_data[i] = 0;
-      }
+      //! @param[in] path file path.
+      MappedFile(const std::string& path);
 
       //! Destructor.
-      ~Frame(void)
-      {
-        delete [] m_data;
-      }
+      ~MappedFile(void);
 
-      //! Set frame timestamp to current time.
-      void
-      setTimeStamp(void)
-      {
-        m_tstamp = Clock::getSinceEpoch();
-        m_pkt_count = 0;
-      }
-
-      //! Retrieve frame timestamp.
-      double
-      getTimeStamp(void)
-      {
-        return m_tstamp;
-      }
-
-      //! Get data pointer.
-      //! @return data pointer.
-      uint8_t*
-      getData(void)
+      //! Retrieve a pointer to the beginning of the mapped data.
+      //! @return pointer to mapped data.
+      const uint8_t*
+      data(void) const
       {
         return m_data;
       }
 
-      //! Write packet to frame.
-      //! @param[in] nr frame number.
-      //! @param[in] data packet data.
-      //! @param[in] size packet size.
-      unsigned
-      writePacket(unsigned nr, const uint8_t* data, unsigned size)
+      //! Retrieve the size of the mapped data.
+      //! @return size of the mapped data in bytes.
+      size_t
+      size(void) const
       {
-        ++m_pkt_count;
-        unsigned esize = std::min(size, m_capacity - (((nr - 1) * size)));
-        std::memcpy(m_data + ((nr - 1) * size), data, esize);
-        return esize;
+        return m_size;
       }
 
-      //! Retrieve the number of packets written to the frame. This
-      //! count can be inflated due to duplicated packets.
-      //! @return packets in the frame.
-      unsigned
-      getPacketCount(void)
+      //! Retrieve the file path.
+      //! @return file path.
+      const std::string&
+      getPath(void) const
       {
-        return m_pkt_count;
+        return m_path;
       }
 
+      //! Advise the operating system that the mapped data will be
+      //! accessed in random order, disabling read-ahead.
+      void
+      adviseRandom(void);
+
     private:
-      //! Frame capacity (in bytes).
-      unsigned m_capacity;
-      //! Raw data.
+      //! File path.
+      std::string m_path;
+      //! Pointer to mapped data.
       uint8_t* m_data;
-      //! Timestamp.
-      double m_tstamp;
-      //! Packet count.
-      unsigned m_pkt_count;
+      //! Size of mapped data.
+      size_t m_size;
+      //! True if the data was mapped with mmap().
+      bool m_mapped;
+
+      //! Non-copyable.
+      MappedFile(const MappedFile&);
+
+      //! Non-assignable.
+      MappedFile&
+      operator=(const MappedFile&);
     };
   }
 }
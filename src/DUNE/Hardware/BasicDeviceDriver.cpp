@@ -56,14 +56,29 @@ namespace DUNE
         m_restart(false),
         m_restart_delay(0.0),
         m_read_period(0.0),
-        m_uri()
-    {
+        m_uri(),
+        m_replay(NULL),
+        m_replay_cpu(0.0),
+        m_replay_msgs(0),
+        m_replay_reported(false)
+    {
+      param(DTR_RT("Device Capture File"), m_capture_file)
+      .visibility(Tasks::Parameter::VISIBILITY_DEVELOPER)
+      .defaultValue("")
+      .description(DTR("Record raw data exchanged with the device to this file, "
+                       "relative to the log folder (empty to disable)"));
+
       bind<IMC::EstimatedState>(this);
       bind<IMC::LoggingControl>(this);
       bind<IMC::PowerChannelState>(this);
       bind<IMC::SoundSpeed>(this);
     }
 
+    BasicDeviceDriver::~BasicDeviceDriver(void)
+    {
+      Memory::clear(m_replay);
+    }
+
     void
     BasicDeviceDriver::onResourceRelease(void)
     {
@@ -85,9 +100,22 @@ namespace DUNE
       IO::Handle *handle = openSocketTCP(device);
       if (handle == nullptr)
         handle = openUART(device);
+      if (handle == nullptr)
+        handle = openReplay(device);
+
+      if (handle == nullptr)
+        return nullptr;
 
-      if (handle != nullptr)
-        handle->flush();
+      handle->flush();
+      handle = openCapture(handle);
+
+      if (m_replay != nullptr)
+      {
+        m_replay_cpu = Resources::getThreadProcessorTime();
+        m_replay_msgs = getDispatchCount();
+        m_replay_reported = false;
+        m_replay->start();
+      }
 
       return handle;
     }
@@ -141,6 +169,86 @@ namespace DUNE
       return sock;
     }
 
+    IO::Handle *
+    BasicDeviceDriver::openReplay(const std::string &device)
+    {
+      char file[512] = {0};
+      double speed = 1.0;
+
+      // Save device URI
+      m_uri = device;
+      trace("[Replay] >> attempting URI: %s", device.c_str());
+
+      if (std::sscanf(device.c_str(), "replay://%511[^:]:%lf", file, &speed) < 1)
+        return nullptr;
+
+      Path path(file);
+      if (!path.isAbsolute())
+        path = m_ctx.dir_log / path;
+
+      Memory::clear(m_replay);
+      m_replay = new DeviceReplay(path.str(), speed);
+
+      try
+      {
+        return new SerialPort(m_replay->openTerminal(), 115200);
+      }
+      catch (...)
+      {
+        Memory::clear(m_replay);
+        throw;
+      }
+    }
+
+    IO::Handle *
+    BasicDeviceDriver::openCapture(IO::Handle *handle)
+    {
+      if (m_capture_file.empty())
+        return handle;
+
+      Path path(m_capture_file);
+      if (!path.isAbsolute())
+        path = m_ctx.dir_log / path;
+
+      // Keep captures of previous connections.
+      Path file = path;
+      for (unsigned i = 1; file.exists(); ++i)
+        file = path.str() + String::str(".%u", i);
+
+      try
+      {
+        handle = new IO::RecordingHandle(handle, file.str());
+      }
+      catch (...)
+      {
+        Memory::clear(handle);
+        throw;
+      }
+
+      inf(DTR("recording device data to '%s'"), file.c_str());
+      return handle;
+    }
+
+    void
+    BasicDeviceDriver::checkReplay(void)
+    {
+      if (m_replay == nullptr || m_replay_reported || !m_replay->isFinished())
+        return;
+
+      uint64_t bytes = m_replay->getBytes();
+      double elapsed = m_replay->getElapsed();
+      int msgs = getDispatchCount() - m_replay_msgs;
+      double cpu = Resources::getThreadProcessorTime() - m_replay_cpu;
+
+      inf("replay finished: %llu bytes, %d messages in %0.3f s (%0.1f messages/s)",
+          (unsigned long long)bytes, msgs, elapsed, elapsed > 0 ? msgs / elapsed : 0.0);
+
+      if (m_replay_cpu >= 0 && bytes > 0)
+        inf("replay processing cost: %0.3f us of CPU per byte", cpu * 1e6 / bytes);
+
+      m_replay_reported = true;
+    }
+
     void
     BasicDeviceDriver::queueState(StateMachineStates state)
     {
@@ -767,6 +875,7 @@ namespace DUNE
         consumeMessages();
       
       updateStateMachine();
+      checkReplay();
     }
 
     void
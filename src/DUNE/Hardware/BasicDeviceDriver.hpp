@@ -46,6 +46,8 @@ namespace DUNE
     public:
       BasicDeviceDriver(const std::string& name, DUNE::Tasks::Context& ctx);
 
+      ~BasicDeviceDriver(void) override;
+
       //! Consume estimated state messages.
       //! @param[in] msg EstimatedState message.
       void
@@ -91,6 +93,17 @@ namespace DUNE
       IO::Handle*
       openSocketTCP(const std::string& uri);
 
+      //! Create an I/O handle given a replay URI. The capture file is
+      //! served through a pseudo-terminal and relative paths are
+      //! resolved against the log folder.
+      //!
+      //! @param[in] uri URI of the form: replay://FILE[:SPEED]
+      //! (SPEED defaults to 1.0, zero replays at maximum speed).
+      //!
+      //! @return I/O handle.
+      IO::Handle*
+      openReplay(const std::string& uri);
+
       //! Set the amount of time to wait before powering up the device.
       //! @param[in] value delay in second.
       void
@@ -330,6 +343,26 @@ namespace DUNE
       DUNE::Time::Counter<double> m_read_timer;
       //! Device URI.
       std::string m_uri;
+      //! Raw device stream capture file (empty to disable).
+      std::string m_capture_file;
+      //! Device stream replay.
+      DeviceReplay* m_replay;
+      //! Thread CPU time when the replay started.
+      double m_replay_cpu;
+      //! Dispatched message count when the replay started.
+      int m_replay_msgs;
+      //! True if the replay throughput was reported.
+      bool m_replay_reported;
+
+      //! Record raw data exchanged with the device, if enabled.
+      //! @param[in] handle device I/O handle.
+      //! @return device I/O handle.
+      IO::Handle*
+      openCapture(IO::Handle* handle);
+
+      //! Report replay throughput once all data was served.
+      void
+      checkReplay(void);
 
       void
       onResourceRelease(void) override;
@@ -0,0 +1,347 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cerrno>
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Exceptions.hpp>
+#include <DUNE/System/Error.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Utils.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Network/Exceptions.hpp>
+#include <DUNE/Hardware/DeviceReplay.hpp>
+
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_FCNTL_H)
+#  include <fcntl.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_SELECT_H)
+#  include <sys/select.h>
+#endif
+
+namespace DUNE
+{
+  namespace Hardware
+  {
+    //! Maximum time blocked waiting for the client.
+    static const double c_poll_period = 0.1;
+    //! Size of the buffer used to discard client data.
+    static const size_t c_drain_size = 1024;
+
+    //! Wait until a descriptor is readable or writable.
+    //! @param[in] fd descriptor.
+    //! @param[in] write true to wait for writability, false for
+    //! readability.
+    //! @param[in] timeout timeout in seconds.
+    //! @return true if the descriptor is ready, false otherwise.
+    static bool
+    waitDescriptor(int fd, bool write, double timeout)
+    {
+#if defined(DUNE_OS_POSIX)
+      fd_set fds;
+      FD_ZERO(&fds);
+      FD_SET(fd, &fds);
+      timeval tv = DUNE_TIMEVAL_INIT_SEC_FP(timeout);
+
+      int rv = select(fd + 1, write ? NULL : &fds, write ? &fds : NULL, NULL, &tv);
+      if (rv == -1)
+      {
+        if (errno == EINTR)
+          return false;
+        throw System::Error("polling replay client", System::Error::getLastMessage());
+      }
+
+      return rv > 0;
+#else
+      (void)fd;
+      (void)write;
+      (void)timeout;
+      throw NotImplemented("device replay");
+#endif
+    }
+
+    DeviceReplay::DeviceReplay(const std::string& path, double speed):
+      m_reader(path),
+      m_speed(speed),
+      m_master(-1),
+      m_server(NULL),
+      m_client(NULL),
+      m_bytes(0),
+      m_first(-1.0),
+      m_last(-1.0),
+      m_finished(false)
+    { }
+
+    DeviceReplay::~DeviceReplay(void)
+    {
+      if (isCreated())
+        stopAndJoin();
+
+      delete m_client;
+      delete m_server;
+
+#if defined(DUNE_OS_POSIX)
+      if (m_master >= 0)
+        close(m_master);
+#endif
+    }
+
+    std::string
+    DeviceReplay::openTerminal(void)
+    {
+#if defined(DUNE_SYS_HAS_POSIX_OPENPT)
+      if (m_master >= 0 || m_server != NULL)
+        throw std::runtime_error("device replay is already being served");
+
+      m_master = posix_openpt(O_RDWR | O_NOCTTY);
+      if (m_master < 0)
+        throw System::Error("opening pseudo-terminal", System::Error::getLastMessage());
+
+      const char* name = NULL;
+      if (grantpt(m_master) == 0 && unlockpt(m_master) == 0)
+        name = ptsname(m_master);
+
+      if (name == NULL)
+      {
+        std::string msg = System::Error::getLastMessage();
+        close(m_master);
+        m_master = -1;
+        throw System::Error("configuring pseudo-terminal", msg);
+      }
+
+      fcntl(m_master, F_SETFL, fcntl(m_master, F_GETFL) | O_NONBLOCK);
+      return name;
+#else
+      throw NotImplemented("pseudo-terminal device replay");
+#endif
+    }
+
+    uint16_t
+    DeviceReplay::listenTCP(uint16_t port)
+    {
+      if (m_master >= 0 || m_server != NULL)
+        throw std::runtime_error("device replay is already being served");
+
+      m_server = new Network::TCPSocket;
+      try
+      {
+        m_server->bind(port, Network::Address::Loopback, true);
+        m_server->listen(1);
+      }
+      catch (...)
+      {
+        delete m_server;
+        m_server = NULL;
+        throw;
+      }
+
+      return m_server->getBoundPort();
+    }
+
+    bool
+    DeviceReplay::isFinished(void)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      return m_finished;
+    }
+
+    uint64_t
+    DeviceReplay::getBytes(void)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      return m_bytes;
+    }
+
+    double
+    DeviceReplay::getElapsed(void)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      if (m_first < 0)
+        return 0;
+      return m_last - m_first;
+    }
+
+    bool
+    DeviceReplay::waitClient(void)
+    {
+      while (!isStopping())
+      {
+        if (waitDescriptor(m_server->getNative(), false, c_poll_period))
+        {
+          m_client = m_server->accept();
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    void
+    DeviceReplay::drain(void)
+    {
+      uint8_t bfr[c_drain_size];
+
+      if (m_client != NULL)
+      {
+        m_client->read(bfr, sizeof(bfr));
+        return;
+      }
+
+#if defined(DUNE_OS_POSIX)
+      // Nothing but errors (such as no slave side) is expected here.
+      while (::read(m_master, bfr, sizeof(bfr)) > 0)
+        ;
+#endif
+    }
+
+    bool
+    DeviceReplay::send(const uint8_t* data, size_t size)
+    {
+      int fd = (m_client != NULL) ? m_client->getNative() : m_master;
+
+      while (size > 0 && !isStopping())
+      {
+        if (waitDescriptor(fd, false, 0))
+          drain();
+
+        if (!waitDescriptor(fd, true, c_poll_period))
+          continue;
+
+        ssize_t rv = 0;
+        if (m_client != NULL)
+        {
+          rv = (ssize_t)m_client->write(data, size);
+        }
+        else
+        {
+#if defined(DUNE_OS_POSIX)
+          rv = ::write(m_master, data, size);
+          if (rv < 0 && errno != EAGAIN && errno != EINTR)
+            return false;
+#endif
+        }
+
+        if (rv > 0)
+        {
+          data += rv;
+          size -= rv;
+        }
+      }
+
+      return size == 0;
+    }
+
+    void
+    DeviceReplay::waitUntil(double time)
+    {
+      int fd = (m_client != NULL) ? m_client->getNative() : m_master;
+
+      while (!isStopping())
+      {
+        double remaining = time - Time::Clock::get();
+        if (remaining <= 0)
+          break;
+
+        if (waitDescriptor(fd, false, std::min(remaining, c_poll_period)))
+          drain();
+      }
+    }
+
+    void
+    DeviceReplay::run(void)
+    {
+      try
+      {
+        if (m_server != NULL && !waitClient())
+          return;
+
+        if (m_client == NULL && m_master < 0)
+          throw std::runtime_error("device replay is not being served");
+
+        IO::CaptureRecord rec;
+        double start = -1.0;
+        double origin = 0;
+
+        while (!isStopping() && m_reader.read(rec))
+        {
+          if (rec.direction != IO::CaptureRecord::DIR_INPUT || rec.data.empty())
+            continue;
+
+          if (start < 0)
+          {
+            start = Time::Clock::get();
+            origin = rec.time;
+          }
+          else if (m_speed > 0)
+          {
+            waitUntil(start + (rec.time - origin) / m_speed);
+          }
+
+          if (!send(&rec.data[0], rec.data.size()))
+            break;
+
+          Concurrency::ScopedMutex l(m_lock);
+          m_last = Time::Clock::get();
+          if (m_first < 0)
+            m_first = m_last;
+          m_bytes += rec.data.size();
+        }
+      }
+      catch (Network::ConnectionClosed&)
+      {
+        // Client gave up.
+      }
+
+      {
+        Concurrency::ScopedMutex l(m_lock);
+        m_finished = true;
+      }
+
+      // Keep consuming client data until stopped.
+      try
+      {
+        while (!isStopping())
+          waitUntil(Time::Clock::get() + c_poll_period);
+      }
+      catch (Network::ConnectionClosed&)
+      { }
+    }
+  }
+}
@@ -0,0 +1,146 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_HARDWARE_DEVICE_REPLAY_HPP_INCLUDED_
+#define DUNE_HARDWARE_DEVICE_REPLAY_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IO/Capture.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Network/TCPSocket.hpp>
+
+namespace DUNE
+{
+  namespace Hardware
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM DeviceReplay;
+
+    //! Replay of a raw device stream capture (see IO::CaptureWriter).
+    //! Data read from the device during the capture is served through
+    //! a pseudo-terminal or a local TCP server, either respecting the
+    //! original timing (scaled by a speed factor) or as fast as the
+    //! client consumes it. Data written by the client is discarded.
+    //! Open the pseudo-terminal or TCP server, connect the driver
+    //! and then start() the replay.
+    class DeviceReplay: public Concurrency::Thread
+    {
+    public:
+      //! Constructor.
+      //! @param[in] path capture file name.
+      //! @param[in] speed replay speed factor (1.0 for real time, zero
+      //! or negative for maximum speed).
+      DeviceReplay(const std::string& path, double speed = 1.0);
+
+      //! Destructor.
+      ~DeviceReplay(void);
+
+      //! Serve the capture through a pseudo-terminal.
+      //! @return name of the terminal device to be opened by the
+      //! client.
+      std::string
+      openTerminal(void);
+
+      //! Serve the capture through a TCP server accepting a single
+      //! client.
+      //! @param[in] port TCP port (0 to select any free port).
+      //! @return TCP port.
+      uint16_t
+      listenTCP(uint16_t port = 0);
+
+      //! Test if all records were served.
+      //! @return true if replay finished, false otherwise.
+      bool
+      isFinished(void);
+
+      //! Get number of bytes served.
+      //! @return number of bytes.
+      uint64_t
+      getBytes(void);
+
+      //! Get time between the first and the last served byte.
+      //! @return time in seconds.
+      double
+      getElapsed(void);
+
+    private:
+      //! Capture reader.
+      IO::CaptureReader m_reader;
+      //! Speed factor.
+      double m_speed;
+      //! Pseudo-terminal master descriptor.
+      int m_master;
+      //! TCP server.
+      Network::TCPSocket* m_server;
+      //! TCP client.
+      Network::TCPSocket* m_client;
+      //! Bytes served.
+      uint64_t m_bytes;
+      //! Time of the first served byte.
+      double m_first;
+      //! Time of the last served byte.
+      double m_last;
+      //! True if all records were served.
+      bool m_finished;
+      //! Lock protecting statistics.
+      Concurrency::Mutex m_lock;
+
+      //! Wait for a TCP client.
+      //! @return true if a client connected, false if stopping.
+      bool
+      waitClient(void);
+
+      //! Send data to the client.
+      //! @param[in] data data.
+      //! @param[in] size number of bytes.
+      //! @return true if all data was sent, false otherwise.
+      bool
+      send(const uint8_t* data, size_t size);
+
+      //! Read and discard data written by the client.
+      void
+      drain(void);
+
+      //! Wait until a given time, draining client data.
+      //! @param[in] time monotonic time.
+      void
+      waitUntil(double time);
+
+      void
+      run(void);
+    };
+  }
+}
+
+#endif
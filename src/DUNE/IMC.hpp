@@ -38,6 +38,7 @@ namespace DUNE
 }
 
 #include <DUNE/IMC/Bus.hpp>
+#include <DUNE/IMC/DeliveryFilter.hpp>
 #include <DUNE/IMC/Serialization.hpp>
 #include <DUNE/IMC/InlineMessage.hpp>
 #include <DUNE/IMC/MessageList.hpp>
@@ -37,6 +37,7 @@
 #include <DUNE/IMC/Bus.hpp>
 #include <DUNE/IMC/Message.hpp>
 #include <DUNE/IMC/Definitions.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
 
 namespace DUNE
 {
@@ -60,6 +61,39 @@ namespace DUNE
       Tasks::AbstractTask* exclude;
     };
 
+    struct Bus::Subscription
+    {
+      Subscription(Tasks::AbstractTask* t):
+        task(t),
+        unfiltered(false)
+      { }
+
+      //! Test if message must be delivered.
+      bool
+      accepts(const Message* msg) const
+      {
+        if (unfiltered)
+          return true;
+
+        for (size_t i = 0; i < filters.size(); ++i)
+        {
+          if (filters[i].matches(msg))
+            return true;
+        }
+
+        return false;
+      }
+
+      //! Recipient.
+      Tasks::AbstractTask* task;
+      //! Delivery filters (any of them must match).
+      std::vector<DeliveryFilter> filters;
+      //! True if all messages are delivered.
+      bool unfiltered;
+      //! Number of messages rejected by filters.
+      Concurrency::AtomicCounter filtered;
+    };
+
     Bus::Bus(void):
       m_paused(false)
     { }
@@ -75,29 +109,77 @@ namespace DUNE
 
       for (unsigned i = 0; i < m_bind_msgs.size(); ++i)
         delete m_bind_msgs[i];
+
+      std::map<uint16_t, TransportList>::iterator itr = m_recipients.begin();
+      for (; itr != m_recipients.end(); ++itr)
+      {
+        for (TransportList::iterator sitr = itr->second.begin(); sitr != itr->second.end(); ++sitr)
+          delete *sitr;
+      }
     }
 
     void
-    Bus::registerRecipient(Tasks::AbstractTask* task, uint16_t id)
+    Bus::registerRecipient(Tasks::AbstractTask* task, uint16_t id, const DeliveryFilter* filter)
     {
-      TransportBindings* bind = new TransportBindings;
-      bind->setSourceEntity(DUNE_IMC_CONST_SYS_EID);
-      bind->setTimeStamp();
-      bind->consumer = task->getName();
-      bind->message_id = id;
-
       Concurrency::ScopedRWLock l(m_lock, true);
-      m_bind_msgs.push_back(bind);
-      TransportList::iterator itr = std::find(m_recipients[id].begin(), m_recipients[id].end(), task);
-      if (itr == m_recipients[id].end())
-        m_recipients[id].push_back(task);
+
+      TransportList& dlst(m_recipients[id]);
+      Subscription* sub = NULL;
+      for (TransportList::iterator itr = dlst.begin(); itr != dlst.end(); ++itr)
+      {
+        if ((*itr)->task == task)
+        {
+          sub = *itr;
+          break;
+        }
+      }
+
+      if (sub == NULL)
+      {
+        TransportBindings* bind = new TransportBindings;
+        bind->setSourceEntity(DUNE_IMC_CONST_SYS_EID);
+        bind->setTimeStamp();
+        bind->consumer = task->getName();
+        bind->message_id = id;
+        m_bind_msgs.push_back(bind);
+
+        sub = new Subscription(task);
+        dlst.push_back(sub);
+      }
+
+      if (filter == NULL || filter->isEmpty())
+      {
+        sub->unfiltered = true;
+        sub->filters.clear();
+      }
+      else if (!sub->unfiltered)
+      {
+        sub->filters.push_back(*filter);
+      }
     }
 
     void
     Bus::unregisterRecipient(Tasks::AbstractTask* task, uint16_t id)
     {
       Concurrency::ScopedRWLock l(m_lock, true);
-      m_recipients[id].remove(task);
+
+      std::map<uint16_t, TransportList>::iterator ritr = m_recipients.find(id);
+      if (ritr == m_recipients.end())
+        return;
+
+      TransportList& dlst(ritr->second);
+      for (TransportList::iterator itr = dlst.begin(); itr != dlst.end(); )
+      {
+        if ((*itr)->task == task)
+        {
+          delete *itr;
+          itr = dlst.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
     }
 
     void
@@ -114,11 +196,21 @@ namespace DUNE
 
       uint16_t id = msg->getId();
       Concurrency::ScopedRWLock l(m_lock);
-      TransportList& dlst(m_recipients[id]);
+      std::map<uint16_t, TransportList>::iterator ritr = m_recipients.find(id);
+      if (ritr == m_recipients.end())
+        return;
+
+      TransportList& dlst(ritr->second);
       for (TransportList::iterator itr = dlst.begin(); itr != dlst.end(); ++itr)
       {
-        if (*itr != task)
-          (*itr)->receive(msg);
+        Subscription* sub = *itr;
+        if (sub->task == task)
+          continue;
+
+        if (sub->accepts(msg))
+          sub->task->receive(msg);
+        else
+          sub->filtered.add(1);
       }
     }
 
@@ -146,5 +238,24 @@ namespace DUNE
       Concurrency::ScopedRWLock l(m_lock);
       return m_bind_msgs;
     }
+
+    unsigned
+    Bus::getFilteredCount(const Tasks::AbstractTask* task)
+    {
+      Concurrency::ScopedRWLock l(m_lock);
+
+      unsigned count = 0;
+      std::map<uint16_t, TransportList>::iterator itr = m_recipients.begin();
+      for (; itr != m_recipients.end(); ++itr)
+      {
+        for (TransportList::iterator sitr = itr->second.begin(); sitr != itr->second.end(); ++sitr)
+        {
+          if (task == NULL || (*sitr)->task == task)
+            count += (*sitr)->filtered.add(0);
+        }
+      }
+
+      return count;
+    }
   }
 }
@@ -44,6 +44,7 @@
 #include <DUNE/Concurrency/TSQueue.hpp>
 #include <DUNE/Concurrency/ScopedMutex.hpp>
 #include <DUNE/Concurrency/ScopedRWLock.hpp>
+#include <DUNE/IMC/DeliveryFilter.hpp>
 
 namespace DUNE
 {
@@ -66,11 +67,15 @@ namespace DUNE
       ~Bus(void);
 
       //! Register a task as a recipient a given message
-      //! identification number.
+      //! identification number. Registering the same task more than
+      //! once widens its subscription: messages are delivered if
+      //! they satisfy any of the given filters.
       //! @param task task object.
       //! @param id message identification number.
+      //! @param filter delivery filter or NULL to receive all
+      //! messages with the given identification number.
       void
-      registerRecipient(Tasks::AbstractTask* task, uint16_t id);
+      registerRecipient(Tasks::AbstractTask* task, uint16_t id, const DeliveryFilter* filter = NULL);
 
       //! Unregister a task as a recipient of a given message
       //! identification number.
@@ -98,8 +103,18 @@ namespace DUNE
       const std::vector<TransportBindings*>
       getBindings(void);
 
+      //! Get the number of deliveries avoided by delivery filters,
+      //! i.e., messages that were not cloned into a task's queue.
+      //! @param task task object or NULL for all tasks.
+      //! @return number of avoided deliveries.
+      unsigned
+      getFilteredCount(const Tasks::AbstractTask* task = NULL);
+
     private:
-      typedef std::list<Tasks::AbstractTask*> TransportList;
+      // Forward declaration.
+      struct Subscription;
+
+      typedef std::list<Subscription*> TransportList;
       //! Table of recipients.
       std::map<uint16_t, TransportList> m_recipients;
       //! Internal list lock.
@@ -111,11 +111,11 @@ namespace DUNE
     }
 
     void
-    EntityState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    EntityState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "state", state, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
-      IMC::toJSON(os__, "description", description, nindent__);
+      w__.field("state", state);
+      w__.field("flags", flags);
+      w__.field("description", description);
     }
 
     QueryEntityState::QueryEntityState(void)
@@ -240,13 +240,13 @@ namespace DUNE
     }
 
     void
-    EntityInfo::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    EntityInfo::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
-      IMC::toJSON(os__, "label", label, nindent__);
-      IMC::toJSON(os__, "component", component, nindent__);
-      IMC::toJSON(os__, "act_time", act_time, nindent__);
-      IMC::toJSON(os__, "deact_time", deact_time, nindent__);
+      w__.field("id", id);
+      w__.field("label", label);
+      w__.field("component", component);
+      w__.field("act_time", act_time);
+      w__.field("deact_time", deact_time);
     }
 
     QueryEntityInfo::QueryEntityInfo(void)
@@ -312,9 +312,9 @@ namespace DUNE
     }
 
     void
-    QueryEntityInfo::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    QueryEntityInfo::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
+      w__.field("id", id);
     }
 
     EntityList::EntityList(void)
@@ -373,10 +373,10 @@ namespace DUNE
     }
 
     void
-    EntityList::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    EntityList::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "list", list, nindent__);
+      w__.field("op", op);
+      w__.field("list", list);
     }
 
     CpuUsage::CpuUsage(void)
@@ -443,9 +443,9 @@ namespace DUNE
     }
 
     void
-    CpuUsage::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CpuUsage::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     TransportBindings::TransportBindings(void)
@@ -504,10 +504,10 @@ namespace DUNE
     }
 
     void
-    TransportBindings::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TransportBindings::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "consumer", consumer, nindent__);
-      IMC::toJSON(os__, "message_id", message_id, nindent__);
+      w__.field("consumer", consumer);
+      w__.field("message_id", message_id);
     }
 
     RestartSystem::RestartSystem(void)
@@ -561,9 +561,9 @@ namespace DUNE
     }
 
     void
-    RestartSystem::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    RestartSystem::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
+      w__.field("type", type);
     }
 
     DevCalibrationControl::DevCalibrationControl(void)
@@ -617,9 +617,9 @@ namespace DUNE
     }
 
     void
-    DevCalibrationControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DevCalibrationControl::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
+      w__.field("op", op);
     }
 
     DevCalibrationState::DevCalibrationState(void)
@@ -688,12 +688,12 @@ namespace DUNE
     }
 
     void
-    DevCalibrationState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DevCalibrationState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "total_steps", total_steps, nindent__);
-      IMC::toJSON(os__, "step_number", step_number, nindent__);
-      IMC::toJSON(os__, "step", step, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
+      w__.field("total_steps", total_steps);
+      w__.field("step_number", step_number);
+      w__.field("step", step);
+      w__.field("flags", flags);
     }
 
     EntityActivationState::EntityActivationState(void)
@@ -752,10 +752,10 @@ namespace DUNE
     }
 
     void
-    EntityActivationState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    EntityActivationState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "state", state, nindent__);
-      IMC::toJSON(os__, "error", error, nindent__);
+      w__.field("state", state);
+      w__.field("error", error);
     }
 
     QueryEntityActivationState::QueryEntityActivationState(void)
@@ -948,26 +948,26 @@ namespace DUNE
     }
 
     void
-    VehicleOperationalLimits::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    VehicleOperationalLimits::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "speed_min", speed_min, nindent__);
-      IMC::toJSON(os__, "speed_max", speed_max, nindent__);
-      IMC::toJSON(os__, "long_accel", long_accel, nindent__);
-      IMC::toJSON(os__, "alt_max_msl", alt_max_msl, nindent__);
-      IMC::toJSON(os__, "dive_fraction_max", dive_fraction_max, nindent__);
-      IMC::toJSON(os__, "climb_fraction_max", climb_fraction_max, nindent__);
-      IMC::toJSON(os__, "bank_max", bank_max, nindent__);
-      IMC::toJSON(os__, "p_max", p_max, nindent__);
-      IMC::toJSON(os__, "pitch_min", pitch_min, nindent__);
-      IMC::toJSON(os__, "pitch_max", pitch_max, nindent__);
-      IMC::toJSON(os__, "q_max", q_max, nindent__);
-      IMC::toJSON(os__, "g_min", g_min, nindent__);
-      IMC::toJSON(os__, "g_max", g_max, nindent__);
-      IMC::toJSON(os__, "g_lat_max", g_lat_max, nindent__);
-      IMC::toJSON(os__, "rpm_min", rpm_min, nindent__);
-      IMC::toJSON(os__, "rpm_max", rpm_max, nindent__);
-      IMC::toJSON(os__, "rpm_rate_max", rpm_rate_max, nindent__);
+      w__.field("op", op);
+      w__.field("speed_min", speed_min);
+      w__.field("speed_max", speed_max);
+      w__.field("long_accel", long_accel);
+      w__.field("alt_max_msl", alt_max_msl);
+      w__.field("dive_fraction_max", dive_fraction_max);
+      w__.field("climb_fraction_max", climb_fraction_max);
+      w__.field("bank_max", bank_max);
+      w__.field("p_max", p_max);
+      w__.field("pitch_min", pitch_min);
+      w__.field("pitch_max", pitch_max);
+      w__.field("q_max", q_max);
+      w__.field("g_min", g_min);
+      w__.field("g_max", g_max);
+      w__.field("g_lat_max", g_lat_max);
+      w__.field("rpm_min", rpm_min);
+      w__.field("rpm_max", rpm_max);
+      w__.field("rpm_rate_max", rpm_rate_max);
     }
 
     MsgList::MsgList(void)
@@ -1022,9 +1022,9 @@ namespace DUNE
     }
 
     void
-    MsgList::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    MsgList::writeJSONFields(JSONWriter& w__) const
     {
-      msgs.toJSON(os__, "msgs", nindent__);
+      msgs.toJSON(w__, "msgs");
     }
 
     void
@@ -1201,26 +1201,26 @@ namespace DUNE
     }
 
     void
-    SimulatedState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SimulatedState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "height", height, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "phi", phi, nindent__);
-      IMC::toJSON(os__, "theta", theta, nindent__);
-      IMC::toJSON(os__, "psi", psi, nindent__);
-      IMC::toJSON(os__, "u", u, nindent__);
-      IMC::toJSON(os__, "v", v, nindent__);
-      IMC::toJSON(os__, "w", w, nindent__);
-      IMC::toJSON(os__, "p", p, nindent__);
-      IMC::toJSON(os__, "q", q, nindent__);
-      IMC::toJSON(os__, "r", r, nindent__);
-      IMC::toJSON(os__, "svx", svx, nindent__);
-      IMC::toJSON(os__, "svy", svy, nindent__);
-      IMC::toJSON(os__, "svz", svz, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("height", height);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
+      w__.field("phi", phi);
+      w__.field("theta", theta);
+      w__.field("psi", psi);
+      w__.field("u", u);
+      w__.field("v", v);
+      w__.field("w", w);
+      w__.field("p", p);
+      w__.field("q", q);
+      w__.field("r", r);
+      w__.field("svx", svx);
+      w__.field("svy", svy);
+      w__.field("svz", svz);
     }
 
     LeakSimulation::LeakSimulation(void)
@@ -1279,10 +1279,10 @@ namespace DUNE
     }
 
     void
-    LeakSimulation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LeakSimulation::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "entities", entities, nindent__);
+      w__.field("op", op);
+      w__.field("entities", entities);
     }
 
     UASimulation::UASimulation(void)
@@ -1346,11 +1346,11 @@ namespace DUNE
     }
 
     void
-    UASimulation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UASimulation::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("type", type);
+      w__.field("speed", speed);
+      w__.field("data", data);
     }
 
     DynamicsSimParam::DynamicsSimParam(void)
@@ -1414,11 +1414,11 @@ namespace DUNE
     }
 
     void
-    DynamicsSimParam::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DynamicsSimParam::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "tas2acc_pgain", tas2acc_pgain, nindent__);
-      IMC::toJSON(os__, "bank2p_pgain", bank2p_pgain, nindent__);
+      w__.field("op", op);
+      w__.field("tas2acc_pgain", tas2acc_pgain);
+      w__.field("bank2p_pgain", bank2p_pgain);
     }
 
     StorageUsage::StorageUsage(void)
@@ -1490,10 +1490,10 @@ namespace DUNE
     }
 
     void
-    StorageUsage::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    StorageUsage::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "available", available, nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("available", available);
+      w__.field("value", value);
     }
 
     CacheControl::CacheControl(void)
@@ -1558,11 +1558,11 @@ namespace DUNE
     }
 
     void
-    CacheControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CacheControl::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "snapshot", snapshot, nindent__);
-      message.toJSON(os__, "message", nindent__);
+      w__.field("op", op);
+      w__.field("snapshot", snapshot);
+      message.toJSON(w__, "message");
     }
 
     void
@@ -1666,10 +1666,10 @@ namespace DUNE
     }
 
     void
-    LoggingControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LoggingControl::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "name", name, nindent__);
+      w__.field("op", op);
+      w__.field("name", name);
     }
 
     LogBookEntry::LogBookEntry(void)
@@ -1738,12 +1738,12 @@ namespace DUNE
     }
 
     void
-    LogBookEntry::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LogBookEntry::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "htime", htime, nindent__);
-      IMC::toJSON(os__, "context", context, nindent__);
-      IMC::toJSON(os__, "text", text, nindent__);
+      w__.field("type", type);
+      w__.field("htime", htime);
+      w__.field("context", context);
+      w__.field("text", text);
     }
 
     LogBookControl::LogBookControl(void)
@@ -1808,11 +1808,11 @@ namespace DUNE
     }
 
     void
-    LogBookControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LogBookControl::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "command", command, nindent__);
-      IMC::toJSON(os__, "htime", htime, nindent__);
-      msg.toJSON(os__, "msg", nindent__);
+      w__.field("command", command);
+      w__.field("htime", htime);
+      msg.toJSON(w__, "msg");
     }
 
     void
@@ -1901,10 +1901,10 @@ namespace DUNE
     }
 
     void
-    ReplayControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ReplayControl::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "file", file, nindent__);
+      w__.field("op", op);
+      w__.field("file", file);
     }
 
     ClockControl::ClockControl(void)
@@ -1969,11 +1969,11 @@ namespace DUNE
     }
 
     void
-    ClockControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ClockControl::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "clock", clock, nindent__);
-      IMC::toJSON(os__, "tz", tz, nindent__);
+      w__.field("op", op);
+      w__.field("clock", clock);
+      w__.field("tz", tz);
     }
 
     HistoricCTD::HistoricCTD(void)
@@ -2037,11 +2037,11 @@ namespace DUNE
     }
 
     void
-    HistoricCTD::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    HistoricCTD::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "conductivity", conductivity, nindent__);
-      IMC::toJSON(os__, "temperature", temperature, nindent__);
-      IMC::toJSON(os__, "depth", depth, nindent__);
+      w__.field("conductivity", conductivity);
+      w__.field("temperature", temperature);
+      w__.field("depth", depth);
     }
 
     HistoricTelemetry::HistoricTelemetry(void)
@@ -2115,13 +2115,13 @@ namespace DUNE
     }
 
     void
-    HistoricTelemetry::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    HistoricTelemetry::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "altitude", altitude, nindent__);
-      IMC::toJSON(os__, "roll", roll, nindent__);
-      IMC::toJSON(os__, "pitch", pitch, nindent__);
-      IMC::toJSON(os__, "yaw", yaw, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
+      w__.field("altitude", altitude);
+      w__.field("roll", roll);
+      w__.field("pitch", pitch);
+      w__.field("yaw", yaw);
+      w__.field("speed", speed);
     }
 
     HistoricSonarData::HistoricSonarData(void)
@@ -2205,15 +2205,15 @@ namespace DUNE
     }
 
     void
-    HistoricSonarData::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    HistoricSonarData::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "altitude", altitude, nindent__);
-      IMC::toJSON(os__, "width", width, nindent__);
-      IMC::toJSON(os__, "length", length, nindent__);
-      IMC::toJSON(os__, "bearing", bearing, nindent__);
-      IMC::toJSON(os__, "pxl", pxl, nindent__);
-      IMC::toJSON(os__, "encoding", encoding, nindent__);
-      IMC::toJSON(os__, "sonar_data", sonar_data, nindent__);
+      w__.field("altitude", altitude);
+      w__.field("width", width);
+      w__.field("length", length);
+      w__.field("bearing", bearing);
+      w__.field("pxl", pxl);
+      w__.field("encoding", encoding);
+      w__.field("sonar_data", sonar_data);
     }
 
     HistoricEvent::HistoricEvent(void)
@@ -2272,10 +2272,10 @@ namespace DUNE
     }
 
     void
-    HistoricEvent::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    HistoricEvent::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "text", text, nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
+      w__.field("text", text);
+      w__.field("type", type);
     }
 
     ProfileSample::ProfileSample(void)
@@ -2334,10 +2334,10 @@ namespace DUNE
     }
 
     void
-    ProfileSample::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ProfileSample::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "depth", depth, nindent__);
-      IMC::toJSON(os__, "avg", avg, nindent__);
+      w__.field("depth", depth);
+      w__.field("avg", avg);
     }
 
     VerticalProfile::VerticalProfile(void)
@@ -2412,13 +2412,13 @@ namespace DUNE
     }
 
     void
-    VerticalProfile::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    VerticalProfile::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "parameter", parameter, nindent__);
-      IMC::toJSON(os__, "numsamples", numsamples, nindent__);
-      samples.toJSON(os__, "samples", nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
+      w__.field("parameter", parameter);
+      w__.field("numsamples", numsamples);
+      samples.toJSON(w__, "samples");
+      w__.field("lat", lat);
+      w__.field("lon", lon);
     }
 
     void
@@ -2573,15 +2573,15 @@ namespace DUNE
     }
 
     void
-    Announce::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Announce::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "sys_name", sys_name, nindent__);
-      IMC::toJSON(os__, "sys_type", sys_type, nindent__);
-      IMC::toJSON(os__, "owner", owner, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "height", height, nindent__);
-      IMC::toJSON(os__, "services", services, nindent__);
+      w__.field("sys_name", sys_name);
+      w__.field("sys_type", sys_type);
+      w__.field("owner", owner);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("height", height);
+      w__.field("services", services);
     }
 
     AnnounceService::AnnounceService(void)
@@ -2640,10 +2640,10 @@ namespace DUNE
     }
 
     void
-    AnnounceService::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    AnnounceService::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "service", service, nindent__);
-      IMC::toJSON(os__, "service_type", service_type, nindent__);
+      w__.field("service", service);
+      w__.field("service_type", service_type);
     }
 
     RSSI::RSSI(void)
@@ -2710,9 +2710,9 @@ namespace DUNE
     }
 
     void
-    RSSI::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    RSSI::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     VSWR::VSWR(void)
@@ -2778,9 +2778,9 @@ namespace DUNE
     }
 
     void
-    VSWR::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    VSWR::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     LinkLevel::LinkLevel(void)
@@ -2846,9 +2846,9 @@ namespace DUNE
     }
 
     void
-    LinkLevel::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LinkLevel::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Sms::Sms(void)
@@ -2912,11 +2912,11 @@ namespace DUNE
     }
 
     void
-    Sms::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Sms::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "number", number, nindent__);
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "contents", contents, nindent__);
+      w__.field("number", number);
+      w__.field("timeout", timeout);
+      w__.field("contents", contents);
     }
 
     SmsTx::SmsTx(void)
@@ -2985,12 +2985,12 @@ namespace DUNE
     }
 
     void
-    SmsTx::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SmsTx::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "seq", seq, nindent__);
-      IMC::toJSON(os__, "destination", destination, nindent__);
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("seq", seq);
+      w__.field("destination", destination);
+      w__.field("timeout", timeout);
+      w__.field("data", data);
     }
 
     SmsRx::SmsRx(void)
@@ -3049,10 +3049,10 @@ namespace DUNE
     }
 
     void
-    SmsRx::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SmsRx::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "source", source, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("source", source);
+      w__.field("data", data);
     }
 
     SmsState::SmsState(void)
@@ -3116,11 +3116,11 @@ namespace DUNE
     }
 
     void
-    SmsState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SmsState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "seq", seq, nindent__);
-      IMC::toJSON(os__, "state", state, nindent__);
-      IMC::toJSON(os__, "error", error, nindent__);
+      w__.field("seq", seq);
+      w__.field("state", state);
+      w__.field("error", error);
     }
 
     TextMessage::TextMessage(void)
@@ -3179,10 +3179,10 @@ namespace DUNE
     }
 
     void
-    TextMessage::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TextMessage::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "origin", origin, nindent__);
-      IMC::toJSON(os__, "text", text, nindent__);
+      w__.field("origin", origin);
+      w__.field("text", text);
     }
 
     IridiumMsgRx::IridiumMsgRx(void)
@@ -3256,13 +3256,13 @@ namespace DUNE
     }
 
     void
-    IridiumMsgRx::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    IridiumMsgRx::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "origin", origin, nindent__);
-      IMC::toJSON(os__, "htime", htime, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("origin", origin);
+      w__.field("htime", htime);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("data", data);
     }
 
     IridiumMsgTx::IridiumMsgTx(void)
@@ -3331,12 +3331,12 @@ namespace DUNE
     }
 
     void
-    IridiumMsgTx::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    IridiumMsgTx::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "req_id", req_id, nindent__);
-      IMC::toJSON(os__, "ttl", ttl, nindent__);
-      IMC::toJSON(os__, "destination", destination, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("req_id", req_id);
+      w__.field("ttl", ttl);
+      w__.field("destination", destination);
+      w__.field("data", data);
     }
 
     IridiumTxStatus::IridiumTxStatus(void)
@@ -3400,11 +3400,11 @@ namespace DUNE
     }
 
     void
-    IridiumTxStatus::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    IridiumTxStatus::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "req_id", req_id, nindent__);
-      IMC::toJSON(os__, "status", status, nindent__);
-      IMC::toJSON(os__, "text", text, nindent__);
+      w__.field("req_id", req_id);
+      w__.field("status", status);
+      w__.field("text", text);
     }
 
     GroupMembershipState::GroupMembershipState(void)
@@ -3463,10 +3463,10 @@ namespace DUNE
     }
 
     void
-    GroupMembershipState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    GroupMembershipState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "group_name", group_name, nindent__);
-      IMC::toJSON(os__, "links", links, nindent__);
+      w__.field("group_name", group_name);
+      w__.field("links", links);
     }
 
     SystemGroup::SystemGroup(void)
@@ -3530,11 +3530,11 @@ namespace DUNE
     }
 
     void
-    SystemGroup::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SystemGroup::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "groupname", groupname, nindent__);
-      IMC::toJSON(os__, "action", action, nindent__);
-      IMC::toJSON(os__, "grouplist", grouplist, nindent__);
+      w__.field("groupname", groupname);
+      w__.field("action", action);
+      w__.field("grouplist", grouplist);
     }
 
     LinkLatency::LinkLatency(void)
@@ -3606,10 +3606,10 @@ namespace DUNE
     }
 
     void
-    LinkLatency::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LinkLatency::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
-      IMC::toJSON(os__, "sys_src", sys_src, nindent__);
+      w__.field("value", value);
+      w__.field("sys_src", sys_src);
     }
 
     ExtendedRSSI::ExtendedRSSI(void)
@@ -3680,10 +3680,10 @@ namespace DUNE
     }
 
     void
-    ExtendedRSSI::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ExtendedRSSI::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
-      IMC::toJSON(os__, "units", units, nindent__);
+      w__.field("value", value);
+      w__.field("units", units);
     }
 
     HistoricData::HistoricData(void)
@@ -3753,12 +3753,12 @@ namespace DUNE
     }
 
     void
-    HistoricData::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    HistoricData::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "base_lat", base_lat, nindent__);
-      IMC::toJSON(os__, "base_lon", base_lon, nindent__);
-      IMC::toJSON(os__, "base_time", base_time, nindent__);
-      data.toJSON(os__, "data", nindent__);
+      w__.field("base_lat", base_lat);
+      w__.field("base_lon", base_lon);
+      w__.field("base_time", base_time);
+      data.toJSON(w__, "data");
     }
 
     void
@@ -3857,12 +3857,12 @@ namespace DUNE
     }
 
     void
-    CompressedHistory::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CompressedHistory::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "base_lat", base_lat, nindent__);
-      IMC::toJSON(os__, "base_lon", base_lon, nindent__);
-      IMC::toJSON(os__, "base_time", base_time, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("base_lat", base_lat);
+      w__.field("base_lon", base_lon);
+      w__.field("base_time", base_time);
+      w__.field("data", data);
     }
 
     HistoricSample::HistoricSample(void)
@@ -3947,15 +3947,15 @@ namespace DUNE
     }
 
     void
-    HistoricSample::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    HistoricSample::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "sys_id", sys_id, nindent__);
-      IMC::toJSON(os__, "priority", priority, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "t", t, nindent__);
-      sample.toJSON(os__, "sample", nindent__);
+      w__.field("sys_id", sys_id);
+      w__.field("priority", priority);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
+      w__.field("t", t);
+      sample.toJSON(w__, "sample");
     }
 
     void
@@ -4070,12 +4070,12 @@ namespace DUNE
     }
 
     void
-    HistoricDataQuery::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    HistoricDataQuery::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "req_id", req_id, nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "max_size", max_size, nindent__);
-      data.toJSON(os__, "data", nindent__);
+      w__.field("req_id", req_id);
+      w__.field("type", type);
+      w__.field("max_size", max_size);
+      data.toJSON(w__, "data");
     }
 
     void
@@ -4190,12 +4190,12 @@ namespace DUNE
     }
 
     void
-    RemoteCommand::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    RemoteCommand::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "original_source", original_source, nindent__);
-      IMC::toJSON(os__, "destination", destination, nindent__);
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      cmd.toJSON(os__, "cmd", nindent__);
+      w__.field("original_source", original_source);
+      w__.field("destination", destination);
+      w__.field("timeout", timeout);
+      cmd.toJSON(w__, "cmd");
     }
 
     void
@@ -4309,12 +4309,12 @@ namespace DUNE
     }
 
     void
-    CommSystemsQuery::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CommSystemsQuery::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "comm_interface", comm_interface, nindent__);
-      IMC::toJSON(os__, "model", model, nindent__);
-      IMC::toJSON(os__, "list", list, nindent__);
+      w__.field("type", type);
+      w__.field("comm_interface", comm_interface);
+      w__.field("model", model);
+      w__.field("list", list);
     }
 
     TelemetryMsg::TelemetryMsg(void)
@@ -4408,17 +4408,17 @@ namespace DUNE
     }
 
     void
-    TelemetryMsg::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TelemetryMsg::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "req_id", req_id, nindent__);
-      IMC::toJSON(os__, "ttl", ttl, nindent__);
-      IMC::toJSON(os__, "code", code, nindent__);
-      IMC::toJSON(os__, "destination", destination, nindent__);
-      IMC::toJSON(os__, "source", source, nindent__);
-      IMC::toJSON(os__, "acknowledge", acknowledge, nindent__);
-      IMC::toJSON(os__, "status", status, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("type", type);
+      w__.field("req_id", req_id);
+      w__.field("ttl", ttl);
+      w__.field("code", code);
+      w__.field("destination", destination);
+      w__.field("source", source);
+      w__.field("acknowledge", acknowledge);
+      w__.field("status", status);
+      w__.field("data", data);
     }
 
     LblRange::LblRange(void)
@@ -4489,10 +4489,10 @@ namespace DUNE
     }
 
     void
-    LblRange::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LblRange::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
-      IMC::toJSON(os__, "range", range, nindent__);
+      w__.field("id", id);
+      w__.field("range", range);
     }
 
     LblBeacon::LblBeacon(void)
@@ -4578,15 +4578,15 @@ namespace DUNE
     }
 
     void
-    LblBeacon::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LblBeacon::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "beacon", beacon, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "depth", depth, nindent__);
-      IMC::toJSON(os__, "query_channel", query_channel, nindent__);
-      IMC::toJSON(os__, "reply_channel", reply_channel, nindent__);
-      IMC::toJSON(os__, "transponder_delay", transponder_delay, nindent__);
+      w__.field("beacon", beacon);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("depth", depth);
+      w__.field("query_channel", query_channel);
+      w__.field("reply_channel", reply_channel);
+      w__.field("transponder_delay", transponder_delay);
     }
 
     LblConfig::LblConfig(void)
@@ -4646,10 +4646,10 @@ namespace DUNE
     }
 
     void
-    LblConfig::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LblConfig::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      beacons.toJSON(os__, "beacons", nindent__);
+      w__.field("op", op);
+      beacons.toJSON(w__, "beacons");
     }
 
     void
@@ -4734,9 +4734,9 @@ namespace DUNE
     }
 
     void
-    AcousticMessage::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    AcousticMessage::writeJSONFields(JSONWriter& w__) const
     {
-      message.toJSON(os__, "message", nindent__);
+      message.toJSON(w__, "message");
     }
 
     void
@@ -4885,19 +4885,19 @@ namespace DUNE
     }
 
     void
-    SimAcousticMessage::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SimAcousticMessage::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "depth", depth, nindent__);
-      IMC::toJSON(os__, "sentence", sentence, nindent__);
-      IMC::toJSON(os__, "txtime", txtime, nindent__);
-      IMC::toJSON(os__, "modem_type", modem_type, nindent__);
-      IMC::toJSON(os__, "sys_src", sys_src, nindent__);
-      IMC::toJSON(os__, "seq", seq, nindent__);
-      IMC::toJSON(os__, "sys_dst", sys_dst, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("depth", depth);
+      w__.field("sentence", sentence);
+      w__.field("txtime", txtime);
+      w__.field("modem_type", modem_type);
+      w__.field("sys_src", sys_src);
+      w__.field("seq", seq);
+      w__.field("sys_dst", sys_dst);
+      w__.field("flags", flags);
+      w__.field("data", data);
     }
 
     AcousticOperation::AcousticOperation(void)
@@ -4967,12 +4967,12 @@ namespace DUNE
     }
 
     void
-    AcousticOperation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    AcousticOperation::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "system", system, nindent__);
-      IMC::toJSON(os__, "range", range, nindent__);
-      msg.toJSON(os__, "msg", nindent__);
+      w__.field("op", op);
+      w__.field("system", system);
+      w__.field("range", range);
+      msg.toJSON(w__, "msg");
     }
 
     void
@@ -5110,9 +5110,9 @@ namespace DUNE
     }
 
     void
-    AcousticSystems::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    AcousticSystems::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "list", list, nindent__);
+      w__.field("list", list);
     }
 
     AcousticLink::AcousticLink(void)
@@ -5176,11 +5176,11 @@ namespace DUNE
     }
 
     void
-    AcousticLink::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    AcousticLink::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "peer", peer, nindent__);
-      IMC::toJSON(os__, "rssi", rssi, nindent__);
-      IMC::toJSON(os__, "integrity", integrity, nindent__);
+      w__.field("peer", peer);
+      w__.field("rssi", rssi);
+      w__.field("integrity", integrity);
     }
 
     AcousticRequest::AcousticRequest(void)
@@ -5260,14 +5260,14 @@ namespace DUNE
     }
 
     void
-    AcousticRequest::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    AcousticRequest::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "req_id", req_id, nindent__);
-      IMC::toJSON(os__, "destination", destination, nindent__);
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "range", range, nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
-      msg.toJSON(os__, "msg", nindent__);
+      w__.field("req_id", req_id);
+      w__.field("destination", destination);
+      w__.field("timeout", timeout);
+      w__.field("range", range);
+      w__.field("type", type);
+      msg.toJSON(w__, "msg");
     }
 
     void
@@ -5386,13 +5386,13 @@ namespace DUNE
     }
 
     void
-    AcousticStatus::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    AcousticStatus::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "req_id", req_id, nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "status", status, nindent__);
-      IMC::toJSON(os__, "info", info, nindent__);
-      IMC::toJSON(os__, "range", range, nindent__);
+      w__.field("req_id", req_id);
+      w__.field("type", type);
+      w__.field("status", status);
+      w__.field("info", info);
+      w__.field("range", range);
     }
 
     Rpm::Rpm(void)
@@ -5458,9 +5458,9 @@ namespace DUNE
     }
 
     void
-    Rpm::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Rpm::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Voltage::Voltage(void)
@@ -5526,9 +5526,9 @@ namespace DUNE
     }
 
     void
-    Voltage::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Voltage::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Current::Current(void)
@@ -5594,9 +5594,9 @@ namespace DUNE
     }
 
     void
-    Current::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Current::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     GpsFix::GpsFix(void)
@@ -5727,24 +5727,24 @@ namespace DUNE
     }
 
     void
-    GpsFix::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    GpsFix::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "validity", validity, nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "utc_year", utc_year, nindent__);
-      IMC::toJSON(os__, "utc_month", utc_month, nindent__);
-      IMC::toJSON(os__, "utc_day", utc_day, nindent__);
-      IMC::toJSON(os__, "utc_time", utc_time, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "height", height, nindent__);
-      IMC::toJSON(os__, "satellites", satellites, nindent__);
-      IMC::toJSON(os__, "cog", cog, nindent__);
-      IMC::toJSON(os__, "sog", sog, nindent__);
-      IMC::toJSON(os__, "hdop", hdop, nindent__);
-      IMC::toJSON(os__, "vdop", vdop, nindent__);
-      IMC::toJSON(os__, "hacc", hacc, nindent__);
-      IMC::toJSON(os__, "vacc", vacc, nindent__);
+      w__.field("validity", validity);
+      w__.field("type", type);
+      w__.field("utc_year", utc_year);
+      w__.field("utc_month", utc_month);
+      w__.field("utc_day", utc_day);
+      w__.field("utc_time", utc_time);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("height", height);
+      w__.field("satellites", satellites);
+      w__.field("cog", cog);
+      w__.field("sog", sog);
+      w__.field("hdop", hdop);
+      w__.field("vdop", vdop);
+      w__.field("hacc", hacc);
+      w__.field("vacc", vacc);
     }
 
     EulerAngles::EulerAngles(void)
@@ -5822,13 +5822,13 @@ namespace DUNE
     }
 
     void
-    EulerAngles::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    EulerAngles::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "time", time, nindent__);
-      IMC::toJSON(os__, "phi", phi, nindent__);
-      IMC::toJSON(os__, "theta", theta, nindent__);
-      IMC::toJSON(os__, "psi", psi, nindent__);
-      IMC::toJSON(os__, "psi_magnetic", psi_magnetic, nindent__);
+      w__.field("time", time);
+      w__.field("phi", phi);
+      w__.field("theta", theta);
+      w__.field("psi", psi);
+      w__.field("psi_magnetic", psi_magnetic);
     }
 
     EulerAnglesDelta::EulerAnglesDelta(void)
@@ -5902,13 +5902,13 @@ namespace DUNE
     }
 
     void
-    EulerAnglesDelta::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    EulerAnglesDelta::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "time", time, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "timestep", timestep, nindent__);
+      w__.field("time", time);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
+      w__.field("timestep", timestep);
     }
 
     AngularVelocity::AngularVelocity(void)
@@ -5977,12 +5977,12 @@ namespace DUNE
     }
 
     void
-    AngularVelocity::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    AngularVelocity::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "time", time, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
+      w__.field("time", time);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
     }
 
     Acceleration::Acceleration(void)
@@ -6051,12 +6051,12 @@ namespace DUNE
     }
 
     void
-    Acceleration::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Acceleration::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "time", time, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
+      w__.field("time", time);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
     }
 
     MagneticField::MagneticField(void)
@@ -6125,12 +6125,12 @@ namespace DUNE
     }
 
     void
-    MagneticField::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    MagneticField::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "time", time, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
+      w__.field("time", time);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
     }
 
     GroundVelocity::GroundVelocity(void)
@@ -6199,12 +6199,12 @@ namespace DUNE
     }
 
     void
-    GroundVelocity::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    GroundVelocity::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "validity", validity, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
+      w__.field("validity", validity);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
     }
 
     WaterVelocity::WaterVelocity(void)
@@ -6273,12 +6273,12 @@ namespace DUNE
     }
 
     void
-    WaterVelocity::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    WaterVelocity::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "validity", validity, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
+      w__.field("validity", validity);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
     }
 
     VelocityDelta::VelocityDelta(void)
@@ -6347,12 +6347,12 @@ namespace DUNE
     }
 
     void
-    VelocityDelta::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    VelocityDelta::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "time", time, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
+      w__.field("time", time);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
     }
 
     DeviceState::DeviceState(void)
@@ -6431,14 +6431,14 @@ namespace DUNE
     }
 
     void
-    DeviceState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DeviceState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "phi", phi, nindent__);
-      IMC::toJSON(os__, "theta", theta, nindent__);
-      IMC::toJSON(os__, "psi", psi, nindent__);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
+      w__.field("phi", phi);
+      w__.field("theta", theta);
+      w__.field("psi", psi);
     }
 
     BeamConfig::BeamConfig(void)
@@ -6499,10 +6499,10 @@ namespace DUNE
     }
 
     void
-    BeamConfig::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    BeamConfig::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "beam_width", beam_width, nindent__);
-      IMC::toJSON(os__, "beam_height", beam_height, nindent__);
+      w__.field("beam_width", beam_width);
+      w__.field("beam_height", beam_height);
     }
 
     Distance::Distance(void)
@@ -6585,12 +6585,12 @@ namespace DUNE
     }
 
     void
-    Distance::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Distance::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "validity", validity, nindent__);
-      location.toJSON(os__, "location", nindent__);
-      beam_config.toJSON(os__, "beam_config", nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("validity", validity);
+      location.toJSON(w__, "location");
+      beam_config.toJSON(w__, "beam_config");
+      w__.field("value", value);
     }
 
     void
@@ -6696,9 +6696,9 @@ namespace DUNE
     }
 
     void
-    Temperature::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Temperature::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Pressure::Pressure(void)
@@ -6764,9 +6764,9 @@ namespace DUNE
     }
 
     void
-    Pressure::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Pressure::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Depth::Depth(void)
@@ -6832,9 +6832,9 @@ namespace DUNE
     }
 
     void
-    Depth::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Depth::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     DepthOffset::DepthOffset(void)
@@ -6900,9 +6900,9 @@ namespace DUNE
     }
 
     void
-    DepthOffset::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DepthOffset::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     SoundSpeed::SoundSpeed(void)
@@ -6968,9 +6968,9 @@ namespace DUNE
     }
 
     void
-    SoundSpeed::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SoundSpeed::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     WaterDensity::WaterDensity(void)
@@ -7036,9 +7036,9 @@ namespace DUNE
     }
 
     void
-    WaterDensity::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    WaterDensity::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Conductivity::Conductivity(void)
@@ -7104,9 +7104,9 @@ namespace DUNE
     }
 
     void
-    Conductivity::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Conductivity::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Salinity::Salinity(void)
@@ -7172,9 +7172,9 @@ namespace DUNE
     }
 
     void
-    Salinity::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Salinity::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     WindSpeed::WindSpeed(void)
@@ -7238,11 +7238,11 @@ namespace DUNE
     }
 
     void
-    WindSpeed::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    WindSpeed::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "direction", direction, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "turbulence", turbulence, nindent__);
+      w__.field("direction", direction);
+      w__.field("speed", speed);
+      w__.field("turbulence", turbulence);
     }
 
     RelativeHumidity::RelativeHumidity(void)
@@ -7309,9 +7309,9 @@ namespace DUNE
     }
 
     void
-    RelativeHumidity::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    RelativeHumidity::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     DevDataText::DevDataText(void)
@@ -7365,9 +7365,9 @@ namespace DUNE
     }
 
     void
-    DevDataText::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DevDataText::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     DevDataBinary::DevDataBinary(void)
@@ -7421,9 +7421,9 @@ namespace DUNE
     }
 
     void
-    DevDataBinary::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DevDataBinary::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Force::Force(void)
@@ -7489,9 +7489,9 @@ namespace DUNE
     }
 
     void
-    Force::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Force::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     SonarData::SonarData(void)
@@ -7581,16 +7581,16 @@ namespace DUNE
     }
 
     void
-    SonarData::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SonarData::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "frequency", frequency, nindent__);
-      IMC::toJSON(os__, "min_range", min_range, nindent__);
-      IMC::toJSON(os__, "max_range", max_range, nindent__);
-      IMC::toJSON(os__, "bits_per_point", bits_per_point, nindent__);
-      IMC::toJSON(os__, "scale_factor", scale_factor, nindent__);
-      beam_config.toJSON(os__, "beam_config", nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("type", type);
+      w__.field("frequency", frequency);
+      w__.field("min_range", min_range);
+      w__.field("max_range", max_range);
+      w__.field("bits_per_point", bits_per_point);
+      w__.field("scale_factor", scale_factor);
+      beam_config.toJSON(w__, "beam_config");
+      w__.field("data", data);
     }
 
     void
@@ -7713,9 +7713,9 @@ namespace DUNE
     }
 
     void
-    PulseDetectionControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PulseDetectionControl::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
+      w__.field("op", op);
     }
 
     FuelLevel::FuelLevel(void)
@@ -7793,11 +7793,11 @@ namespace DUNE
     }
 
     void
-    FuelLevel::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FuelLevel::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
-      IMC::toJSON(os__, "confidence", confidence, nindent__);
-      IMC::toJSON(os__, "opmodes", opmodes, nindent__);
+      w__.field("value", value);
+      w__.field("confidence", confidence);
+      w__.field("opmodes", opmodes);
     }
 
     GpsNavData::GpsNavData(void)
@@ -7921,23 +7921,23 @@ namespace DUNE
     }
 
     void
-    GpsNavData::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    GpsNavData::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "itow", itow, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "height_ell", height_ell, nindent__);
-      IMC::toJSON(os__, "height_sea", height_sea, nindent__);
-      IMC::toJSON(os__, "hacc", hacc, nindent__);
-      IMC::toJSON(os__, "vacc", vacc, nindent__);
-      IMC::toJSON(os__, "vel_n", vel_n, nindent__);
-      IMC::toJSON(os__, "vel_e", vel_e, nindent__);
-      IMC::toJSON(os__, "vel_d", vel_d, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "gspeed", gspeed, nindent__);
-      IMC::toJSON(os__, "heading", heading, nindent__);
-      IMC::toJSON(os__, "sacc", sacc, nindent__);
-      IMC::toJSON(os__, "cacc", cacc, nindent__);
+      w__.field("itow", itow);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("height_ell", height_ell);
+      w__.field("height_sea", height_sea);
+      w__.field("hacc", hacc);
+      w__.field("vacc", vacc);
+      w__.field("vel_n", vel_n);
+      w__.field("vel_e", vel_e);
+      w__.field("vel_d", vel_d);
+      w__.field("speed", speed);
+      w__.field("gspeed", gspeed);
+      w__.field("heading", heading);
+      w__.field("sacc", sacc);
+      w__.field("cacc", cacc);
     }
 
     ServoPosition::ServoPosition(void)
@@ -8021,10 +8021,10 @@ namespace DUNE
     }
 
     void
-    ServoPosition::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ServoPosition::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("id", id);
+      w__.field("value", value);
     }
 
     DataSanity::DataSanity(void)
@@ -8078,9 +8078,9 @@ namespace DUNE
     }
 
     void
-    DataSanity::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DataSanity::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "sane", sane, nindent__);
+      w__.field("sane", sane);
     }
 
     RhodamineDye::RhodamineDye(void)
@@ -8146,9 +8146,9 @@ namespace DUNE
     }
 
     void
-    RhodamineDye::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    RhodamineDye::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     CrudeOil::CrudeOil(void)
@@ -8214,9 +8214,9 @@ namespace DUNE
     }
 
     void
-    CrudeOil::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CrudeOil::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     FineOil::FineOil(void)
@@ -8282,9 +8282,9 @@ namespace DUNE
     }
 
     void
-    FineOil::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FineOil::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Turbidity::Turbidity(void)
@@ -8350,9 +8350,9 @@ namespace DUNE
     }
 
     void
-    Turbidity::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Turbidity::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Chlorophyll::Chlorophyll(void)
@@ -8418,9 +8418,9 @@ namespace DUNE
     }
 
     void
-    Chlorophyll::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Chlorophyll::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Fluorescein::Fluorescein(void)
@@ -8486,9 +8486,9 @@ namespace DUNE
     }
 
     void
-    Fluorescein::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Fluorescein::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Phycocyanin::Phycocyanin(void)
@@ -8554,9 +8554,9 @@ namespace DUNE
     }
 
     void
-    Phycocyanin::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Phycocyanin::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Phycoerythrin::Phycoerythrin(void)
@@ -8622,9 +8622,9 @@ namespace DUNE
     }
 
     void
-    Phycoerythrin::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Phycoerythrin::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     GpsFixRtk::GpsFixRtk(void)
@@ -8750,23 +8750,23 @@ namespace DUNE
     }
 
     void
-    GpsFixRtk::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    GpsFixRtk::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "validity", validity, nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "tow", tow, nindent__);
-      IMC::toJSON(os__, "base_lat", base_lat, nindent__);
-      IMC::toJSON(os__, "base_lon", base_lon, nindent__);
-      IMC::toJSON(os__, "base_height", base_height, nindent__);
-      IMC::toJSON(os__, "n", n, nindent__);
-      IMC::toJSON(os__, "e", e, nindent__);
-      IMC::toJSON(os__, "d", d, nindent__);
-      IMC::toJSON(os__, "v_n", v_n, nindent__);
-      IMC::toJSON(os__, "v_e", v_e, nindent__);
-      IMC::toJSON(os__, "v_d", v_d, nindent__);
-      IMC::toJSON(os__, "satellites", satellites, nindent__);
-      IMC::toJSON(os__, "iar_hyp", iar_hyp, nindent__);
-      IMC::toJSON(os__, "iar_ratio", iar_ratio, nindent__);
+      w__.field("validity", validity);
+      w__.field("type", type);
+      w__.field("tow", tow);
+      w__.field("base_lat", base_lat);
+      w__.field("base_lon", base_lon);
+      w__.field("base_height", base_height);
+      w__.field("n", n);
+      w__.field("e", e);
+      w__.field("d", d);
+      w__.field("v_n", v_n);
+      w__.field("v_e", v_e);
+      w__.field("v_d", v_d);
+      w__.field("satellites", satellites);
+      w__.field("iar_hyp", iar_hyp);
+      w__.field("iar_ratio", iar_ratio);
     }
 
     EstimatedState::EstimatedState(void)
@@ -8923,28 +8923,28 @@ namespace DUNE
     }
 
     void
-    EstimatedState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    EstimatedState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "height", height, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "phi", phi, nindent__);
-      IMC::toJSON(os__, "theta", theta, nindent__);
-      IMC::toJSON(os__, "psi", psi, nindent__);
-      IMC::toJSON(os__, "u", u, nindent__);
-      IMC::toJSON(os__, "v", v, nindent__);
-      IMC::toJSON(os__, "w", w, nindent__);
-      IMC::toJSON(os__, "vx", vx, nindent__);
-      IMC::toJSON(os__, "vy", vy, nindent__);
-      IMC::toJSON(os__, "vz", vz, nindent__);
-      IMC::toJSON(os__, "p", p, nindent__);
-      IMC::toJSON(os__, "q", q, nindent__);
-      IMC::toJSON(os__, "r", r, nindent__);
-      IMC::toJSON(os__, "depth", depth, nindent__);
-      IMC::toJSON(os__, "alt", alt, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("height", height);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
+      w__.field("phi", phi);
+      w__.field("theta", theta);
+      w__.field("psi", psi);
+      w__.field("u", u);
+      w__.field("v", v);
+      w__.field("w", w);
+      w__.field("vx", vx);
+      w__.field("vy", vy);
+      w__.field("vz", vz);
+      w__.field("p", p);
+      w__.field("q", q);
+      w__.field("r", r);
+      w__.field("depth", depth);
+      w__.field("alt", alt);
     }
 
     ExternalNavData::ExternalNavData(void)
@@ -9004,10 +9004,10 @@ namespace DUNE
     }
 
     void
-    ExternalNavData::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ExternalNavData::writeJSONFields(JSONWriter& w__) const
     {
-      state.toJSON(os__, "state", nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
+      state.toJSON(w__, "state");
+      w__.field("type", type);
     }
 
     void
@@ -9118,9 +9118,9 @@ namespace DUNE
     }
 
     void
-    DissolvedOxygen::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DissolvedOxygen::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     AirSaturation::AirSaturation(void)
@@ -9186,9 +9186,9 @@ namespace DUNE
     }
 
     void
-    AirSaturation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    AirSaturation::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Throttle::Throttle(void)
@@ -9254,9 +9254,9 @@ namespace DUNE
     }
 
     void
-    Throttle::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Throttle::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     PH::PH(void)
@@ -9322,9 +9322,9 @@ namespace DUNE
     }
 
     void
-    PH::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PH::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Redox::Redox(void)
@@ -9390,9 +9390,9 @@ namespace DUNE
     }
 
     void
-    Redox::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Redox::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     CameraZoom::CameraZoom(void)
@@ -9468,11 +9468,11 @@ namespace DUNE
     }
 
     void
-    CameraZoom::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CameraZoom::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
-      IMC::toJSON(os__, "zoom", zoom, nindent__);
-      IMC::toJSON(os__, "action", action, nindent__);
+      w__.field("id", id);
+      w__.field("zoom", zoom);
+      w__.field("action", action);
     }
 
     SetThrusterActuation::SetThrusterActuation(void)
@@ -9556,10 +9556,10 @@ namespace DUNE
     }
 
     void
-    SetThrusterActuation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SetThrusterActuation::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("id", id);
+      w__.field("value", value);
     }
 
     SetServoPosition::SetServoPosition(void)
@@ -9643,10 +9643,10 @@ namespace DUNE
     }
 
     void
-    SetServoPosition::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SetServoPosition::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("id", id);
+      w__.field("value", value);
     }
 
     SetControlSurfaceDeflection::SetControlSurfaceDeflection(void)
@@ -9717,10 +9717,10 @@ namespace DUNE
     }
 
     void
-    SetControlSurfaceDeflection::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SetControlSurfaceDeflection::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
-      IMC::toJSON(os__, "angle", angle, nindent__);
+      w__.field("id", id);
+      w__.field("angle", angle);
     }
 
     RemoteActionsRequest::RemoteActionsRequest(void)
@@ -9779,10 +9779,10 @@ namespace DUNE
     }
 
     void
-    RemoteActionsRequest::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    RemoteActionsRequest::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "actions", actions, nindent__);
+      w__.field("op", op);
+      w__.field("actions", actions);
     }
 
     RemoteActions::RemoteActions(void)
@@ -9836,9 +9836,9 @@ namespace DUNE
     }
 
     void
-    RemoteActions::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    RemoteActions::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "actions", actions, nindent__);
+      w__.field("actions", actions);
     }
 
     ButtonEvent::ButtonEvent(void)
@@ -9909,10 +9909,10 @@ namespace DUNE
     }
 
     void
-    ButtonEvent::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ButtonEvent::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "button", button, nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("button", button);
+      w__.field("value", value);
     }
 
     LcdControl::LcdControl(void)
@@ -9971,10 +9971,10 @@ namespace DUNE
     }
 
     void
-    LcdControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LcdControl::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "text", text, nindent__);
+      w__.field("op", op);
+      w__.field("text", text);
     }
 
     PowerOperation::PowerOperation(void)
@@ -10038,11 +10038,11 @@ namespace DUNE
     }
 
     void
-    PowerOperation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PowerOperation::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "time_remain", time_remain, nindent__);
-      IMC::toJSON(os__, "sched_time", sched_time, nindent__);
+      w__.field("op", op);
+      w__.field("time_remain", time_remain);
+      w__.field("sched_time", sched_time);
     }
 
     PowerChannelControl::PowerChannelControl(void)
@@ -10107,11 +10107,11 @@ namespace DUNE
     }
 
     void
-    PowerChannelControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PowerChannelControl::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "sched_time", sched_time, nindent__);
+      w__.field("name", name);
+      w__.field("op", op);
+      w__.field("sched_time", sched_time);
     }
 
     QueryPowerChannelState::QueryPowerChannelState(void)
@@ -10209,10 +10209,10 @@ namespace DUNE
     }
 
     void
-    PowerChannelState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PowerChannelState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
-      IMC::toJSON(os__, "state", state, nindent__);
+      w__.field("name", name);
+      w__.field("state", state);
     }
 
     LedBrightness::LedBrightness(void)
@@ -10283,10 +10283,10 @@ namespace DUNE
     }
 
     void
-    LedBrightness::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LedBrightness::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("name", name);
+      w__.field("value", value);
     }
 
     QueryLedBrightness::QueryLedBrightness(void)
@@ -10340,9 +10340,9 @@ namespace DUNE
     }
 
     void
-    QueryLedBrightness::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    QueryLedBrightness::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
+      w__.field("name", name);
     }
 
     SetLedBrightness::SetLedBrightness(void)
@@ -10413,10 +10413,10 @@ namespace DUNE
     }
 
     void
-    SetLedBrightness::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SetLedBrightness::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("name", name);
+      w__.field("value", value);
     }
 
     SetPWM::SetPWM(void)
@@ -10492,11 +10492,11 @@ namespace DUNE
     }
 
     void
-    SetPWM::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SetPWM::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
-      IMC::toJSON(os__, "period", period, nindent__);
-      IMC::toJSON(os__, "duty_cycle", duty_cycle, nindent__);
+      w__.field("id", id);
+      w__.field("period", period);
+      w__.field("duty_cycle", duty_cycle);
     }
 
     PWM::PWM(void)
@@ -10572,11 +10572,11 @@ namespace DUNE
     }
 
     void
-    PWM::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PWM::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
-      IMC::toJSON(os__, "period", period, nindent__);
-      IMC::toJSON(os__, "duty_cycle", duty_cycle, nindent__);
+      w__.field("id", id);
+      w__.field("period", period);
+      w__.field("duty_cycle", duty_cycle);
     }
 
     EstimatedStreamVelocity::EstimatedStreamVelocity(void)
@@ -10640,11 +10640,11 @@ namespace DUNE
     }
 
     void
-    EstimatedStreamVelocity::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    EstimatedStreamVelocity::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
     }
 
     IndicatedSpeed::IndicatedSpeed(void)
@@ -10710,9 +10710,9 @@ namespace DUNE
     }
 
     void
-    IndicatedSpeed::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    IndicatedSpeed::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     TrueSpeed::TrueSpeed(void)
@@ -10778,9 +10778,9 @@ namespace DUNE
     }
 
     void
-    TrueSpeed::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TrueSpeed::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     NavigationUncertainty::NavigationUncertainty(void)
@@ -10899,22 +10899,22 @@ namespace DUNE
     }
 
     void
-    NavigationUncertainty::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    NavigationUncertainty::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "phi", phi, nindent__);
-      IMC::toJSON(os__, "theta", theta, nindent__);
-      IMC::toJSON(os__, "psi", psi, nindent__);
-      IMC::toJSON(os__, "p", p, nindent__);
-      IMC::toJSON(os__, "q", q, nindent__);
-      IMC::toJSON(os__, "r", r, nindent__);
-      IMC::toJSON(os__, "u", u, nindent__);
-      IMC::toJSON(os__, "v", v, nindent__);
-      IMC::toJSON(os__, "w", w, nindent__);
-      IMC::toJSON(os__, "bias_psi", bias_psi, nindent__);
-      IMC::toJSON(os__, "bias_r", bias_r, nindent__);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
+      w__.field("phi", phi);
+      w__.field("theta", theta);
+      w__.field("psi", psi);
+      w__.field("p", p);
+      w__.field("q", q);
+      w__.field("r", r);
+      w__.field("u", u);
+      w__.field("v", v);
+      w__.field("w", w);
+      w__.field("bias_psi", bias_psi);
+      w__.field("bias_r", bias_r);
     }
 
     NavigationData::NavigationData(void)
@@ -11008,17 +11008,17 @@ namespace DUNE
     }
 
     void
-    NavigationData::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    NavigationData::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "bias_psi", bias_psi, nindent__);
-      IMC::toJSON(os__, "bias_r", bias_r, nindent__);
-      IMC::toJSON(os__, "cog", cog, nindent__);
-      IMC::toJSON(os__, "cyaw", cyaw, nindent__);
-      IMC::toJSON(os__, "lbl_rej_level", lbl_rej_level, nindent__);
-      IMC::toJSON(os__, "gps_rej_level", gps_rej_level, nindent__);
-      IMC::toJSON(os__, "custom_x", custom_x, nindent__);
-      IMC::toJSON(os__, "custom_y", custom_y, nindent__);
-      IMC::toJSON(os__, "custom_z", custom_z, nindent__);
+      w__.field("bias_psi", bias_psi);
+      w__.field("bias_r", bias_r);
+      w__.field("cog", cog);
+      w__.field("cyaw", cyaw);
+      w__.field("lbl_rej_level", lbl_rej_level);
+      w__.field("gps_rej_level", gps_rej_level);
+      w__.field("custom_x", custom_x);
+      w__.field("custom_y", custom_y);
+      w__.field("custom_z", custom_z);
     }
 
     GpsFixRejection::GpsFixRejection(void)
@@ -11077,10 +11077,10 @@ namespace DUNE
     }
 
     void
-    GpsFixRejection::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    GpsFixRejection::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "utc_time", utc_time, nindent__);
-      IMC::toJSON(os__, "reason", reason, nindent__);
+      w__.field("utc_time", utc_time);
+      w__.field("reason", reason);
     }
 
     LblRangeAcceptance::LblRangeAcceptance(void)
@@ -11156,11 +11156,11 @@ namespace DUNE
     }
 
     void
-    LblRangeAcceptance::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LblRangeAcceptance::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
-      IMC::toJSON(os__, "range", range, nindent__);
-      IMC::toJSON(os__, "acceptance", acceptance, nindent__);
+      w__.field("id", id);
+      w__.field("range", range);
+      w__.field("acceptance", acceptance);
     }
 
     DvlRejection::DvlRejection(void)
@@ -11241,12 +11241,12 @@ namespace DUNE
     }
 
     void
-    DvlRejection::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DvlRejection::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "reason", reason, nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
-      IMC::toJSON(os__, "timestep", timestep, nindent__);
+      w__.field("type", type);
+      w__.field("reason", reason);
+      w__.field("value", value);
+      w__.field("timestep", timestep);
     }
 
     LblEstimate::LblEstimate(void)
@@ -11326,14 +11326,14 @@ namespace DUNE
     }
 
     void
-    LblEstimate::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LblEstimate::writeJSONFields(JSONWriter& w__) const
     {
-      beacon.toJSON(os__, "beacon", nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "var_x", var_x, nindent__);
-      IMC::toJSON(os__, "var_y", var_y, nindent__);
-      IMC::toJSON(os__, "distance", distance, nindent__);
+      beacon.toJSON(w__, "beacon");
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("var_x", var_x);
+      w__.field("var_y", var_y);
+      w__.field("distance", distance);
     }
 
     void
@@ -11432,9 +11432,9 @@ namespace DUNE
     }
 
     void
-    AlignmentState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    AlignmentState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "state", state, nindent__);
+      w__.field("state", state);
     }
 
     GroupStreamVelocity::GroupStreamVelocity(void)
@@ -11498,11 +11498,11 @@ namespace DUNE
     }
 
     void
-    GroupStreamVelocity::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    GroupStreamVelocity::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
     }
 
     Airflow::Airflow(void)
@@ -11566,11 +11566,11 @@ namespace DUNE
     }
 
     void
-    Airflow::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Airflow::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "va", va, nindent__);
-      IMC::toJSON(os__, "aoa", aoa, nindent__);
-      IMC::toJSON(os__, "ssa", ssa, nindent__);
+      w__.field("va", va);
+      w__.field("aoa", aoa);
+      w__.field("ssa", ssa);
     }
 
     DesiredHeading::DesiredHeading(void)
@@ -11636,9 +11636,9 @@ namespace DUNE
     }
 
     void
-    DesiredHeading::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DesiredHeading::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     DesiredZ::DesiredZ(void)
@@ -11709,10 +11709,10 @@ namespace DUNE
     }
 
     void
-    DesiredZ::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DesiredZ::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
+      w__.field("value", value);
+      w__.field("z_units", z_units);
     }
 
     DesiredSpeed::DesiredSpeed(void)
@@ -11783,10 +11783,10 @@ namespace DUNE
     }
 
     void
-    DesiredSpeed::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DesiredSpeed::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
+      w__.field("value", value);
+      w__.field("speed_units", speed_units);
     }
 
     DesiredRoll::DesiredRoll(void)
@@ -11852,9 +11852,9 @@ namespace DUNE
     }
 
     void
-    DesiredRoll::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DesiredRoll::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     DesiredPitch::DesiredPitch(void)
@@ -11920,9 +11920,9 @@ namespace DUNE
     }
 
     void
-    DesiredPitch::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DesiredPitch::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     DesiredVerticalRate::DesiredVerticalRate(void)
@@ -11988,9 +11988,9 @@ namespace DUNE
     }
 
     void
-    DesiredVerticalRate::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DesiredVerticalRate::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     DesiredPath::DesiredPath(void)
@@ -12108,21 +12108,21 @@ namespace DUNE
     }
 
     void
-    DesiredPath::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DesiredPath::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "path_ref", path_ref, nindent__);
-      IMC::toJSON(os__, "start_lat", start_lat, nindent__);
-      IMC::toJSON(os__, "start_lon", start_lon, nindent__);
-      IMC::toJSON(os__, "start_z", start_z, nindent__);
-      IMC::toJSON(os__, "start_z_units", start_z_units, nindent__);
-      IMC::toJSON(os__, "end_lat", end_lat, nindent__);
-      IMC::toJSON(os__, "end_lon", end_lon, nindent__);
-      IMC::toJSON(os__, "end_z", end_z, nindent__);
-      IMC::toJSON(os__, "end_z_units", end_z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "lradius", lradius, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
+      w__.field("path_ref", path_ref);
+      w__.field("start_lat", start_lat);
+      w__.field("start_lon", start_lon);
+      w__.field("start_z", start_z);
+      w__.field("start_z_units", start_z_units);
+      w__.field("end_lat", end_lat);
+      w__.field("end_lon", end_lon);
+      w__.field("end_z", end_z);
+      w__.field("end_z_units", end_z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("lradius", lradius);
+      w__.field("flags", flags);
     }
 
     DesiredControl::DesiredControl(void)
@@ -12206,15 +12206,15 @@ namespace DUNE
     }
 
     void
-    DesiredControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DesiredControl::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "k", k, nindent__);
-      IMC::toJSON(os__, "m", m, nindent__);
-      IMC::toJSON(os__, "n", n, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
+      w__.field("k", k);
+      w__.field("m", m);
+      w__.field("n", n);
+      w__.field("flags", flags);
     }
 
     DesiredHeadingRate::DesiredHeadingRate(void)
@@ -12280,9 +12280,9 @@ namespace DUNE
     }
 
     void
-    DesiredHeadingRate::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DesiredHeadingRate::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     DesiredVelocity::DesiredVelocity(void)
@@ -12366,15 +12366,15 @@ namespace DUNE
     }
 
     void
-    DesiredVelocity::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DesiredVelocity::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "u", u, nindent__);
-      IMC::toJSON(os__, "v", v, nindent__);
-      IMC::toJSON(os__, "w", w, nindent__);
-      IMC::toJSON(os__, "p", p, nindent__);
-      IMC::toJSON(os__, "q", q, nindent__);
-      IMC::toJSON(os__, "r", r, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
+      w__.field("u", u);
+      w__.field("v", v);
+      w__.field("w", w);
+      w__.field("p", p);
+      w__.field("q", q);
+      w__.field("r", r);
+      w__.field("flags", flags);
     }
 
     PathControlState::PathControlState(void)
@@ -12522,27 +12522,27 @@ namespace DUNE
     }
 
     void
-    PathControlState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PathControlState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "path_ref", path_ref, nindent__);
-      IMC::toJSON(os__, "start_lat", start_lat, nindent__);
-      IMC::toJSON(os__, "start_lon", start_lon, nindent__);
-      IMC::toJSON(os__, "start_z", start_z, nindent__);
-      IMC::toJSON(os__, "start_z_units", start_z_units, nindent__);
-      IMC::toJSON(os__, "end_lat", end_lat, nindent__);
-      IMC::toJSON(os__, "end_lon", end_lon, nindent__);
-      IMC::toJSON(os__, "end_z", end_z, nindent__);
-      IMC::toJSON(os__, "end_z_units", end_z_units, nindent__);
-      IMC::toJSON(os__, "lradius", lradius, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "vx", vx, nindent__);
-      IMC::toJSON(os__, "vy", vy, nindent__);
-      IMC::toJSON(os__, "vz", vz, nindent__);
-      IMC::toJSON(os__, "course_error", course_error, nindent__);
-      IMC::toJSON(os__, "eta", eta, nindent__);
+      w__.field("path_ref", path_ref);
+      w__.field("start_lat", start_lat);
+      w__.field("start_lon", start_lon);
+      w__.field("start_z", start_z);
+      w__.field("start_z_units", start_z_units);
+      w__.field("end_lat", end_lat);
+      w__.field("end_lon", end_lon);
+      w__.field("end_z", end_z);
+      w__.field("end_z_units", end_z_units);
+      w__.field("lradius", lradius);
+      w__.field("flags", flags);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
+      w__.field("vx", vx);
+      w__.field("vy", vy);
+      w__.field("vz", vz);
+      w__.field("course_error", course_error);
+      w__.field("eta", eta);
     }
 
     AllocatedControlTorques::AllocatedControlTorques(void)
@@ -12606,11 +12606,11 @@ namespace DUNE
     }
 
     void
-    AllocatedControlTorques::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    AllocatedControlTorques::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "k", k, nindent__);
-      IMC::toJSON(os__, "m", m, nindent__);
-      IMC::toJSON(os__, "n", n, nindent__);
+      w__.field("k", k);
+      w__.field("m", m);
+      w__.field("n", n);
     }
 
     ControlParcel::ControlParcel(void)
@@ -12679,12 +12679,12 @@ namespace DUNE
     }
 
     void
-    ControlParcel::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ControlParcel::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "p", p, nindent__);
-      IMC::toJSON(os__, "i", i, nindent__);
-      IMC::toJSON(os__, "d", d, nindent__);
-      IMC::toJSON(os__, "a", a, nindent__);
+      w__.field("p", p);
+      w__.field("i", i);
+      w__.field("d", d);
+      w__.field("a", a);
     }
 
     Brake::Brake(void)
@@ -12738,9 +12738,9 @@ namespace DUNE
     }
 
     void
-    Brake::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Brake::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
+      w__.field("op", op);
     }
 
     DesiredLinearState::DesiredLinearState(void)
@@ -12839,18 +12839,18 @@ namespace DUNE
     }
 
     void
-    DesiredLinearState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DesiredLinearState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "vx", vx, nindent__);
-      IMC::toJSON(os__, "vy", vy, nindent__);
-      IMC::toJSON(os__, "vz", vz, nindent__);
-      IMC::toJSON(os__, "ax", ax, nindent__);
-      IMC::toJSON(os__, "ay", ay, nindent__);
-      IMC::toJSON(os__, "az", az, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
+      w__.field("vx", vx);
+      w__.field("vy", vy);
+      w__.field("vz", vz);
+      w__.field("ax", ax);
+      w__.field("ay", ay);
+      w__.field("az", az);
+      w__.field("flags", flags);
     }
 
     DesiredThrottle::DesiredThrottle(void)
@@ -12916,9 +12916,9 @@ namespace DUNE
     }
 
     void
-    DesiredThrottle::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DesiredThrottle::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Goto::Goto(void)
@@ -13027,19 +13027,19 @@ namespace DUNE
     }
 
     void
-    Goto::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Goto::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "roll", roll, nindent__);
-      IMC::toJSON(os__, "pitch", pitch, nindent__);
-      IMC::toJSON(os__, "yaw", yaw, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("roll", roll);
+      w__.field("pitch", pitch);
+      w__.field("yaw", yaw);
+      w__.field("custom", custom);
     }
 
     PopUp::PopUp(void)
@@ -13146,19 +13146,19 @@ namespace DUNE
     }
 
     void
-    PopUp::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PopUp::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "duration", duration, nindent__);
-      IMC::toJSON(os__, "radius", radius, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("duration", duration);
+      w__.field("radius", radius);
+      w__.field("flags", flags);
+      w__.field("custom", custom);
     }
 
     Teleoperation::Teleoperation(void)
@@ -13212,9 +13212,9 @@ namespace DUNE
     }
 
     void
-    Teleoperation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Teleoperation::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("custom", custom);
     }
 
     Loiter::Loiter(void)
@@ -13340,22 +13340,22 @@ namespace DUNE
     }
 
     void
-    Loiter::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Loiter::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "duration", duration, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "radius", radius, nindent__);
-      IMC::toJSON(os__, "length", length, nindent__);
-      IMC::toJSON(os__, "bearing", bearing, nindent__);
-      IMC::toJSON(os__, "direction", direction, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("duration", duration);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("type", type);
+      w__.field("radius", radius);
+      w__.field("length", length);
+      w__.field("bearing", bearing);
+      w__.field("direction", direction);
+      w__.field("custom", custom);
     }
 
     IdleManeuver::IdleManeuver(void)
@@ -13414,10 +13414,10 @@ namespace DUNE
     }
 
     void
-    IdleManeuver::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    IdleManeuver::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "duration", duration, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("duration", duration);
+      w__.field("custom", custom);
     }
 
     LowLevelControl::LowLevelControl(void)
@@ -13482,11 +13482,11 @@ namespace DUNE
     }
 
     void
-    LowLevelControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LowLevelControl::writeJSONFields(JSONWriter& w__) const
     {
-      control.toJSON(os__, "control", nindent__);
-      IMC::toJSON(os__, "duration", duration, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      control.toJSON(w__, "control");
+      w__.field("duration", duration);
+      w__.field("custom", custom);
     }
 
     void
@@ -13668,24 +13668,24 @@ namespace DUNE
     }
 
     void
-    Rows::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Rows::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "bearing", bearing, nindent__);
-      IMC::toJSON(os__, "cross_angle", cross_angle, nindent__);
-      IMC::toJSON(os__, "width", width, nindent__);
-      IMC::toJSON(os__, "length", length, nindent__);
-      IMC::toJSON(os__, "hstep", hstep, nindent__);
-      IMC::toJSON(os__, "coff", coff, nindent__);
-      IMC::toJSON(os__, "alternation", alternation, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("bearing", bearing);
+      w__.field("cross_angle", cross_angle);
+      w__.field("width", width);
+      w__.field("length", length);
+      w__.field("hstep", hstep);
+      w__.field("coff", coff);
+      w__.field("alternation", alternation);
+      w__.field("flags", flags);
+      w__.field("custom", custom);
     }
 
     PathPoint::PathPoint(void)
@@ -13749,11 +13749,11 @@ namespace DUNE
     }
 
     void
-    PathPoint::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PathPoint::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
     }
 
     FollowPath::FollowPath(void)
@@ -13850,17 +13850,17 @@ namespace DUNE
     }
 
     void
-    FollowPath::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FollowPath::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      points.toJSON(os__, "points", nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      points.toJSON(w__, "points");
+      w__.field("custom", custom);
     }
 
     void
@@ -13992,18 +13992,18 @@ namespace DUNE
     }
 
     void
-    YoYo::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    YoYo::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "amplitude", amplitude, nindent__);
-      IMC::toJSON(os__, "pitch", pitch, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("amplitude", amplitude);
+      w__.field("pitch", pitch);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("custom", custom);
     }
 
     TeleoperationDone::TeleoperationDone(void)
@@ -14138,17 +14138,17 @@ namespace DUNE
     }
 
     void
-    StationKeeping::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    StationKeeping::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "radius", radius, nindent__);
-      IMC::toJSON(os__, "duration", duration, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("radius", radius);
+      w__.field("duration", duration);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("custom", custom);
     }
 
     Elevator::Elevator(void)
@@ -14260,20 +14260,20 @@ namespace DUNE
     }
 
     void
-    Elevator::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Elevator::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "start_z", start_z, nindent__);
-      IMC::toJSON(os__, "start_z_units", start_z_units, nindent__);
-      IMC::toJSON(os__, "end_z", end_z, nindent__);
-      IMC::toJSON(os__, "end_z_units", end_z_units, nindent__);
-      IMC::toJSON(os__, "radius", radius, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("flags", flags);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("start_z", start_z);
+      w__.field("start_z_units", start_z_units);
+      w__.field("end_z", end_z);
+      w__.field("end_z_units", end_z_units);
+      w__.field("radius", radius);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("custom", custom);
     }
 
     TrajectoryPoint::TrajectoryPoint(void)
@@ -14342,12 +14342,12 @@ namespace DUNE
     }
 
     void
-    TrajectoryPoint::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TrajectoryPoint::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "t", t, nindent__);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
+      w__.field("t", t);
     }
 
     FollowTrajectory::FollowTrajectory(void)
@@ -14444,17 +14444,17 @@ namespace DUNE
     }
 
     void
-    FollowTrajectory::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FollowTrajectory::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      points.toJSON(os__, "points", nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      points.toJSON(w__, "points");
+      w__.field("custom", custom);
     }
 
     void
@@ -14548,11 +14548,11 @@ namespace DUNE
     }
 
     void
-    CustomManeuver::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CustomManeuver::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "name", name, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("name", name);
+      w__.field("custom", custom);
     }
 
     VehicleFormationParticipant::VehicleFormationParticipant(void)
@@ -14621,12 +14621,12 @@ namespace DUNE
     }
 
     void
-    VehicleFormationParticipant::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    VehicleFormationParticipant::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "vid", vid, nindent__);
-      IMC::toJSON(os__, "off_x", off_x, nindent__);
-      IMC::toJSON(os__, "off_y", off_y, nindent__);
-      IMC::toJSON(os__, "off_z", off_z, nindent__);
+      w__.field("vid", vid);
+      w__.field("off_x", off_x);
+      w__.field("off_y", off_y);
+      w__.field("off_z", off_z);
     }
 
     VehicleFormation::VehicleFormation(void)
@@ -14729,18 +14729,18 @@ namespace DUNE
     }
 
     void
-    VehicleFormation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    VehicleFormation::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      points.toJSON(os__, "points", nindent__);
-      participants.toJSON(os__, "participants", nindent__);
-      IMC::toJSON(os__, "start_time", start_time, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      points.toJSON(w__, "points");
+      participants.toJSON(w__, "participants");
+      w__.field("start_time", start_time);
+      w__.field("custom", custom);
     }
 
     void
@@ -14873,9 +14873,9 @@ namespace DUNE
     }
 
     void
-    RegisterManeuver::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    RegisterManeuver::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "mid", mid, nindent__);
+      w__.field("mid", mid);
     }
 
     ManeuverControlState::ManeuverControlState(void)
@@ -14939,11 +14939,11 @@ namespace DUNE
     }
 
     void
-    ManeuverControlState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ManeuverControlState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "state", state, nindent__);
-      IMC::toJSON(os__, "eta", eta, nindent__);
-      IMC::toJSON(os__, "info", info, nindent__);
+      w__.field("state", state);
+      w__.field("eta", eta);
+      w__.field("info", info);
     }
 
     FollowSystem::FollowSystem(void)
@@ -15032,16 +15032,16 @@ namespace DUNE
     }
 
     void
-    FollowSystem::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FollowSystem::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "system", system, nindent__);
-      IMC::toJSON(os__, "duration", duration, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
+      w__.field("system", system);
+      w__.field("duration", duration);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
     }
 
     CommsRelay::CommsRelay(void)
@@ -15132,16 +15132,16 @@ namespace DUNE
     }
 
     void
-    CommsRelay::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CommsRelay::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "duration", duration, nindent__);
-      IMC::toJSON(os__, "sys_a", sys_a, nindent__);
-      IMC::toJSON(os__, "sys_b", sys_b, nindent__);
-      IMC::toJSON(os__, "move_threshold", move_threshold, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("duration", duration);
+      w__.field("sys_a", sys_a);
+      w__.field("sys_b", sys_b);
+      w__.field("move_threshold", move_threshold);
     }
 
     PolygonVertex::PolygonVertex(void)
@@ -15202,10 +15202,10 @@ namespace DUNE
     }
 
     void
-    PolygonVertex::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PolygonVertex::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
     }
 
     CoverArea::CoverArea(void)
@@ -15297,16 +15297,16 @@ namespace DUNE
     }
 
     void
-    CoverArea::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CoverArea::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      polygon.toJSON(os__, "polygon", nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      polygon.toJSON(w__, "polygon");
+      w__.field("custom", custom);
     }
 
     void
@@ -15455,21 +15455,21 @@ namespace DUNE
     }
 
     void
-    CompassCalibration::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CompassCalibration::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "pitch", pitch, nindent__);
-      IMC::toJSON(os__, "amplitude", amplitude, nindent__);
-      IMC::toJSON(os__, "duration", duration, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "radius", radius, nindent__);
-      IMC::toJSON(os__, "direction", direction, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("pitch", pitch);
+      w__.field("amplitude", amplitude);
+      w__.field("duration", duration);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("radius", radius);
+      w__.field("direction", direction);
+      w__.field("custom", custom);
     }
 
     FormationParameters::FormationParameters(void)
@@ -15539,12 +15539,12 @@ namespace DUNE
     }
 
     void
-    FormationParameters::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FormationParameters::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "formation_name", formation_name, nindent__);
-      IMC::toJSON(os__, "reference_frame", reference_frame, nindent__);
-      participants.toJSON(os__, "participants", nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("formation_name", formation_name);
+      w__.field("reference_frame", reference_frame);
+      participants.toJSON(w__, "participants");
+      w__.field("custom", custom);
     }
 
     void
@@ -15693,22 +15693,22 @@ namespace DUNE
     }
 
     void
-    FormationPlanExecution::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FormationPlanExecution::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "group_name", group_name, nindent__);
-      IMC::toJSON(os__, "formation_name", formation_name, nindent__);
-      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
-      IMC::toJSON(os__, "description", description, nindent__);
-      IMC::toJSON(os__, "leader_speed", leader_speed, nindent__);
-      IMC::toJSON(os__, "leader_bank_lim", leader_bank_lim, nindent__);
-      IMC::toJSON(os__, "pos_sim_err_lim", pos_sim_err_lim, nindent__);
-      IMC::toJSON(os__, "pos_sim_err_wrn", pos_sim_err_wrn, nindent__);
-      IMC::toJSON(os__, "pos_sim_err_timeout", pos_sim_err_timeout, nindent__);
-      IMC::toJSON(os__, "converg_max", converg_max, nindent__);
-      IMC::toJSON(os__, "converg_timeout", converg_timeout, nindent__);
-      IMC::toJSON(os__, "comms_timeout", comms_timeout, nindent__);
-      IMC::toJSON(os__, "turb_lim", turb_lim, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("group_name", group_name);
+      w__.field("formation_name", formation_name);
+      w__.field("plan_id", plan_id);
+      w__.field("description", description);
+      w__.field("leader_speed", leader_speed);
+      w__.field("leader_bank_lim", leader_bank_lim);
+      w__.field("pos_sim_err_lim", pos_sim_err_lim);
+      w__.field("pos_sim_err_wrn", pos_sim_err_wrn);
+      w__.field("pos_sim_err_timeout", pos_sim_err_timeout);
+      w__.field("converg_max", converg_max);
+      w__.field("converg_timeout", converg_timeout);
+      w__.field("comms_timeout", comms_timeout);
+      w__.field("turb_lim", turb_lim);
+      w__.field("custom", custom);
     }
 
     FollowReference::FollowReference(void)
@@ -15782,13 +15782,13 @@ namespace DUNE
     }
 
     void
-    FollowReference::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FollowReference::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "control_src", control_src, nindent__);
-      IMC::toJSON(os__, "control_ent", control_ent, nindent__);
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "loiter_radius", loiter_radius, nindent__);
-      IMC::toJSON(os__, "altitude_interval", altitude_interval, nindent__);
+      w__.field("control_src", control_src);
+      w__.field("control_ent", control_ent);
+      w__.field("timeout", timeout);
+      w__.field("loiter_radius", loiter_radius);
+      w__.field("altitude_interval", altitude_interval);
     }
 
     Reference::Reference(void)
@@ -15869,14 +15869,14 @@ namespace DUNE
     }
 
     void
-    Reference::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Reference::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "flags", flags, nindent__);
-      speed.toJSON(os__, "speed", nindent__);
-      z.toJSON(os__, "z", nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "radius", radius, nindent__);
+      w__.field("flags", flags);
+      speed.toJSON(w__, "speed");
+      z.toJSON(w__, "z");
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("radius", radius);
     }
 
     void
@@ -16021,13 +16021,13 @@ namespace DUNE
     }
 
     void
-    FollowRefState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FollowRefState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "control_src", control_src, nindent__);
-      IMC::toJSON(os__, "control_ent", control_ent, nindent__);
-      reference.toJSON(os__, "reference", nindent__);
-      IMC::toJSON(os__, "state", state, nindent__);
-      IMC::toJSON(os__, "proximity", proximity, nindent__);
+      w__.field("control_src", control_src);
+      w__.field("control_ent", control_ent);
+      reference.toJSON(w__, "reference");
+      w__.field("state", state);
+      w__.field("proximity", proximity);
     }
 
     void
@@ -16231,30 +16231,30 @@ namespace DUNE
     }
 
     void
-    RelativeState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    RelativeState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "s_id", s_id, nindent__);
-      IMC::toJSON(os__, "dist", dist, nindent__);
-      IMC::toJSON(os__, "err", err, nindent__);
-      IMC::toJSON(os__, "ctrl_imp", ctrl_imp, nindent__);
-      IMC::toJSON(os__, "rel_dir_x", rel_dir_x, nindent__);
-      IMC::toJSON(os__, "rel_dir_y", rel_dir_y, nindent__);
-      IMC::toJSON(os__, "rel_dir_z", rel_dir_z, nindent__);
-      IMC::toJSON(os__, "err_x", err_x, nindent__);
-      IMC::toJSON(os__, "err_y", err_y, nindent__);
-      IMC::toJSON(os__, "err_z", err_z, nindent__);
-      IMC::toJSON(os__, "rf_err_x", rf_err_x, nindent__);
-      IMC::toJSON(os__, "rf_err_y", rf_err_y, nindent__);
-      IMC::toJSON(os__, "rf_err_z", rf_err_z, nindent__);
-      IMC::toJSON(os__, "rf_err_vx", rf_err_vx, nindent__);
-      IMC::toJSON(os__, "rf_err_vy", rf_err_vy, nindent__);
-      IMC::toJSON(os__, "rf_err_vz", rf_err_vz, nindent__);
-      IMC::toJSON(os__, "ss_x", ss_x, nindent__);
-      IMC::toJSON(os__, "ss_y", ss_y, nindent__);
-      IMC::toJSON(os__, "ss_z", ss_z, nindent__);
-      IMC::toJSON(os__, "virt_err_x", virt_err_x, nindent__);
-      IMC::toJSON(os__, "virt_err_y", virt_err_y, nindent__);
-      IMC::toJSON(os__, "virt_err_z", virt_err_z, nindent__);
+      w__.field("s_id", s_id);
+      w__.field("dist", dist);
+      w__.field("err", err);
+      w__.field("ctrl_imp", ctrl_imp);
+      w__.field("rel_dir_x", rel_dir_x);
+      w__.field("rel_dir_y", rel_dir_y);
+      w__.field("rel_dir_z", rel_dir_z);
+      w__.field("err_x", err_x);
+      w__.field("err_y", err_y);
+      w__.field("err_z", err_z);
+      w__.field("rf_err_x", rf_err_x);
+      w__.field("rf_err_y", rf_err_y);
+      w__.field("rf_err_z", rf_err_z);
+      w__.field("rf_err_vx", rf_err_vx);
+      w__.field("rf_err_vy", rf_err_vy);
+      w__.field("rf_err_vz", rf_err_vz);
+      w__.field("ss_x", ss_x);
+      w__.field("ss_y", ss_y);
+      w__.field("ss_z", ss_z);
+      w__.field("virt_err_x", virt_err_x);
+      w__.field("virt_err_y", virt_err_y);
+      w__.field("virt_err_z", virt_err_z);
     }
 
     FormationMonitor::FormationMonitor(void)
@@ -16399,27 +16399,27 @@ namespace DUNE
     }
 
     void
-    FormationMonitor::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FormationMonitor::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "ax_cmd", ax_cmd, nindent__);
-      IMC::toJSON(os__, "ay_cmd", ay_cmd, nindent__);
-      IMC::toJSON(os__, "az_cmd", az_cmd, nindent__);
-      IMC::toJSON(os__, "ax_des", ax_des, nindent__);
-      IMC::toJSON(os__, "ay_des", ay_des, nindent__);
-      IMC::toJSON(os__, "az_des", az_des, nindent__);
-      IMC::toJSON(os__, "virt_err_x", virt_err_x, nindent__);
-      IMC::toJSON(os__, "virt_err_y", virt_err_y, nindent__);
-      IMC::toJSON(os__, "virt_err_z", virt_err_z, nindent__);
-      IMC::toJSON(os__, "surf_fdbk_x", surf_fdbk_x, nindent__);
-      IMC::toJSON(os__, "surf_fdbk_y", surf_fdbk_y, nindent__);
-      IMC::toJSON(os__, "surf_fdbk_z", surf_fdbk_z, nindent__);
-      IMC::toJSON(os__, "surf_unkn_x", surf_unkn_x, nindent__);
-      IMC::toJSON(os__, "surf_unkn_y", surf_unkn_y, nindent__);
-      IMC::toJSON(os__, "surf_unkn_z", surf_unkn_z, nindent__);
-      IMC::toJSON(os__, "ss_x", ss_x, nindent__);
-      IMC::toJSON(os__, "ss_y", ss_y, nindent__);
-      IMC::toJSON(os__, "ss_z", ss_z, nindent__);
-      rel_state.toJSON(os__, "rel_state", nindent__);
+      w__.field("ax_cmd", ax_cmd);
+      w__.field("ay_cmd", ay_cmd);
+      w__.field("az_cmd", az_cmd);
+      w__.field("ax_des", ax_des);
+      w__.field("ay_des", ay_des);
+      w__.field("az_des", az_des);
+      w__.field("virt_err_x", virt_err_x);
+      w__.field("virt_err_y", virt_err_y);
+      w__.field("virt_err_z", virt_err_z);
+      w__.field("surf_fdbk_x", surf_fdbk_x);
+      w__.field("surf_fdbk_y", surf_fdbk_y);
+      w__.field("surf_fdbk_z", surf_fdbk_z);
+      w__.field("surf_unkn_x", surf_unkn_x);
+      w__.field("surf_unkn_y", surf_unkn_y);
+      w__.field("surf_unkn_z", surf_unkn_z);
+      w__.field("ss_x", ss_x);
+      w__.field("ss_y", ss_y);
+      w__.field("ss_z", ss_z);
+      rel_state.toJSON(w__, "rel_state");
     }
 
     void
@@ -16518,12 +16518,12 @@ namespace DUNE
     }
 
     void
-    Dislodge::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Dislodge::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "rpm", rpm, nindent__);
-      IMC::toJSON(os__, "direction", direction, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("rpm", rpm);
+      w__.field("direction", direction);
+      w__.field("custom", custom);
     }
 
     Formation::Formation(void)
@@ -16678,29 +16678,29 @@ namespace DUNE
     }
 
     void
-    Formation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Formation::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "formation_name", formation_name, nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "group_name", group_name, nindent__);
-      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
-      IMC::toJSON(os__, "description", description, nindent__);
-      IMC::toJSON(os__, "reference_frame", reference_frame, nindent__);
-      participants.toJSON(os__, "participants", nindent__);
-      IMC::toJSON(os__, "leader_bank_lim", leader_bank_lim, nindent__);
-      IMC::toJSON(os__, "leader_speed_min", leader_speed_min, nindent__);
-      IMC::toJSON(os__, "leader_speed_max", leader_speed_max, nindent__);
-      IMC::toJSON(os__, "leader_alt_min", leader_alt_min, nindent__);
-      IMC::toJSON(os__, "leader_alt_max", leader_alt_max, nindent__);
-      IMC::toJSON(os__, "pos_sim_err_lim", pos_sim_err_lim, nindent__);
-      IMC::toJSON(os__, "pos_sim_err_wrn", pos_sim_err_wrn, nindent__);
-      IMC::toJSON(os__, "pos_sim_err_timeout", pos_sim_err_timeout, nindent__);
-      IMC::toJSON(os__, "converg_max", converg_max, nindent__);
-      IMC::toJSON(os__, "converg_timeout", converg_timeout, nindent__);
-      IMC::toJSON(os__, "comms_timeout", comms_timeout, nindent__);
-      IMC::toJSON(os__, "turb_lim", turb_lim, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("formation_name", formation_name);
+      w__.field("type", type);
+      w__.field("op", op);
+      w__.field("group_name", group_name);
+      w__.field("plan_id", plan_id);
+      w__.field("description", description);
+      w__.field("reference_frame", reference_frame);
+      participants.toJSON(w__, "participants");
+      w__.field("leader_bank_lim", leader_bank_lim);
+      w__.field("leader_speed_min", leader_speed_min);
+      w__.field("leader_speed_max", leader_speed_max);
+      w__.field("leader_alt_min", leader_alt_min);
+      w__.field("leader_alt_max", leader_alt_max);
+      w__.field("pos_sim_err_lim", pos_sim_err_lim);
+      w__.field("pos_sim_err_wrn", pos_sim_err_wrn);
+      w__.field("pos_sim_err_timeout", pos_sim_err_timeout);
+      w__.field("converg_max", converg_max);
+      w__.field("converg_timeout", converg_timeout);
+      w__.field("comms_timeout", comms_timeout);
+      w__.field("turb_lim", turb_lim);
+      w__.field("custom", custom);
     }
 
     void
@@ -16821,16 +16821,16 @@ namespace DUNE
     }
 
     void
-    Launch::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Launch::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("custom", custom);
     }
 
     Drop::Drop(void)
@@ -16921,16 +16921,16 @@ namespace DUNE
     }
 
     void
-    Drop::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Drop::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("custom", custom);
     }
 
     ScheduledGoto::ScheduledGoto(void)
@@ -17021,16 +17021,16 @@ namespace DUNE
     }
 
     void
-    ScheduledGoto::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ScheduledGoto::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "arrival_time", arrival_time, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "travel_z", travel_z, nindent__);
-      IMC::toJSON(os__, "travel_z_units", travel_z_units, nindent__);
-      IMC::toJSON(os__, "delayed", delayed, nindent__);
+      w__.field("arrival_time", arrival_time);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("travel_z", travel_z);
+      w__.field("travel_z_units", travel_z_units);
+      w__.field("delayed", delayed);
     }
 
     RowsCoverage::RowsCoverage(void)
@@ -17167,24 +17167,24 @@ namespace DUNE
     }
 
     void
-    RowsCoverage::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    RowsCoverage::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "bearing", bearing, nindent__);
-      IMC::toJSON(os__, "cross_angle", cross_angle, nindent__);
-      IMC::toJSON(os__, "width", width, nindent__);
-      IMC::toJSON(os__, "length", length, nindent__);
-      IMC::toJSON(os__, "coff", coff, nindent__);
-      IMC::toJSON(os__, "angaperture", angaperture, nindent__);
-      IMC::toJSON(os__, "range", range, nindent__);
-      IMC::toJSON(os__, "overlap", overlap, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("bearing", bearing);
+      w__.field("cross_angle", cross_angle);
+      w__.field("width", width);
+      w__.field("length", length);
+      w__.field("coff", coff);
+      w__.field("angaperture", angaperture);
+      w__.field("range", range);
+      w__.field("overlap", overlap);
+      w__.field("flags", flags);
+      w__.field("custom", custom);
     }
 
     Sample::Sample(void)
@@ -17290,19 +17290,19 @@ namespace DUNE
     }
 
     void
-    Sample::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Sample::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "syringe0", syringe0, nindent__);
-      IMC::toJSON(os__, "syringe1", syringe1, nindent__);
-      IMC::toJSON(os__, "syringe2", syringe2, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("syringe0", syringe0);
+      w__.field("syringe1", syringe1);
+      w__.field("syringe2", syringe2);
+      w__.field("custom", custom);
     }
 
     ImageTracking::ImageTracking(void)
@@ -17433,16 +17433,16 @@ namespace DUNE
     }
 
     void
-    Takeoff::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Takeoff::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "takeoff_pitch", takeoff_pitch, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("takeoff_pitch", takeoff_pitch);
+      w__.field("custom", custom);
     }
 
     Land::Land(void)
@@ -17550,19 +17550,19 @@ namespace DUNE
     }
 
     void
-    Land::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Land::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "abort_z", abort_z, nindent__);
-      IMC::toJSON(os__, "bearing", bearing, nindent__);
-      IMC::toJSON(os__, "glide_slope", glide_slope, nindent__);
-      IMC::toJSON(os__, "glide_slope_alt", glide_slope_alt, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("abort_z", abort_z);
+      w__.field("bearing", bearing);
+      w__.field("glide_slope", glide_slope);
+      w__.field("glide_slope_alt", glide_slope_alt);
+      w__.field("custom", custom);
     }
 
     AutonomousSection::AutonomousSection(void)
@@ -17669,19 +17669,19 @@ namespace DUNE
     }
 
     void
-    AutonomousSection::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    AutonomousSection::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "limits", limits, nindent__);
-      IMC::toJSON(os__, "max_depth", max_depth, nindent__);
-      IMC::toJSON(os__, "min_alt", min_alt, nindent__);
-      IMC::toJSON(os__, "time_limit", time_limit, nindent__);
-      area_limits.toJSON(os__, "area_limits", nindent__);
-      IMC::toJSON(os__, "controller", controller, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("limits", limits);
+      w__.field("max_depth", max_depth);
+      w__.field("min_alt", min_alt);
+      w__.field("time_limit", time_limit);
+      area_limits.toJSON(w__, "area_limits");
+      w__.field("controller", controller);
+      w__.field("custom", custom);
     }
 
     void
@@ -17803,16 +17803,16 @@ namespace DUNE
     }
 
     void
-    FollowPoint::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FollowPoint::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "target", target, nindent__);
-      IMC::toJSON(os__, "max_speed", max_speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("target", target);
+      w__.field("max_speed", max_speed);
+      w__.field("speed_units", speed_units);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("custom", custom);
     }
 
     Alignment::Alignment(void)
@@ -17893,14 +17893,14 @@ namespace DUNE
     }
 
     void
-    Alignment::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Alignment::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("custom", custom);
     }
 
     StationKeepingExtended::StationKeepingExtended(void)
@@ -18011,20 +18011,20 @@ namespace DUNE
     }
 
     void
-    StationKeepingExtended::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    StationKeepingExtended::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "radius", radius, nindent__);
-      IMC::toJSON(os__, "duration", duration, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "popup_period", popup_period, nindent__);
-      IMC::toJSON(os__, "popup_duration", popup_duration, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("radius", radius);
+      w__.field("duration", duration);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("popup_period", popup_period);
+      w__.field("popup_duration", popup_duration);
+      w__.field("flags", flags);
+      w__.field("custom", custom);
     }
 
     ManeuverDone::ManeuverDone(void)
@@ -18172,19 +18172,19 @@ namespace DUNE
     }
 
     void
-    Magnetometer::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Magnetometer::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "bearing", bearing, nindent__);
-      IMC::toJSON(os__, "width", width, nindent__);
-      IMC::toJSON(os__, "direction", direction, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+      w__.field("timeout", timeout);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("speed", speed);
+      w__.field("speed_units", speed_units);
+      w__.field("bearing", bearing);
+      w__.field("width", width);
+      w__.field("direction", direction);
+      w__.field("custom", custom);
     }
 
     VehicleState::VehicleState(void)
@@ -18283,18 +18283,18 @@ namespace DUNE
     }
 
     void
-    VehicleState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    VehicleState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op_mode", op_mode, nindent__);
-      IMC::toJSON(os__, "error_count", error_count, nindent__);
-      IMC::toJSON(os__, "error_ents", error_ents, nindent__);
-      IMC::toJSON(os__, "maneuver_type", maneuver_type, nindent__);
-      IMC::toJSON(os__, "maneuver_stime", maneuver_stime, nindent__);
-      IMC::toJSON(os__, "maneuver_eta", maneuver_eta, nindent__);
-      IMC::toJSON(os__, "control_loops", control_loops, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
-      IMC::toJSON(os__, "last_error", last_error, nindent__);
-      IMC::toJSON(os__, "last_error_time", last_error_time, nindent__);
+      w__.field("op_mode", op_mode);
+      w__.field("error_count", error_count);
+      w__.field("error_ents", error_ents);
+      w__.field("maneuver_type", maneuver_type);
+      w__.field("maneuver_stime", maneuver_stime);
+      w__.field("maneuver_eta", maneuver_eta);
+      w__.field("control_loops", control_loops);
+      w__.field("flags", flags);
+      w__.field("last_error", last_error);
+      w__.field("last_error_time", last_error_time);
     }
 
     VehicleCommand::VehicleCommand(void)
@@ -18374,14 +18374,14 @@ namespace DUNE
     }
 
     void
-    VehicleCommand::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    VehicleCommand::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "request_id", request_id, nindent__);
-      IMC::toJSON(os__, "command", command, nindent__);
-      maneuver.toJSON(os__, "maneuver", nindent__);
-      IMC::toJSON(os__, "calib_time", calib_time, nindent__);
-      IMC::toJSON(os__, "info", info, nindent__);
+      w__.field("type", type);
+      w__.field("request_id", request_id);
+      w__.field("command", command);
+      maneuver.toJSON(w__, "maneuver");
+      w__.field("calib_time", calib_time);
+      w__.field("info", info);
     }
 
     void
@@ -18485,10 +18485,10 @@ namespace DUNE
     }
 
     void
-    MonitorEntityState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    MonitorEntityState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "command", command, nindent__);
-      IMC::toJSON(os__, "entities", entities, nindent__);
+      w__.field("command", command);
+      w__.field("entities", entities);
     }
 
     EntityMonitoringState::EntityMonitoringState(void)
@@ -18577,16 +18577,16 @@ namespace DUNE
     }
 
     void
-    EntityMonitoringState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    EntityMonitoringState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "mcount", mcount, nindent__);
-      IMC::toJSON(os__, "mnames", mnames, nindent__);
-      IMC::toJSON(os__, "ecount", ecount, nindent__);
-      IMC::toJSON(os__, "enames", enames, nindent__);
-      IMC::toJSON(os__, "ccount", ccount, nindent__);
-      IMC::toJSON(os__, "cnames", cnames, nindent__);
-      IMC::toJSON(os__, "last_error", last_error, nindent__);
-      IMC::toJSON(os__, "last_error_time", last_error_time, nindent__);
+      w__.field("mcount", mcount);
+      w__.field("mnames", mnames);
+      w__.field("ecount", ecount);
+      w__.field("enames", enames);
+      w__.field("ccount", ccount);
+      w__.field("cnames", cnames);
+      w__.field("last_error", last_error);
+      w__.field("last_error_time", last_error_time);
     }
 
     OperationalLimits::OperationalLimits(void)
@@ -18703,20 +18703,20 @@ namespace DUNE
     }
 
     void
-    OperationalLimits::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    OperationalLimits::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "mask", mask, nindent__);
-      IMC::toJSON(os__, "max_depth", max_depth, nindent__);
-      IMC::toJSON(os__, "min_altitude", min_altitude, nindent__);
-      IMC::toJSON(os__, "max_altitude", max_altitude, nindent__);
-      IMC::toJSON(os__, "min_speed", min_speed, nindent__);
-      IMC::toJSON(os__, "max_speed", max_speed, nindent__);
-      IMC::toJSON(os__, "max_vrate", max_vrate, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "orientation", orientation, nindent__);
-      IMC::toJSON(os__, "width", width, nindent__);
-      IMC::toJSON(os__, "length", length, nindent__);
+      w__.field("mask", mask);
+      w__.field("max_depth", max_depth);
+      w__.field("min_altitude", min_altitude);
+      w__.field("max_altitude", max_altitude);
+      w__.field("min_speed", min_speed);
+      w__.field("max_speed", max_speed);
+      w__.field("max_vrate", max_vrate);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("orientation", orientation);
+      w__.field("width", width);
+      w__.field("length", length);
     }
 
     GetOperationalLimits::GetOperationalLimits(void)
@@ -18809,9 +18809,9 @@ namespace DUNE
     }
 
     void
-    Calibration::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Calibration::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "duration", duration, nindent__);
+      w__.field("duration", duration);
     }
 
     ControlLoops::ControlLoops(void)
@@ -18875,11 +18875,11 @@ namespace DUNE
     }
 
     void
-    ControlLoops::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ControlLoops::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "enable", enable, nindent__);
-      IMC::toJSON(os__, "mask", mask, nindent__);
-      IMC::toJSON(os__, "scope_ref", scope_ref, nindent__);
+      w__.field("enable", enable);
+      w__.field("mask", mask);
+      w__.field("scope_ref", scope_ref);
     }
 
     VehicleMedium::VehicleMedium(void)
@@ -18933,9 +18933,9 @@ namespace DUNE
     }
 
     void
-    VehicleMedium::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    VehicleMedium::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "medium", medium, nindent__);
+      w__.field("medium", medium);
     }
 
     Collision::Collision(void)
@@ -19006,10 +19006,10 @@ namespace DUNE
     }
 
     void
-    Collision::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Collision::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
+      w__.field("value", value);
+      w__.field("type", type);
     }
 
     FormState::FormState(void)
@@ -19088,14 +19088,14 @@ namespace DUNE
     }
 
     void
-    FormState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FormState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "possimerr", possimerr, nindent__);
-      IMC::toJSON(os__, "converg", converg, nindent__);
-      IMC::toJSON(os__, "turbulence", turbulence, nindent__);
-      IMC::toJSON(os__, "possimmon", possimmon, nindent__);
-      IMC::toJSON(os__, "commmon", commmon, nindent__);
-      IMC::toJSON(os__, "convergmon", convergmon, nindent__);
+      w__.field("possimerr", possimerr);
+      w__.field("converg", converg);
+      w__.field("turbulence", turbulence);
+      w__.field("possimmon", possimmon);
+      w__.field("commmon", commmon);
+      w__.field("convergmon", convergmon);
     }
 
     AutopilotMode::AutopilotMode(void)
@@ -19154,10 +19154,10 @@ namespace DUNE
     }
 
     void
-    AutopilotMode::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    AutopilotMode::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "autonomy", autonomy, nindent__);
-      IMC::toJSON(os__, "mode", mode, nindent__);
+      w__.field("autonomy", autonomy);
+      w__.field("mode", mode);
     }
 
     FormationState::FormationState(void)
@@ -19246,16 +19246,16 @@ namespace DUNE
     }
 
     void
-    FormationState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FormationState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "possimerr", possimerr, nindent__);
-      IMC::toJSON(os__, "converg", converg, nindent__);
-      IMC::toJSON(os__, "turbulence", turbulence, nindent__);
-      IMC::toJSON(os__, "possimmon", possimmon, nindent__);
-      IMC::toJSON(os__, "commmon", commmon, nindent__);
-      IMC::toJSON(os__, "convergmon", convergmon, nindent__);
+      w__.field("type", type);
+      w__.field("op", op);
+      w__.field("possimerr", possimerr);
+      w__.field("converg", converg);
+      w__.field("turbulence", turbulence);
+      w__.field("possimmon", possimmon);
+      w__.field("commmon", commmon);
+      w__.field("convergmon", convergmon);
     }
 
     ReportControl::ReportControl(void)
@@ -19324,12 +19324,12 @@ namespace DUNE
     }
 
     void
-    ReportControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ReportControl::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "comm_interface", comm_interface, nindent__);
-      IMC::toJSON(os__, "period", period, nindent__);
-      IMC::toJSON(os__, "sys_dst", sys_dst, nindent__);
+      w__.field("op", op);
+      w__.field("comm_interface", comm_interface);
+      w__.field("period", period);
+      w__.field("sys_dst", sys_dst);
     }
 
     StateReport::StateReport(void)
@@ -19428,18 +19428,18 @@ namespace DUNE
     }
 
     void
-    StateReport::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    StateReport::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "stime", stime, nindent__);
-      IMC::toJSON(os__, "latitude", latitude, nindent__);
-      IMC::toJSON(os__, "longitude", longitude, nindent__);
-      IMC::toJSON(os__, "altitude", altitude, nindent__);
-      IMC::toJSON(os__, "depth", depth, nindent__);
-      IMC::toJSON(os__, "heading", heading, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "fuel", fuel, nindent__);
-      IMC::toJSON(os__, "exec_state", exec_state, nindent__);
-      IMC::toJSON(os__, "plan_checksum", plan_checksum, nindent__);
+      w__.field("stime", stime);
+      w__.field("latitude", latitude);
+      w__.field("longitude", longitude);
+      w__.field("altitude", altitude);
+      w__.field("depth", depth);
+      w__.field("heading", heading);
+      w__.field("speed", speed);
+      w__.field("fuel", fuel);
+      w__.field("exec_state", exec_state);
+      w__.field("plan_checksum", plan_checksum);
     }
 
     TransmissionRequest::TransmissionRequest(void)
@@ -19534,17 +19534,17 @@ namespace DUNE
     }
 
     void
-    TransmissionRequest::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TransmissionRequest::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "req_id", req_id, nindent__);
-      IMC::toJSON(os__, "comm_mean", comm_mean, nindent__);
-      IMC::toJSON(os__, "destination", destination, nindent__);
-      IMC::toJSON(os__, "deadline", deadline, nindent__);
-      IMC::toJSON(os__, "range", range, nindent__);
-      IMC::toJSON(os__, "data_mode", data_mode, nindent__);
-      msg_data.toJSON(os__, "msg_data", nindent__);
-      IMC::toJSON(os__, "txt_data", txt_data, nindent__);
-      IMC::toJSON(os__, "raw_data", raw_data, nindent__);
+      w__.field("req_id", req_id);
+      w__.field("comm_mean", comm_mean);
+      w__.field("destination", destination);
+      w__.field("deadline", deadline);
+      w__.field("range", range);
+      w__.field("data_mode", data_mode);
+      msg_data.toJSON(w__, "msg_data");
+      w__.field("txt_data", txt_data);
+      w__.field("raw_data", raw_data);
     }
 
     void
@@ -19658,12 +19658,12 @@ namespace DUNE
     }
 
     void
-    TransmissionStatus::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TransmissionStatus::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "req_id", req_id, nindent__);
-      IMC::toJSON(os__, "status", status, nindent__);
-      IMC::toJSON(os__, "range", range, nindent__);
-      IMC::toJSON(os__, "info", info, nindent__);
+      w__.field("req_id", req_id);
+      w__.field("status", status);
+      w__.field("range", range);
+      w__.field("info", info);
     }
 
     SmsRequest::SmsRequest(void)
@@ -19732,12 +19732,12 @@ namespace DUNE
     }
 
     void
-    SmsRequest::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SmsRequest::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "req_id", req_id, nindent__);
-      IMC::toJSON(os__, "destination", destination, nindent__);
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      IMC::toJSON(os__, "sms_text", sms_text, nindent__);
+      w__.field("req_id", req_id);
+      w__.field("destination", destination);
+      w__.field("timeout", timeout);
+      w__.field("sms_text", sms_text);
     }
 
     SmsStatus::SmsStatus(void)
@@ -19801,11 +19801,11 @@ namespace DUNE
     }
 
     void
-    SmsStatus::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SmsStatus::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "req_id", req_id, nindent__);
-      IMC::toJSON(os__, "status", status, nindent__);
-      IMC::toJSON(os__, "info", info, nindent__);
+      w__.field("req_id", req_id);
+      w__.field("status", status);
+      w__.field("info", info);
     }
 
     VtolState::VtolState(void)
@@ -19859,9 +19859,9 @@ namespace DUNE
     }
 
     void
-    VtolState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    VtolState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "state", state, nindent__);
+      w__.field("state", state);
     }
 
     ArmingState::ArmingState(void)
@@ -19915,9 +19915,9 @@ namespace DUNE
     }
 
     void
-    ArmingState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ArmingState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "state", state, nindent__);
+      w__.field("state", state);
     }
 
     TCPRequest::TCPRequest(void)
@@ -19987,12 +19987,12 @@ namespace DUNE
     }
 
     void
-    TCPRequest::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TCPRequest::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "req_id", req_id, nindent__);
-      IMC::toJSON(os__, "destination", destination, nindent__);
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
-      msg_data.toJSON(os__, "msg_data", nindent__);
+      w__.field("req_id", req_id);
+      w__.field("destination", destination);
+      w__.field("timeout", timeout);
+      msg_data.toJSON(w__, "msg_data");
     }
 
     void
@@ -20101,11 +20101,11 @@ namespace DUNE
     }
 
     void
-    TCPStatus::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TCPStatus::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "req_id", req_id, nindent__);
-      IMC::toJSON(os__, "status", status, nindent__);
-      IMC::toJSON(os__, "info", info, nindent__);
+      w__.field("req_id", req_id);
+      w__.field("status", status);
+      w__.field("info", info);
     }
 
     Abort::Abort(void)
@@ -20213,12 +20213,12 @@ namespace DUNE
     }
 
     void
-    PlanVariable::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PlanVariable::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "access", access, nindent__);
+      w__.field("name", name);
+      w__.field("value", value);
+      w__.field("type", type);
+      w__.field("access", access);
     }
 
     PlanManeuver::PlanManeuver(void)
@@ -20290,12 +20290,12 @@ namespace DUNE
     }
 
     void
-    PlanManeuver::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PlanManeuver::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "maneuver_id", maneuver_id, nindent__);
-      data.toJSON(os__, "data", nindent__);
-      start_actions.toJSON(os__, "start_actions", nindent__);
-      end_actions.toJSON(os__, "end_actions", nindent__);
+      w__.field("maneuver_id", maneuver_id);
+      data.toJSON(w__, "data");
+      start_actions.toJSON(w__, "start_actions");
+      end_actions.toJSON(w__, "end_actions");
     }
 
     void
@@ -20430,12 +20430,12 @@ namespace DUNE
     }
 
     void
-    PlanTransition::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PlanTransition::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "source_man", source_man, nindent__);
-      IMC::toJSON(os__, "dest_man", dest_man, nindent__);
-      IMC::toJSON(os__, "conditions", conditions, nindent__);
-      actions.toJSON(os__, "actions", nindent__);
+      w__.field("source_man", source_man);
+      w__.field("dest_man", dest_man);
+      w__.field("conditions", conditions);
+      actions.toJSON(w__, "actions");
     }
 
     void
@@ -20564,17 +20564,17 @@ namespace DUNE
     }
 
     void
-    PlanSpecification::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PlanSpecification::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
-      IMC::toJSON(os__, "description", description, nindent__);
-      IMC::toJSON(os__, "vnamespace", vnamespace, nindent__);
-      variables.toJSON(os__, "variables", nindent__);
-      IMC::toJSON(os__, "start_man_id", start_man_id, nindent__);
-      maneuvers.toJSON(os__, "maneuvers", nindent__);
-      transitions.toJSON(os__, "transitions", nindent__);
-      start_actions.toJSON(os__, "start_actions", nindent__);
-      end_actions.toJSON(os__, "end_actions", nindent__);
+      w__.field("plan_id", plan_id);
+      w__.field("description", description);
+      w__.field("vnamespace", vnamespace);
+      variables.toJSON(w__, "variables");
+      w__.field("start_man_id", start_man_id);
+      maneuvers.toJSON(w__, "maneuvers");
+      transitions.toJSON(w__, "transitions");
+      start_actions.toJSON(w__, "start_actions");
+      end_actions.toJSON(w__, "end_actions");
     }
 
     void
@@ -20704,10 +20704,10 @@ namespace DUNE
     }
 
     void
-    EmergencyControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    EmergencyControl::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "command", command, nindent__);
-      plan.toJSON(os__, "plan", nindent__);
+      w__.field("command", command);
+      plan.toJSON(w__, "plan");
     }
 
     void
@@ -20817,11 +20817,11 @@ namespace DUNE
     }
 
     void
-    EmergencyControlState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    EmergencyControlState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "state", state, nindent__);
-      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
-      IMC::toJSON(os__, "comm_level", comm_level, nindent__);
+      w__.field("state", state);
+      w__.field("plan_id", plan_id);
+      w__.field("comm_level", comm_level);
     }
 
     PlanDB::PlanDB(void)
@@ -20901,14 +20901,14 @@ namespace DUNE
     }
 
     void
-    PlanDB::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PlanDB::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "request_id", request_id, nindent__);
-      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
-      arg.toJSON(os__, "arg", nindent__);
-      IMC::toJSON(os__, "info", info, nindent__);
+      w__.field("type", type);
+      w__.field("op", op);
+      w__.field("request_id", request_id);
+      w__.field("plan_id", plan_id);
+      arg.toJSON(w__, "arg");
+      w__.field("info", info);
     }
 
     void
@@ -21032,14 +21032,14 @@ namespace DUNE
     }
 
     void
-    PlanDBInformation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PlanDBInformation::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
-      IMC::toJSON(os__, "plan_size", plan_size, nindent__);
-      IMC::toJSON(os__, "change_time", change_time, nindent__);
-      IMC::toJSON(os__, "change_sid", change_sid, nindent__);
-      IMC::toJSON(os__, "change_sname", change_sname, nindent__);
-      IMC::toJSON(os__, "md5", md5, nindent__);
+      w__.field("plan_id", plan_id);
+      w__.field("plan_size", plan_size);
+      w__.field("change_time", change_time);
+      w__.field("change_sid", change_sid);
+      w__.field("change_sname", change_sname);
+      w__.field("md5", md5);
     }
 
     PlanDBState::PlanDBState(void)
@@ -21124,15 +21124,15 @@ namespace DUNE
     }
 
     void
-    PlanDBState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PlanDBState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "plan_count", plan_count, nindent__);
-      IMC::toJSON(os__, "plan_size", plan_size, nindent__);
-      IMC::toJSON(os__, "change_time", change_time, nindent__);
-      IMC::toJSON(os__, "change_sid", change_sid, nindent__);
-      IMC::toJSON(os__, "change_sname", change_sname, nindent__);
-      IMC::toJSON(os__, "md5", md5, nindent__);
-      plans_info.toJSON(os__, "plans_info", nindent__);
+      w__.field("plan_count", plan_count);
+      w__.field("plan_size", plan_size);
+      w__.field("change_time", change_time);
+      w__.field("change_sid", change_sid);
+      w__.field("change_sname", change_sname);
+      w__.field("md5", md5);
+      plans_info.toJSON(w__, "plans_info");
     }
 
     void
@@ -21247,15 +21247,15 @@ namespace DUNE
     }
 
     void
-    PlanControl::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PlanControl::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "request_id", request_id, nindent__);
-      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
-      arg.toJSON(os__, "arg", nindent__);
-      IMC::toJSON(os__, "info", info, nindent__);
+      w__.field("type", type);
+      w__.field("op", op);
+      w__.field("request_id", request_id);
+      w__.field("plan_id", plan_id);
+      w__.field("flags", flags);
+      arg.toJSON(w__, "arg");
+      w__.field("info", info);
     }
 
     void
@@ -21389,16 +21389,16 @@ namespace DUNE
     }
 
     void
-    PlanControlState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PlanControlState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "state", state, nindent__);
-      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
-      IMC::toJSON(os__, "plan_eta", plan_eta, nindent__);
-      IMC::toJSON(os__, "plan_progress", plan_progress, nindent__);
-      IMC::toJSON(os__, "man_id", man_id, nindent__);
-      IMC::toJSON(os__, "man_type", man_type, nindent__);
-      IMC::toJSON(os__, "man_eta", man_eta, nindent__);
-      IMC::toJSON(os__, "last_outcome", last_outcome, nindent__);
+      w__.field("state", state);
+      w__.field("plan_id", plan_id);
+      w__.field("plan_eta", plan_eta);
+      w__.field("plan_progress", plan_progress);
+      w__.field("man_id", man_id);
+      w__.field("man_type", man_type);
+      w__.field("man_eta", man_eta);
+      w__.field("last_outcome", last_outcome);
     }
 
     PlanGeneration::PlanGeneration(void)
@@ -21467,12 +21467,12 @@ namespace DUNE
     }
 
     void
-    PlanGeneration::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PlanGeneration::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "cmd", cmd, nindent__);
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
-      IMC::toJSON(os__, "params", params, nindent__);
+      w__.field("cmd", cmd);
+      w__.field("op", op);
+      w__.field("plan_id", plan_id);
+      w__.field("params", params);
     }
 
     LeaderState::LeaderState(void)
@@ -21629,28 +21629,28 @@ namespace DUNE
     }
 
     void
-    LeaderState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    LeaderState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "group_name", group_name, nindent__);
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "height", height, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "phi", phi, nindent__);
-      IMC::toJSON(os__, "theta", theta, nindent__);
-      IMC::toJSON(os__, "psi", psi, nindent__);
-      IMC::toJSON(os__, "vx", vx, nindent__);
-      IMC::toJSON(os__, "vy", vy, nindent__);
-      IMC::toJSON(os__, "vz", vz, nindent__);
-      IMC::toJSON(os__, "p", p, nindent__);
-      IMC::toJSON(os__, "q", q, nindent__);
-      IMC::toJSON(os__, "r", r, nindent__);
-      IMC::toJSON(os__, "svx", svx, nindent__);
-      IMC::toJSON(os__, "svy", svy, nindent__);
-      IMC::toJSON(os__, "svz", svz, nindent__);
+      w__.field("group_name", group_name);
+      w__.field("op", op);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("height", height);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
+      w__.field("phi", phi);
+      w__.field("theta", theta);
+      w__.field("psi", psi);
+      w__.field("vx", vx);
+      w__.field("vy", vy);
+      w__.field("vz", vz);
+      w__.field("p", p);
+      w__.field("q", q);
+      w__.field("r", r);
+      w__.field("svx", svx);
+      w__.field("svy", svy);
+      w__.field("svz", svz);
     }
 
     PlanStatistics::PlanStatistics(void)
@@ -21734,15 +21734,15 @@ namespace DUNE
     }
 
     void
-    PlanStatistics::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PlanStatistics::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "properties", properties, nindent__);
-      IMC::toJSON(os__, "durations", durations, nindent__);
-      IMC::toJSON(os__, "distances", distances, nindent__);
-      IMC::toJSON(os__, "actions", actions, nindent__);
-      IMC::toJSON(os__, "fuel", fuel, nindent__);
+      w__.field("plan_id", plan_id);
+      w__.field("type", type);
+      w__.field("properties", properties);
+      w__.field("durations", durations);
+      w__.field("distances", distances);
+      w__.field("actions", actions);
+      w__.field("fuel", fuel);
     }
 
     ReportedState::ReportedState(void)
@@ -21836,17 +21836,17 @@ namespace DUNE
     }
 
     void
-    ReportedState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ReportedState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "depth", depth, nindent__);
-      IMC::toJSON(os__, "roll", roll, nindent__);
-      IMC::toJSON(os__, "pitch", pitch, nindent__);
-      IMC::toJSON(os__, "yaw", yaw, nindent__);
-      IMC::toJSON(os__, "rcp_time", rcp_time, nindent__);
-      IMC::toJSON(os__, "sid", sid, nindent__);
-      IMC::toJSON(os__, "s_type", s_type, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("depth", depth);
+      w__.field("roll", roll);
+      w__.field("pitch", pitch);
+      w__.field("yaw", yaw);
+      w__.field("rcp_time", rcp_time);
+      w__.field("sid", sid);
+      w__.field("s_type", s_type);
     }
 
     RemoteSensorInfo::RemoteSensorInfo(void)
@@ -21930,15 +21930,15 @@ namespace DUNE
     }
 
     void
-    RemoteSensorInfo::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    RemoteSensorInfo::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
-      IMC::toJSON(os__, "sensor_class", sensor_class, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "alt", alt, nindent__);
-      IMC::toJSON(os__, "heading", heading, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("id", id);
+      w__.field("sensor_class", sensor_class);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("alt", alt);
+      w__.field("heading", heading);
+      w__.field("data", data);
     }
 
     MapPoint::MapPoint(void)
@@ -22002,11 +22002,11 @@ namespace DUNE
     }
 
     void
-    MapPoint::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    MapPoint::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "alt", alt, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("alt", alt);
     }
 
     MapFeature::MapFeature(void)
@@ -22086,14 +22086,14 @@ namespace DUNE
     }
 
     void
-    MapFeature::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    MapFeature::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
-      IMC::toJSON(os__, "feature_type", feature_type, nindent__);
-      IMC::toJSON(os__, "rgb_red", rgb_red, nindent__);
-      IMC::toJSON(os__, "rgb_green", rgb_green, nindent__);
-      IMC::toJSON(os__, "rgb_blue", rgb_blue, nindent__);
-      feature.toJSON(os__, "feature", nindent__);
+      w__.field("id", id);
+      w__.field("feature_type", feature_type);
+      w__.field("rgb_red", rgb_red);
+      w__.field("rgb_green", rgb_green);
+      w__.field("rgb_blue", rgb_blue);
+      feature.toJSON(w__, "feature");
     }
 
     void
@@ -22183,10 +22183,10 @@ namespace DUNE
     }
 
     void
-    Map::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Map::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "id", id, nindent__);
-      features.toJSON(os__, "features", nindent__);
+      w__.field("id", id);
+      features.toJSON(w__, "features");
     }
 
     void
@@ -22281,11 +22281,11 @@ namespace DUNE
     }
 
     void
-    CcuEvent::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CcuEvent::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "id", id, nindent__);
-      arg.toJSON(os__, "arg", nindent__);
+      w__.field("type", type);
+      w__.field("id", id);
+      arg.toJSON(w__, "arg");
     }
 
     void
@@ -22390,10 +22390,10 @@ namespace DUNE
     }
 
     void
-    VehicleLinks::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    VehicleLinks::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "localname", localname, nindent__);
-      links.toJSON(os__, "links", nindent__);
+      w__.field("localname", localname);
+      links.toJSON(w__, "links");
     }
 
     void
@@ -22487,11 +22487,11 @@ namespace DUNE
     }
 
     void
-    TrexObservation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TrexObservation::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeline", timeline, nindent__);
-      IMC::toJSON(os__, "predicate", predicate, nindent__);
-      IMC::toJSON(os__, "attributes", attributes, nindent__);
+      w__.field("timeline", timeline);
+      w__.field("predicate", predicate);
+      w__.field("attributes", attributes);
     }
 
     TrexCommand::TrexCommand(void)
@@ -22555,11 +22555,11 @@ namespace DUNE
     }
 
     void
-    TrexCommand::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TrexCommand::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "command", command, nindent__);
-      IMC::toJSON(os__, "goal_id", goal_id, nindent__);
-      IMC::toJSON(os__, "goal_xml", goal_xml, nindent__);
+      w__.field("command", command);
+      w__.field("goal_id", goal_id);
+      w__.field("goal_xml", goal_xml);
     }
 
     TrexAttribute::TrexAttribute(void)
@@ -22628,12 +22628,12 @@ namespace DUNE
     }
 
     void
-    TrexAttribute::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TrexAttribute::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
-      IMC::toJSON(os__, "attr_type", attr_type, nindent__);
-      IMC::toJSON(os__, "min", min, nindent__);
-      IMC::toJSON(os__, "max", max, nindent__);
+      w__.field("name", name);
+      w__.field("attr_type", attr_type);
+      w__.field("min", min);
+      w__.field("max", max);
     }
 
     TrexToken::TrexToken(void)
@@ -22698,11 +22698,11 @@ namespace DUNE
     }
 
     void
-    TrexToken::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TrexToken::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeline", timeline, nindent__);
-      IMC::toJSON(os__, "predicate", predicate, nindent__);
-      attributes.toJSON(os__, "attributes", nindent__);
+      w__.field("timeline", timeline);
+      w__.field("predicate", predicate);
+      attributes.toJSON(w__, "attributes");
     }
 
     void
@@ -22797,11 +22797,11 @@ namespace DUNE
     }
 
     void
-    TrexOperation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TrexOperation::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "goal_id", goal_id, nindent__);
-      token.toJSON(os__, "token", nindent__);
+      w__.field("op", op);
+      w__.field("goal_id", goal_id);
+      token.toJSON(w__, "token");
     }
 
     void
@@ -22906,10 +22906,10 @@ namespace DUNE
     }
 
     void
-    TrexPlan::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TrexPlan::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "reactor", reactor, nindent__);
-      tokens.toJSON(os__, "tokens", nindent__);
+      w__.field("reactor", reactor);
+      tokens.toJSON(w__, "tokens");
     }
 
     void
@@ -22998,10 +22998,10 @@ namespace DUNE
     }
 
     void
-    Event::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Event::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "topic", topic, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("topic", topic);
+      w__.field("data", data);
     }
 
     CompressedImage::CompressedImage(void)
@@ -23060,10 +23060,10 @@ namespace DUNE
     }
 
     void
-    CompressedImage::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CompressedImage::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "frameid", frameid, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("frameid", frameid);
+      w__.field("data", data);
     }
 
     ImageTxSettings::ImageTxSettings(void)
@@ -23132,12 +23132,12 @@ namespace DUNE
     }
 
     void
-    ImageTxSettings::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ImageTxSettings::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "fps", fps, nindent__);
-      IMC::toJSON(os__, "quality", quality, nindent__);
-      IMC::toJSON(os__, "reps", reps, nindent__);
-      IMC::toJSON(os__, "tsize", tsize, nindent__);
+      w__.field("fps", fps);
+      w__.field("quality", quality);
+      w__.field("reps", reps);
+      w__.field("tsize", tsize);
     }
 
     RemoteState::RemoteState(void)
@@ -23213,13 +23213,13 @@ namespace DUNE
     }
 
     void
-    RemoteState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    RemoteState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "depth", depth, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "psi", psi, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("depth", depth);
+      w__.field("speed", speed);
+      w__.field("psi", psi);
     }
 
     Target::Target(void)
@@ -23305,15 +23305,15 @@ namespace DUNE
     }
 
     void
-    Target::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Target::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "label", label, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "cog", cog, nindent__);
-      IMC::toJSON(os__, "sog", sog, nindent__);
+      w__.field("label", label);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
+      w__.field("cog", cog);
+      w__.field("sog", sog);
     }
 
     EntityParameter::EntityParameter(void)
@@ -23372,10 +23372,10 @@ namespace DUNE
     }
 
     void
-    EntityParameter::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    EntityParameter::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("name", name);
+      w__.field("value", value);
     }
 
     EntityParameters::EntityParameters(void)
@@ -23435,10 +23435,10 @@ namespace DUNE
     }
 
     void
-    EntityParameters::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    EntityParameters::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
-      params.toJSON(os__, "params", nindent__);
+      w__.field("name", name);
+      params.toJSON(w__, "params");
     }
 
     void
@@ -23532,11 +23532,11 @@ namespace DUNE
     }
 
     void
-    QueryEntityParameters::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    QueryEntityParameters::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
-      IMC::toJSON(os__, "visibility", visibility, nindent__);
-      IMC::toJSON(os__, "scope", scope, nindent__);
+      w__.field("name", name);
+      w__.field("visibility", visibility);
+      w__.field("scope", scope);
     }
 
     SetEntityParameters::SetEntityParameters(void)
@@ -23596,10 +23596,10 @@ namespace DUNE
     }
 
     void
-    SetEntityParameters::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SetEntityParameters::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
-      params.toJSON(os__, "params", nindent__);
+      w__.field("name", name);
+      params.toJSON(w__, "params");
     }
 
     void
@@ -23683,9 +23683,9 @@ namespace DUNE
     }
 
     void
-    SaveEntityParameters::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SaveEntityParameters::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
+      w__.field("name", name);
     }
 
     CreateSession::CreateSession(void)
@@ -23739,9 +23739,9 @@ namespace DUNE
     }
 
     void
-    CreateSession::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CreateSession::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
+      w__.field("timeout", timeout);
     }
 
     CloseSession::CloseSession(void)
@@ -23795,9 +23795,9 @@ namespace DUNE
     }
 
     void
-    CloseSession::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    CloseSession::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "sessid", sessid, nindent__);
+      w__.field("sessid", sessid);
     }
 
     SessionSubscription::SessionSubscription(void)
@@ -23856,10 +23856,10 @@ namespace DUNE
     }
 
     void
-    SessionSubscription::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SessionSubscription::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "sessid", sessid, nindent__);
-      IMC::toJSON(os__, "messages", messages, nindent__);
+      w__.field("sessid", sessid);
+      w__.field("messages", messages);
     }
 
     SessionKeepAlive::SessionKeepAlive(void)
@@ -23913,9 +23913,9 @@ namespace DUNE
     }
 
     void
-    SessionKeepAlive::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SessionKeepAlive::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "sessid", sessid, nindent__);
+      w__.field("sessid", sessid);
     }
 
     SessionStatus::SessionStatus(void)
@@ -23974,10 +23974,10 @@ namespace DUNE
     }
 
     void
-    SessionStatus::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SessionStatus::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "sessid", sessid, nindent__);
-      IMC::toJSON(os__, "status", status, nindent__);
+      w__.field("sessid", sessid);
+      w__.field("status", status);
     }
 
     PushEntityParameters::PushEntityParameters(void)
@@ -24031,9 +24031,9 @@ namespace DUNE
     }
 
     void
-    PushEntityParameters::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PushEntityParameters::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
+      w__.field("name", name);
     }
 
     PopEntityParameters::PopEntityParameters(void)
@@ -24087,9 +24087,9 @@ namespace DUNE
     }
 
     void
-    PopEntityParameters::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    PopEntityParameters::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
+      w__.field("name", name);
     }
 
     IoEvent::IoEvent(void)
@@ -24148,10 +24148,10 @@ namespace DUNE
     }
 
     void
-    IoEvent::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    IoEvent::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "error", error, nindent__);
+      w__.field("type", type);
+      w__.field("error", error);
     }
 
     UamTxFrame::UamTxFrame(void)
@@ -24220,12 +24220,12 @@ namespace DUNE
     }
 
     void
-    UamTxFrame::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UamTxFrame::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "seq", seq, nindent__);
-      IMC::toJSON(os__, "sys_dst", sys_dst, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("seq", seq);
+      w__.field("sys_dst", sys_dst);
+      w__.field("flags", flags);
+      w__.field("data", data);
     }
 
     UamRxFrame::UamRxFrame(void)
@@ -24294,12 +24294,12 @@ namespace DUNE
     }
 
     void
-    UamRxFrame::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UamRxFrame::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "sys_src", sys_src, nindent__);
-      IMC::toJSON(os__, "sys_dst", sys_dst, nindent__);
-      IMC::toJSON(os__, "flags", flags, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("sys_src", sys_src);
+      w__.field("sys_dst", sys_dst);
+      w__.field("flags", flags);
+      w__.field("data", data);
     }
 
     UamTxStatus::UamTxStatus(void)
@@ -24375,11 +24375,11 @@ namespace DUNE
     }
 
     void
-    UamTxStatus::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UamTxStatus::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "seq", seq, nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
-      IMC::toJSON(os__, "error", error, nindent__);
+      w__.field("seq", seq);
+      w__.field("value", value);
+      w__.field("error", error);
     }
 
     UamRxRange::UamRxRange(void)
@@ -24455,11 +24455,11 @@ namespace DUNE
     }
 
     void
-    UamRxRange::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UamRxRange::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "seq", seq, nindent__);
-      IMC::toJSON(os__, "sys", sys, nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("seq", seq);
+      w__.field("sys", sys);
+      w__.field("value", value);
     }
 
     UamTxRange::UamTxRange(void)
@@ -24523,11 +24523,11 @@ namespace DUNE
     }
 
     void
-    UamTxRange::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UamTxRange::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "seq", seq, nindent__);
-      IMC::toJSON(os__, "sys_dst", sys_dst, nindent__);
-      IMC::toJSON(os__, "timeout", timeout, nindent__);
+      w__.field("seq", seq);
+      w__.field("sys_dst", sys_dst);
+      w__.field("timeout", timeout);
     }
 
     FormCtrlParam::FormCtrlParam(void)
@@ -24606,14 +24606,14 @@ namespace DUNE
     }
 
     void
-    FormCtrlParam::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FormCtrlParam::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "action", action, nindent__);
-      IMC::toJSON(os__, "longain", longain, nindent__);
-      IMC::toJSON(os__, "latgain", latgain, nindent__);
-      IMC::toJSON(os__, "bondthick", bondthick, nindent__);
-      IMC::toJSON(os__, "leadgain", leadgain, nindent__);
-      IMC::toJSON(os__, "deconflgain", deconflgain, nindent__);
+      w__.field("action", action);
+      w__.field("longain", longain);
+      w__.field("latgain", latgain);
+      w__.field("bondthick", bondthick);
+      w__.field("leadgain", leadgain);
+      w__.field("deconflgain", deconflgain);
     }
 
     FormationEval::FormationEval(void)
@@ -24677,11 +24677,11 @@ namespace DUNE
     }
 
     void
-    FormationEval::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FormationEval::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "err_mean", err_mean, nindent__);
-      IMC::toJSON(os__, "dist_min_abs", dist_min_abs, nindent__);
-      IMC::toJSON(os__, "dist_min_mean", dist_min_mean, nindent__);
+      w__.field("err_mean", err_mean);
+      w__.field("dist_min_abs", dist_min_abs);
+      w__.field("dist_min_mean", dist_min_mean);
     }
 
     FormationControlParams::FormationControlParams(void)
@@ -24785,19 +24785,19 @@ namespace DUNE
     }
 
     void
-    FormationControlParams::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FormationControlParams::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "action", action, nindent__);
-      IMC::toJSON(os__, "lon_gain", lon_gain, nindent__);
-      IMC::toJSON(os__, "lat_gain", lat_gain, nindent__);
-      IMC::toJSON(os__, "bond_thick", bond_thick, nindent__);
-      IMC::toJSON(os__, "lead_gain", lead_gain, nindent__);
-      IMC::toJSON(os__, "deconfl_gain", deconfl_gain, nindent__);
-      IMC::toJSON(os__, "accel_switch_gain", accel_switch_gain, nindent__);
-      IMC::toJSON(os__, "safe_dist", safe_dist, nindent__);
-      IMC::toJSON(os__, "deconflict_offset", deconflict_offset, nindent__);
-      IMC::toJSON(os__, "accel_safe_margin", accel_safe_margin, nindent__);
-      IMC::toJSON(os__, "accel_lim_x", accel_lim_x, nindent__);
+      w__.field("action", action);
+      w__.field("lon_gain", lon_gain);
+      w__.field("lat_gain", lat_gain);
+      w__.field("bond_thick", bond_thick);
+      w__.field("lead_gain", lead_gain);
+      w__.field("deconfl_gain", deconfl_gain);
+      w__.field("accel_switch_gain", accel_switch_gain);
+      w__.field("safe_dist", safe_dist);
+      w__.field("deconflict_offset", deconflict_offset);
+      w__.field("accel_safe_margin", accel_safe_margin);
+      w__.field("accel_lim_x", accel_lim_x);
     }
 
     FormationEvaluation::FormationEvaluation(void)
@@ -24887,16 +24887,16 @@ namespace DUNE
     }
 
     void
-    FormationEvaluation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    FormationEvaluation::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "err_mean", err_mean, nindent__);
-      IMC::toJSON(os__, "dist_min_abs", dist_min_abs, nindent__);
-      IMC::toJSON(os__, "dist_min_mean", dist_min_mean, nindent__);
-      IMC::toJSON(os__, "roll_rate_mean", roll_rate_mean, nindent__);
-      IMC::toJSON(os__, "time", time, nindent__);
-      controlparams.toJSON(os__, "controlparams", nindent__);
+      w__.field("type", type);
+      w__.field("op", op);
+      w__.field("err_mean", err_mean);
+      w__.field("dist_min_abs", dist_min_abs);
+      w__.field("dist_min_mean", dist_min_mean);
+      w__.field("roll_rate_mean", roll_rate_mean);
+      w__.field("time", time);
+      controlparams.toJSON(w__, "controlparams");
     }
 
     void
@@ -25010,12 +25010,12 @@ namespace DUNE
     }
 
     void
-    SoiWaypoint::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SoiWaypoint::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "eta", eta, nindent__);
-      IMC::toJSON(os__, "duration", duration, nindent__);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("eta", eta);
+      w__.field("duration", duration);
     }
 
     SoiPlan::SoiPlan(void)
@@ -25075,10 +25075,10 @@ namespace DUNE
     }
 
     void
-    SoiPlan::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SoiPlan::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
-      waypoints.toJSON(os__, "waypoints", nindent__);
+      w__.field("plan_id", plan_id);
+      waypoints.toJSON(w__, "waypoints");
     }
 
     void
@@ -25183,13 +25183,13 @@ namespace DUNE
     }
 
     void
-    SoiCommand::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SoiCommand::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "command", command, nindent__);
-      IMC::toJSON(os__, "settings", settings, nindent__);
-      plan.toJSON(os__, "plan", nindent__);
-      IMC::toJSON(os__, "info", info, nindent__);
+      w__.field("type", type);
+      w__.field("command", command);
+      w__.field("settings", settings);
+      plan.toJSON(w__, "plan");
+      w__.field("info", info);
     }
 
     void
@@ -25303,12 +25303,12 @@ namespace DUNE
     }
 
     void
-    SoiState::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SoiState::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "state", state, nindent__);
-      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
-      IMC::toJSON(os__, "wpt_id", wpt_id, nindent__);
-      IMC::toJSON(os__, "settings_chk", settings_chk, nindent__);
+      w__.field("state", state);
+      w__.field("plan_id", plan_id);
+      w__.field("wpt_id", wpt_id);
+      w__.field("settings_chk", settings_chk);
     }
 
     MessagePart::MessagePart(void)
@@ -25377,12 +25377,12 @@ namespace DUNE
     }
 
     void
-    MessagePart::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    MessagePart::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "uid", uid, nindent__);
-      IMC::toJSON(os__, "frag_number", frag_number, nindent__);
-      IMC::toJSON(os__, "num_frags", num_frags, nindent__);
-      IMC::toJSON(os__, "data", data, nindent__);
+      w__.field("uid", uid);
+      w__.field("frag_number", frag_number);
+      w__.field("num_frags", num_frags);
+      w__.field("data", data);
     }
 
     NeptusBlob::NeptusBlob(void)
@@ -25441,10 +25441,10 @@ namespace DUNE
     }
 
     void
-    NeptusBlob::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    NeptusBlob::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "content_type", content_type, nindent__);
-      IMC::toJSON(os__, "content", content, nindent__);
+      w__.field("content_type", content_type);
+      w__.field("content", content);
     }
 
     Aborted::Aborted(void)
@@ -25547,11 +25547,11 @@ namespace DUNE
     }
 
     void
-    UsblAngles::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UsblAngles::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "target", target, nindent__);
-      IMC::toJSON(os__, "bearing", bearing, nindent__);
-      IMC::toJSON(os__, "elevation", elevation, nindent__);
+      w__.field("target", target);
+      w__.field("bearing", bearing);
+      w__.field("elevation", elevation);
     }
 
     UsblPosition::UsblPosition(void)
@@ -25620,12 +25620,12 @@ namespace DUNE
     }
 
     void
-    UsblPosition::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UsblPosition::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "target", target, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
+      w__.field("target", target);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
     }
 
     UsblFix::UsblFix(void)
@@ -25701,13 +25701,13 @@ namespace DUNE
     }
 
     void
-    UsblFix::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UsblFix::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "target", target, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
+      w__.field("target", target);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z_units", z_units);
+      w__.field("z", z);
     }
 
     ParametersXml::ParametersXml(void)
@@ -25766,10 +25766,10 @@ namespace DUNE
     }
 
     void
-    ParametersXml::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ParametersXml::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "locale", locale, nindent__);
-      IMC::toJSON(os__, "config", config, nindent__);
+      w__.field("locale", locale);
+      w__.field("config", config);
     }
 
     GetParametersXml::GetParametersXml(void)
@@ -25872,11 +25872,11 @@ namespace DUNE
     }
 
     void
-    SetImageCoords::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SetImageCoords::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "camid", camid, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
+      w__.field("camid", camid);
+      w__.field("x", x);
+      w__.field("y", y);
     }
 
     GetImageCoords::GetImageCoords(void)
@@ -25940,11 +25940,11 @@ namespace DUNE
     }
 
     void
-    GetImageCoords::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    GetImageCoords::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "camid", camid, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
+      w__.field("camid", camid);
+      w__.field("x", x);
+      w__.field("y", y);
     }
 
     GetWorldCoordinates::GetWorldCoordinates(void)
@@ -26023,14 +26023,14 @@ namespace DUNE
     }
 
     void
-    GetWorldCoordinates::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    GetWorldCoordinates::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "tracking", tracking, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
+      w__.field("tracking", tracking);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
     }
 
     UsblAnglesExtended::UsblAnglesExtended(void)
@@ -26128,17 +26128,17 @@ namespace DUNE
     }
 
     void
-    UsblAnglesExtended::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UsblAnglesExtended::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "target", target, nindent__);
-      IMC::toJSON(os__, "lbearing", lbearing, nindent__);
-      IMC::toJSON(os__, "lelevation", lelevation, nindent__);
-      IMC::toJSON(os__, "bearing", bearing, nindent__);
-      IMC::toJSON(os__, "elevation", elevation, nindent__);
-      IMC::toJSON(os__, "phi", phi, nindent__);
-      IMC::toJSON(os__, "theta", theta, nindent__);
-      IMC::toJSON(os__, "psi", psi, nindent__);
-      IMC::toJSON(os__, "accuracy", accuracy, nindent__);
+      w__.field("target", target);
+      w__.field("lbearing", lbearing);
+      w__.field("lelevation", lelevation);
+      w__.field("bearing", bearing);
+      w__.field("elevation", elevation);
+      w__.field("phi", phi);
+      w__.field("theta", theta);
+      w__.field("psi", psi);
+      w__.field("accuracy", accuracy);
     }
 
     UsblPositionExtended::UsblPositionExtended(void)
@@ -26246,19 +26246,19 @@ namespace DUNE
     }
 
     void
-    UsblPositionExtended::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UsblPositionExtended::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "target", target, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "n", n, nindent__);
-      IMC::toJSON(os__, "e", e, nindent__);
-      IMC::toJSON(os__, "d", d, nindent__);
-      IMC::toJSON(os__, "phi", phi, nindent__);
-      IMC::toJSON(os__, "theta", theta, nindent__);
-      IMC::toJSON(os__, "psi", psi, nindent__);
-      IMC::toJSON(os__, "accuracy", accuracy, nindent__);
+      w__.field("target", target);
+      w__.field("x", x);
+      w__.field("y", y);
+      w__.field("z", z);
+      w__.field("n", n);
+      w__.field("e", e);
+      w__.field("d", d);
+      w__.field("phi", phi);
+      w__.field("theta", theta);
+      w__.field("psi", psi);
+      w__.field("accuracy", accuracy);
     }
 
     UsblFixExtended::UsblFixExtended(void)
@@ -26340,14 +26340,14 @@ namespace DUNE
     }
 
     void
-    UsblFixExtended::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UsblFixExtended::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "target", target, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "accuracy", accuracy, nindent__);
+      w__.field("target", target);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z_units", z_units);
+      w__.field("z", z);
+      w__.field("accuracy", accuracy);
     }
 
     UsblModem::UsblModem(void)
@@ -26423,13 +26423,13 @@ namespace DUNE
     }
 
     void
-    UsblModem::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UsblModem::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "z", z, nindent__);
-      IMC::toJSON(os__, "z_units", z_units, nindent__);
+      w__.field("name", name);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("z", z);
+      w__.field("z_units", z_units);
     }
 
     UsblConfig::UsblConfig(void)
@@ -26489,10 +26489,10 @@ namespace DUNE
     }
 
     void
-    UsblConfig::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    UsblConfig::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      modems.toJSON(os__, "modems", nindent__);
+      w__.field("op", op);
+      modems.toJSON(w__, "modems");
     }
 
     void
@@ -26593,10 +26593,10 @@ namespace DUNE
     }
 
     void
-    DissolvedOrganicMatter::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DissolvedOrganicMatter::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
+      w__.field("value", value);
+      w__.field("type", type);
     }
 
     OpticalBackscatter::OpticalBackscatter(void)
@@ -26662,9 +26662,9 @@ namespace DUNE
     }
 
     void
-    OpticalBackscatter::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    OpticalBackscatter::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
 
     Tachograph::Tachograph(void)
@@ -26793,24 +26793,24 @@ namespace DUNE
     }
 
     void
-    Tachograph::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    Tachograph::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "timestamp_last_service", timestamp_last_service, nindent__);
-      IMC::toJSON(os__, "time_next_service", time_next_service, nindent__);
-      IMC::toJSON(os__, "time_motor_next_service", time_motor_next_service, nindent__);
-      IMC::toJSON(os__, "time_idle_ground", time_idle_ground, nindent__);
-      IMC::toJSON(os__, "time_idle_air", time_idle_air, nindent__);
-      IMC::toJSON(os__, "time_idle_water", time_idle_water, nindent__);
-      IMC::toJSON(os__, "time_idle_underwater", time_idle_underwater, nindent__);
-      IMC::toJSON(os__, "time_idle_unknown", time_idle_unknown, nindent__);
-      IMC::toJSON(os__, "time_motor_ground", time_motor_ground, nindent__);
-      IMC::toJSON(os__, "time_motor_air", time_motor_air, nindent__);
-      IMC::toJSON(os__, "time_motor_water", time_motor_water, nindent__);
-      IMC::toJSON(os__, "time_motor_underwater", time_motor_underwater, nindent__);
-      IMC::toJSON(os__, "time_motor_unknown", time_motor_unknown, nindent__);
-      IMC::toJSON(os__, "rpm_min", rpm_min, nindent__);
-      IMC::toJSON(os__, "rpm_max", rpm_max, nindent__);
-      IMC::toJSON(os__, "depth_max", depth_max, nindent__);
+      w__.field("timestamp_last_service", timestamp_last_service);
+      w__.field("time_next_service", time_next_service);
+      w__.field("time_motor_next_service", time_motor_next_service);
+      w__.field("time_idle_ground", time_idle_ground);
+      w__.field("time_idle_air", time_idle_air);
+      w__.field("time_idle_water", time_idle_water);
+      w__.field("time_idle_underwater", time_idle_underwater);
+      w__.field("time_idle_unknown", time_idle_unknown);
+      w__.field("time_motor_ground", time_motor_ground);
+      w__.field("time_motor_air", time_motor_air);
+      w__.field("time_motor_water", time_motor_water);
+      w__.field("time_motor_underwater", time_motor_underwater);
+      w__.field("time_motor_unknown", time_motor_unknown);
+      w__.field("rpm_min", rpm_min);
+      w__.field("rpm_max", rpm_max);
+      w__.field("depth_max", depth_max);
     }
 
     ApmStatus::ApmStatus(void)
@@ -26869,10 +26869,10 @@ namespace DUNE
     }
 
     void
-    ApmStatus::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    ApmStatus::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "severity", severity, nindent__);
-      IMC::toJSON(os__, "text", text, nindent__);
+      w__.field("severity", severity);
+      w__.field("text", text);
     }
 
     SadcReadings::SadcReadings(void)
@@ -26949,11 +26949,11 @@ namespace DUNE
     }
 
     void
-    SadcReadings::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    SadcReadings::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "channel", channel, nindent__);
-      IMC::toJSON(os__, "value", value, nindent__);
-      IMC::toJSON(os__, "gain", gain, nindent__);
+      w__.field("channel", channel);
+      w__.field("value", value);
+      w__.field("gain", gain);
     }
 
     DmsDetection::DmsDetection(void)
@@ -27082,24 +27082,24 @@ namespace DUNE
     }
 
     void
-    DmsDetection::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    DmsDetection::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "ch01", ch01, nindent__);
-      IMC::toJSON(os__, "ch02", ch02, nindent__);
-      IMC::toJSON(os__, "ch03", ch03, nindent__);
-      IMC::toJSON(os__, "ch04", ch04, nindent__);
-      IMC::toJSON(os__, "ch05", ch05, nindent__);
-      IMC::toJSON(os__, "ch06", ch06, nindent__);
-      IMC::toJSON(os__, "ch07", ch07, nindent__);
-      IMC::toJSON(os__, "ch08", ch08, nindent__);
-      IMC::toJSON(os__, "ch09", ch09, nindent__);
-      IMC::toJSON(os__, "ch10", ch10, nindent__);
-      IMC::toJSON(os__, "ch11", ch11, nindent__);
-      IMC::toJSON(os__, "ch12", ch12, nindent__);
-      IMC::toJSON(os__, "ch13", ch13, nindent__);
-      IMC::toJSON(os__, "ch14", ch14, nindent__);
-      IMC::toJSON(os__, "ch15", ch15, nindent__);
-      IMC::toJSON(os__, "ch16", ch16, nindent__);
+      w__.field("ch01", ch01);
+      w__.field("ch02", ch02);
+      w__.field("ch03", ch03);
+      w__.field("ch04", ch04);
+      w__.field("ch05", ch05);
+      w__.field("ch06", ch06);
+      w__.field("ch07", ch07);
+      w__.field("ch08", ch08);
+      w__.field("ch09", ch09);
+      w__.field("ch10", ch10);
+      w__.field("ch11", ch11);
+      w__.field("ch12", ch12);
+      w__.field("ch13", ch13);
+      w__.field("ch14", ch14);
+      w__.field("ch15", ch15);
+      w__.field("ch16", ch16);
     }
 
     HomePosition::HomePosition(void)
@@ -27180,14 +27180,14 @@ namespace DUNE
     }
 
     void
-    HomePosition::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    HomePosition::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "height", height, nindent__);
-      IMC::toJSON(os__, "depth", depth, nindent__);
-      IMC::toJSON(os__, "alt", alt, nindent__);
+      w__.field("op", op);
+      w__.field("lat", lat);
+      w__.field("lon", lon);
+      w__.field("height", height);
+      w__.field("depth", depth);
+      w__.field("alt", alt);
     }
 
     TotalMagIntensity::TotalMagIntensity(void)
@@ -27253,9 +27253,9 @@ namespace DUNE
     }
 
     void
-    TotalMagIntensity::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    TotalMagIntensity::writeJSONFields(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      w__.field("value", value);
     }
   }
 }
@@ -47,7 +47,7 @@
 #include <DUNE/IMC/Enumerations.hpp>
 #include <DUNE/IMC/Bitfields.hpp>
 #include <DUNE/IMC/SuperTypes.hpp>
-#include <DUNE/IMC/JSON.hpp>
+#include <DUNE/IMC/JSONWriter.hpp>
 
 namespace DUNE
 {
@@ -143,7 +143,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Query Entity State.
@@ -277,7 +277,7 @@ namespace DUNE
       setSubId(uint16_t subid);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Query Entity Information.
@@ -344,7 +344,7 @@ namespace DUNE
       setSubId(uint16_t subid);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Entity List.
@@ -422,7 +422,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! CPU Usage.
@@ -489,7 +489,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Transport Bindings.
@@ -558,7 +558,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Restart System.
@@ -628,7 +628,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Device Calibration Control.
@@ -702,7 +702,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Device Calibration State.
@@ -790,7 +790,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Entity Activation State.
@@ -880,7 +880,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Query Entity Activation State.
@@ -1039,7 +1039,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Message List.
@@ -1106,7 +1106,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -1217,7 +1217,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Leak Simulation.
@@ -1295,7 +1295,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Underwater Acoustics Simulation.
@@ -1377,7 +1377,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Dynamics Simulation Parameters.
@@ -1453,7 +1453,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Storage Usage.
@@ -1522,7 +1522,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Cache Control.
@@ -1608,7 +1608,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -1710,7 +1710,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Log Book Entry.
@@ -1798,7 +1798,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Log Book Control.
@@ -1882,7 +1882,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -1980,7 +1980,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Clock Control.
@@ -2062,7 +2062,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Historic CTD.
@@ -2127,7 +2127,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Historic Telemetry.
@@ -2196,7 +2196,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Historic Sonar Data.
@@ -2286,7 +2286,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Historic Event.
@@ -2364,7 +2364,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Profile Sample.
@@ -2427,7 +2427,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Vertical Profile.
@@ -2521,7 +2521,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -2669,7 +2669,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Announce Service.
@@ -2747,7 +2747,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Receive Signal Strength Information.
@@ -2814,7 +2814,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Voltage Standing Wave Ratio.
@@ -2881,7 +2881,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Link Level.
@@ -2948,7 +2948,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! SMS.
@@ -3019,7 +3019,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! SMS Transmit.
@@ -3092,7 +3092,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! SMS Receive.
@@ -3161,7 +3161,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! SMS State.
@@ -3251,7 +3251,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Text Message.
@@ -3320,7 +3320,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Received Iridium Message.
@@ -3395,7 +3395,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Transmit Iridium Message.
@@ -3468,7 +3468,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Iridium Transmission Status.
@@ -3556,7 +3556,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Group Membership State.
@@ -3625,7 +3625,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! System Group.
@@ -3713,7 +3713,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Link Latency.
@@ -3782,7 +3782,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Extended Receive Signal Strength Information.
@@ -3851,7 +3851,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Historic Data Series.
@@ -3924,7 +3924,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -4013,7 +4013,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Historic Data Sample.
@@ -4092,7 +4092,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -4192,7 +4192,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -4281,7 +4281,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -4405,7 +4405,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Telemetry Message.
@@ -4544,7 +4544,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! LBL Range.
@@ -4613,7 +4613,7 @@ namespace DUNE
       setSubId(uint16_t subid);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! LBL Beacon Configuration.
@@ -4692,7 +4692,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! LBL Configuration.
@@ -4772,7 +4772,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -4855,7 +4855,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -4969,7 +4969,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Acoustic Operation.
@@ -5085,7 +5085,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -5221,7 +5221,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Acoustic Link Quality.
@@ -5292,7 +5292,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Acoustic Transmission Request.
@@ -5384,7 +5384,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -5513,7 +5513,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Revolutions Per Minute.
@@ -5580,7 +5580,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Voltage.
@@ -5647,7 +5647,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Current.
@@ -5714,7 +5714,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! GPS Fix.
@@ -5843,7 +5843,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Euler Angles.
@@ -5912,7 +5912,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Euler Angles Delta.
@@ -5981,7 +5981,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Angular Velocity.
@@ -6048,7 +6048,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Acceleration.
@@ -6115,7 +6115,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Magnetic Field.
@@ -6182,7 +6182,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Ground Velocity.
@@ -6260,7 +6260,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Water Velocity.
@@ -6338,7 +6338,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Velocity Delta.
@@ -6405,7 +6405,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Device State.
@@ -6476,7 +6476,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Beam Configuration.
@@ -6539,7 +6539,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Distance.
@@ -6627,7 +6627,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -6710,7 +6710,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Pressure.
@@ -6777,7 +6777,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Depth.
@@ -6844,7 +6844,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Depth Offset.
@@ -6911,7 +6911,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Sound Speed.
@@ -6978,7 +6978,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Water Density.
@@ -7045,7 +7045,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Conductivity.
@@ -7112,7 +7112,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Salinity.
@@ -7179,7 +7179,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Wind Speed.
@@ -7244,7 +7244,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Relative Humidity.
@@ -7311,7 +7311,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Device Data (Text).
@@ -7378,7 +7378,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Device Data (Binary).
@@ -7445,7 +7445,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Force.
@@ -7512,7 +7512,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Sonar Data.
@@ -7604,7 +7604,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -7743,7 +7743,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Fuel Level.
@@ -7820,7 +7820,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! GPS Navigation Data.
@@ -7909,7 +7909,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Servo Position.
@@ -7984,7 +7984,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Data Sanity.
@@ -8054,7 +8054,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Rhodamine Dye.
@@ -8121,7 +8121,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Crude Oil.
@@ -8188,7 +8188,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Fine Oil.
@@ -8255,7 +8255,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Turbidity.
@@ -8322,7 +8322,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Chlorophyll.
@@ -8389,7 +8389,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Fluorescein.
@@ -8456,7 +8456,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Phycocyanin.
@@ -8523,7 +8523,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Phycoerythrin.
@@ -8590,7 +8590,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! GPS Fix RTK.
@@ -8705,7 +8705,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Estimated State.
@@ -8804,7 +8804,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! External Navigation Data.
@@ -8884,7 +8884,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -8967,7 +8967,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Air Saturation.
@@ -9034,7 +9034,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Throttle.
@@ -9101,7 +9101,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! pH.
@@ -9168,7 +9168,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Redox Potential.
@@ -9235,7 +9235,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Camera Zoom.
@@ -9319,7 +9319,7 @@ namespace DUNE
       setSubId(uint16_t subid);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Set Thruster Actuation.
@@ -9394,7 +9394,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Set Servo Position.
@@ -9469,7 +9469,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Set Control Surface Deflection.
@@ -9538,7 +9538,7 @@ namespace DUNE
       setSubId(uint16_t subid);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Remote Actions Request.
@@ -9616,7 +9616,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Remote Actions.
@@ -9683,7 +9683,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Button Event.
@@ -9752,7 +9752,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! LCD Control.
@@ -9836,7 +9836,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Power Operation.
@@ -9920,7 +9920,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Power Channel Control.
@@ -10012,7 +10012,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Query Power Channel State.
@@ -10143,7 +10143,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! LED Brightness.
@@ -10218,7 +10218,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Query LED Brightness.
@@ -10285,7 +10285,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Set LED Brightness.
@@ -10360,7 +10360,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Set PWM.
@@ -10431,7 +10431,7 @@ namespace DUNE
       setSubId(uint16_t subid);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! PWM.
@@ -10502,7 +10502,7 @@ namespace DUNE
       setSubId(uint16_t subid);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Estimated Stream Velocity.
@@ -10567,7 +10567,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Indicated Speed.
@@ -10634,7 +10634,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! True Speed.
@@ -10701,7 +10701,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Navigation Uncertainty.
@@ -10788,7 +10788,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Navigation Data.
@@ -10865,7 +10865,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! GPS Fix Rejection.
@@ -10943,7 +10943,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! LBL Range Acceptance.
@@ -11029,7 +11029,7 @@ namespace DUNE
       setSubId(uint16_t subid);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! DVL Rejection.
@@ -11124,7 +11124,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! LBL Beacon Position Estimate.
@@ -11201,7 +11201,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -11299,7 +11299,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! GroupStreamVelocity.
@@ -11364,7 +11364,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Airflow.
@@ -11429,7 +11429,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Desired Heading.
@@ -11496,7 +11496,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Desired Z.
@@ -11565,7 +11565,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Desired Speed.
@@ -11634,7 +11634,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Desired Roll.
@@ -11701,7 +11701,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Desired Pitch.
@@ -11768,7 +11768,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Desired Vertical Rate.
@@ -11835,7 +11835,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Desired Path.
@@ -11941,7 +11941,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Desired Control.
@@ -12031,7 +12031,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Desired Heading Rate.
@@ -12098,7 +12098,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Desired Velocity.
@@ -12188,7 +12188,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Path Control State.
@@ -12300,7 +12300,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Allocated Control Torques.
@@ -12365,7 +12365,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Control Parcel.
@@ -12432,7 +12432,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Brake.
@@ -12504,7 +12504,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Desired Linear State.
@@ -12606,7 +12606,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Desired Throttle.
@@ -12673,7 +12673,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Goto Maneuver.
@@ -12760,7 +12760,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! PopUp Maneuver.
@@ -12858,7 +12858,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Teleoperation Maneuver.
@@ -12925,7 +12925,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Loiter Maneuver.
@@ -13046,7 +13046,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Idle Maneuver.
@@ -13115,7 +13115,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Low Level Control Maneuver.
@@ -13186,7 +13186,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -13308,7 +13308,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Path Point.
@@ -13373,7 +13373,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Follow Path Maneuver.
@@ -13456,7 +13456,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -13557,7 +13557,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Teleoperation Done.
@@ -13693,7 +13693,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Elevator Maneuver.
@@ -13789,7 +13789,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Trajectory Point.
@@ -13856,7 +13856,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Follow Trajectory.
@@ -13939,7 +13939,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -14026,7 +14026,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Vehicle Formation Participant.
@@ -14093,7 +14093,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Vehicle Formation.
@@ -14178,7 +14178,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -14308,7 +14308,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Maneuver Control State.
@@ -14392,7 +14392,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Follow System.
@@ -14467,7 +14467,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Communications Relay.
@@ -14542,7 +14542,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Polygon Vertex.
@@ -14605,7 +14605,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Cover Area.
@@ -14686,7 +14686,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -14806,7 +14806,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Formation Parameters.
@@ -14890,7 +14890,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -14999,7 +14999,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Follow Reference Maneuver.
@@ -15068,7 +15068,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Reference To Follow.
@@ -15164,7 +15164,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -15287,7 +15287,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -15412,7 +15412,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Formation Monitoring Data.
@@ -15515,7 +15515,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -15615,7 +15615,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Formation.
@@ -15757,7 +15757,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -15854,7 +15854,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Drop Maneuver.
@@ -15935,7 +15935,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Scheduled Goto.
@@ -16021,7 +16021,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Rows Coverage.
@@ -16127,7 +16127,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Sample Maneuver.
@@ -16214,7 +16214,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Image Tracking.
@@ -16348,7 +16348,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Land Maneuver.
@@ -16435,7 +16435,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Autonomous Section.
@@ -16535,7 +16535,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -16632,7 +16632,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Alignment Maneuver.
@@ -16709,7 +16709,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Station Keeping Extended.
@@ -16805,7 +16805,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Maneuver Done.
@@ -16954,7 +16954,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Vehicle State.
@@ -17063,7 +17063,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Vehicle Command.
@@ -17166,7 +17166,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -17266,7 +17266,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Entity Monitoring State.
@@ -17347,7 +17347,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Operational Limits.
@@ -17430,7 +17430,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Get Operational Limits.
@@ -17544,7 +17544,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Control Loops.
@@ -17618,7 +17618,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Vehicle Medium.
@@ -17694,7 +17694,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Collision.
@@ -17776,7 +17776,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Formation Tracking State.
@@ -17876,7 +17876,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Autopilot Mode.
@@ -17956,7 +17956,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Formation Tracking State.
@@ -18078,7 +18078,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Report Control.
@@ -18183,7 +18183,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! State Report.
@@ -18262,7 +18262,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Transmission Request.
@@ -18379,7 +18379,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -18489,7 +18489,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! SMS Transmission Request.
@@ -18562,7 +18562,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! SMS Transmission Status.
@@ -18646,7 +18646,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! VTOL State.
@@ -18722,7 +18722,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Arming State.
@@ -18792,7 +18792,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! TCP Transmission Request.
@@ -18865,7 +18865,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -18969,7 +18969,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Abort.
@@ -19119,7 +19119,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Plan Maneuver.
@@ -19192,7 +19192,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -19281,7 +19281,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -19380,7 +19380,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -19482,7 +19482,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -19586,7 +19586,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Plan DB.
@@ -19697,7 +19697,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -19790,7 +19790,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Plan DB State.
@@ -19869,7 +19869,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -19999,7 +19999,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -20120,7 +20120,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Plan Generation.
@@ -20213,7 +20213,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Leader State.
@@ -20329,7 +20329,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Plan Statistics.
@@ -20434,7 +20434,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Reported State.
@@ -20532,7 +20532,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Remote Sensor Info.
@@ -20611,7 +20611,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! MapPoint.
@@ -20676,7 +20676,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Map Feature.
@@ -20772,7 +20772,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -20857,7 +20857,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -20967,7 +20967,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -21052,7 +21052,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -21139,7 +21139,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! TREX Command.
@@ -21227,7 +21227,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! TREX Attribute.
@@ -21315,7 +21315,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! TREX Token.
@@ -21386,7 +21386,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -21488,7 +21488,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -21573,7 +21573,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -21658,7 +21658,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Compressed Image.
@@ -21727,7 +21727,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Image Transmission Settings.
@@ -21794,7 +21794,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Remote State.
@@ -21863,7 +21863,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Target.
@@ -21942,7 +21942,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! EntityParameter.
@@ -22011,7 +22011,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! EntityParameters.
@@ -22080,7 +22080,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -22167,7 +22167,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! SetEntityParameters.
@@ -22236,7 +22236,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -22319,7 +22319,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Create Session.
@@ -22380,7 +22380,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Close Session.
@@ -22441,7 +22441,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Session Subscription.
@@ -22510,7 +22510,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Session Keep-Alive.
@@ -22571,7 +22571,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Session Status.
@@ -22643,7 +22643,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Push Entity Parameters.
@@ -22710,7 +22710,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Pop Entity Parameters.
@@ -22777,7 +22777,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! I/O Event.
@@ -22855,7 +22855,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! UamTxFrame.
@@ -22939,7 +22939,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! UamRxFrame.
@@ -23021,7 +23021,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! UamTxStatus.
@@ -23123,7 +23123,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! UamRxRange.
@@ -23200,7 +23200,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! UamTxRange.
@@ -23271,7 +23271,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Formation Control Parameters.
@@ -23353,7 +23353,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Formation Evaluation Data.
@@ -23418,7 +23418,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Formation Control Parameters.
@@ -23510,7 +23510,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Formation Evaluation Data.
@@ -23615,7 +23615,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -23698,7 +23698,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! SOI Plan.
@@ -23767,7 +23767,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -23886,7 +23886,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -23980,7 +23980,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Message Fragment.
@@ -24053,7 +24053,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Neptus Blob.
@@ -24122,7 +24122,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Aborted.
@@ -24240,7 +24240,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! USBL Position.
@@ -24307,7 +24307,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! USBL Fix.
@@ -24376,7 +24376,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Parameters XML.
@@ -24445,7 +24445,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Get Parameters XML.
@@ -24563,7 +24563,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Get Image Coordinates.
@@ -24628,7 +24628,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Get World Coordinates.
@@ -24699,7 +24699,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! USBL Angles Extended.
@@ -24782,7 +24782,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! USBL Position Extended.
@@ -24869,7 +24869,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! USBL Fix Extended.
@@ -24946,7 +24946,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! USBL Modem Configuration.
@@ -25021,7 +25021,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! USBL Configuration.
@@ -25101,7 +25101,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
 
     protected:
       void
@@ -25195,7 +25195,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Optical Backscattering Coefficient.
@@ -25262,7 +25262,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Tachograph.
@@ -25353,7 +25353,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! APM Status.
@@ -25443,7 +25443,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! SADC Readings.
@@ -25525,7 +25525,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! DMS Detection.
@@ -25616,7 +25616,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Home Position.
@@ -25696,7 +25696,7 @@ namespace DUNE
       }
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
 
     //! Total Magnetic Field Intensity.
@@ -25763,7 +25763,7 @@ namespace DUNE
       setValueFP(fp64_t val);
 
       void
-      fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+      writeJSONFields(JSONWriter& w__) const;
     };
   }
 }
@@ -0,0 +1,179 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_IMC_DELIVERY_FILTER_HPP_INCLUDED_
+#define DUNE_IMC_DELIVERY_FILTER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <bitset>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Message.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Compact predicate on message addressing fields, evaluated by
+    //! the message bus before a message is cloned into a task's
+    //! queue. An empty filter accepts all messages; otherwise a
+    //! message must satisfy every configured criterion.
+    //!
+    //! Example:
+    //! @code
+    //! bind<IMC::EstimatedState>(this, IMC::DeliveryFilter().source(m_vehicle));
+    //! @endcode
+    class DeliveryFilter
+    {
+    public:
+      //! Create a filter that accepts all messages.
+      DeliveryFilter(void):
+        m_any_entity(true),
+        m_destination(DUNE_IMC_CONST_NULL_ID),
+        m_local(false),
+        m_local_id(DUNE_IMC_CONST_NULL_ID)
+      { }
+
+      //! Accept messages from a given source system. May be called
+      //! several times to accept a set of systems.
+      //! @param[in] id source system.
+      //! @return reference to this filter.
+      DeliveryFilter&
+      source(uint16_t id)
+      {
+        std::vector<uint16_t>::iterator itr = std::lower_bound(m_sources.begin(), m_sources.end(), id);
+        if (itr == m_sources.end() || *itr != id)
+          m_sources.insert(itr, id);
+        return *this;
+      }
+
+      //! Accept messages from a given source entity. May be called
+      //! several times to accept a set of entities.
+      //! @param[in] id source entity.
+      //! @return reference to this filter.
+      DeliveryFilter&
+      sourceEntity(uint8_t id)
+      {
+        m_any_entity = false;
+        m_entities.set(id);
+        return *this;
+      }
+
+      //! Accept messages addressed to a given system or to no system
+      //! in particular.
+      //! @param[in] id destination system.
+      //! @return reference to this filter.
+      DeliveryFilter&
+      destination(uint16_t id)
+      {
+        m_destination = id;
+        return *this;
+      }
+
+      //! Accept only messages produced by the local system.
+      //! @return reference to this filter.
+      DeliveryFilter&
+      localOnly(void)
+      {
+        m_local = true;
+        return *this;
+      }
+
+      //! Test if filter only accepts messages of the local system.
+      //! @return true if filter is local only, false otherwise.
+      bool
+      isLocalOnly(void) const
+      {
+        return m_local;
+      }
+
+      //! Set the identifier of the local system, used by
+      //! localOnly() filters.
+      //! @param[in] id local system.
+      void
+      setLocalSystem(uint16_t id)
+      {
+        m_local_id = id;
+      }
+
+      //! Test if filter accepts all messages.
+      //! @return true if filter is empty, false otherwise.
+      bool
+      isEmpty(void) const
+      {
+        return m_sources.empty() && m_any_entity
+        && m_destination == DUNE_IMC_CONST_NULL_ID && !m_local;
+      }
+
+      //! Test if a message satisfies the filter.
+      //! @param[in] msg message.
+      //! @return true if message is accepted, false otherwise.
+      bool
+      matches(const Message* msg) const
+      {
+        if (m_local && msg->getSource() != m_local_id)
+          return false;
+
+        if (!m_any_entity && !m_entities.test(msg->getSourceEntity()))
+          return false;
+
+        if (m_destination != DUNE_IMC_CONST_NULL_ID
+            && msg->getDestination() != m_destination
+            && msg->getDestination() != DUNE_IMC_CONST_NULL_ID)
+          return false;
+
+        if (!m_sources.empty()
+            && !std::binary_search(m_sources.begin(), m_sources.end(), msg->getSource()))
+          return false;
+
+        return true;
+      }
+
+    private:
+      //! Sorted set of accepted source systems.
+      std::vector<uint16_t> m_sources;
+      //! Set of accepted source entities.
+      std::bitset<256> m_entities;
+      //! True if any source entity is accepted.
+      bool m_any_entity;
+      //! Accepted destination system.
+      uint16_t m_destination;
+      //! True if only local messages are accepted.
+      bool m_local;
+      //! Local system.
+      uint16_t m_local_id;
+    };
+  }
+}
+
+#endif
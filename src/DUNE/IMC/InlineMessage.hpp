@@ -33,13 +33,14 @@
 // ISO C++ 98 headers.
 #include <cstddef>
 #include <stdexcept>
+#include <string>
 
 // DUNE headers.
 #include <DUNE/IMC/Constants.hpp>
 #include <DUNE/IMC/Message.hpp>
 #include <DUNE/IMC/Exceptions.hpp>
 #include <DUNE/IMC/Serialization.hpp>
-#include <DUNE/IMC/JSON.hpp>
+#include <DUNE/IMC/JSONWriter.hpp>
 
 namespace DUNE
 {
@@ -258,21 +259,17 @@ namespace DUNE
       void
       toJSON(std::ostream& os, const char* label, unsigned nindent, char prefix = ',') const
       {
-        const char* indent = indentJSON(nindent);
-        const char* indent_next = indentJSON(nindent + 2);
-
-        os << prefix << '\n' << indent << '"' << label << "\": ";
+        std::string str;
+        JSONWriter writer(str, nindent);
+        writer.message(label, m_msg);
+        str[0] = prefix;
+        os << str;
+      }
 
-        if (m_msg == NULL)
-        {
-          os << "\"null\"";
-        }
-        else
-        {
-          os << "{\n" << indent_next << "\"abbrev\": \"" << m_msg->getName() << '"';
-          m_msg->fieldsToJSON(os, nindent + 2);
-          os << '\n' << indent << "}";
-        }
+      void
+      toJSON(JSONWriter& writer, const char* label) const
+      {
+        writer.message(label, m_msg);
       }
 
     private:
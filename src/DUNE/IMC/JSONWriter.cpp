@@ -0,0 +1,322 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/IMC/JSONWriter.hpp>
+#include <DUNE/IMC/Message.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Largest magnitude written by the integer fast path.
+    static const double c_max_integral = 9007199254740992.0;
+    //! Hexadecimal digits.
+    static const char c_hex[] = "0123456789ABCDEF";
+
+    //! Format a floating point number with the shortest precision
+    //! that reads back to the same value.
+    //! @param[in] bfr output buffer (at least 32 bytes).
+    //! @param[in] value value.
+    //! @param[in] min_digits first precision to try.
+    //! @param[in] max_digits maximum precision.
+    //! @param[in] single true if the value is single precision.
+    //! @return number of characters written.
+    static int
+    formatShortest(char* bfr, double value, int min_digits, int max_digits, bool single)
+    {
+      int rv = 0;
+
+      for (int digits = min_digits; digits <= max_digits; ++digits)
+      {
+        rv = std::snprintf(bfr, 32, "%.*g", digits, value);
+        if (digits == max_digits)
+          break;
+
+        if (single)
+        {
+          if (std::strtof(bfr, NULL) == (float)value)
+            break;
+        }
+        else if (std::strtod(bfr, NULL) == value)
+        {
+          break;
+        }
+      }
+
+      // Decimal separator of the current locale.
+      for (int i = 0; i < rv; ++i)
+      {
+        if (bfr[i] == ',')
+          bfr[i] = '.';
+      }
+
+      return rv;
+    }
+
+    JSONWriter::JSONWriter(std::string& out, unsigned indent):
+      m_out(out),
+      m_indent(indent),
+      m_depth(0)
+    { }
+
+    void
+    JSONWriter::write(const Message& msg)
+    {
+      m_out += '{';
+      m_out += '\n';
+      m_out.append(m_indent, ' ');
+      m_out += "\"abbrev\": \"";
+      m_out += msg.getName();
+      m_out += '"';
+
+      // Header fields are not subject to selection.
+      ++m_depth;
+      field("timestamp", msg.getTimeStamp());
+      field("src", msg.getSource());
+      field("src_ent", msg.getSourceEntity());
+      field("dst", msg.getDestination());
+      field("dst_ent", msg.getDestinationEntity());
+      --m_depth;
+
+      msg.writeJSONFields(*this);
+      m_out += "\n}\n";
+    }
+
+    void
+    JSONWriter::writeFields(const Message& msg)
+    {
+      msg.writeJSONFields(*this);
+    }
+
+    void
+    JSONWriter::field(const char* label, const char* value)
+    {
+      if (!begin(label))
+        return;
+
+      appendString(value, std::strlen(value));
+      m_out += '"';
+    }
+
+    void
+    JSONWriter::field(const char* label, const std::vector<char>& value)
+    {
+      if (!begin(label))
+        return;
+
+      size_t offset = m_out.size();
+      m_out.resize(offset + value.size() * 2);
+      for (size_t i = 0; i < value.size(); ++i)
+      {
+        m_out[offset + i * 2] = c_hex[(uint8_t)value[i] >> 4];
+        m_out[offset + i * 2 + 1] = c_hex[(uint8_t)value[i] & 0x0f];
+      }
+
+      m_out += '"';
+    }
+
+    void
+    JSONWriter::message(const char* label, const Message* msg)
+    {
+      if (begin(label, false))
+        object(msg);
+    }
+
+    bool
+    JSONWriter::begin(const char* label, bool quote)
+    {
+      if (m_depth == 0 && !m_fields.empty())
+      {
+        bool found = false;
+        for (size_t i = 0; i < m_fields.size(); ++i)
+        {
+          if (m_fields[i] == label)
+          {
+            found = true;
+            break;
+          }
+        }
+
+        if (!found)
+          return false;
+      }
+
+      m_out += ",\n";
+      m_out.append(m_indent, ' ');
+      m_out += '"';
+      m_out += label;
+      m_out += quote ? "\": \"" : "\": ";
+      return true;
+    }
+
+    void
+    JSONWriter::object(const Message* msg)
+    {
+      if (msg == NULL)
+      {
+        m_out += "\"null\"";
+        return;
+      }
+
+      m_out += "{\n";
+      m_out.append(m_indent + 2, ' ');
+      m_out += "\"abbrev\": \"";
+      m_out += msg->getName();
+      m_out += '"';
+
+      m_indent += 2;
+      ++m_depth;
+      msg->writeJSONFields(*this);
+      --m_depth;
+      m_indent -= 2;
+
+      m_out += '\n';
+      m_out.append(m_indent, ' ');
+      m_out += '}';
+    }
+
+    void
+    JSONWriter::appendInteger(int64_t value)
+    {
+      if (value < 0)
+      {
+        m_out += '-';
+        appendUnsigned(~(uint64_t)value + 1);
+      }
+      else
+      {
+        appendUnsigned((uint64_t)value);
+      }
+    }
+
+    void
+    JSONWriter::appendUnsigned(uint64_t value)
+    {
+      char bfr[20];
+      char* ptr = bfr + sizeof(bfr);
+
+      do
+      {
+        *--ptr = (char)('0' + value % 10);
+        value /= 10;
+      }
+      while (value != 0);
+
+      m_out.append(ptr, bfr + sizeof(bfr) - ptr);
+    }
+
+    bool
+    JSONWriter::appendIntegral(double value)
+    {
+      // Integral values below 2^53 are written exactly as integers.
+      if (!(value > -c_max_integral && value < c_max_integral))
+        return false;
+
+      int64_t integer = (int64_t)value;
+      if ((double)integer != value)
+        return false;
+
+      if (integer == 0 && std::signbit(value))
+        m_out += '-';
+
+      appendInteger(integer);
+      return true;
+    }
+
+    void
+    JSONWriter::appendFloat(float value)
+    {
+      if (appendIntegral(value))
+        return;
+
+      char bfr[32];
+      m_out.append(bfr, formatShortest(bfr, value, 6, 9, true));
+    }
+
+    void
+    JSONWriter::appendDouble(double value)
+    {
+      if (appendIntegral(value))
+        return;
+
+      char bfr[32];
+      m_out.append(bfr, formatShortest(bfr, value, 15, 17, false));
+    }
+
+    void
+    JSONWriter::appendString(const char* value, size_t size)
+    {
+      const char* begin = value;
+      const char* end = value + size;
+
+      for (const char* ptr = value; ptr != end; ++ptr)
+      {
+        uint8_t c = (uint8_t)*ptr;
+        if (c >= 0x20 && c != '"' && c != '\\')
+          continue;
+
+        m_out.append(begin, ptr - begin);
+        begin = ptr + 1;
+
+        switch (c)
+        {
+          case '"':
+            m_out += "\\\"";
+            break;
+          case '\\':
+            m_out += "\\\\";
+            break;
+          case '\n':
+            m_out += "\\n";
+            break;
+          case '\r':
+            m_out += "\\r";
+            break;
+          case '\t':
+            m_out += "\\t";
+            break;
+          default:
+            m_out += "\\u00";
+            m_out += c_hex[c >> 4];
+            m_out += c_hex[c & 0x0f];
+            break;
+        }
+      }
+
+      m_out.append(begin, end - begin);
+    }
+  }
+}
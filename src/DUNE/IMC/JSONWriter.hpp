@@ -0,0 +1,291 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_IMC_JSON_WRITER_HPP_INCLUDED_
+#define DUNE_IMC_JSON_WRITER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Forward declarations.
+    class Message;
+
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM JSONWriter;
+
+    //! Buffer based JSON encoder of IMC messages. Output is appended
+    //! to a caller supplied string, which can be reused across
+    //! messages to avoid allocations. The layout is the same as the
+    //! one of Message::toJSON(std::ostream&): one field per line and
+    //! all values quoted. Floating point values are written with the
+    //! shortest representation that reads back to the same value,
+    //! independently of the current locale.
+    class JSONWriter
+    {
+    public:
+      //! Constructor.
+      //! @param[in] out output buffer (appended to).
+      //! @param[in] indent number of indentation spaces of top level
+      //! fields.
+      JSONWriter(std::string& out, unsigned indent = 2);
+
+      //! Restrict the fields written by write() to a set of top
+      //! level fields. The header fields and the fields of nested
+      //! messages are always written.
+      //! @param[in] fields field names (empty to write all fields).
+      void
+      select(const std::vector<std::string>& fields)
+      {
+        m_fields = fields;
+      }
+
+      //! Get the output buffer.
+      //! @return output buffer.
+      std::string&
+      buffer(void)
+      {
+        return m_out;
+      }
+
+      //! Write a complete message: header and fields.
+      //! @param[in] msg message.
+      void
+      write(const Message& msg);
+
+      //! Write the fields of a message, excluding the header.
+      //! @param[in] msg message.
+      void
+      writeFields(const Message& msg);
+
+      //! Write a field.
+      //! @param[in] label field name.
+      //! @param[in] value field value.
+      void
+      field(const char* label, int8_t value)
+      {
+        if (!begin(label))
+          return;
+
+        appendInteger((int64_t)value);
+        m_out += '"';
+      }
+
+      void
+      field(const char* label, uint8_t value)
+      {
+        if (!begin(label))
+          return;
+
+        appendUnsigned(value);
+        m_out += '"';
+      }
+
+      void
+      field(const char* label, int16_t value)
+      {
+        if (!begin(label))
+          return;
+
+        appendInteger(value);
+        m_out += '"';
+      }
+
+      void
+      field(const char* label, uint16_t value)
+      {
+        if (!begin(label))
+          return;
+
+        appendUnsigned(value);
+        m_out += '"';
+      }
+
+      void
+      field(const char* label, int32_t value)
+      {
+        if (!begin(label))
+          return;
+
+        appendInteger(value);
+        m_out += '"';
+      }
+
+      void
+      field(const char* label, uint32_t value)
+      {
+        if (!begin(label))
+          return;
+
+        appendUnsigned(value);
+        m_out += '"';
+      }
+
+      void
+      field(const char* label, int64_t value)
+      {
+        if (!begin(label))
+          return;
+
+        appendInteger(value);
+        m_out += '"';
+      }
+
+      void
+      field(const char* label, uint64_t value)
+      {
+        if (!begin(label))
+          return;
+
+        appendUnsigned(value);
+        m_out += '"';
+      }
+
+      void
+      field(const char* label, float value)
+      {
+        if (!begin(label))
+          return;
+
+        appendFloat(value);
+        m_out += '"';
+      }
+
+      void
+      field(const char* label, double value)
+      {
+        if (!begin(label))
+          return;
+
+        appendDouble(value);
+        m_out += '"';
+      }
+
+      void
+      field(const char* label, const std::string& value)
+      {
+        if (!begin(label))
+          return;
+
+        appendString(value.data(), value.size());
+        m_out += '"';
+      }
+
+      //! Write a string field.
+      //! @param[in] label field name.
+      //! @param[in] value null terminated string.
+      void
+      field(const char* label, const char* value);
+
+      //! Write a raw data field as hexadecimal digits.
+      //! @param[in] label field name.
+      //! @param[in] value data.
+      void
+      field(const char* label, const std::vector<char>& value);
+
+      //! Write an inline message field.
+      //! @param[in] label field name.
+      //! @param[in] msg message (NULL if not set).
+      void
+      message(const char* label, const Message* msg);
+
+      //! Write a message list field.
+      //! @param[in] label field name.
+      //! @param[in] list messages.
+      template <typename Type>
+      void
+      list(const char* label, const std::vector<Type*>& list)
+      {
+        if (!begin(label, false))
+          return;
+
+        m_out += '[';
+        for (size_t i = 0; i < list.size(); ++i)
+        {
+          if (i > 0)
+            m_out += ',';
+          object(list[i]);
+        }
+        m_out += ']';
+      }
+
+    private:
+      //! Output buffer.
+      std::string& m_out;
+      //! Current number of indentation spaces.
+      unsigned m_indent;
+      //! Nesting depth.
+      unsigned m_depth;
+      //! Selected top level fields.
+      std::vector<std::string> m_fields;
+
+      //! Start a field: separator, indentation and label.
+      //! @param[in] label field name.
+      //! @param[in] quote true to open a quoted value.
+      //! @return false if the field is not selected.
+      bool
+      begin(const char* label, bool quote = true);
+
+      //! Write a nested message object at the current indentation.
+      //! @param[in] msg message (NULL if not set).
+      void
+      object(const Message* msg);
+
+      void
+      appendInteger(int64_t value);
+
+      void
+      appendUnsigned(uint64_t value);
+
+      //! Write a floating point value with an integral value.
+      //! @param[in] value value.
+      //! @return false if the value is not integral.
+      bool
+      appendIntegral(double value);
+
+      void
+      appendFloat(float value);
+
+      void
+      appendDouble(double value);
+
+      void
+      appendString(const char* value, size_t size);
+    };
+  }
+}
+
+#endif
@@ -28,14 +28,14 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
-#include <iomanip>
+#include <string>
 #include <cstring>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
 #include <DUNE/IMC/Message.hpp>
 #include <DUNE/IMC/Packet.hpp>
-#include <DUNE/IMC/JSON.hpp>
+#include <DUNE/IMC/JSONWriter.hpp>
 #include <DUNE/IMC/Exceptions.hpp>
 
 namespace DUNE
@@ -71,15 +71,25 @@ namespace DUNE
     void
     Message::toJSON(std::ostream& os) const
     {
-      os << std::setprecision(12);
-      IMC::toJSON(os, "abbrev", getName(), c_nindent, '{');
-      IMC::toJSON(os, "timestamp", getTimeStamp(), c_nindent);
-      IMC::toJSON(os, "src", getSource(), c_nindent);
-      IMC::toJSON(os, "src_ent", (unsigned)getSourceEntity(), c_nindent);
-      IMC::toJSON(os, "dst", getDestination(), c_nindent);
-      IMC::toJSON(os, "dst_ent", (unsigned)getDestinationEntity(), c_nindent);
-      fieldsToJSON(os, c_nindent);
-      os << "\n}\n";
+      std::string str;
+      JSONWriter writer(str, c_nindent);
+      writer.write(*this);
+      os << str;
+    }
+
+    void
+    Message::toJSON(JSONWriter& writer) const
+    {
+      writer.write(*this);
+    }
+
+    void
+    Message::fieldsToJSON(std::ostream& os, unsigned indent_level) const
+    {
+      std::string str;
+      JSONWriter writer(str, indent_level);
+      writer.writeFields(*this);
+      os << str;
     }
   }
 }
@@ -35,6 +35,8 @@
 #include <DUNE/Time/Clock.hpp>
 #include <DUNE/IMC/Constants.hpp>
 #include <DUNE/IMC/Header.hpp>
+#include <DUNE/IMC/MessagePool.hpp>
+#include <DUNE/IMC/TraceContext.hpp>
 #include <DUNE/IMC/Packet.hpp>
 #include <DUNE/IMC/AddressResolver.hpp>
 
@@ -43,6 +45,9 @@ namespace DUNE
   //! Implementation of the %IMC API
   namespace IMC
   {
+    // Forward declarations.
+    class JSONWriter;
+
     // Export symbol.
     class DUNE_DLL_SYM Message;
 
@@ -58,6 +63,8 @@ namespace DUNE
         m_header.dst = AddressResolver::invalid();
         m_header.dst_ent = DUNE_IMC_CONST_UNK_EID;
         m_header.timestamp = -1.0;
+        m_trace.trace = 0;
+        m_trace.span = 0;
       }
 
       //! Default destructor.
@@ -65,6 +72,27 @@ namespace DUNE
       ~Message(void)
       { }
 
+#if defined(DUNE_USING_MESSAGE_POOL)
+      //! Allocate message objects from the message pool.
+      //! @param[in] size object size.
+      //! @return pointer to the object.
+      static void*
+      operator new(std::size_t size)
+      {
+        return MessagePool::allocate(size);
+      }
+
+      //! Return message objects to the message pool. The destructor
+      //! is virtual, so size is the size of the most derived type.
+      //! @param[in] ptr pointer to the object.
+      //! @param[in] size object size.
+      static void
+      operator delete(void* ptr, std::size_t size)
+      {
+        MessagePool::release(ptr, size);
+      }
+#endif
+
       //! Retrieve a copy of the message.
       //! @return message copy.
       virtual Message*
@@ -186,6 +214,22 @@ namespace DUNE
         setDestinationEntityNested(dst_ent);
       }
 
+      //! Retrieve the causal trace context of the message.
+      //! @return trace context.
+      const TraceContext&
+      getTraceContext(void) const
+      {
+        return m_trace;
+      }
+
+      //! Set the causal trace context of the message.
+      //! @param[in] ctx trace context.
+      void
+      setTraceContext(const TraceContext& ctx)
+      {
+        m_trace = ctx;
+      }
+
       //! Retrieve message's sub identification number (id field).
       //! @return message's sub identification number.
       virtual uint16_t
@@ -263,6 +307,11 @@ namespace DUNE
       void
       toJSON(std::ostream& os) const;
 
+      //! Output the message in JSON format.
+      //! @param writer JSON writer.
+      void
+      toJSON(JSONWriter& writer) const;
+
       //! Output the message in human readable text.
       //! @param os output stream.
       void
@@ -291,11 +340,15 @@ namespace DUNE
       //! Output the message fields (excluding header) in JSON format.
       //! @param os output stream.
       //! @param indent_level number of indentation spaces.
+      void
+      fieldsToJSON(std::ostream& os, unsigned indent_level) const;
+
+      //! Write the message fields (excluding header) in JSON format.
+      //! @param writer JSON writer.
       virtual void
-      fieldsToJSON(std::ostream& os, unsigned indent_level) const
+      writeJSONFields(JSONWriter& writer) const
       {
-        (void)os;
-        (void)indent_level;
+        (void)writer;
       }
 
       //! Compare messages for equality.
@@ -316,6 +369,8 @@ namespace DUNE
     protected:
       //! Message header.
       Header m_header;
+      //! Trace context (not serialized).
+      TraceContext m_trace;
 
       //! Set the timestamp of nested messages.
       //! @param[in] value timestamp.
@@ -33,13 +33,14 @@
 // ISO C++ 98 headers.
 #include <cstddef>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 // DUNE headers.
 #include <DUNE/IMC/Message.hpp>
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/IMC/Serialization.hpp>
-#include <DUNE/IMC/JSON.hpp>
+#include <DUNE/IMC/JSONWriter.hpp>
 
 namespace DUNE
 {
@@ -339,29 +340,17 @@ namespace DUNE
       void
       toJSON(std::ostream& os, const char* label, unsigned nindent, char prefix = ',') const
       {
-        const char* indent = indentJSON(nindent);
-        const char* indent_next = indentJSON(nindent + 2);
-
-        os << prefix << '\n' << indent << '"' << label << "\": [";
-
-        for (unsigned i = 0; i < m_list.size(); ++i)
-        {
-          if (m_list[i] == NULL)
-          {
-            os << "\"null\"";
-          }
-          else
-          {
-            os << "{\n" << indent_next << "\"abbrev\": \"" << m_list[i]->getName() << '"';
-            m_list[i]->fieldsToJSON(os, nindent + 2);
-            os << '\n' << indent << "}";
-          }
-
-          if (i != (m_list.size() - 1))
-            os << ",";
-        }
+        std::string str;
+        JSONWriter writer(str, nindent);
+        writer.list(label, m_list);
+        str[0] = prefix;
+        os << str;
+      }
 
-        os << "]";
+      void
+      toJSON(JSONWriter& writer, const char* label) const
+      {
+        writer.list(label, m_list);
       }
 
       void
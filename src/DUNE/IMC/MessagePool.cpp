@@ -0,0 +1,312 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdlib>
+#include <new>
+#include <set>
+
+// DUNE headers.
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/TLS.hpp>
+#include <DUNE/IMC/MessagePool.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Size class granularity.
+    static const std::size_t c_granularity = 16;
+    //! Largest pooled object.
+    static const std::size_t c_max_size = 512;
+    //! Number of size classes.
+    static const unsigned c_classes = c_max_size / c_granularity;
+    //! Maximum number of free objects per thread and class.
+    static const unsigned c_cache_size = 64;
+    //! Number of objects moved between thread caches and the pool.
+    static const unsigned c_batch_size = 32;
+    //! Size of memory blocks taken from the system allocator.
+    static const std::size_t c_block_size = 8192;
+
+    //! Free object.
+    struct FreeObject
+    {
+      FreeObject* next;
+    };
+
+    //! List of free objects.
+    struct FreeList
+    {
+      FreeObject* head;
+      unsigned count;
+
+      FreeList(void):
+        head(NULL),
+        count(0)
+      { }
+
+      void
+      push(FreeObject* obj)
+      {
+        obj->next = head;
+        head = obj;
+        ++count;
+      }
+
+      FreeObject*
+      pop(void)
+      {
+        FreeObject* obj = head;
+        head = obj->next;
+        --count;
+        return obj;
+      }
+    };
+
+    struct ThreadCache;
+
+    //! Shared state of the pool.
+    struct PoolState
+    {
+      PoolState(void):
+        enabled(std::getenv("DUNE_NO_MESSAGE_POOL") == NULL),
+        retired_oversize(0)
+      { }
+
+      //! True if objects are pooled.
+      const bool enabled;
+      //! Protects the shared lists, caches and retired statistics.
+      Concurrency::Mutex mutex;
+      //! Shared free lists.
+      FreeList lists[c_classes];
+      //! Caches of running threads.
+      std::set<ThreadCache*> caches;
+      //! Statistics of exited threads.
+      MessagePool::Statistics retired[c_classes];
+      //! Oversize allocations of exited threads.
+      uint64_t retired_oversize;
+      //! Per-thread caches.
+      Concurrency::TLS<ThreadCache> tls;
+    };
+
+    //! Get the pool state. The state is never destroyed, since
+    //! messages may be released by other static destructors.
+    static PoolState&
+    getPoolState(void)
+    {
+      static PoolState* state = new PoolState;
+      return *state;
+    }
+
+    //! Per-thread cache of free objects.
+    struct ThreadCache
+    {
+      ThreadCache(void):
+        oversize(0)
+      {
+        PoolState& state = getPoolState();
+        Concurrency::ScopedMutex l(state.mutex);
+        state.caches.insert(this);
+      }
+
+      ~ThreadCache(void)
+      {
+        PoolState& state = getPoolState();
+        Concurrency::ScopedMutex l(state.mutex);
+        state.caches.erase(this);
+
+        for (unsigned i = 0; i < c_classes; ++i)
+        {
+          while (lists[i].count > 0)
+            state.lists[i].push(lists[i].pop());
+
+          state.retired[i].add(stats[i]);
+        }
+
+        state.retired_oversize += oversize;
+      }
+
+      //! Free objects.
+      FreeList lists[c_classes];
+      //! Statistics.
+      MessagePool::Statistics stats[c_classes];
+      //! Number of oversize allocations.
+      uint64_t oversize;
+    };
+
+    void
+    MessagePool::Statistics::add(const Statistics& other)
+    {
+      allocations += other.allocations;
+      hits += other.hits;
+      releases += other.releases;
+      reserved += other.reserved;
+      oversize += other.oversize;
+    }
+
+    //! Refill a thread cache from the shared lists or, if these are
+    //! empty, from a new block of system memory.
+    static void
+    refill(PoolState& state, ThreadCache& cache, unsigned index)
+    {
+      FreeList& list = cache.lists[index];
+
+      {
+        Concurrency::ScopedMutex l(state.mutex);
+        FreeList& shared = state.lists[index];
+        while (shared.count > 0 && list.count < c_batch_size)
+          list.push(shared.pop());
+      }
+
+      if (list.count > 0)
+        return;
+
+      std::size_t size = (index + 1) * c_granularity;
+      std::size_t count = c_block_size / size;
+      char* block = static_cast<char*>(::operator new(count * size));
+      for (std::size_t i = 0; i < count; ++i)
+        list.push(reinterpret_cast<FreeObject*>(block + i * size));
+
+      cache.stats[index].reserved += count;
+    }
+
+    void*
+    MessagePool::allocate(std::size_t size)
+    {
+      PoolState& state = getPoolState();
+
+      if (!state.enabled)
+        return ::operator new(size);
+
+      if (size > c_max_size || size == 0)
+      {
+        ++state.tls.value().oversize;
+        return ::operator new(size);
+      }
+
+      unsigned index = (size - 1) / c_granularity;
+      ThreadCache& cache = state.tls.value();
+      MessagePool::Statistics& stats = cache.stats[index];
+      ++stats.allocations;
+
+      if (cache.lists[index].count > 0)
+        ++stats.hits;
+      else
+        refill(state, cache, index);
+
+      return cache.lists[index].pop();
+    }
+
+    void
+    MessagePool::release(void* ptr, std::size_t size)
+    {
+      if (ptr == NULL)
+        return;
+
+      PoolState& state = getPoolState();
+
+      if (!state.enabled || size > c_max_size || size == 0)
+      {
+        ::operator delete(ptr);
+        return;
+      }
+
+      unsigned index = (size - 1) / c_granularity;
+      ThreadCache& cache = state.tls.value();
+      FreeList& list = cache.lists[index];
+      ++cache.stats[index].releases;
+      list.push(static_cast<FreeObject*>(ptr));
+
+      if (list.count <= c_cache_size)
+        return;
+
+      // Give a batch back, so objects released by consumer threads
+      // flow to producer threads.
+      Concurrency::ScopedMutex l(state.mutex);
+      FreeList& shared = state.lists[index];
+      while (list.count > c_cache_size - c_batch_size)
+        shared.push(list.pop());
+    }
+
+    bool
+    MessagePool::isEnabled(void)
+    {
+      return getPoolState().enabled;
+    }
+
+    unsigned
+    MessagePool::getClassCount(void)
+    {
+      return c_classes;
+    }
+
+    std::size_t
+    MessagePool::getClassSize(unsigned index)
+    {
+      return (index + 1) * c_granularity;
+    }
+
+    void
+    MessagePool::getStatistics(unsigned index, Statistics& stats)
+    {
+      stats = Statistics();
+      if (index >= c_classes)
+        return;
+
+      PoolState& state = getPoolState();
+      Concurrency::ScopedMutex l(state.mutex);
+      stats.add(state.retired[index]);
+
+      std::set<ThreadCache*>::const_iterator itr = state.caches.begin();
+      for (; itr != state.caches.end(); ++itr)
+        stats.add((*itr)->stats[index]);
+    }
+
+    void
+    MessagePool::getStatistics(Statistics& stats)
+    {
+      stats = Statistics();
+      for (unsigned i = 0; i < c_classes; ++i)
+      {
+        Statistics tmp;
+        getStatistics(i, tmp);
+        stats.add(tmp);
+      }
+
+      PoolState& state = getPoolState();
+      Concurrency::ScopedMutex l(state.mutex);
+      stats.oversize = state.retired_oversize;
+
+      std::set<ThreadCache*>::const_iterator itr = state.caches.begin();
+      for (; itr != state.caches.end(); ++itr)
+        stats.oversize += (*itr)->oversize;
+    }
+  }
+}
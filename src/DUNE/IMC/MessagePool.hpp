@@ -0,0 +1,137 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_IMC_MESSAGE_POOL_HPP_INCLUDED_
+#define DUNE_IMC_MESSAGE_POOL_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM MessagePool;
+
+    //! Size-class allocator for IMC message objects.
+    //!
+    //! Message objects are grouped in size classes of 16 bytes, up to
+    //! 512 bytes. Each thread keeps a small cache of free objects per
+    //! class, so allocating and releasing messages does not take any
+    //! lock nor call the system allocator. Caches exchange objects with
+    //! a shared pool in batches when they run empty or grow too large,
+    //! and return all their objects to it when the thread exits.
+    //! Objects taken from the system allocator are never returned to
+    //! it, so the pool keeps the memory of its high-water mark.
+    //!
+    //! Larger objects use the system allocator. Setting the environment
+    //! variable DUNE_NO_MESSAGE_POOL disables the pool for the whole
+    //! process, which is useful with memory debugging tools.
+    class MessagePool
+    {
+    public:
+      //! Allocation statistics.
+      struct Statistics
+      {
+        //! Number of allocations.
+        uint64_t allocations;
+        //! Number of allocations served by a thread cache.
+        uint64_t hits;
+        //! Number of releases.
+        uint64_t releases;
+        //! Number of objects taken from the system allocator. This is
+        //! the high-water mark of the pool, in objects.
+        uint64_t reserved;
+        //! Number of allocations larger than the largest class, only
+        //! counted in the totals of all classes.
+        uint64_t oversize;
+
+        Statistics(void):
+          allocations(0),
+          hits(0),
+          releases(0),
+          reserved(0),
+          oversize(0)
+        { }
+
+        //! Accumulate the counters of other statistics.
+        //! @param[in] other statistics.
+        void
+        add(const Statistics& other);
+      };
+
+      //! Allocate an object.
+      //! @param[in] size object size.
+      //! @return pointer to the object.
+      static void*
+      allocate(std::size_t size);
+
+      //! Release an object.
+      //! @param[in] ptr pointer to the object.
+      //! @param[in] size object size, as given to allocate().
+      static void
+      release(void* ptr, std::size_t size);
+
+      //! Test if objects are being pooled.
+      //! @return true if the pool is enabled, false if all objects
+      //! come from the system allocator.
+      static bool
+      isEnabled(void);
+
+      //! Get the number of size classes.
+      //! @return number of size classes.
+      static unsigned
+      getClassCount(void);
+
+      //! Get the object size of a size class.
+      //! @param[in] index class index.
+      //! @return object size in bytes.
+      static std::size_t
+      getClassSize(unsigned index);
+
+      //! Get the statistics of a size class. Counters of running
+      //! threads are read without synchronization and may lag behind.
+      //! @param[in] index class index.
+      //! @param[out] stats statistics.
+      static void
+      getStatistics(unsigned index, Statistics& stats);
+
+      //! Get the statistics of all size classes.
+      //! @param[out] stats statistics.
+      static void
+      getStatistics(Statistics& stats);
+    };
+  }
+}
+
+#endif
@@ -39,5 +39,7 @@ namespace DUNE
 
 #include <DUNE/IO/Handle.hpp>
 #include <DUNE/IO/Poll.hpp>
+#include <DUNE/IO/Capture.hpp>
+#include <DUNE/IO/RecordingHandle.hpp>
 
 #endif
@@ -0,0 +1,140 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Utils/ByteCopy.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/FileSystem/Exceptions.hpp>
+#include <DUNE/IO/Capture.hpp>
+
+namespace DUNE
+{
+  namespace IO
+  {
+    //! Capture file signature.
+    static const char c_capture_signature[] = "DUNECAP1";
+    //! Signature size.
+    static const size_t c_capture_signature_size = 8;
+    //! Record header size.
+    static const size_t c_capture_header_size = 13;
+
+    CaptureWriter::CaptureWriter(const std::string& path)
+    {
+      m_bytes[0] = 0;
+      m_bytes[1] = 0;
+
+      m_file = std::fopen(path.c_str(), "wb");
+      if (m_file == NULL)
+        throw FileSystem::FileWriteError(path);
+
+      std::fwrite(c_capture_signature, 1, c_capture_signature_size, m_file);
+    }
+
+    CaptureWriter::~CaptureWriter(void)
+    {
+      std::fclose(m_file);
+    }
+
+    void
+    CaptureWriter::write(CaptureRecord::Direction direction, const uint8_t* data, size_t size)
+    {
+      if (size == 0)
+        return;
+
+      uint8_t hdr[c_capture_header_size];
+      Utils::ByteCopy::toLE(Time::Clock::getSinceEpoch(), hdr);
+      hdr[8] = static_cast<uint8_t>(direction);
+      Utils::ByteCopy::toLE(static_cast<uint32_t>(size), hdr + 9);
+
+      Concurrency::ScopedMutex l(m_lock);
+      std::fwrite(hdr, 1, sizeof(hdr), m_file);
+      std::fwrite(data, 1, size, m_file);
+      std::fflush(m_file);
+      m_bytes[direction] += size;
+    }
+
+    uint64_t
+    CaptureWriter::getBytes(CaptureRecord::Direction direction)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      return m_bytes[direction];
+    }
+
+    CaptureReader::CaptureReader(const std::string& path):
+      m_path(path)
+    {
+      m_file = std::fopen(path.c_str(), "rb");
+      if (m_file == NULL)
+        throw FileSystem::FileReadError(path);
+
+      char signature[c_capture_signature_size];
+      if (std::fread(signature, 1, sizeof(signature), m_file) != sizeof(signature)
+          || std::memcmp(signature, c_capture_signature, sizeof(signature)) != 0)
+      {
+        std::fclose(m_file);
+        throw FileSystem::FileReadError(path, "not a device capture file");
+      }
+    }
+
+    CaptureReader::~CaptureReader(void)
+    {
+      std::fclose(m_file);
+    }
+
+    bool
+    CaptureReader::read(CaptureRecord& record)
+    {
+      uint8_t hdr[c_capture_header_size];
+      if (std::fread(hdr, 1, sizeof(hdr), m_file) != sizeof(hdr))
+        return false;
+
+      uint32_t size = 0;
+      Utils::ByteCopy::fromLE(record.time, hdr);
+      record.direction = (hdr[8] == CaptureRecord::DIR_OUTPUT)
+      ? CaptureRecord::DIR_OUTPUT : CaptureRecord::DIR_INPUT;
+      Utils::ByteCopy::fromLE(size, hdr + 9);
+
+      record.data.resize(size);
+      if (size == 0)
+        return true;
+
+      return std::fread(&record.data[0], 1, size, m_file) == size;
+    }
+
+    void
+    CaptureReader::rewind(void)
+    {
+      std::fseek(m_file, c_capture_signature_size, SEEK_SET);
+    }
+  }
+}
@@ -0,0 +1,154 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_IO_CAPTURE_HPP_INCLUDED_
+#define DUNE_IO_CAPTURE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace IO
+  {
+    // Export DLL Symbol.
+    struct DUNE_DLL_SYM CaptureRecord;
+    class DUNE_DLL_SYM CaptureWriter;
+    class DUNE_DLL_SYM CaptureReader;
+
+    //! Chunk of raw data exchanged with a device. A capture file
+    //! starts with an 8-byte signature followed by records stored
+    //! as: time (fp64_t, seconds since the Unix Epoch), direction
+    //! (uint8_t), size (uint32_t) and data. Numbers are
+    //! little-endian.
+    struct CaptureRecord
+    {
+      //! Data direction.
+      enum Direction
+      {
+        //! Data read from the device.
+        DIR_INPUT = 0,
+        //! Data written to the device.
+        DIR_OUTPUT = 1
+      };
+
+      //! Time of transfer (seconds since the Unix Epoch).
+      double time;
+      //! Data direction.
+      Direction direction;
+      //! Data.
+      std::vector<uint8_t> data;
+    };
+
+    //! Writer of raw device stream capture files. Records can be
+    //! written from multiple threads.
+    class CaptureWriter
+    {
+    public:
+      //! Create a capture file.
+      //! @param[in] path file name.
+      CaptureWriter(const std::string& path);
+
+      //! Destructor.
+      ~CaptureWriter(void);
+
+      //! Append a record timestamped with the current time.
+      //! @param[in] direction data direction.
+      //! @param[in] data data.
+      //! @param[in] size number of bytes.
+      void
+      write(CaptureRecord::Direction direction, const uint8_t* data, size_t size);
+
+      //! Get number of bytes captured in a direction.
+      //! @param[in] direction data direction.
+      //! @return number of bytes.
+      uint64_t
+      getBytes(CaptureRecord::Direction direction);
+
+    private:
+      //! Capture file.
+      std::FILE* m_file;
+      //! Bytes captured in each direction.
+      uint64_t m_bytes[2];
+      //! Lock serializing writes.
+      Concurrency::Mutex m_lock;
+
+      // Non-copyable.
+      CaptureWriter(const CaptureWriter&);
+
+      // Non-assignable.
+      CaptureWriter&
+      operator=(const CaptureWriter&);
+    };
+
+    //! Reader of raw device stream capture files.
+    class CaptureReader
+    {
+    public:
+      //! Open a capture file.
+      //! @param[in] path file name.
+      CaptureReader(const std::string& path);
+
+      //! Destructor.
+      ~CaptureReader(void);
+
+      //! Read next record.
+      //! @param[out] record record.
+      //! @return true if a record was read, false at the end of the
+      //! file (a truncated trailing record is ignored).
+      bool
+      read(CaptureRecord& record);
+
+      //! Go back to the first record.
+      void
+      rewind(void);
+
+    private:
+      //! Capture file.
+      std::FILE* m_file;
+      //! File name.
+      std::string m_path;
+
+      // Non-copyable.
+      CaptureReader(const CaptureReader&);
+
+      // Non-assignable.
+      CaptureReader&
+      operator=(const CaptureReader&);
+    };
+  }
+}
+
+#endif
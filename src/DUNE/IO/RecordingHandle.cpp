@@ -0,0 +1,87 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/IO/RecordingHandle.hpp>
+
+namespace DUNE
+{
+  namespace IO
+  {
+    RecordingHandle::RecordingHandle(Handle* handle, const std::string& path):
+      m_handle(handle),
+      m_writer(path)
+    { }
+
+    RecordingHandle::~RecordingHandle(void)
+    {
+      delete m_handle;
+    }
+
+    NativeHandle
+    RecordingHandle::doGetNative(void) const
+    {
+      return m_handle->getNative();
+    }
+
+    size_t
+    RecordingHandle::doWrite(const uint8_t* data, size_t data_size)
+    {
+      size_t rv = m_handle->write(data, data_size);
+      m_writer.write(CaptureRecord::DIR_OUTPUT, data, rv);
+      return rv;
+    }
+
+    size_t
+    RecordingHandle::doRead(uint8_t* data, size_t data_size)
+    {
+      size_t rv = m_handle->read(data, data_size);
+      m_writer.write(CaptureRecord::DIR_INPUT, data, rv);
+      return rv;
+    }
+
+    void
+    RecordingHandle::doFlushInput(void)
+    {
+      m_handle->flushInput();
+    }
+
+    void
+    RecordingHandle::doFlushOutput(void)
+    {
+      m_handle->flushOutput();
+    }
+
+    void
+    RecordingHandle::doFlush(void)
+    {
+      m_handle->flush();
+    }
+  }
+}
@@ -24,94 +24,75 @@
 // https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
 // http://ec.europa.eu/idabc/eupl.html.                                     *
 //***************************************************************************
-// Author: Eduardo Marques                                                  *
+// Author: Ricardo Martins                                                  *
 //***************************************************************************
 
-#ifndef SIMULATORS_ENVIRONMENT_QUAD_TREE_HPP_INCLUDED_
-#define SIMULATORS_ENVIRONMENT_QUAD_TREE_HPP_INCLUDED_
+#ifndef DUNE_IO_RECORDING_HANDLE_HPP_INCLUDED_
+#define DUNE_IO_RECORDING_HANDLE_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
-#include <iomanip>
-#include <iostream>
-#include <vector>
+#include <string>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/IO/Handle.hpp>
+#include <DUNE/IO/Capture.hpp>
 
-// Local headers.
-#include "Point.hpp"
-#include "Bounds.hpp"
-
-namespace Simulators
+namespace DUNE
 {
-  namespace Environment
+  namespace IO
   {
-    //! Forward declaration.
-    struct Node;
-
-    //! "Quad-tree" structure used to index spatial data in two dimensions.
-    class QuadTree
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM RecordingHandle;
+
+    //! I/O handle that forwards all operations to another handle and
+    //! records every chunk of data read or written, with its
+    //! timestamp, to a capture file. Polling uses the native handle
+    //! of the wrapped handle.
+    class RecordingHandle: public Handle
     {
     public:
-      //! Item datum.
-      struct Item
-      {
-        double x, y, value;
-      };
-
-      //! Iteration handle.
-      class Iteration
+      //! Constructor.
+      //! @param[in] handle wrapped handle (ownership is taken).
+      //! @param[in] path capture file name.
+      RecordingHandle(Handle* handle, const std::string& path);
+
+      //! Destructor. Deletes the wrapped handle.
+      ~RecordingHandle(void);
+
+      //! Get number of bytes recorded in a direction.
+      //! @param[in] direction data direction.
+      //! @return number of bytes.
+      uint64_t
+      getBytes(CaptureRecord::Direction direction)
       {
-      public:
-        virtual void
-        process(const Item& item) = 0;
-
-        virtual
-        ~Iteration(){ }
-      };
+        return m_writer.getBytes(direction);
+      }
 
-      //! Constructor.
-      QuadTree(const Bounds& bounds);
+    private:
+      //! Wrapped handle.
+      Handle* m_handle;
+      //! Capture writer.
+      CaptureWriter m_writer;
 
-      ~QuadTree();
+      NativeHandle
+      doGetNative(void) const;
 
-      //! Insert an item.
-      //! Returns 'false' if item is out-of-bounds.
-      bool
-      insert(const Item& item);
+      size_t
+      doWrite(const uint8_t* data, size_t data_size);
 
-      //! Iterate tree.
-      void
-      iterate(Iteration& iteration) const;
+      size_t
+      doRead(uint8_t* data, size_t data_size);
 
-      //! Iterate tree over a given area.
       void
-      iterate(Iteration& iteration, const Bounds& area) const;
+      doFlushInput(void);
 
-      //! Clear entire tree.
       void
-      clear(void);
+      doFlushOutput(void);
 
-      //! Remove items in a given area.
       void
-      remove(const Bounds& area);
-
-      //! Search for items in a given area.
-      //! If any are found returns 'true' and adds results to 'item' vector.
-      bool
-      search(const Bounds& area, std::vector<Item>& items) const;
-
-      //! Get number of elements in a given area.
-      uint32_t
-      size(const Bounds& area) const;
-
-    private:
-      Bounds m_bounds;     //!< Bounds.
-      Node* m_root;     //!< Node handle providing actual implementation.
+      doFlush(void);
     };
-
-    std::ostream&
-    operator<<(std::ostream& os, const QuadTree& tree);
   }
 }
 
@@ -156,6 +156,21 @@ namespace DUNE
         }
       }
 
+      template <typename M, typename T>
+      void
+      bind(T* task_obj, const IMC::DeliveryFilter& filter, bool always = false)
+      {
+        if (always)
+        {
+          Task::bind<M>(task_obj, filter);
+        }
+        else
+        {
+          void (Maneuver::* func)(const M*) = &Maneuver::consumeIfActive<M, T>;
+          Task::bind<M>(this, filter, func);
+        }
+      }
+
       //! Consumer for StopManeuver message.
       //! @param sm message to consume.
       void
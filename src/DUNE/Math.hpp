@@ -50,6 +50,7 @@ namespace DUNE
 #include <DUNE/Math/MovingAverage.hpp>
 #include <DUNE/Math/MultiMovingAverage.hpp>
 #include <DUNE/Math/Grid.hpp>
+#include <DUNE/Math/TiledGridData.hpp>
 #include <DUNE/Math/FIRFilter.hpp>
 
 #endif
@@ -0,0 +1,320 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Miguel Aguiar                                                    *
+//***************************************************************************
+
+#ifndef DUNE_MATH_TILED_GRID_DATA_HPP_INCLUDED_
+#define DUNE_MATH_TILED_GRID_DATA_HPP_INCLUDED_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <list>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "DUNE/Math/Grid.hpp"
+
+namespace DUNE
+{
+  namespace Math
+  {
+    //! Values defined on the points of a Grid, stored in rectangular
+    //! tiles that are loaded on demand.
+    //! Tiles are kept in a least-recently-used cache whose size is bounded
+    //! by a memory budget, so that datasets much larger than the available
+    //! memory can be sampled.
+    //! @tparam dim number of dimensions.
+    //! @tparam T value type.
+    template<size_t dim, typename T = double>
+    class TiledGridData
+    {
+    public:
+      //! Indices of a gridpoint, or number of gridpoints along each
+      //! dimension.
+      using Index = std::array<size_t, dim>;
+
+      //! Function used to load a tile.
+      //! The first argument holds the indices of the first gridpoint of the
+      //! tile, the second holds the number of gridpoints along each dimension
+      //! and the third must be filled with the values in row-major order.
+      using Loader = std::function<void(Index const&, Index const&, std::vector<T>&)>;
+
+      //! Cache statistics.
+      struct Statistics
+      {
+        //! Number of accesses served from memory.
+        size_t hits;
+        //! Number of accesses that required loading a tile.
+        size_t misses;
+        //! Number of tiles evicted from the cache.
+        size_t evictions;
+        //! Amount of memory currently used by tiles (bytes).
+        size_t resident;
+        //! Maximum amount of memory used by tiles (bytes).
+        size_t peak;
+      };
+
+      //! Constructor.
+      //! @param[in] grid grid where the values are defined.
+      //! @param[in] tile_shape number of gridpoints of a tile along each
+      //! dimension.
+      //! @param[in] budget maximum amount of memory used by tiles (bytes). At
+      //! least one tile is always kept in memory.
+      //! @param[in] loader function used to load a tile.
+      TiledGridData(Grid<dim> const& grid,
+                    Index const& tile_shape,
+                    size_t budget,
+                    Loader loader);
+
+      //! Get the value at a gridpoint, loading the corresponding tile if
+      //! needed.
+      //! @param[in] indices indices of the gridpoint.
+      //! @return value at the gridpoint.
+      T
+      at(Index const& indices);
+
+      //! Multilinear interpolation of the values at the vertices of the grid
+      //! cell that contains a point.
+      //! @param[in] coordinates coordinates of a point in dim-dimensional
+      //! space.
+      //! @param[out] value interpolated value.
+      //! @return true if the point lies inside the grid, false otherwise.
+      bool
+      interpolate(std::array<double, dim> const& coordinates, T& value);
+
+      //! @return grid where the values are defined.
+      Grid<dim> const&
+      getGrid() const
+      {
+        return m_grid;
+      }
+
+      //! @return cache statistics.
+      Statistics const&
+      getStatistics() const
+      {
+        return m_stats;
+      }
+
+      //! Drop all tiles from memory.
+      void
+      clear()
+      {
+        m_lru.clear();
+        m_tiles.clear();
+        m_stats.resident = 0;
+      }
+
+    private:
+      //! A tile held in memory.
+      struct Tile
+      {
+        //! Row-major offset of the tile.
+        size_t key;
+        //! Number of gridpoints along each dimension.
+        Index count;
+        //! Values in row-major order.
+        std::vector<T> data;
+      };
+
+      //! Grid where the values are defined.
+      Grid<dim> m_grid;
+      //! Number of gridpoints of a full tile along each dimension.
+      Index m_shape;
+      //! Number of tiles along each dimension.
+      Index m_ntiles;
+      //! Memory budget (bytes).
+      size_t m_budget;
+      //! Tile loader.
+      Loader m_loader;
+      //! Tiles in memory, most recently used first.
+      std::list<Tile> m_lru;
+      //! Tiles in memory, indexed by key.
+      std::unordered_map<size_t, typename std::list<Tile>::iterator> m_tiles;
+      //! Cache statistics.
+      Statistics m_stats;
+
+      //! Get a tile, loading it if needed.
+      //! @param[in] indices indices of a gridpoint inside the tile.
+      //! @return tile.
+      Tile&
+      fetch(Index const& indices);
+    };
+
+    template<size_t dim, typename T>
+    TiledGridData<dim, T>::TiledGridData(Grid<dim> const& grid,
+                                         Index const& tile_shape,
+                                         size_t budget,
+                                         Loader loader)
+        : m_grid(grid),
+          m_shape(tile_shape),
+          m_budget(budget),
+          m_loader(loader),
+          m_stats()
+    {
+      for (size_t i = 0; i < dim; ++i)
+      {
+        if (m_shape[i] == 0)
+          throw std::runtime_error(
+              "TiledGridData::TiledGridData(): invalid tile shape.");
+
+        m_ntiles[i] = (m_grid.getDimensions(i) + m_shape[i] - 1) / m_shape[i];
+      }
+    }
+
+    template<size_t dim, typename T>
+    typename TiledGridData<dim, T>::Tile&
+    TiledGridData<dim, T>::fetch(Index const& indices)
+    {
+      Index first;
+      Index count;
+      size_t key = 0;
+
+      for (size_t i = 0; i < dim; ++i)
+      {
+        if (indices[i] >= m_grid.getDimensions(i))
+          throw std::runtime_error("TiledGridData::fetch(): out of bounds.");
+
+        size_t tile = indices[i] / m_shape[i];
+        key = key * m_ntiles[i] + tile;
+        first[i] = tile * m_shape[i];
+        count[i] = std::min(m_shape[i], m_grid.getDimensions(i) - first[i]);
+      }
+
+      // Most recently used tile.
+      if (!m_lru.empty() && m_lru.front().key == key)
+      {
+        ++m_stats.hits;
+        return m_lru.front();
+      }
+
+      auto itr = m_tiles.find(key);
+      if (itr != m_tiles.end())
+      {
+        ++m_stats.hits;
+        m_lru.splice(m_lru.begin(), m_lru, itr->second);
+        return m_lru.front();
+      }
+
+      ++m_stats.misses;
+
+      size_t size = sizeof(T);
+      for (size_t i = 0; i < dim; ++i)
+        size *= count[i];
+
+      while (!m_lru.empty() && m_stats.resident + size > m_budget)
+      {
+        m_stats.resident -= m_lru.back().data.size() * sizeof(T);
+        m_tiles.erase(m_lru.back().key);
+        m_lru.pop_back();
+        ++m_stats.evictions;
+      }
+
+      m_lru.push_front(Tile{key, count, std::vector<T>()});
+      m_loader(first, count, m_lru.front().data);
+
+      if (m_lru.front().data.size() * sizeof(T) != size)
+      {
+        m_lru.pop_front();
+        throw std::runtime_error("TiledGridData::fetch(): invalid tile size.");
+      }
+
+      m_tiles[key] = m_lru.begin();
+      m_stats.resident += size;
+      m_stats.peak = std::max(m_stats.peak, m_stats.resident);
+
+      return m_lru.front();
+    }
+
+    template<size_t dim, typename T>
+    T
+    TiledGridData<dim, T>::at(Index const& indices)
+    {
+      Tile& tile = fetch(indices);
+
+      size_t offset = 0;
+      for (size_t i = 0; i < dim; ++i)
+        offset = offset * tile.count[i] + indices[i] % m_shape[i];
+
+      return tile.data[offset];
+    }
+
+    template<size_t dim, typename T>
+    bool
+    TiledGridData<dim, T>::interpolate(std::array<double, dim> const& coordinates,
+                                       T& value)
+    {
+      Index corner = m_grid.getCorner(coordinates);
+      std::array<double, dim> delta;
+
+      for (size_t i = 0; i < dim; ++i)
+      {
+        if (corner[i] >= m_grid.getDimensions(i))
+          return false;
+
+        // Points on the upper boundary belong to the last cell.
+        if (corner[i] == m_grid.getDimensions(i) - 1)
+          --corner[i];
+
+        double lower = m_grid.getLower(i) + corner[i] * m_grid.getSpacing(i);
+        delta[i] = (coordinates[i] - lower) / m_grid.getSpacing(i);
+      }
+
+      T result = T();
+
+      for (size_t vertex = 0; vertex < (1u << dim); ++vertex)
+      {
+        Index point = corner;
+        double weight = 1.0;
+
+        for (size_t i = 0; i < dim; ++i)
+        {
+          if (vertex & (1u << i))
+          {
+            ++point[i];
+            weight *= delta[i];
+          }
+          else
+          {
+            weight *= 1.0 - delta[i];
+          }
+        }
+
+        if (weight != 0.0)
+          result += weight * at(point);
+      }
+
+      value = result;
+      return true;
+    }
+  }    // namespace Math
+}    // namespace DUNE
+
+#endif
@@ -40,6 +40,9 @@ namespace DUNE
 #include <DUNE/Media/VideoCapture.hpp>
 #include <DUNE/Media/VideoIIDC1394.hpp>
 #include <DUNE/Media/BayerDecoder.hpp>
+#include <DUNE/Media/Exif.hpp>
+#include <DUNE/Media/FramePool.hpp>
+#include <DUNE/Media/FramePipeline.hpp>
 #include <DUNE/Media/MJPG/Encoder.hpp>
 
 #endif
@@ -29,15 +29,625 @@
 // Based on libdc1394.                                                      *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cstring>
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/Config.hpp>
 #include <DUNE/Media/BayerDecoder.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+
+// SIMD headers.
+#if defined(__SSE2__) || defined(_M_X64)
+#  include <emmintrin.h>
+#  define DUNE_MEDIA_BAYER_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  include <arm_neon.h>
+#  define DUNE_MEDIA_BAYER_NEON
+#endif
 
 namespace DUNE
 {
   namespace Media
   {
-    BayerDecoder::BayerDecoder(Tile tile, Method method)
+    // The vectorized kernels are written once, as templates over the
+    // lane type, and instantiated both for eight 16-bit lanes and for
+    // a single int (used for the pixels that do not fill a vector at
+    // the right edge of each row). All intermediate values fit in 16
+    // bits, so both instantiations produce the same results as the
+    // reference implementation.
+
+    //! Mask selecting the lanes with the given parity.
+    static const int16_t c_bayer_masks[2][8] =
+    {
+      {-1, 0, -1, 0, -1, 0, -1, 0},
+      {0, -1, 0, -1, 0, -1, 0, -1}
+    };
+
+#if defined(DUNE_MEDIA_BAYER_SSE2)
+    //! Eight signed 16-bit lanes.
+    typedef __m128i BayerLanes;
+
+    static inline void
+    bayerLoad(const uint8_t* p, BayerLanes& out)
+    {
+      out = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)p), _mm_setzero_si128());
+    }
+
+    static inline void
+    bayerStore(uint8_t* p, BayerLanes a)
+    {
+      _mm_storel_epi64((__m128i*)p, _mm_packus_epi16(a, a));
+    }
+
+    static inline void
+    bayerSet(int value, BayerLanes& out)
+    {
+      out = _mm_set1_epi16((int16_t)value);
+    }
+
+    static inline void
+    bayerMask(int parity, BayerLanes& out)
+    {
+      out = _mm_loadu_si128((const __m128i*)c_bayer_masks[parity]);
+    }
+
+    static inline BayerLanes
+    bayerAdd(BayerLanes a, BayerLanes b)
+    {
+      return _mm_add_epi16(a, b);
+    }
+
+    static inline BayerLanes
+    bayerSub(BayerLanes a, BayerLanes b)
+    {
+      return _mm_sub_epi16(a, b);
+    }
+
+    static inline BayerLanes
+    bayerMul(BayerLanes a, int value)
+    {
+      return _mm_mullo_epi16(a, _mm_set1_epi16((int16_t)value));
+    }
+
+    static inline BayerLanes
+    bayerShl(BayerLanes a, int n)
+    {
+      return _mm_slli_epi16(a, n);
+    }
+
+    static inline BayerLanes
+    bayerSra(BayerLanes a, int n)
+    {
+      return _mm_srai_epi16(a, n);
+    }
+
+    static inline BayerLanes
+    bayerSrl(BayerLanes a, int n)
+    {
+      return _mm_srli_epi16(a, n);
+    }
+
+    static inline BayerLanes
+    bayerSelect(BayerLanes mask, BayerLanes a, BayerLanes b)
+    {
+      return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+
+#elif defined(DUNE_MEDIA_BAYER_NEON)
+    //! Eight signed 16-bit lanes.
+    typedef int16x8_t BayerLanes;
+
+    static inline void
+    bayerLoad(const uint8_t* p, BayerLanes& out)
+    {
+      out = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(p)));
+    }
+
+    static inline void
+    bayerStore(uint8_t* p, BayerLanes a)
+    {
+      vst1_u8(p, vqmovun_s16(a));
+    }
+
+    static inline void
+    bayerSet(int value, BayerLanes& out)
+    {
+      out = vdupq_n_s16((int16_t)value);
+    }
+
+    static inline void
+    bayerMask(int parity, BayerLanes& out)
+    {
+      out = vld1q_s16(c_bayer_masks[parity]);
+    }
+
+    static inline BayerLanes
+    bayerAdd(BayerLanes a, BayerLanes b)
+    {
+      return vaddq_s16(a, b);
+    }
+
+    static inline BayerLanes
+    bayerSub(BayerLanes a, BayerLanes b)
+    {
+      return vsubq_s16(a, b);
+    }
+
+    static inline BayerLanes
+    bayerMul(BayerLanes a, int value)
+    {
+      return vmulq_n_s16(a, (int16_t)value);
+    }
+
+    static inline BayerLanes
+    bayerShl(BayerLanes a, int n)
+    {
+      return vshlq_s16(a, vdupq_n_s16((int16_t)n));
+    }
+
+    static inline BayerLanes
+    bayerSra(BayerLanes a, int n)
+    {
+      return vshlq_s16(a, vdupq_n_s16((int16_t)-n));
+    }
+
+    static inline BayerLanes
+    bayerSrl(BayerLanes a, int n)
+    {
+      return vreinterpretq_s16_u16(vshlq_u16(vreinterpretq_u16_s16(a), vdupq_n_s16((int16_t)-n)));
+    }
+
+    static inline BayerLanes
+    bayerSelect(BayerLanes mask, BayerLanes a, BayerLanes b)
+    {
+      return vbslq_s16(vreinterpretq_u16_s16(mask), a, b);
+    }
+
+#else
+    //! Eight signed 16-bit lanes.
+    struct BayerLanes
+    {
+      int16_t v[8];
+    };
+
+    static inline void
+    bayerLoad(const uint8_t* p, BayerLanes& out)
+    {
+      for (unsigned i = 0; i < 8; ++i)
+        out.v[i] = p[i];
+    }
+
+    static inline void
+    bayerStore(uint8_t* p, BayerLanes a)
+    {
+      for (unsigned i = 0; i < 8; ++i)
+        p[i] = (a.v[i] < 0) ? 0 : ((a.v[i] > 255) ? 255 : a.v[i]);
+    }
+
+    static inline void
+    bayerSet(int value, BayerLanes& out)
+    {
+      for (unsigned i = 0; i < 8; ++i)
+        out.v[i] = (int16_t)value;
+    }
+
+    static inline void
+    bayerMask(int parity, BayerLanes& out)
+    {
+      std::memcpy(out.v, c_bayer_masks[parity], sizeof(out.v));
+    }
+
+    static inline BayerLanes
+    bayerAdd(BayerLanes a, BayerLanes b)
+    {
+      for (unsigned i = 0; i < 8; ++i)
+        a.v[i] = (int16_t)(a.v[i] + b.v[i]);
+      return a;
+    }
+
+    static inline BayerLanes
+    bayerSub(BayerLanes a, BayerLanes b)
+    {
+      for (unsigned i = 0; i < 8; ++i)
+        a.v[i] = (int16_t)(a.v[i] - b.v[i]);
+      return a;
+    }
+
+    static inline BayerLanes
+    bayerMul(BayerLanes a, int value)
+    {
+      for (unsigned i = 0; i < 8; ++i)
+        a.v[i] = (int16_t)(a.v[i] * value);
+      return a;
+    }
+
+    static inline BayerLanes
+    bayerShl(BayerLanes a, int n)
+    {
+      for (unsigned i = 0; i < 8; ++i)
+        a.v[i] = (int16_t)(a.v[i] << n);
+      return a;
+    }
+
+    static inline BayerLanes
+    bayerSra(BayerLanes a, int n)
+    {
+      for (unsigned i = 0; i < 8; ++i)
+        a.v[i] = (int16_t)(a.v[i] >> n);
+      return a;
+    }
+
+    static inline BayerLanes
+    bayerSrl(BayerLanes a, int n)
+    {
+      for (unsigned i = 0; i < 8; ++i)
+        a.v[i] = (int16_t)((uint16_t)a.v[i] >> n);
+      return a;
+    }
+
+    static inline BayerLanes
+    bayerSelect(BayerLanes mask, BayerLanes a, BayerLanes b)
+    {
+      for (unsigned i = 0; i < 8; ++i)
+        a.v[i] = (int16_t)((mask.v[i] & a.v[i]) | (~mask.v[i] & b.v[i]));
+      return a;
+    }
+#endif
+
+    // Single lane versions.
+
+    static inline void
+    bayerLoad(const uint8_t* p, int& out)
+    {
+      out = *p;
+    }
+
+    static inline void
+    bayerStore(uint8_t* p, int a)
+    {
+      *p = (a < 0) ? 0 : ((a > 255) ? 255 : a);
+    }
+
+    static inline void
+    bayerSet(int value, int& out)
+    {
+      out = value;
+    }
+
+    static inline int
+    bayerAdd(int a, int b)
+    {
+      return a + b;
+    }
+
+    static inline int
+    bayerSub(int a, int b)
+    {
+      return a - b;
+    }
+
+    static inline int
+    bayerMul(int a, int value)
+    {
+      return a * value;
+    }
+
+    static inline int
+    bayerShl(int a, int n)
+    {
+      return a << n;
+    }
+
+    static inline int
+    bayerSra(int a, int n)
+    {
+      return a >> n;
+    }
+
+    static inline int
+    bayerSrl(int a, int n)
+    {
+      return (int)((unsigned)a >> n);
+    }
+
+    static inline int
+    bayerSelect(int mask, int a, int b)
+    {
+      return (mask & a) | (~mask & b);
+    }
+
+    //! Nearest neighbor kernel. 'P' is the non-green color of the
+    //! current row and 'Q' the non-green color of the next row. The
+    //! mask selects green pixels.
+    struct BayerNearestKernel
+    {
+      const uint8_t* c;
+      const uint8_t* d;
+
+      template <typename V>
+      void
+      operator()(int x, V m, uint8_t* p, uint8_t* g, uint8_t* q) const
+      {
+        V cc, r1, d1, dr;
+        bayerLoad(c + x, cc);
+        bayerLoad(c + x + 1, r1);
+        bayerLoad(d + x, d1);
+        bayerLoad(d + x + 1, dr);
+
+        bayerStore(p + x, bayerSelect(m, r1, cc));
+        bayerStore(g + x, bayerSelect(m, dr, r1));
+        bayerStore(q + x, bayerSelect(m, d1, dr));
+      }
+    };
+
+    //! Bilinear interpolation kernel.
+    struct BayerBilinearKernel
+    {
+      const uint8_t* u;
+      const uint8_t* c;
+      const uint8_t* d;
+
+      template <typename V>
+      void
+      operator()(int x, V m, uint8_t* p, uint8_t* g, uint8_t* q) const
+      {
+        V cc, l1, r1, u1, d1, ul, ur, dl, dr, one, two;
+        bayerLoad(c + x, cc);
+        bayerLoad(c + x - 1, l1);
+        bayerLoad(c + x + 1, r1);
+        bayerLoad(u + x, u1);
+        bayerLoad(d + x, d1);
+        bayerLoad(u + x - 1, ul);
+        bayerLoad(u + x + 1, ur);
+        bayerLoad(d + x - 1, dl);
+        bayerLoad(d + x + 1, dr);
+        bayerSet(1, one);
+        bayerSet(2, two);
+
+        V h2 = bayerSra(bayerAdd(bayerAdd(l1, r1), one), 1);
+        V v2 = bayerSra(bayerAdd(bayerAdd(u1, d1), one), 1);
+        V x4 = bayerSra(bayerAdd(bayerAdd(bayerAdd(l1, r1), bayerAdd(u1, d1)), two), 2);
+        V d4 = bayerSra(bayerAdd(bayerAdd(bayerAdd(ul, ur), bayerAdd(dl, dr)), two), 2);
+
+        bayerStore(p + x, bayerSelect(m, h2, cc));
+        bayerStore(g + x, bayerSelect(m, cc, x4));
+        bayerStore(q + x, bayerSelect(m, v2, d4));
+      }
+    };
+
+    //! High-quality linear interpolation kernel.
+    struct BayerHQLinearKernel
+    {
+      const uint8_t* uu;
+      const uint8_t* u;
+      const uint8_t* c;
+      const uint8_t* d;
+      const uint8_t* dd;
+
+      template <typename V>
+      void
+      operator()(int x, V m, uint8_t* p, uint8_t* g, uint8_t* q) const
+      {
+        V cc, l1, r1, l2, r2, u1, d1, u2, d2, ul, ur, dl, dr, one, four;
+        bayerLoad(c + x, cc);
+        bayerLoad(c + x - 1, l1);
+        bayerLoad(c + x + 1, r1);
+        bayerLoad(c + x - 2, l2);
+        bayerLoad(c + x + 2, r2);
+        bayerLoad(u + x, u1);
+        bayerLoad(d + x, d1);
+        bayerLoad(uu + x, u2);
+        bayerLoad(dd + x, d2);
+        bayerLoad(u + x - 1, ul);
+        bayerLoad(u + x + 1, ur);
+        bayerLoad(d + x - 1, dl);
+        bayerLoad(d + x + 1, dr);
+        bayerSet(1, one);
+        bayerSet(4, four);
+
+        V diag = bayerAdd(bayerAdd(ul, ur), bayerAdd(dl, dr));
+        V far_h = bayerAdd(l2, r2);
+        V far_v = bayerAdd(u2, d2);
+        V far = bayerAdd(far_h, far_v);
+        V cross = bayerAdd(bayerAdd(l1, r1), bayerAdd(u1, d1));
+        V c5 = bayerAdd(bayerShl(cc, 2), cc);
+
+        // Green pixel: horizontal and vertical neighbor colors.
+        V th = bayerAdd(c5, bayerShl(bayerAdd(l1, r1), 2));
+        th = bayerSub(bayerSub(th, far_h), diag);
+        th = bayerAdd(th, bayerSra(bayerAdd(far_v, one), 1));
+
+        V tv = bayerAdd(c5, bayerShl(bayerAdd(u1, d1), 2));
+        tv = bayerSub(bayerSub(tv, far_v), diag);
+        tv = bayerAdd(tv, bayerSra(bayerAdd(far_h, one), 1));
+
+        // Non-green pixel: diagonal color and green.
+        V td = bayerShl(diag, 1);
+        td = bayerSub(td, bayerSra(bayerAdd(bayerAdd(far, bayerShl(far, 1)), one), 1));
+        td = bayerAdd(td, bayerAdd(bayerShl(cc, 2), bayerShl(cc, 1)));
+
+        V tg = bayerSub(bayerShl(cross, 1), far);
+        tg = bayerAdd(tg, bayerShl(cc, 2));
+
+        th = bayerSra(bayerAdd(th, four), 3);
+        tv = bayerSra(bayerAdd(tv, four), 3);
+        td = bayerSra(bayerAdd(td, four), 3);
+        tg = bayerSra(bayerAdd(tg, four), 3);
+
+        bayerStore(p + x, bayerSelect(m, th, cc));
+        bayerStore(g + x, bayerSelect(m, cc, tg));
+        bayerStore(q + x, bayerSelect(m, tv, td));
+      }
+    };
+
+    //! Apply a kernel to the pixels [x0, x1) of a row.
+    //! @param[in] kernel kernel.
+    //! @param[in] x0 first column.
+    //! @param[in] x1 one past the last column.
+    //! @param[in] gx parity of the green pixels of the row.
+    //! @param[out] p line of the non-green color of the row.
+    //! @param[out] g green line.
+    //! @param[out] q line of the non-green color of adjacent rows.
+    template <typename Kernel>
+    static void
+    bayerApply(const Kernel& kernel, int x0, int x1, int gx, uint8_t* p, uint8_t* g, uint8_t* q)
+    {
+      int x = x0;
+
+      for (; x + 8 <= x1; x += 8)
+      {
+        BayerLanes m;
+        bayerMask(gx ^ (x & 1), m);
+        kernel(x, m, p, g, q);
+      }
+
+      for (; x < x1; ++x)
+        kernel(x, ((x & 1) == gx) ? -1 : 0, p, g, q);
+    }
+
+    //! Interleave planar red, green and blue lines into RGB24.
+    static void
+    bayerInterleave(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* dst, int sx)
+    {
+      int x = 0;
+
+#if defined(DUNE_MEDIA_BAYER_SSE2)
+      // Build RGBX pixels and squeeze each pair into six bytes. Every
+      // store writes two bytes past its pixels, which are overwritten
+      // by the next store, so a pixel must always follow.
+      const __m128i zero = _mm_setzero_si128();
+      const __m128i lo = _mm_set_epi32(0, 0x00ffffff, 0, 0x00ffffff);
+      const __m128i hi = _mm_set_epi32(0x00ffffff, 0, 0x00ffffff, 0);
+
+      for (; x + 9 <= sx; x += 8)
+      {
+        __m128i rg = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(r + x)),
+                                       _mm_loadl_epi64((const __m128i*)(g + x)));
+        __m128i bz = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(b + x)), zero);
+        __m128i p0 = _mm_unpacklo_epi16(rg, bz);
+        __m128i p1 = _mm_unpackhi_epi16(rg, bz);
+        p0 = _mm_or_si128(_mm_and_si128(p0, lo), _mm_srli_epi64(_mm_and_si128(p0, hi), 8));
+        p1 = _mm_or_si128(_mm_and_si128(p1, lo), _mm_srli_epi64(_mm_and_si128(p1, hi), 8));
+
+        uint8_t* out = dst + x * 3;
+        _mm_storel_epi64((__m128i*)out, p0);
+        _mm_storel_epi64((__m128i*)(out + 6), _mm_srli_si128(p0, 8));
+        _mm_storel_epi64((__m128i*)(out + 12), p1);
+        _mm_storel_epi64((__m128i*)(out + 18), _mm_srli_si128(p1, 8));
+      }
+#elif defined(DUNE_MEDIA_BAYER_NEON)
+      for (; x + 8 <= sx; x += 8)
+      {
+        uint8x8x3_t px;
+        px.val[0] = vld1_u8(r + x);
+        px.val[1] = vld1_u8(g + x);
+        px.val[2] = vld1_u8(b + x);
+        vst3_u8(dst + x * 3, px);
+      }
+#endif
+
+      for (; x < sx; ++x)
+      {
+        dst[x * 3 + 0] = r[x];
+        dst[x * 3 + 1] = g[x];
+        dst[x * 3 + 2] = b[x];
+      }
+    }
+
+    //! Compute luma.
+    template <typename V>
+    static inline void
+    bayerLuma(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* y, int x)
+    {
+      V rr, gg, bb, half;
+      bayerLoad(r + x, rr);
+      bayerLoad(g + x, gg);
+      bayerLoad(b + x, bb);
+      bayerSet(128, half);
+
+      // The weighted sum may exceed 32767, hence the logical shift.
+      V t = bayerAdd(bayerAdd(bayerMul(rr, 77), bayerMul(gg, 150)),
+                     bayerAdd(bayerMul(bb, 29), half));
+      bayerStore(y + x, bayerSrl(t, 8));
+    }
+
+    //! Compute blue-difference chroma.
+    static inline uint8_t
+    bayerCb(int r, int g, int b)
+    {
+      int t = ((-43 * r - 85 * g + 128 * b + 128) >> 8) + 128;
+      return (t > 255) ? 255 : (uint8_t)t;
+    }
+
+    //! Compute red-difference chroma.
+    static inline uint8_t
+    bayerCr(int r, int g, int b)
+    {
+      int t = ((128 * r - 107 * g - 21 * b + 128) >> 8) + 128;
+      return (t > 255) ? 255 : (uint8_t)t;
+    }
+
+    //! Compute one row of chroma from two rows of planar RGB.
+    static void
+    bayerChroma(const uint8_t* r0, const uint8_t* g0, const uint8_t* b0,
+                const uint8_t* r1, const uint8_t* g1, const uint8_t* b1,
+                int sx, uint8_t* u, uint8_t* v)
+    {
+      for (int x = 0; x < sx; x += 2)
+      {
+        int n = (x + 1 < sx) ? x + 1 : x;
+        int r = (r0[x] + r0[n] + r1[x] + r1[n] + 2) >> 2;
+        int g = (g0[x] + g0[n] + g1[x] + g1[n] + 2) >> 2;
+        int b = (b0[x] + b0[n] + b1[x] + b1[n] + 2) >> 2;
+        u[x / 2] = bayerCb(r, g, b);
+        v[x / 2] = bayerCr(r, g, b);
+      }
+    }
+
+    struct BayerDecoder::Band
+    {
+      //! Bayer mosaic.
+      const uint8_t* bayer;
+      //! RGB24 output or NULL for YUV 4:2:0 output.
+      uint8_t* rgb;
+      //! Y, Cb and Cr output planes.
+      uint8_t* y;
+      uint8_t* u;
+      uint8_t* v;
+      //! Image dimensions.
+      int sx;
+      int sy;
+      //! First and one past the last row of the band.
+      int row0;
+      int row1;
+    };
+
+    class BayerDecoder::BandWorker: public Concurrency::Thread
+    {
+    public:
+      BandWorker(const BayerDecoder& decoder, const Band& band):
+        m_decoder(decoder),
+        m_band(band)
+      { }
+
+    private:
+      //! Decoder.
+      const BayerDecoder& m_decoder;
+      //! Band to decode.
+      Band m_band;
+
+      void
+      run(void)
+      {
+        m_decoder.decodeBand(m_band);
+      }
+    };
+
+    BayerDecoder::BayerDecoder(Tile tile, Method method):
+      m_vectorized(true),
+      m_threads(1)
     {
       m_blue_line = (tile == TILE_BGGR || tile == TILE_GBRG) ? -1 : 1;
       m_start_with_green = (tile == TILE_GBRG || tile == TILE_GRBG);
@@ -47,6 +657,8 @@ namespace DUNE
     void
     BayerDecoder::setMethod(Method method)
     {
+      m_method = method;
+
       switch (method)
       {
         case METHOD_NEAREST:
@@ -56,11 +668,252 @@ namespace DUNE
           m_decoder = &BayerDecoder::decodeHQLinear;
           break;
         default:
+          m_method = METHOD_BILINEAR;
           m_decoder = &BayerDecoder::decodeBilinear;
           break;
       }
     }
 
+    void
+    BayerDecoder::setVectorized(bool enabled)
+    {
+      m_vectorized = enabled;
+    }
+
+    void
+    BayerDecoder::setThreads(unsigned count)
+    {
+      m_threads = (count < 1) ? 1 : count;
+    }
+
+    bool
+    BayerDecoder::hasSIMD(void)
+    {
+#if defined(DUNE_MEDIA_BAYER_SSE2) || defined(DUNE_MEDIA_BAYER_NEON)
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    void
+    BayerDecoder::decodeToRGB24(const uint8_t* bayer, uint8_t* rgb, int width, int height) const
+    {
+      if (!m_vectorized)
+      {
+        ((*this).*(m_decoder))(bayer, rgb, width, height);
+        return;
+      }
+
+      Band band = {bayer, rgb, NULL, NULL, NULL, width, height, 0, height};
+      decodeBands(band);
+    }
+
+    void
+    BayerDecoder::decodeToYUV420(const uint8_t* bayer, uint8_t* y, uint8_t* u, uint8_t* v,
+                                 int width, int height) const
+    {
+      if (!m_vectorized)
+      {
+        m_scratch.resize(width * height * 3);
+        ((*this).*(m_decoder))(bayer, &m_scratch[0], width, height);
+        convertRGB24ToYUV420(&m_scratch[0], y, u, v, width, height);
+        return;
+      }
+
+      Band band = {bayer, NULL, y, u, v, width, height, 0, height};
+      decodeBands(band);
+    }
+
+    void
+    BayerDecoder::convertRGB24ToYUV420(const uint8_t* rgb, uint8_t* y, uint8_t* u, uint8_t* v,
+                                       int width, int height)
+    {
+      for (int i = 0; i < width * height; ++i)
+      {
+        const uint8_t* px = rgb + i * 3;
+        y[i] = (77 * px[0] + 150 * px[1] + 29 * px[2] + 128) >> 8;
+      }
+
+      int cw = (width + 1) / 2;
+      for (int row = 0; row < height; row += 2)
+      {
+        const uint8_t* l0 = rgb + row * width * 3;
+        const uint8_t* l1 = (row + 1 < height) ? l0 + width * 3 : l0;
+
+        for (int x = 0; x < width; x += 2)
+        {
+          int n = ((x + 1 < width) ? x + 1 : x) * 3;
+          int c = x * 3;
+          int r = (l0[c + 0] + l0[n + 0] + l1[c + 0] + l1[n + 0] + 2) >> 2;
+          int g = (l0[c + 1] + l0[n + 1] + l1[c + 1] + l1[n + 1] + 2) >> 2;
+          int b = (l0[c + 2] + l0[n + 2] + l1[c + 2] + l1[n + 2] + 2) >> 2;
+          u[(row / 2) * cw + x / 2] = bayerCb(r, g, b);
+          v[(row / 2) * cw + x / 2] = bayerCr(r, g, b);
+        }
+      }
+    }
+
+    void
+    BayerDecoder::decodeBands(const Band& band) const
+    {
+      // Bands always start on even rows so that each one owns whole
+      // chroma rows.
+      int pairs = (band.sy + 1) / 2;
+      int count = ((int)m_threads < pairs) ? (int)m_threads : pairs;
+
+      if (count <= 1)
+      {
+        decodeBand(band);
+        return;
+      }
+
+      std::vector<BandWorker*> workers;
+      Band first = band;
+
+      for (int i = 0; i < count; ++i)
+      {
+        Band part = band;
+        part.row0 = 2 * ((pairs * i) / count);
+        part.row1 = 2 * ((pairs * (i + 1)) / count);
+        if (part.row1 > band.sy)
+          part.row1 = band.sy;
+
+        if (i == 0)
+        {
+          first = part;
+          continue;
+        }
+
+        BandWorker* worker = new BandWorker(*this, part);
+        worker->start();
+        workers.push_back(worker);
+      }
+
+      decodeBand(first);
+
+      for (size_t i = 0; i < workers.size(); ++i)
+      {
+        workers[i]->join();
+        delete workers[i];
+      }
+    }
+
+    void
+    BayerDecoder::decodeBand(const Band& band) const
+    {
+      const int sx = band.sx;
+      std::vector<uint8_t> lines(sx * 6);
+      uint8_t* r0 = &lines[0];
+      uint8_t* g0 = r0 + sx;
+      uint8_t* b0 = g0 + sx;
+      uint8_t* r1 = b0 + sx;
+      uint8_t* g1 = r1 + sx;
+      uint8_t* b1 = g1 + sx;
+
+      if (band.rgb != NULL)
+      {
+        for (int row = band.row0; row < band.row1; ++row)
+        {
+          decodeRow(band.bayer, sx, band.sy, row, r0, g0, b0);
+
+          bayerInterleave(r0, g0, b0, band.rgb + row * sx * 3, sx);
+        }
+
+        return;
+      }
+
+      const int cw = (sx + 1) / 2;
+      for (int row = band.row0; row < band.row1; row += 2)
+      {
+        decodeRow(band.bayer, sx, band.sy, row, r0, g0, b0);
+
+        int x = 0;
+        uint8_t* y = band.y + row * sx;
+        for (; x + 8 <= sx; x += 8)
+          bayerLuma<BayerLanes>(r0, g0, b0, y, x);
+        for (; x < sx; ++x)
+          bayerLuma<int>(r0, g0, b0, y, x);
+
+        if (row + 1 < band.sy)
+        {
+          decodeRow(band.bayer, sx, band.sy, row + 1, r1, g1, b1);
+
+          y += sx;
+          for (x = 0; x + 8 <= sx; x += 8)
+            bayerLuma<BayerLanes>(r1, g1, b1, y, x);
+          for (; x < sx; ++x)
+            bayerLuma<int>(r1, g1, b1, y, x);
+
+          bayerChroma(r0, g0, b0, r1, g1, b1, sx,
+                      band.u + (row / 2) * cw, band.v + (row / 2) * cw);
+        }
+        else
+        {
+          bayerChroma(r0, g0, b0, r0, g0, b0, sx,
+                      band.u + (row / 2) * cw, band.v + (row / 2) * cw);
+        }
+      }
+    }
+
+    void
+    BayerDecoder::decodeRow(const uint8_t* bayer, int sx, int sy, int row,
+                            uint8_t* r, uint8_t* g, uint8_t* b) const
+    {
+      // Border widths must match the reference implementation:
+      // nearest neighbor clears the last row and column, the
+      // interpolating methods clear one or two pixels on every side.
+      int lo = 0;
+      int hi = 1;
+      if (m_method == METHOD_BILINEAR)
+        lo = hi = 1;
+      else if (m_method == METHOD_HQLINEAR)
+        lo = hi = 2;
+
+      if (row < lo || row >= sy - hi || sx - hi <= lo)
+      {
+        std::memset(r, 0, sx);
+        std::memset(g, 0, sx);
+        std::memset(b, 0, sx);
+        return;
+      }
+
+      for (int x = 0; x < lo; ++x)
+        r[x] = g[x] = b[x] = 0;
+      for (int x = sx - hi; x < sx; ++x)
+        r[x] = g[x] = b[x] = 0;
+
+      int gx = (m_start_with_green != ((row & 1) != 0)) ? 0 : 1;
+      bool blue_row = (m_blue_line < 0) != ((row & 1) != 0);
+      uint8_t* p = blue_row ? b : r;
+      uint8_t* q = blue_row ? r : b;
+      const uint8_t* c = bayer + row * sx;
+
+      switch (m_method)
+      {
+        case METHOD_NEAREST:
+          {
+            BayerNearestKernel kernel = {c, c + sx};
+            bayerApply(kernel, lo, sx - hi, gx, p, g, q);
+          }
+          break;
+
+        case METHOD_HQLINEAR:
+          {
+            BayerHQLinearKernel kernel = {c - 2 * sx, c - sx, c, c + sx, c + 2 * sx};
+            bayerApply(kernel, lo, sx - hi, gx, p, g, q);
+          }
+          break;
+
+        default:
+          {
+            BayerBilinearKernel kernel = {c - sx, c, c + sx};
+            bayerApply(kernel, lo, sx - hi, gx, p, g, q);
+          }
+          break;
+      }
+    }
+
     void
     BayerDecoder::decodeNearest(const uint8_t* bayer, uint8_t* rgb, int sx, int sy) const
     {
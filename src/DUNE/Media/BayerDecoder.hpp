@@ -30,6 +30,9 @@
 #ifndef DUNE_MEDIA_BAYER_DECODER_HPP_INCLUDED_
 #define DUNE_MEDIA_BAYER_DECODER_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/Config.hpp>
 
@@ -37,7 +40,17 @@ namespace DUNE
 {
   namespace Media
   {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM BayerDecoder;
+
     //! Bayer decoder (demosaicing).
+    //!
+    //! Besides the reference per-pixel implementations, every method
+    //! has a vectorized kernel (SSE2 or NEON when available, portable
+    //! eight-lane code otherwise) that produces bit-identical output
+    //! and that can split the image in row bands decoded by several
+    //! threads. The same kernels also feed a fused Bayer to planar
+    //! YUV 4:2:0 conversion, suitable for JPEGCompressor::compressYUV420.
     class BayerDecoder
     {
     public:
@@ -75,18 +88,61 @@ namespace DUNE
       void
       setMethod(Method method);
 
+      //! Select between the vectorized kernels (default) and the
+      //! reference per-pixel implementation.
+      //! @param[in] enabled true to use the vectorized kernels.
+      void
+      setVectorized(bool enabled);
+
+      //! Set the number of threads used by the vectorized kernels.
+      //! Each thread decodes a contiguous band of rows; the calling
+      //! thread decodes the first band.
+      //! @param[in] count number of threads (at least one).
+      void
+      setThreads(unsigned count);
+
+      //! Check if the vectorized kernels use SIMD instructions.
+      //! @return true if SSE2 or NEON are available, false otherwise.
+      static bool
+      hasSIMD(void);
+
       //! Convert Bayer mosaic to RGB24.
       //! @param[in] bayer bayer mosaic.
       //! @param[out] rgb RGB24 image.
       //! @param[in] width width of bayer mosaic.
       //! @param[in] height height of bayer mosaic.
       void
-      decodeToRGB24(const uint8_t* bayer, uint8_t* rgb, int width, int height) const
-      {
-        ((*this).*(m_decoder))(bayer, rgb, width, height);
-      }
+      decodeToRGB24(const uint8_t* bayer, uint8_t* rgb, int width, int height) const;
+
+      //! Convert Bayer mosaic to planar YUV 4:2:0 (full range BT.601,
+      //! chroma sampled at the center of each 2x2 block).
+      //! @param[in] bayer bayer mosaic.
+      //! @param[out] y luma plane (width x height).
+      //! @param[out] u Cb plane ((width + 1) / 2 x (height + 1) / 2).
+      //! @param[out] v Cr plane ((width + 1) / 2 x (height + 1) / 2).
+      //! @param[in] width width of bayer mosaic.
+      //! @param[in] height height of bayer mosaic.
+      void
+      decodeToYUV420(const uint8_t* bayer, uint8_t* y, uint8_t* u, uint8_t* v,
+                     int width, int height) const;
+
+      //! Convert an RGB24 image to planar YUV 4:2:0 using the same
+      //! coefficients as decodeToYUV420().
+      //! @param[in] rgb RGB24 image.
+      //! @param[out] y luma plane.
+      //! @param[out] u Cb plane.
+      //! @param[out] v Cr plane.
+      //! @param[in] width image width.
+      //! @param[in] height image height.
+      static void
+      convertRGB24ToYUV420(const uint8_t* rgb, uint8_t* y, uint8_t* u, uint8_t* v,
+                           int width, int height);
 
     private:
+      //! Band decoding job.
+      struct Band;
+      //! Band decoding thread.
+      class BandWorker;
       //! Type of decoder functions.
       typedef void (BayerDecoder::*Decoder)(const uint8_t*, uint8_t*, int, int) const;
       //! Pointer to decoder.
@@ -94,6 +150,37 @@ namespace DUNE
       //! True if tile starts with a green pixel.
       bool m_start_with_green;
       int m_blue_line;
+      //! Decoding method.
+      Method m_method;
+      //! True to use vectorized kernels.
+      bool m_vectorized;
+      //! Number of decoding threads.
+      unsigned m_threads;
+      //! Scratch RGB24 image used by the reference YUV 4:2:0 path.
+      mutable std::vector<uint8_t> m_scratch;
+
+      //! Decode a band of rows using the vectorized kernels.
+      //! @param[in] band band decoding job.
+      void
+      decodeBand(const Band& band) const;
+
+      //! Decode one row to planar red, green and blue lines using the
+      //! vectorized kernels. Border pixels are set to zero.
+      //! @param[in] bayer bayer mosaic.
+      //! @param[in] sx width of bayer mosaic.
+      //! @param[in] sy height of bayer mosaic.
+      //! @param[in] row row index.
+      //! @param[out] r red line.
+      //! @param[out] g green line.
+      //! @param[out] b blue line.
+      void
+      decodeRow(const uint8_t* bayer, int sx, int sy, int row,
+                uint8_t* r, uint8_t* g, uint8_t* b) const;
+
+      //! Run the vectorized kernels over the whole image.
+      //! @param[in] band band decoding job covering the image.
+      void
+      decodeBands(const Band& band) const;
 
       //! Convert Bayer mosaic to RGB24 using the nearest neighbor method.
       //! @param[in] bayer bayer mosaic.
@@ -0,0 +1,376 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstring>
+#include <ctime>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Media/Exif.hpp>
+#include <DUNE/Math/Angles.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    //! TIFF field types.
+    enum ExifType
+    {
+      EXIF_BYTE = 1,
+      EXIF_ASCII = 2,
+      EXIF_SHORT = 3,
+      EXIF_LONG = 4,
+      EXIF_RATIONAL = 5,
+      EXIF_UNDEFINED = 7
+    };
+
+    //! APP1 identifier followed by a little endian TIFF header whose
+    //! first IFD starts right after it.
+    static const uint8_t c_exif_header[] =
+    {
+      'E', 'x', 'i', 'f', 0, 0, 'I', 'I', 0x2a, 0x00, 0x08, 0x00, 0x00, 0x00
+    };
+
+    //! Image File Directory entry.
+    struct ExifEntry
+    {
+      //! Tag.
+      uint16_t tag;
+      //! Field type.
+      uint16_t type;
+      //! Number of values.
+      uint32_t count;
+      //! Value bytes (little endian).
+      std::vector<uint8_t> value;
+    };
+
+    //! Image File Directory.
+    class ExifDirectory
+    {
+    public:
+      //! Add ASCII entry, if not empty.
+      void
+      addString(uint16_t tag, const std::string& str)
+      {
+        if (str.empty())
+          return;
+
+        ExifEntry& e = add(tag, EXIF_ASCII, str.size() + 1);
+        e.value.assign(str.begin(), str.end());
+        e.value.push_back(0);
+      }
+
+      //! Add undefined (opaque bytes) entry.
+      void
+      addBytes(uint16_t tag, uint16_t type, const std::string& bytes)
+      {
+        ExifEntry& e = add(tag, type, bytes.size());
+        e.value.assign(bytes.begin(), bytes.end());
+      }
+
+      //! Add LONG entry.
+      void
+      addLong(uint16_t tag, uint32_t value)
+      {
+        ExifEntry& e = add(tag, EXIF_LONG, 1);
+        putLong(e.value, value);
+      }
+
+      //! Add RATIONAL entries.
+      void
+      addRationals(uint16_t tag, const uint32_t* values, unsigned count)
+      {
+        ExifEntry& e = add(tag, EXIF_RATIONAL, count);
+        for (unsigned i = 0; i < count * 2; ++i)
+          putLong(e.value, values[i]);
+      }
+
+      //! Check if directory has no entries.
+      bool
+      empty(void) const
+      {
+        return m_entries.empty();
+      }
+
+      //! Size of the serialized directory.
+      uint32_t
+      size(void) const
+      {
+        uint32_t total = 2 + 12 * m_entries.size() + 4;
+        for (size_t i = 0; i < m_entries.size(); ++i)
+        {
+          if (m_entries[i].value.size() > 4)
+            total += (m_entries[i].value.size() + 1) & ~1u;
+        }
+
+        return total;
+      }
+
+      //! Set the value of a LONG entry.
+      void
+      setLong(uint16_t tag, uint32_t value)
+      {
+        for (size_t i = 0; i < m_entries.size(); ++i)
+        {
+          if (m_entries[i].tag == tag)
+          {
+            m_entries[i].value.clear();
+            putLong(m_entries[i].value, value);
+          }
+        }
+      }
+
+      //! Serialize directory.
+      //! @param[out] out output buffer (TIFF header starts at 'base').
+      //! @param[in] base offset of the TIFF header in 'out'.
+      void
+      write(std::vector<uint8_t>& out, size_t base) const
+      {
+        size_t start = out.size() - base;
+        uint32_t data = start + 2 + 12 * m_entries.size() + 4;
+
+        putShort(out, m_entries.size());
+        for (size_t i = 0; i < m_entries.size(); ++i)
+        {
+          const ExifEntry& e = m_entries[i];
+          putShort(out, e.tag);
+          putShort(out, e.type);
+          putLong(out, e.count);
+
+          if (e.value.size() > 4)
+          {
+            putLong(out, data);
+            data += (e.value.size() + 1) & ~1u;
+          }
+          else
+          {
+            out.insert(out.end(), e.value.begin(), e.value.end());
+            out.insert(out.end(), 4 - e.value.size(), 0);
+          }
+        }
+
+        // No next IFD.
+        putLong(out, 0);
+
+        for (size_t i = 0; i < m_entries.size(); ++i)
+        {
+          const ExifEntry& e = m_entries[i];
+          if (e.value.size() <= 4)
+            continue;
+
+          out.insert(out.end(), e.value.begin(), e.value.end());
+          if (e.value.size() & 1)
+            out.push_back(0);
+        }
+      }
+
+    private:
+      //! Entries, sorted by tag.
+      std::vector<ExifEntry> m_entries;
+
+      ExifEntry&
+      add(uint16_t tag, uint16_t type, uint32_t count)
+      {
+        std::vector<ExifEntry>::iterator itr = m_entries.begin();
+        while (itr != m_entries.end() && itr->tag < tag)
+          ++itr;
+
+        itr = m_entries.insert(itr, ExifEntry());
+        itr->tag = tag;
+        itr->type = type;
+        itr->count = count;
+        return *itr;
+      }
+
+      static void
+      putShort(std::vector<uint8_t>& out, uint16_t value)
+      {
+        out.push_back(value & 0xff);
+        out.push_back(value >> 8);
+      }
+
+      static void
+      putLong(std::vector<uint8_t>& out, uint32_t value)
+      {
+        for (unsigned i = 0; i < 4; ++i)
+          out.push_back((value >> (8 * i)) & 0xff);
+      }
+    };
+
+    //! Convert angle to degrees, minutes and seconds rationals.
+    static void
+    exifToDMS(double angle, uint32_t* values)
+    {
+      double deg = std::fabs(Math::Angles::degrees(angle));
+      double min = (deg - std::floor(deg)) * 60.0;
+      double sec = (min - std::floor(min)) * 60.0;
+
+      values[0] = (uint32_t)std::floor(deg);
+      values[1] = 1;
+      values[2] = (uint32_t)std::floor(min);
+      values[3] = 1;
+      values[4] = (uint32_t)(sec * 1e6);
+      values[5] = 1000000;
+    }
+
+    Exif::Exif(void)
+    {
+      clear();
+    }
+
+    void
+    Exif::clear(void)
+    {
+      m_make.clear();
+      m_model.clear();
+      m_lens_make.clear();
+      m_lens_model.clear();
+      m_artist.clear();
+      m_copyright.clear();
+      m_comment.clear();
+      m_time.clear();
+      m_has_position = false;
+      m_lat = 0;
+      m_lon = 0;
+      m_height = 0;
+    }
+
+    void
+    Exif::setCamera(const std::string& make, const std::string& model)
+    {
+      m_make = make;
+      m_model = model;
+    }
+
+    void
+    Exif::setLens(const std::string& make, const std::string& model)
+    {
+      m_lens_make = make;
+      m_lens_model = model;
+    }
+
+    void
+    Exif::setAuthor(const std::string& artist, const std::string& copyright)
+    {
+      m_artist = artist;
+      m_copyright = copyright;
+    }
+
+    void
+    Exif::setComment(const std::string& comment)
+    {
+      m_comment = comment;
+    }
+
+    void
+    Exif::setTime(double time)
+    {
+      std::time_t t = static_cast<std::time_t>(time);
+
+#if defined(DUNE_SYS_HAS_GMTIME_R)
+      std::tm tm_bfr = {0};
+      std::tm* tmp = gmtime_r(&t, &tm_bfr);
+#else
+      std::tm* tmp = std::gmtime(&t);
+#endif
+
+      char bfr[32];
+      if (tmp == 0 || std::strftime(bfr, sizeof(bfr), "%Y:%m:%d %H:%M:%S", tmp) == 0)
+      {
+        m_time.clear();
+        return;
+      }
+
+      m_time = bfr;
+    }
+
+    void
+    Exif::setPosition(double lat, double lon, double height)
+    {
+      m_has_position = true;
+      m_lat = lat;
+      m_lon = lon;
+      m_height = height;
+    }
+
+    void
+    Exif::build(std::vector<uint8_t>& data) const
+    {
+      // Tags from the Exif 2.3 specification.
+      ExifDirectory ifd0;
+      ifd0.addString(0x010f, m_make);
+      ifd0.addString(0x0110, m_model);
+      ifd0.addString(0x0132, m_time);
+      ifd0.addString(0x013b, m_artist);
+      ifd0.addString(0x8298, m_copyright);
+      ifd0.addLong(0x8769, 0);
+      if (m_has_position)
+        ifd0.addLong(0x8825, 0);
+
+      ExifDirectory exif;
+      exif.addBytes(0x9000, EXIF_UNDEFINED, "0230");
+      exif.addString(0x9003, m_time);
+      exif.addString(0x9004, m_time);
+      if (!m_comment.empty())
+        exif.addBytes(0x9286, EXIF_UNDEFINED, std::string("ASCII\0\0\0", 8) + m_comment);
+      exif.addString(0xa433, m_lens_make);
+      exif.addString(0xa434, m_lens_model);
+
+      ExifDirectory gps;
+      if (m_has_position)
+      {
+        uint32_t dms[6];
+        gps.addBytes(0x0000, EXIF_BYTE, std::string("\x02\x03\x00\x00", 4));
+        gps.addString(0x0001, m_lat < 0 ? "S" : "N");
+        exifToDMS(m_lat, dms);
+        gps.addRationals(0x0002, dms, 3);
+        gps.addString(0x0003, m_lon < 0 ? "W" : "E");
+        exifToDMS(m_lon, dms);
+        gps.addRationals(0x0004, dms, 3);
+        gps.addBytes(0x0005, EXIF_BYTE, std::string(1, m_height < 0 ? '\x01' : '\x00'));
+        uint32_t alt[2] = {(uint32_t)(std::fabs(m_height) * 1000.0), 1000};
+        gps.addRationals(0x0006, alt, 1);
+      }
+
+      // Offsets are relative to the TIFF header, which takes 8 bytes.
+      uint32_t exif_offset = 8 + ifd0.size();
+      ifd0.setLong(0x8769, exif_offset);
+      if (m_has_position)
+        ifd0.setLong(0x8825, exif_offset + exif.size());
+
+      data.assign(c_exif_header, c_exif_header + sizeof(c_exif_header));
+      ifd0.write(data, 6);
+      exif.write(data, 6);
+      if (m_has_position)
+        gps.write(data, 6);
+    }
+  }
+}
@@ -0,0 +1,132 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_MEDIA_EXIF_HPP_INCLUDED_
+#define DUNE_MEDIA_EXIF_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Exif;
+
+    //! Builder of Exif metadata segments (APP1 payloads) for JPEG
+    //! images. The segment is generated in memory and can be handed
+    //! to JPEGCompressor::setExif() so that images are written to disk
+    //! once, already tagged.
+    class Exif
+    {
+    public:
+      //! Constructor.
+      Exif(void);
+
+      //! Clear all fields.
+      void
+      clear(void);
+
+      //! Set camera identification.
+      //! @param[in] make camera manufacturer.
+      //! @param[in] model camera model.
+      void
+      setCamera(const std::string& make, const std::string& model);
+
+      //! Set lens identification.
+      //! @param[in] make lens manufacturer.
+      //! @param[in] model lens model.
+      void
+      setLens(const std::string& make, const std::string& model);
+
+      //! Set author and copyright notice.
+      //! @param[in] artist author.
+      //! @param[in] copyright copyright notice.
+      void
+      setAuthor(const std::string& artist, const std::string& copyright);
+
+      //! Set user comment.
+      //! @param[in] comment comment.
+      void
+      setComment(const std::string& comment);
+
+      //! Set capture time (DateTime, DateTimeOriginal and
+      //! DateTimeDigitized).
+      //! @param[in] time seconds since the Unix Epoch (UTC).
+      void
+      setTime(double time);
+
+      //! Set capture position.
+      //! @param[in] lat WGS-84 latitude (rad).
+      //! @param[in] lon WGS-84 longitude (rad).
+      //! @param[in] height height above the WGS-84 ellipsoid (m).
+      void
+      setPosition(double lat, double lon, double height);
+
+      //! Generate the APP1 payload ("Exif\0\0" followed by a little
+      //! endian TIFF structure).
+      //! @param[out] data payload.
+      void
+      build(std::vector<uint8_t>& data) const;
+
+    private:
+      //! Camera manufacturer.
+      std::string m_make;
+      //! Camera model.
+      std::string m_model;
+      //! Lens manufacturer.
+      std::string m_lens_make;
+      //! Lens model.
+      std::string m_lens_model;
+      //! Author.
+      std::string m_artist;
+      //! Copyright notice.
+      std::string m_copyright;
+      //! User comment.
+      std::string m_comment;
+      //! Capture time in Exif format ("YYYY:MM:DD HH:MM:SS").
+      std::string m_time;
+      //! True if position is valid.
+      bool m_has_position;
+      //! Latitude (rad).
+      double m_lat;
+      //! Longitude (rad).
+      double m_lon;
+      //! Height (m).
+      double m_height;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,474 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <exception>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Media/FramePipeline.hpp>
+#include <DUNE/Media/JPEGCompressor.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Delay.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    //! Compute the mean of a buffer, sampling every fourth byte.
+    static double
+    frameMean(const uint8_t* data, unsigned count)
+    {
+      uint64_t sum = 0;
+      unsigned samples = 0;
+      for (unsigned i = 0; i < count; i += 4, ++samples)
+        sum += data[i];
+
+      return samples ? (double)sum / samples : 0.0;
+    }
+
+    //! Compute the mean luma of an RGB24 image, sampling every fourth
+    //! pixel.
+    static double
+    frameMeanRGB(const uint8_t* data, unsigned pixels)
+    {
+      uint64_t sum = 0;
+      unsigned samples = 0;
+      for (unsigned i = 0; i < pixels; i += 4, ++samples)
+        sum += (77 * data[i * 3] + 150 * data[i * 3 + 1] + 29 * data[i * 3 + 2]) >> 8;
+
+      return samples ? (double)sum / samples : 0.0;
+    }
+
+    class FramePipeline::Encoder: public Concurrency::Thread
+    {
+    public:
+      Encoder(FramePipeline& pipeline):
+        m_pipeline(pipeline)
+      { }
+
+    private:
+      //! Parent pipeline.
+      FramePipeline& m_pipeline;
+      //! JPEG compressor.
+      JPEGCompressor m_jpeg;
+      //! Planar YUV 4:2:0 image.
+      std::vector<uint8_t> m_yuv;
+      //! Exif segment.
+      std::vector<uint8_t> m_exif;
+
+      void
+      run(void)
+      {
+        while (!isStopping())
+        {
+          ImageFrame* frame = m_pipeline.nextToEncode();
+          if (frame == NULL)
+            continue;
+
+          double luma = 0;
+          bool ok = false;
+
+          try
+          {
+            ok = encode(*frame, luma);
+          }
+          catch (std::exception&)
+          {
+            ok = false;
+          }
+
+          if (ok)
+            m_pipeline.encoded(frame, luma);
+          else
+            m_pipeline.complete(frame, 0, false);
+        }
+      }
+
+      bool
+      encode(ImageFrame& frame, double& luma)
+      {
+        unsigned w = frame.getWidth();
+        unsigned h = frame.getHeight();
+        if (w == 0 || h == 0)
+          return false;
+
+        BayerDecoder::Method method;
+        unsigned quality;
+        {
+          Concurrency::ScopedMutex l(m_pipeline.m_lock);
+          method = m_pipeline.m_method;
+          quality = m_pipeline.m_quality;
+        }
+
+        frame.getExif().build(m_exif);
+        m_jpeg.setExif(&m_exif[0], m_exif.size());
+        m_jpeg.setInputDimensions(w, h);
+
+        switch (frame.getFormat())
+        {
+          case ImageFrame::FMT_GRAY8:
+            m_jpeg.setInputColorSpace(JPEGCompressor::CS_GRAYSCALE);
+            m_jpeg.setOutputColorSpace(JPEGCompressor::CS_GRAYSCALE);
+            m_jpeg.compress(frame.getData(), quality);
+            luma = frameMean(frame.getData(), w * h);
+            break;
+
+          case ImageFrame::FMT_RGB24:
+            m_jpeg.setInputColorSpace(JPEGCompressor::CS_RGB);
+            m_jpeg.setOutputColorSpace(JPEGCompressor::CS_YUV);
+            m_jpeg.compress(frame.getData(), quality);
+            luma = frameMeanRGB(frame.getData(), w * h);
+            break;
+
+          default:
+            {
+              BayerDecoder::Tile tile = BayerDecoder::TILE_GBRG;
+              if (frame.getFormat() == ImageFrame::FMT_BAYER_GRBG)
+                tile = BayerDecoder::TILE_GRBG;
+              else if (frame.getFormat() == ImageFrame::FMT_BAYER_RGGB)
+                tile = BayerDecoder::TILE_RGGB;
+              else if (frame.getFormat() == ImageFrame::FMT_BAYER_BGGR)
+                tile = BayerDecoder::TILE_BGGR;
+
+              unsigned cs = ((w + 1) / 2) * ((h + 1) / 2);
+              m_yuv.resize(w * h + 2 * cs);
+              uint8_t* y = &m_yuv[0];
+
+              BayerDecoder decoder(tile, method);
+              decoder.decodeToYUV420(frame.getData(), y, y + w * h, y + w * h + cs, w, h);
+              m_jpeg.setOutputColorSpace(JPEGCompressor::CS_YUV);
+              m_jpeg.compressYUV420(y, y + w * h, y + w * h + cs, quality);
+              luma = frameMean(y, w * h);
+            }
+            break;
+        }
+
+        frame.getEncoded().assign(m_jpeg.imageData(), m_jpeg.imageData() + m_jpeg.imageSize());
+        return true;
+      }
+    };
+
+    class FramePipeline::Writer: public Concurrency::Thread
+    {
+    public:
+      Writer(FramePipeline& pipeline):
+        m_pipeline(pipeline)
+      { }
+
+    private:
+      //! Parent pipeline.
+      FramePipeline& m_pipeline;
+
+      void
+      run(void)
+      {
+        while (!isStopping())
+        {
+          ImageFrame* frame = m_pipeline.nextToWrite();
+          if (frame == NULL)
+            continue;
+
+          const std::vector<uint8_t>& data = frame->getEncoded();
+          if (frame->getPath().empty())
+          {
+            m_pipeline.complete(frame, data.size(), true);
+            continue;
+          }
+
+          bool ok = false;
+          std::FILE* fd = std::fopen(frame->getPath().c_str(), "wb");
+          if (fd != NULL)
+          {
+            ok = std::fwrite(&data[0], 1, data.size(), fd) == data.size();
+            ok = (std::fclose(fd) == 0) && ok;
+          }
+
+          m_pipeline.complete(frame, ok ? data.size() : 0, ok);
+        }
+      }
+    };
+
+    FramePipeline::FramePipeline(FramePool& pool, unsigned encoders):
+      m_pool(pool),
+      m_writer(NULL),
+      m_in_flight(0),
+      m_start_time(-1),
+      m_quality(90),
+      m_method(BayerDecoder::METHOD_BILINEAR),
+      m_luma(-1),
+      m_encoder_count(encoders < 1 ? 1 : encoders),
+      m_stopping(false)
+    {
+      m_stats.submitted = 0;
+      m_stats.dropped = 0;
+      m_stats.encoded = 0;
+      m_stats.completed = 0;
+      m_stats.failed = 0;
+      m_stats.bytes = 0;
+      m_stats.fps = 0;
+    }
+
+    FramePipeline::~FramePipeline(void)
+    {
+      stop();
+    }
+
+    void
+    FramePipeline::setQuality(unsigned quality)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      m_quality = (quality > 100) ? 100 : quality;
+    }
+
+    void
+    FramePipeline::setMethod(BayerDecoder::Method method)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      m_method = method;
+    }
+
+    void
+    FramePipeline::start(void)
+    {
+      if (m_writer != NULL)
+        return;
+
+      m_stopping = false;
+
+      {
+        Concurrency::ScopedMutex l(m_lock);
+        m_start_time = Time::Clock::get();
+      }
+
+      m_writer = new Writer(*this);
+      m_writer->start();
+
+      for (unsigned i = 0; i < m_encoder_count; ++i)
+      {
+        m_encoders.push_back(new Encoder(*this));
+        m_encoders.back()->start();
+      }
+    }
+
+    void
+    FramePipeline::stop(void)
+    {
+      if (m_writer == NULL)
+        return;
+
+      for (size_t i = 0; i < m_encoders.size(); ++i)
+        m_encoders[i]->stop();
+      m_writer->stop();
+
+      {
+        Concurrency::ScopedCondition l(m_encode_cond);
+        m_stopping = true;
+        m_encode_cond.broadcast();
+      }
+
+      {
+        Concurrency::ScopedCondition l(m_write_cond);
+        m_write_cond.broadcast();
+      }
+
+      for (size_t i = 0; i < m_encoders.size(); ++i)
+      {
+        m_encoders[i]->join();
+        delete m_encoders[i];
+      }
+      m_encoders.clear();
+
+      m_writer->join();
+      delete m_writer;
+      m_writer = NULL;
+
+      // Return frames that were not processed.
+      std::deque<ImageFrame*> pending;
+      {
+        Concurrency::ScopedCondition l(m_encode_cond);
+        pending.insert(pending.end(), m_encode_queue.begin(), m_encode_queue.end());
+        m_encode_queue.clear();
+      }
+
+      {
+        Concurrency::ScopedCondition l(m_write_cond);
+        pending.insert(pending.end(), m_write_queue.begin(), m_write_queue.end());
+        m_write_queue.clear();
+      }
+
+      for (size_t i = 0; i < pending.size(); ++i)
+        complete(pending[i], 0, false);
+    }
+
+    ImageFrame*
+    FramePipeline::acquire(void)
+    {
+      return m_pool.acquire();
+    }
+
+    void
+    FramePipeline::submit(ImageFrame* frame)
+    {
+      if (frame == NULL)
+        return;
+
+      {
+        Concurrency::ScopedMutex l(m_lock);
+        frame->setSequence(m_stats.submitted++);
+        ++m_in_flight;
+      }
+
+      Concurrency::ScopedCondition l(m_encode_cond);
+      m_encode_queue.push_back(frame);
+      m_encode_cond.signal();
+    }
+
+    void
+    FramePipeline::discard(ImageFrame* frame)
+    {
+      m_pool.release(frame);
+    }
+
+    bool
+    FramePipeline::flush(double timeout)
+    {
+      double deadline = Time::Clock::get() + timeout;
+
+      while (true)
+      {
+        {
+          Concurrency::ScopedMutex l(m_lock);
+          if (m_in_flight == 0)
+            return true;
+        }
+
+        if (Time::Clock::get() >= deadline)
+          return false;
+
+        Time::Delay::wait(0.005);
+      }
+    }
+
+    double
+    FramePipeline::getMeanLuma(void)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      return m_luma;
+    }
+
+    FramePipeline::Statistics
+    FramePipeline::getStatistics(void)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      Statistics stats = m_stats;
+      stats.dropped = m_pool.getDropped();
+
+      if (m_start_time > 0)
+      {
+        double elapsed = Time::Clock::get() - m_start_time;
+        if (elapsed > 0)
+          stats.fps = stats.completed / elapsed;
+      }
+
+      return stats;
+    }
+
+    ImageFrame*
+    FramePipeline::nextToEncode(void)
+    {
+      Concurrency::ScopedCondition l(m_encode_cond);
+
+      while (m_encode_queue.empty() && !m_stopping)
+        m_encode_cond.wait(1.0);
+
+      if (m_stopping)
+        return NULL;
+
+      ImageFrame* frame = m_encode_queue.front();
+      m_encode_queue.pop_front();
+      return frame;
+    }
+
+    ImageFrame*
+    FramePipeline::nextToWrite(void)
+    {
+      Concurrency::ScopedCondition l(m_write_cond);
+
+      while (m_write_queue.empty() && !m_stopping)
+        m_write_cond.wait(1.0);
+
+      if (m_stopping)
+        return NULL;
+
+      ImageFrame* frame = m_write_queue.front();
+      m_write_queue.pop_front();
+      return frame;
+    }
+
+    void
+    FramePipeline::encoded(ImageFrame* frame, double luma)
+    {
+      {
+        Concurrency::ScopedMutex l(m_lock);
+        ++m_stats.encoded;
+        m_luma = luma;
+      }
+
+      Concurrency::ScopedCondition l(m_write_cond);
+      m_write_queue.push_back(frame);
+      m_write_cond.signal();
+    }
+
+    void
+    FramePipeline::complete(ImageFrame* frame, unsigned bytes, bool ok)
+    {
+      {
+        Concurrency::ScopedMutex l(m_lock);
+        if (ok)
+        {
+          ++m_stats.completed;
+          m_stats.bytes += bytes;
+        }
+        else
+        {
+          ++m_stats.failed;
+        }
+
+        --m_in_flight;
+      }
+
+      m_pool.release(frame);
+    }
+  }
+}
@@ -0,0 +1,214 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_MEDIA_FRAME_PIPELINE_HPP_INCLUDED_
+#define DUNE_MEDIA_FRAME_PIPELINE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <deque>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Media/BayerDecoder.hpp>
+#include <DUNE/Media/FramePool.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM FramePipeline;
+
+    //! Camera frame pipeline. Frames flow through the stages
+    //!
+    //!   capture -> debayer -> encode -> write
+    //!
+    //! The capture stage belongs to the driver: it acquires a frame
+    //! from the pipeline, fills it in place and submits it. A set of
+    //! encoder threads demosaic (if needed) and JPEG-encode frames in
+    //! parallel, embedding the frame's Exif metadata, and a single
+    //! writer thread stores each image with one write. Frames return
+    //! to the pool once written. When the pool is exhausted, capture
+    //! requests fail and are counted as dropped frames, so a slow
+    //! storage device never stalls the capture stage.
+    class FramePipeline
+    {
+    public:
+      //! Pipeline statistics.
+      struct Statistics
+      {
+        //! Frames submitted by the capture stage.
+        unsigned submitted;
+        //! Frames dropped because no frame buffer was free.
+        unsigned dropped;
+        //! Frames encoded.
+        unsigned encoded;
+        //! Frames completed (written or discarded after encoding).
+        unsigned completed;
+        //! Frames that could not be encoded or written.
+        unsigned failed;
+        //! Size of completed images in bytes.
+        uint64_t bytes;
+        //! Average completed frames per second since start().
+        double fps;
+      };
+
+      //! Constructor.
+      //! @param[in] pool frame pool.
+      //! @param[in] encoders number of encoder threads.
+      FramePipeline(FramePool& pool, unsigned encoders = 2);
+
+      //! Destructor. Stops the pipeline.
+      ~FramePipeline(void);
+
+      //! Set JPEG quality.
+      //! @param[in] quality JPEG quality (0 - 100).
+      void
+      setQuality(unsigned quality);
+
+      //! Set demosaicing method used for Bayer frames.
+      //! @param[in] method demosaicing method.
+      void
+      setMethod(BayerDecoder::Method method);
+
+      //! Start stage threads.
+      void
+      start(void);
+
+      //! Stop stage threads. Frames still queued are discarded.
+      void
+      stop(void);
+
+      //! Acquire a frame for capture.
+      //! @return frame or NULL if no frame buffer is free.
+      ImageFrame*
+      acquire(void);
+
+      //! Submit a captured frame for encoding.
+      //! @param[in] frame acquired frame.
+      void
+      submit(ImageFrame* frame);
+
+      //! Return an acquired frame that will not be submitted.
+      //! @param[in] frame acquired frame.
+      void
+      discard(ImageFrame* frame);
+
+      //! Wait for all submitted frames to complete.
+      //! @param[in] timeout maximum amount of time to wait (s).
+      //! @return true if all frames completed, false on timeout.
+      bool
+      flush(double timeout);
+
+      //! Get mean luma of the last encoded frame.
+      //! @return mean luma (0 - 255) or a negative value if no frame
+      //! was encoded yet.
+      double
+      getMeanLuma(void);
+
+      //! Get pipeline statistics.
+      //! @return statistics.
+      Statistics
+      getStatistics(void);
+
+    private:
+      //! Encoder thread.
+      class Encoder;
+      //! Writer thread.
+      class Writer;
+      //! Frame pool.
+      FramePool& m_pool;
+      //! Encoder threads.
+      std::vector<Encoder*> m_encoders;
+      //! Writer thread.
+      Writer* m_writer;
+      //! Frames waiting to be encoded.
+      std::deque<ImageFrame*> m_encode_queue;
+      //! Frames waiting to be written.
+      std::deque<ImageFrame*> m_write_queue;
+      //! Signals changes to the encoding queue.
+      Concurrency::Condition m_encode_cond;
+      //! Signals changes to the writing queue.
+      Concurrency::Condition m_write_cond;
+      //! Protects statistics and settings.
+      Concurrency::Mutex m_lock;
+      //! Statistics.
+      Statistics m_stats;
+      //! Frames submitted but not completed.
+      unsigned m_in_flight;
+      //! Start time.
+      double m_start_time;
+      //! JPEG quality.
+      unsigned m_quality;
+      //! Demosaicing method.
+      BayerDecoder::Method m_method;
+      //! Mean luma of last encoded frame.
+      double m_luma;
+      //! Number of encoder threads.
+      unsigned m_encoder_count;
+      //! True if stopping.
+      bool m_stopping;
+
+      //! Wait for a frame to encode.
+      //! @return frame or NULL if stopping.
+      ImageFrame*
+      nextToEncode(void);
+
+      //! Wait for a frame to write.
+      //! @return frame or NULL if stopping.
+      ImageFrame*
+      nextToWrite(void);
+
+      //! Hand an encoded frame to the writer.
+      //! @param[in] frame encoded frame.
+      //! @param[in] luma mean luma of the frame.
+      void
+      encoded(ImageFrame* frame, double luma);
+
+      //! Complete a frame and return it to the pool.
+      //! @param[in] frame frame.
+      //! @param[in] bytes size of the encoded image.
+      //! @param[in] ok true if the frame was processed successfully.
+      void
+      complete(ImageFrame* frame, unsigned bytes, bool ok);
+
+      //! Non-copyable.
+      FramePipeline(const FramePipeline&);
+
+      //! Non-assignable.
+      FramePipeline&
+      operator=(const FramePipeline&);
+    };
+  }
+}
+
+#endif
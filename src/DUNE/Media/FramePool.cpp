@@ -0,0 +1,133 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Media/FramePool.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    ImageFrame::ImageFrame(unsigned capacity):
+      m_data(capacity)
+    {
+      reset();
+    }
+
+    void
+    ImageFrame::setImage(unsigned width, unsigned height, Format format)
+    {
+      unsigned size = width * height * ((format == FMT_RGB24) ? 3 : 1);
+      if (size > m_data.size())
+        throw std::runtime_error("image does not fit in frame");
+
+      m_width = width;
+      m_height = height;
+      m_format = format;
+    }
+
+    void
+    ImageFrame::reset(void)
+    {
+      m_width = 0;
+      m_height = 0;
+      m_format = FMT_GRAY8;
+      m_time = -1;
+      m_sequence = 0;
+      m_path.clear();
+      m_exif.clear();
+      m_encoded.clear();
+    }
+
+    FramePool::FramePool(unsigned count, unsigned capacity):
+      m_dropped(0)
+    {
+      m_frames.reserve(count);
+      m_free.reserve(count);
+
+      for (unsigned i = 0; i < count; ++i)
+      {
+        m_frames.push_back(new ImageFrame(capacity));
+        m_free.push_back(m_frames.back());
+      }
+    }
+
+    FramePool::~FramePool(void)
+    {
+      for (size_t i = 0; i < m_frames.size(); ++i)
+        delete m_frames[i];
+    }
+
+    ImageFrame*
+    FramePool::acquire(void)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+
+      if (m_free.empty())
+      {
+        ++m_dropped;
+        return NULL;
+      }
+
+      ImageFrame* frame = m_free.back();
+      m_free.pop_back();
+      frame->reset();
+      return frame;
+    }
+
+    void
+    FramePool::release(ImageFrame* frame)
+    {
+      if (frame == NULL)
+        return;
+
+      Concurrency::ScopedMutex l(m_lock);
+      m_free.push_back(frame);
+    }
+
+    unsigned
+    FramePool::getAvailable(void)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      return m_free.size();
+    }
+
+    unsigned
+    FramePool::getDropped(void)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      return m_dropped;
+    }
+  }
+}
@@ -0,0 +1,275 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_MEDIA_FRAME_POOL_HPP_INCLUDED_
+#define DUNE_MEDIA_FRAME_POOL_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Media/Exif.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ImageFrame;
+    class DUNE_DLL_SYM FramePool;
+
+    //! Reusable image buffer with capture metadata. Frames are owned
+    //! by a FramePool and their storage is allocated once.
+    class ImageFrame
+    {
+    public:
+      //! Pixel formats.
+      enum Format
+      {
+        //! 8-bit grayscale.
+        FMT_GRAY8,
+        //! 24-bit RGB.
+        FMT_RGB24,
+        //! 8-bit Bayer mosaic, GBRG tile.
+        FMT_BAYER_GBRG,
+        //! 8-bit Bayer mosaic, GRBG tile.
+        FMT_BAYER_GRBG,
+        //! 8-bit Bayer mosaic, RGGB tile.
+        FMT_BAYER_RGGB,
+        //! 8-bit Bayer mosaic, BGGR tile.
+        FMT_BAYER_BGGR
+      };
+
+      //! Constructor.
+      //! @param[in] capacity capacity of the image buffer in bytes.
+      ImageFrame(unsigned capacity);
+
+      //! Get image buffer.
+      //! @return image buffer.
+      uint8_t*
+      getData(void)
+      {
+        return &m_data[0];
+      }
+
+      //! Get image buffer capacity.
+      //! @return capacity in bytes.
+      unsigned
+      getCapacity(void) const
+      {
+        return m_data.size();
+      }
+
+      //! Describe the image stored in the buffer.
+      //! @param[in] width image width.
+      //! @param[in] height image height.
+      //! @param[in] format pixel format.
+      void
+      setImage(unsigned width, unsigned height, Format format);
+
+      //! Get image width.
+      //! @return image width.
+      unsigned
+      getWidth(void) const
+      {
+        return m_width;
+      }
+
+      //! Get image height.
+      //! @return image height.
+      unsigned
+      getHeight(void) const
+      {
+        return m_height;
+      }
+
+      //! Get pixel format.
+      //! @return pixel format.
+      Format
+      getFormat(void) const
+      {
+        return m_format;
+      }
+
+      //! Set capture time.
+      //! @param[in] time seconds since the Unix Epoch.
+      void
+      setTimeStamp(double time)
+      {
+        m_time = time;
+      }
+
+      //! Get capture time.
+      //! @return seconds since the Unix Epoch.
+      double
+      getTimeStamp(void) const
+      {
+        return m_time;
+      }
+
+      //! Set sequence number.
+      //! @param[in] sequence sequence number.
+      void
+      setSequence(unsigned sequence)
+      {
+        m_sequence = sequence;
+      }
+
+      //! Get sequence number.
+      //! @return sequence number.
+      unsigned
+      getSequence(void) const
+      {
+        return m_sequence;
+      }
+
+      //! Set destination file. Frames without destination are
+      //! encoded but not written.
+      //! @param[in] path destination file.
+      void
+      setPath(const std::string& path)
+      {
+        m_path = path;
+      }
+
+      //! Get destination file.
+      //! @return destination file.
+      const std::string&
+      getPath(void) const
+      {
+        return m_path;
+      }
+
+      //! Get Exif metadata embedded in the encoded image.
+      //! @return Exif metadata.
+      Exif&
+      getExif(void)
+      {
+        return m_exif;
+      }
+
+      //! Get encoded image.
+      //! @return encoded image.
+      std::vector<uint8_t>&
+      getEncoded(void)
+      {
+        return m_encoded;
+      }
+
+      //! Reset metadata (keeps buffers).
+      void
+      reset(void);
+
+    private:
+      //! Image buffer.
+      std::vector<uint8_t> m_data;
+      //! Encoded image.
+      std::vector<uint8_t> m_encoded;
+      //! Image width.
+      unsigned m_width;
+      //! Image height.
+      unsigned m_height;
+      //! Pixel format.
+      Format m_format;
+      //! Capture time.
+      double m_time;
+      //! Sequence number.
+      unsigned m_sequence;
+      //! Destination file.
+      std::string m_path;
+      //! Exif metadata.
+      Exif m_exif;
+    };
+
+    //! Fixed set of reusable image frames. Acquisition never blocks
+    //! nor allocates: when every frame is in use the request fails and
+    //! is counted as a dropped frame.
+    class FramePool
+    {
+    public:
+      //! Constructor.
+      //! @param[in] count number of frames.
+      //! @param[in] capacity capacity of each frame in bytes.
+      FramePool(unsigned count, unsigned capacity);
+
+      //! Destructor.
+      ~FramePool(void);
+
+      //! Acquire a free frame.
+      //! @return frame or NULL if all frames are in use.
+      ImageFrame*
+      acquire(void);
+
+      //! Return a frame to the pool.
+      //! @param[in] frame frame acquired from this pool.
+      void
+      release(ImageFrame* frame);
+
+      //! Get number of frames.
+      //! @return number of frames.
+      unsigned
+      getSize(void) const
+      {
+        return m_frames.size();
+      }
+
+      //! Get number of free frames.
+      //! @return number of free frames.
+      unsigned
+      getAvailable(void);
+
+      //! Get number of failed acquisitions.
+      //! @return number of dropped frames.
+      unsigned
+      getDropped(void);
+
+    private:
+      //! All frames.
+      std::vector<ImageFrame*> m_frames;
+      //! Free frames.
+      std::vector<ImageFrame*> m_free;
+      //! Number of failed acquisitions.
+      unsigned m_dropped;
+      //! Lock.
+      Concurrency::Mutex m_lock;
+
+      //! Non-copyable.
+      FramePool(const FramePool&);
+
+      //! Non-assignable.
+      FramePool&
+      operator=(const FramePool&);
+    };
+  }
+}
+
+#endif
@@ -36,6 +36,7 @@
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
 
 // JPEG Library headers.
 #if defined(DUNE_SYS_HAS_JPEG)
@@ -185,11 +186,36 @@ namespace DUNE
       return *this;
     }
 
+    JPEGCompressor&
+    JPEGCompressor::setExif(const uint8_t* data, uint32_t size)
+    {
+      // Markers are limited to 65533 bytes of payload.
+      if (size > 65533)
+        throw std::runtime_error("Exif segment is too large");
+
+      m_exif.assign(data, data + size);
+      return *this;
+    }
+
+    void
+    JPEGCompressor::startCompress(void)
+    {
+      boolean jfif = m_jcinfo->write_JFIF_header;
+      if (!m_exif.empty())
+        m_jcinfo->write_JFIF_header = FALSE;
+
+      jpeg_start_compress(m_jcinfo, TRUE);
+      m_jcinfo->write_JFIF_header = jfif;
+
+      if (!m_exif.empty())
+        jpeg_write_marker(m_jcinfo, JPEG_APP0 + 1, &m_exif[0], m_exif.size());
+    }
+
     bool
     JPEGCompressor::compress(uint8_t* raw, uint8_t quality)
     {
       jpeg_set_quality(m_jcinfo, quality, TRUE);
-      jpeg_start_compress(m_jcinfo, TRUE);
+      startCompress();
 
       JSAMPROW row_pointer[1];
       int row_stride = m_jcinfo->image_width * m_jcinfo->input_components;
@@ -203,6 +229,116 @@ namespace DUNE
       return true;
     }
 
+    bool
+    JPEGCompressor::compressYUV420(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                                   uint8_t quality)
+    {
+      const int width = m_jcinfo->image_width;
+      const int height = m_jcinfo->image_height;
+      const int cwidth = (width + 1) / 2;
+      const int cheight = (height + 1) / 2;
+
+      // Save color settings: raw data mode is YCbCr with 2x2 luma
+      // sampling.
+      J_COLOR_SPACE in_cspace = m_jcinfo->in_color_space;
+      int in_components = m_jcinfo->input_components;
+      J_COLOR_SPACE out_cspace = m_jcinfo->jpeg_color_space;
+
+      m_jcinfo->in_color_space = JCS_YCbCr;
+      m_jcinfo->input_components = 3;
+      jpeg_set_colorspace(m_jcinfo, JCS_YCbCr);
+      m_jcinfo->comp_info[0].h_samp_factor = 2;
+      m_jcinfo->comp_info[0].v_samp_factor = 2;
+      m_jcinfo->comp_info[1].h_samp_factor = 1;
+      m_jcinfo->comp_info[1].v_samp_factor = 1;
+      m_jcinfo->comp_info[2].h_samp_factor = 1;
+      m_jcinfo->comp_info[2].v_samp_factor = 1;
+      m_jcinfo->raw_data_in = TRUE;
+#if JPEG_LIB_VERSION >= 70
+      // Otherwise chroma is scaled by the DCT and expected at full
+      // resolution.
+      m_jcinfo->do_fancy_downsampling = FALSE;
+#endif
+
+      jpeg_set_quality(m_jcinfo, quality, TRUE);
+      startCompress();
+
+      // The library reads whole blocks: rows shorter than a multiple
+      // of 16 (luma) or 8 (chroma) samples are padded by replicating
+      // the last sample.
+      const int ystride = (width + 15) & ~15;
+      const int cstride = ystride / 2;
+      const bool pad = (ystride != width) || (cstride != cwidth);
+      if (pad)
+        m_padded.resize(16 * ystride + 16 * cstride);
+
+      JSAMPROW yrows[16];
+      JSAMPROW urows[8];
+      JSAMPROW vrows[8];
+      JSAMPARRAY planes[3] = {yrows, urows, vrows};
+
+      while (m_jcinfo->next_scanline < m_jcinfo->image_height)
+      {
+        const int base = m_jcinfo->next_scanline;
+
+        for (int i = 0; i < 16; ++i)
+        {
+          int row = (base + i < height) ? base + i : height - 1;
+          const uint8_t* src = y + row * width;
+
+          if (pad)
+          {
+            uint8_t* dst = &m_padded[i * ystride];
+            std::memcpy(dst, src, width);
+            std::memset(dst + width, src[width - 1], ystride - width);
+            yrows[i] = dst;
+          }
+          else
+          {
+            yrows[i] = (JSAMPROW)src;
+          }
+        }
+
+        for (int i = 0; i < 8; ++i)
+        {
+          int row = (base / 2 + i < cheight) ? base / 2 + i : cheight - 1;
+          const uint8_t* usrc = u + row * cwidth;
+          const uint8_t* vsrc = v + row * cwidth;
+
+          if (pad)
+          {
+            uint8_t* udst = &m_padded[16 * ystride + i * cstride];
+            uint8_t* vdst = &m_padded[16 * ystride + (8 + i) * cstride];
+            std::memcpy(udst, usrc, cwidth);
+            std::memset(udst + cwidth, usrc[cwidth - 1], cstride - cwidth);
+            std::memcpy(vdst, vsrc, cwidth);
+            std::memset(vdst + cwidth, vsrc[cwidth - 1], cstride - cwidth);
+            urows[i] = udst;
+            vrows[i] = vdst;
+          }
+          else
+          {
+            urows[i] = (JSAMPROW)usrc;
+            vrows[i] = (JSAMPROW)vsrc;
+          }
+        }
+
+        jpeg_write_raw_data(m_jcinfo, planes, 16);
+      }
+
+      jpeg_finish_compress(m_jcinfo);
+
+      // Restore settings used by compress().
+      m_jcinfo->raw_data_in = FALSE;
+#if JPEG_LIB_VERSION >= 70
+      m_jcinfo->do_fancy_downsampling = TRUE;
+#endif
+      m_jcinfo->in_color_space = in_cspace;
+      m_jcinfo->input_components = in_components;
+      jpeg_set_colorspace(m_jcinfo, out_cspace);
+      return true;
+    }
+
     const uint8_t*
     JPEGCompressor::imageData(void) const
     {
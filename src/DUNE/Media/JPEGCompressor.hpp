@@ -30,6 +30,9 @@
 #ifndef DUNE_MEDIA_JPEG_COMPRESSOR_HPP_INCLUDED_
 #define DUNE_MEDIA_JPEG_COMPRESSOR_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/Config.hpp>
 
@@ -92,6 +95,15 @@ namespace DUNE
       JPEGCompressor&
       setOutputColorSpace(ColorSpace cspace);
 
+      //! Set Exif metadata written (as an APP1 segment) in every
+      //! subsequent image. When set, the JFIF header is omitted, as
+      //! required by the Exif specification.
+      //! @param data APP1 payload (see Exif::build()).
+      //! @param size payload size in bytes, zero to disable.
+      //! @return JPEGCompressor object.
+      JPEGCompressor&
+      setExif(const uint8_t* data, uint32_t size);
+
       //! Compress a raw image in JPEG.
       //! @param raw raw image.
       //! @param quality JPEG image quality.
@@ -99,6 +111,19 @@ namespace DUNE
       bool
       compress(uint8_t* raw, uint8_t quality = 90);
 
+      //! Compress a planar YUV 4:2:0 image (as produced by
+      //! BayerDecoder::decodeToYUV420) in JPEG. The planes are handed
+      //! to the library in raw data mode, skipping its color conversion
+      //! and downsampling. The input color space setting is ignored.
+      //! @param y luma plane.
+      //! @param u Cb plane ((width + 1) / 2 x (height + 1) / 2).
+      //! @param v Cr plane ((width + 1) / 2 x (height + 1) / 2).
+      //! @param quality JPEG image quality.
+      //! @return true on success, false otherwise.
+      bool
+      compressYUV420(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                     uint8_t quality = 90);
+
       //! Retrieve the compressed image.
       //! @return compressed image.
       const uint8_t*
@@ -116,6 +141,14 @@ namespace DUNE
       jpeg_compress_struct* m_jcinfo;
       //! JPEG compression error.
       jpeg_error_mgr* m_jerror;
+      //! Exif APP1 payload.
+      std::vector<uint8_t> m_exif;
+      //! Rows padded to a whole number of blocks (raw data mode).
+      std::vector<uint8_t> m_padded;
+      //! Start compression, writing the Exif segment if set.
+      void
+      startCompress(void);
+
       //! Default buffer size.
       const static uint32_t c_default_bfr_size = 102400;
       //! Default image width.
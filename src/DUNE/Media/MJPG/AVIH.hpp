@@ -68,8 +68,8 @@ namespace DUNE
           writeWord(0, os);
           // Flags.
           writeWord(0, os);
-          // Total frames.
-          writeWord(m_properties.total_frames, os);
+          // Total frames (first RIFF segment only, see DMLH).
+          writeWord(m_properties.riff_frames, os);
           // Initial frames.
           writeWord(0, os);
           // Streams.
@@ -137,6 +137,15 @@ namespace DUNE
           os.write((const char*)&value, sizeof(uint32_t));
         }
 
+        //! Write 64-bit unsigned value to output stream.
+        //! @param[in] value value to write.
+        //! @param[in] os output stream.
+        void
+        writeQuad(const uint64_t& value, std::ostream& os)
+        {
+          os.write((const char*)&value, sizeof(uint64_t));
+        }
+
         //! Write FourCC value to output stream.
         //! @param[in] value value to write.
         //! @param[in] os output stream.
@@ -24,60 +24,50 @@
 // https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
 // http://ec.europa.eu/idabc/eupl.html.                                     *
 //***************************************************************************
-// Author: Eduardo Marques                                                  *
+// Author: Ricardo Martins                                                  *
 //***************************************************************************
 
-#ifndef SIMULATORS_ENVIRONMENT_POINT_HPP_INCLUDED_
-#define SIMULATORS_ENVIRONMENT_POINT_HPP_INCLUDED_
-
-// ISO C++ 98 headers.
-#include <iomanip>
-#include <cmath>
+#ifndef DUNE_MEDIA_MJPG_DMLH_HPP_INCLUDED_
+#define DUNE_MEDIA_MJPG_DMLH_HPP_INCLUDED_
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
 
-namespace Simulators
+// Local headers.
+#include "Chunk.hpp"
+
+namespace DUNE
 {
-  namespace Environment
+  namespace Media
   {
-    //! Directions for search/insertion
-    enum
+    namespace MJPG
     {
-      DIR_NW, DIR_NE, DIR_SW, DIR_SE
-    };
-
-    //! Point structure.
-    struct Point
-    {
-      double x, y;
-
-      Point(double x_, double y_):
-        x(x_), y(y_) { }
-
-      double
-      distance(const Point& other) const
-      {
-        double dx = x - other.x;
-        double dy = y - other.y;
-        return std::sqrt(dx * dx + dy * dy);
-      }
-
-      template <typename T>
-      int
-      direction(const T& other) const
+      //! Class representing an OpenDML extended AVI header.
+      class DMLH: public Chunk
       {
-        double dx = other.x - x;
-        double dy = other.y - y;
-
-        int dir = dx >= 0 ? DIR_NW : DIR_SW;
+      public:
+        //! Constructor.
+        //! @param[in] properties stream properties.
+        DMLH(const Properties& properties):
+          Chunk(properties, "dmlh")
+        {
+          setDataSize(248);
+        }
 
-        if (dy > 0)
-          dir++;      // other is East of this
+        //! Write chunk data to output stream.
+        //! @param[in] os output stream.
+        void
+        writeData(std::ostream& os)
+        {
+          // Total frames (all RIFF segments).
+          writeWord(m_properties.total_frames, os);
 
-        return dir;
-      }
-    };
+          // Reserved.
+          for (unsigned i = 0; i < 61; ++i)
+            writeWord(0, os);
+        }
+      };
+    }
   }
 }
 
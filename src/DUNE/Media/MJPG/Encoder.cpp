@@ -0,0 +1,379 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Media/MJPG/Encoder.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    namespace MJPG
+    {
+      //! Size of the output stream buffer.
+      static const size_t c_buffer_size = 1024 * 1024;
+      //! Default maximum size of a RIFF segment.
+      static const uint64_t c_segment_size = 1024 * 1024 * 1024;
+      //! Minimum size of a RIFF segment.
+      static const uint64_t c_segment_size_min = 1024 * 1024;
+      //! Maximum size of a RIFF segment (32-bit chunk sizes).
+      static const uint64_t c_segment_size_max = 0xF0000000;
+      //! Default checkpoint interval in seconds of video.
+      static const unsigned c_checkpoint_seconds = 5;
+      //! Number of standard indexes referenced by the super index.
+      static const size_t c_super_index_size = 1024;
+      //! Number of entries of a standard index.
+      static const uint32_t c_index_size = 4096;
+      //! Size of the header of a standard index chunk.
+      static const uint32_t c_index_header_size = 32;
+      //! Offset of the entry count in a standard index chunk.
+      static const uint32_t c_index_count_offset = 12;
+      //! Legacy index flag for key frames.
+      static const uint32_t c_idx1_keyframe = 0x10;
+
+      static void
+      writeFourCC(std::ostream& os, const char* value)
+      {
+        os.write(value, 4);
+      }
+
+      static void
+      writeU8(std::ostream& os, uint8_t value)
+      {
+        os.write((const char*)&value, sizeof(value));
+      }
+
+      static void
+      writeU16(std::ostream& os, uint16_t value)
+      {
+        os.write((const char*)&value, sizeof(value));
+      }
+
+      static void
+      writeU32(std::ostream& os, uint32_t value)
+      {
+        os.write((const char*)&value, sizeof(value));
+      }
+
+      static void
+      writeU64(std::ostream& os, uint64_t value)
+      {
+        os.write((const char*)&value, sizeof(value));
+      }
+
+      Encoder::Encoder(const char* fname, uint32_t width, uint32_t height, unsigned fps):
+        m_buffer(c_buffer_size),
+        m_offset(0),
+        m_segment_size(c_segment_size),
+        m_segments(1),
+        m_segment_begin(0),
+        m_movi_begin(0),
+        m_segment_frames(0),
+        m_ix_begin(0),
+        m_ix_count(0),
+        m_checkpoint_frames(((fps > 0) ? fps : 1) * c_checkpoint_seconds)
+      {
+        m_ofs.rdbuf()->pubsetbuf(&m_buffer[0], m_buffer.size());
+        m_ofs.open(fname, std::ios::binary | std::ios::trunc);
+        if (!m_ofs.is_open())
+          throw std::runtime_error(std::string("unable to open video file: ") + fname);
+
+        m_properties.width = width;
+        m_properties.height = height;
+        m_properties.fps = fps;
+
+        m_avih = new AVIH(m_properties);
+        m_strh = new STRH(m_properties);
+        m_strf = new STRF(m_properties);
+        m_indx = new INDX(m_properties, c_super_index_size);
+        m_dmlh = new DMLH(m_properties);
+        m_isft = new ISFT(m_properties);
+        m_idx1 = new IDX1(m_properties);
+        m_tstp = new TSTP(m_properties);
+
+        m_strl = new List(m_properties, "strl");
+        m_strl->add(m_strh);
+        m_strl->add(m_strf);
+        m_strl->add(m_indx);
+
+        m_odml = new List(m_properties, "odml");
+        m_odml->add(m_dmlh);
+
+        m_hdrl = new List(m_properties, "hdrl");
+        m_hdrl->add(m_avih);
+        m_hdrl->add(m_strl);
+        m_hdrl->add(m_odml);
+
+        m_info = new List(m_properties, "INFO");
+        m_info->add(m_isft);
+
+        m_movi = new List(m_properties, "movi");
+
+        m_riff = new MJPG(m_properties);
+        m_riff->add(m_hdrl);
+        m_riff->add(m_info);
+        m_riff->add(m_movi);
+
+        m_riff->write(m_ofs);
+        m_offset = m_riff->getSize();
+        m_movi_begin = m_offset - 4;
+
+        beginIndex();
+        checkpoint();
+      }
+
+      Encoder::~Encoder(void)
+      {
+        try
+        {
+          endSegment();
+        }
+        catch (...)
+        { }
+
+        m_ofs.close();
+
+        delete m_riff;
+        delete m_movi;
+        delete m_info;
+        delete m_hdrl;
+        delete m_odml;
+        delete m_strl;
+        delete m_idx1;
+        delete m_tstp;
+        delete m_isft;
+        delete m_dmlh;
+        delete m_indx;
+        delete m_strf;
+        delete m_strh;
+        delete m_avih;
+      }
+
+      void
+      Encoder::setSegmentSize(uint64_t size)
+      {
+        if (size < c_segment_size_min)
+          size = c_segment_size_min;
+        else if (size > c_segment_size_max)
+          size = c_segment_size_max;
+
+        m_segment_size = size;
+      }
+
+      void
+      Encoder::setCheckpointInterval(unsigned frames)
+      {
+        m_checkpoint_frames = (frames > 0) ? frames : 1;
+      }
+
+      void
+      Encoder::encode(const uint8_t* data, size_t data_size, double timestamp)
+      {
+        Chunk frame(m_properties, "00dc");
+        frame.setData(data, (uint32_t)data_size);
+
+        // The first segment also holds the legacy index.
+        uint64_t size = m_offset + frame.getSize() - m_segment_begin;
+        if (m_segments == 1)
+          size += m_idx1->getSize() + 16;
+
+        if (m_segment_frames > 0 && size > m_segment_size)
+        {
+          endSegment();
+          beginSegment();
+        }
+        else if (m_ix_count + m_ix_pending.size() / 2 >= c_index_size)
+        {
+          checkpoint();
+          beginIndex();
+        }
+
+        uint64_t position = m_offset;
+        frame.write(m_ofs);
+        m_offset += frame.getSize();
+
+        m_ix_pending.push_back((uint32_t)(position + 8 - m_movi_begin));
+        m_ix_pending.push_back(frame.getDataSize());
+
+        if (m_segments == 1)
+        {
+          m_idx1->add("00dc", c_idx1_keyframe, (uint32_t)(position - m_movi_begin), frame.getDataSize());
+          ++m_properties.riff_frames;
+        }
+
+        m_tstp->add(timestamp);
+        ++m_properties.total_frames;
+        ++m_segment_frames;
+
+        if (m_tstp->getCount() >= m_checkpoint_frames)
+          checkpoint();
+      }
+
+      void
+      Encoder::checkpoint(void)
+      {
+        // Timestamps are appended to the frame list.
+        if (m_tstp->getCount() > 0)
+        {
+          m_tstp->write(m_ofs);
+          m_offset += m_tstp->getSize();
+          m_tstp->clear();
+        }
+
+        // Fill the standard index in place.
+        if (!m_ix_pending.empty())
+        {
+          m_ofs.seekp(m_ix_begin + c_index_header_size + m_ix_count * 8);
+          m_ofs.write((const char*)&m_ix_pending[0], m_ix_pending.size() * sizeof(uint32_t));
+          m_ix_count += m_ix_pending.size() / 2;
+          m_ix_pending.clear();
+
+          m_ofs.seekp(m_ix_begin + c_index_count_offset);
+          writeU32(m_ofs, m_ix_count);
+          m_indx->setDuration(m_ix_count);
+        }
+
+        // Data must reach the file before the headers referencing it.
+        m_ofs.flush();
+        writeHeaders();
+        m_ofs.seekp(m_offset);
+        m_ofs.flush();
+        checkStream();
+      }
+
+      void
+      Encoder::beginSegment(void)
+      {
+        m_segment_begin = m_offset;
+        m_movi_begin = m_offset + 20;
+        m_offset += 24;
+        m_segment_frames = 0;
+        ++m_segments;
+
+        writeFourCC(m_ofs, "RIFF");
+        writeU32(m_ofs, 16);
+        writeFourCC(m_ofs, "AVIX");
+        writeFourCC(m_ofs, "LIST");
+        writeU32(m_ofs, 4);
+        writeFourCC(m_ofs, "movi");
+
+        beginIndex();
+      }
+
+      void
+      Encoder::endSegment(void)
+      {
+        checkpoint();
+
+        if (m_segments != 1)
+          return;
+
+        // Close the first segment with the legacy index.
+        m_movi->setDataSize(m_offset - m_movi_begin);
+        m_idx1->write(m_ofs);
+        m_offset += m_idx1->getSize();
+        m_idx1->clear();
+        m_riff->setDataSize(m_offset - 8);
+
+        m_ofs.seekp(0);
+        m_riff->write(m_ofs);
+        m_ofs.seekp(m_offset);
+        m_ofs.flush();
+        checkStream();
+      }
+
+      void
+      Encoder::beginIndex(void)
+      {
+        if (m_indx->isFull())
+          throw std::runtime_error("video super index is full");
+
+        uint32_t size = c_index_header_size + c_index_size * 8;
+
+        m_ix_begin = m_offset;
+        m_ix_count = 0;
+
+        writeFourCC(m_ofs, "ix00");
+        writeU32(m_ofs, size - 8);
+        // Longs per entry.
+        writeU16(m_ofs, 2);
+        // Index sub type.
+        writeU8(m_ofs, 0);
+        // Index type (AVI_INDEX_OF_CHUNKS).
+        writeU8(m_ofs, 1);
+        // Entries in use.
+        writeU32(m_ofs, 0);
+        // Chunk id.
+        writeFourCC(m_ofs, "00dc");
+        // Base offset.
+        writeU64(m_ofs, m_movi_begin);
+        // Reserved.
+        writeU32(m_ofs, 0);
+
+        std::vector<char> entries(c_index_size * 8, 0);
+        m_ofs.write(&entries[0], entries.size());
+
+        m_offset += size;
+        m_indx->add(m_ix_begin, size);
+      }
+
+      void
+      Encoder::writeHeaders(void)
+      {
+        if (m_segments == 1)
+        {
+          m_movi->setDataSize(m_offset - m_movi_begin);
+          m_riff->setDataSize(m_offset - 8);
+        }
+
+        m_ofs.seekp(0);
+        m_riff->write(m_ofs);
+
+        if (m_segments > 1)
+        {
+          m_ofs.seekp(m_segment_begin + 4);
+          writeU32(m_ofs, (uint32_t)(m_offset - m_segment_begin - 8));
+          m_ofs.seekp(m_movi_begin - 4);
+          writeU32(m_ofs, (uint32_t)(m_offset - m_movi_begin));
+        }
+      }
+
+      void
+      Encoder::checkStream(void)
+      {
+        if (!m_ofs.good())
+          throw std::runtime_error("failed to write video file");
+      }
+    }
+  }
+}
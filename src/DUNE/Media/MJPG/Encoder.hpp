@@ -29,6 +29,13 @@
 #ifndef DUNE_MEDIA_MJPG_ENCODER_HPP_INCLUDED_
 #define DUNE_MEDIA_MJPG_ENCODER_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <fstream>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
 // Local headers.
 #include "List.hpp"
 #include "MJPG.hpp"
@@ -38,6 +45,8 @@
 #include "ISFT.hpp"
 #include "IDX1.hpp"
 #include "TSTP.hpp"
+#include "INDX.hpp"
+#include "DMLH.hpp"
 
 namespace DUNE
 {
@@ -45,7 +54,23 @@ namespace DUNE
   {
     namespace MJPG
     {
-      //! Encoder for an AVI contained MJPEG stream.
+      // Export DLL Symbol.
+      class DUNE_DLL_SYM Encoder;
+
+      //! Streaming encoder for an AVI contained MJPEG stream.
+      //!
+      //! Files are written in the OpenDML (AVI 2.0) layout: frames
+      //! are split in RIFF segments of bounded size ('AVI ' followed
+      //! by 'AVIX' segments), every segment is indexed by standard
+      //! index chunks that are filled in place, and the stream header
+      //! holds a super index referencing them. A legacy 'idx1' index
+      //! is written for the first segment only.
+      //!
+      //! Memory usage is bounded by the checkpoint interval and the
+      //! first segment's legacy index. At every checkpoint pending
+      //! index entries and timestamps are written, followed by the
+      //! headers, so that a file left behind by a crash is playable
+      //! up to the last checkpoint.
       class Encoder
       {
       public:
@@ -54,90 +79,63 @@ namespace DUNE
         //! @param[in] width video width.
         //! @param[in] height video height.
         //! @param[in] fps video frames per second.
-        Encoder(const char* fname, uint32_t width, uint32_t height, unsigned fps)
-        {
-          m_ofs.open(fname, std::ios::binary);
-
-          m_properties.width = width;
-          m_properties.height = height;
-          m_properties.fps = fps;
-
-          m_avih = new AVIH(m_properties);
-          m_strh = new STRH(m_properties);
-          m_strf = new STRF(m_properties);
-          m_isft = new ISFT(m_properties);
-          m_idx1 = new IDX1(m_properties);
-          m_tstp = new TSTP(m_properties);
-
-          m_strl = new List(m_properties, "strl");
-          m_strl->add(m_strh);
-          m_strl->add(m_strf);
-
-          m_hdrl = new List(m_properties, "hdrl");
-          m_hdrl->add(m_avih);
-          m_hdrl->add(m_strl);
-
-          m_info = new List(m_properties, "INFO");
-          m_info->add(m_isft);
-
-          m_movi = new List(m_properties, "movi");
+        Encoder(const char* fname, uint32_t width, uint32_t height, unsigned fps);
 
-          m_riff = new MJPG(m_properties);
-          m_riff->add(m_hdrl);
-          m_riff->add(m_info);
-          m_riff->add(m_movi);
+        //! Destructor.
+        ~Encoder(void);
 
-          m_riff->write(m_ofs);
-        }
+        //! Set the maximum size of a RIFF segment. Takes effect
+        //! when the next frame is encoded.
+        //! @param[in] size segment size in bytes.
+        void
+        setSegmentSize(uint64_t size);
 
-        //! Destructor.
-        ~Encoder(void)
-        {
-          m_idx1->write(m_ofs);
-          m_tstp->write(m_ofs);
-          m_riff->setDataSize(m_riff->getDataSize() + m_idx1->getSize() + m_tstp->getSize());
-
-          // Patch sizes.
-          m_ofs.seekp(0);
-          m_riff->write(m_ofs);
-
-          delete m_riff;
-          delete m_movi;
-          delete m_info;
-          delete m_hdrl;
-          delete m_strl;
-          delete m_idx1;
-          delete m_tstp;
-          delete m_isft;
-          delete m_strf;
-          delete m_strh;
-          delete m_avih;
-        }
+        //! Set the number of frames between checkpoints.
+        //! @param[in] frames number of frames.
+        void
+        setCheckpointInterval(unsigned frames);
 
         //! Encode frame in a video chunk.
         //! @param[in] data video data.
         //! @param[in] data_size size of video data.
+        //! @param[in] timestamp frame timestamp.
         void
-        encode(const uint8_t* data, size_t data_size, double timestamp)
-        {
-          Chunk frame(m_properties, "00dc");
-          frame.setData(data, (uint32_t)data_size);
-          frame.write(m_ofs);
+        encode(const uint8_t* data, size_t data_size, double timestamp);
 
-          uint32_t offset = m_riff->getSize();
+        //! Write pending index entries and timestamps and update all
+        //! headers.
+        void
+        checkpoint(void);
 
-          m_movi->setDataSize(m_movi->getDataSize() + frame.getSize());
-          m_riff->setDataSize(m_riff->getDataSize() + frame.getSize());
+        //! Retrieve the number of encoded frames.
+        //! @return number of frames.
+        uint32_t
+        getFrameCount(void) const
+        {
+          return m_properties.total_frames;
+        }
 
-          m_idx1->add("00dc", 0x01, offset, frame.getSize());
-          m_tstp->add(timestamp);
+        //! Retrieve the number of RIFF segments.
+        //! @return number of segments.
+        unsigned
+        getSegmentCount(void) const
+        {
+          return m_segments;
+        }
 
-          ++m_properties.total_frames;
+        //! Retrieve the number of bytes written so far.
+        //! @return file size.
+        uint64_t
+        getSize(void) const
+        {
+          return m_offset;
         }
 
       private:
         //! Output stream.
         std::ofstream m_ofs;
+        //! Output stream buffer.
+        std::vector<char> m_buffer;
         //! MJPEG properties.
         Properties m_properties;
         //! AVI header.
@@ -146,22 +144,75 @@ namespace DUNE
         STRH* m_strh;
         //! Stream format.
         STRF* m_strf;
+        //! Stream super index.
+        INDX* m_indx;
+        //! Extended AVI header.
+        DMLH* m_dmlh;
         //! Software information.
         ISFT* m_isft;
-        //! AVI index.
+        //! Legacy AVI index of the first segment.
         IDX1* m_idx1;
-        //! AVI timestamp index.
+        //! Pending timestamps.
         TSTP* m_tstp;
         //! Stream list.
         List* m_strl;
         //! Header list.
         List* m_hdrl;
+        //! Extended header list.
+        List* m_odml;
         //! Information list.
         List* m_info;
-        //! Frame list.
+        //! Frame list of the first segment.
         List* m_movi;
         //! MJPEG/AVI container.
         MJPG* m_riff;
+        //! Current file size.
+        uint64_t m_offset;
+        //! Maximum size of a segment.
+        uint64_t m_segment_size;
+        //! Number of segments.
+        unsigned m_segments;
+        //! Offset of the current segment.
+        uint64_t m_segment_begin;
+        //! Offset of the current 'movi' list type.
+        uint64_t m_movi_begin;
+        //! Number of frames in the current segment.
+        unsigned m_segment_frames;
+        //! Offset of the current standard index.
+        uint64_t m_ix_begin;
+        //! Number of entries written to the current standard index.
+        uint32_t m_ix_count;
+        //! Pending standard index entries (offset and size pairs).
+        std::vector<uint32_t> m_ix_pending;
+        //! Number of frames between checkpoints.
+        unsigned m_checkpoint_frames;
+
+        //! Start a new 'AVIX' segment.
+        void
+        beginSegment(void);
+
+        //! Finish the current segment.
+        void
+        endSegment(void);
+
+        //! Reserve a standard index in the current segment.
+        void
+        beginIndex(void);
+
+        //! Rewrite the file and segment headers.
+        void
+        writeHeaders(void);
+
+        //! Throw if the output stream is in an error state.
+        void
+        checkStream(void);
+
+        //! Non-copyable.
+        Encoder(const Encoder&);
+
+        //! Non-assignable.
+        Encoder&
+        operator=(const Encoder&);
       };
     }
   }
@@ -30,7 +30,7 @@
 #define DUNE_MEDIA_MJPG_IDX1_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
-#include <list>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -54,14 +54,6 @@ namespace DUNE
           Chunk(properties, "idx1")
         {  }
 
-        //! Destructor.
-        ~IDX1(void)
-        {
-          std::list<uint8_t*>::const_iterator itr = m_index.begin();
-          for (; itr != m_index.end(); ++itr)
-            delete [] *itr;
-        }
-
         //! Add record to the index.
         //! @param[in] id chunk id.
         //! @param[in] flags flags.
@@ -70,29 +62,35 @@ namespace DUNE
         void
         add(const char* id, uint32_t flags, uint32_t offset, uint32_t length)
         {
-          uint8_t* record = new uint8_t[16];
-          std::memcpy(record, id, 4);
-          std::memcpy(record + 4, &flags, 4);
-          std::memcpy(record + 8, &offset, 4);
-          std::memcpy(record + 12, &length, 4);
-
-          m_index.push_back(record);
+          size_t pos = m_index.size();
+          m_index.resize(pos + 16);
+          std::memcpy(&m_index[pos], id, 4);
+          std::memcpy(&m_index[pos + 4], &flags, 4);
+          std::memcpy(&m_index[pos + 8], &offset, 4);
+          std::memcpy(&m_index[pos + 12], &length, 4);
           setDataSize(getDataSize() + 16);
         }
 
+        //! Remove all records and release their memory.
+        void
+        clear(void)
+        {
+          std::vector<uint8_t>().swap(m_index);
+          setDataSize(0);
+        }
+
         //! Write chunk data to output stream.
         //! @param[in] os output stream.
         void
         writeData(std::ostream& os)
         {
-          std::list<uint8_t*>::const_iterator itr = m_index.begin();
-          for (; itr != m_index.end(); ++itr)
-            os.write((const char*)*itr, 16);
+          if (!m_index.empty())
+            os.write((const char*)&m_index[0], m_index.size());
         }
 
       private:
-        //! List of index entries.
-        std::list<uint8_t*> m_index;
+        //! Index records (16 bytes each).
+        std::vector<uint8_t> m_index;
       };
     }
   }
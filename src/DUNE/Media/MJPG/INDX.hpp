@@ -0,0 +1,163 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_MEDIA_MJPG_INDX_HPP_INCLUDED_
+#define DUNE_MEDIA_MJPG_INDX_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+// Local headers.
+#include "Chunk.hpp"
+
+namespace DUNE
+{
+  namespace Media
+  {
+    namespace MJPG
+    {
+      //! Class representing an OpenDML super index. The chunk has a
+      //! fixed capacity so that it can be rewritten in place in the
+      //! stream header while the file grows.
+      class INDX: public Chunk
+      {
+      public:
+        //! Constructor.
+        //! @param[in] properties stream properties.
+        //! @param[in] capacity maximum number of standard indexes.
+        INDX(const Properties& properties, size_t capacity):
+          Chunk(properties, "indx"),
+          m_capacity(capacity)
+        {
+          m_entries.reserve(capacity);
+          setDataSize(24 + 16 * capacity);
+        }
+
+        //! Test if the super index cannot reference more standard
+        //! indexes.
+        //! @return true if full, false otherwise.
+        bool
+        isFull(void) const
+        {
+          return m_entries.size() >= m_capacity;
+        }
+
+        //! Retrieve the number of standard indexes referenced.
+        //! @return number of standard indexes.
+        size_t
+        getCount(void) const
+        {
+          return m_entries.size();
+        }
+
+        //! Reference a new standard index.
+        //! @param[in] offset absolute file offset of the standard index.
+        //! @param[in] size size of the standard index chunk.
+        void
+        add(uint64_t offset, uint32_t size)
+        {
+          Entry entry;
+          entry.offset = offset;
+          entry.size = size;
+          entry.duration = 0;
+          m_entries.push_back(entry);
+        }
+
+        //! Set the number of frames referenced by the last standard
+        //! index.
+        //! @param[in] duration number of frames.
+        void
+        setDuration(uint32_t duration)
+        {
+          if (!m_entries.empty())
+            m_entries.back().duration = duration;
+        }
+
+        //! Write chunk data to output stream.
+        //! @param[in] os output stream.
+        void
+        writeData(std::ostream& os)
+        {
+          // Longs per entry.
+          writeShort(4, os);
+          // Index sub type.
+          os.put(0);
+          // Index type (AVI_INDEX_OF_INDEXES).
+          os.put(0);
+          // Entries in use.
+          writeWord((uint32_t)m_entries.size(), os);
+          // Chunk id.
+          writeFourCC("00dc", os);
+          // Reserved.
+          writeWord(0, os);
+          writeWord(0, os);
+          writeWord(0, os);
+
+          for (size_t i = 0; i < m_capacity; ++i)
+          {
+            if (i < m_entries.size())
+            {
+              writeQuad(m_entries[i].offset, os);
+              writeWord(m_entries[i].size, os);
+              writeWord(m_entries[i].duration, os);
+            }
+            else
+            {
+              writeQuad(0, os);
+              writeWord(0, os);
+              writeWord(0, os);
+            }
+          }
+        }
+
+      private:
+        //! Super index entry.
+        struct Entry
+        {
+          //! Absolute offset of the standard index.
+          uint64_t offset;
+          //! Size of the standard index.
+          uint32_t size;
+          //! Number of frames referenced.
+          uint32_t duration;
+        };
+
+        //! Maximum number of entries.
+        size_t m_capacity;
+        //! Entries.
+        std::vector<Entry> m_entries;
+      };
+    }
+  }
+}
+
+#endif
@@ -49,13 +49,16 @@ namespace DUNE
         uint32_t fps;
         //! Number of frames in the stream.
         uint32_t total_frames;
+        //! Number of frames in the first RIFF segment.
+        uint32_t riff_frames;
 
         //! Constructor.
         Properties(void):
           width(0),
           height(0),
           fps(0),
-          total_frames(0)
+          total_frames(0),
+          riff_frames(0)
         {  }
       };
     }
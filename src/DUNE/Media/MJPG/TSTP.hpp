@@ -66,6 +66,22 @@ namespace DUNE
           setDataSize(getDataSize() + 8);
         }
 
+        //! Retrieve the number of timestamps.
+        //! @return number of timestamps.
+        size_t
+        getCount(void) const
+        {
+          return m_index.size();
+        }
+
+        //! Remove all timestamps.
+        void
+        clear(void)
+        {
+          m_index.clear();
+          setDataSize(0);
+        }
+
         //! Write chunk data to output stream.
         //! @param[in] os output stream.
         void
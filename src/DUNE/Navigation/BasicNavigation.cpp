@@ -30,6 +30,7 @@
 
 // Local headers.
 #include <DUNE/Navigation/BasicNavigation.hpp>
+#include <DUNE/Tasks/Tracer.hpp>
 
 namespace DUNE
 {
@@ -487,6 +488,7 @@ namespace DUNE
       if (m_declination_defined && m_use_declination)
         m_euler_bfr[AXIS_Z] += m_declination;
 
+      m_euler_trace = msg->getTraceContext();
       m_time_without_euler.reset();
     }
 
@@ -1076,6 +1078,8 @@ namespace DUNE
       m_uncertainty.setTimeStamp(tstamp);
       m_navdata.setTimeStamp(tstamp);
 
+      // The estimate is derived from the last attitude reading.
+      Tasks::Tracer::Cause cause(m_euler_trace);
       dispatch(m_estate, DF_KEEP_TIME);
       dispatch(m_uncertainty, DF_KEEP_TIME);
       dispatch(m_navdata, DF_KEEP_TIME);
@@ -1125,6 +1129,8 @@ namespace DUNE
       m_euler_bfr[AXIS_Y] = 0.0;
       m_euler_bfr[AXIS_Z] = 0.0;
       m_euler_readings = 0.0;
+      m_euler_trace.trace = 0;
+      m_euler_trace.span = 0;
     }
 
     void
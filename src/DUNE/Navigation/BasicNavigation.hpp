@@ -687,6 +687,8 @@ namespace DUNE
       double m_euler_bfr[3];
       double m_agvel_bfr[3];
       double m_accel_bfr[3];
+      //! Trace context of the last Euler Angles reading.
+      IMC::TraceContext m_euler_trace;
       //! Euler Angles Delta.
       double m_edelta_bfr[3];
       //! Euler Angles Delta timestep.
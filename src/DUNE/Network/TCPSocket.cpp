@@ -28,6 +28,7 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <cstring>
 #include <sstream>
 #include <iostream>
@@ -270,19 +271,17 @@ namespace DUNE
       if (fd == -1)
         return false;
 
-      int64_t remaining = off_end;
-      off64_t offset = 0;
-      if (off_beg > 0)
-      {
-        offset = off_beg;
-        remaining -= off_beg;
-      }
+      off64_t offset = (off_beg > 0) ? off_beg : 0;
+      int64_t remaining = off_end - offset + 1;
 
-      while (remaining >= 0)
+      // Send exactly the requested range, other responses may
+      // follow on the same connection.
+      while (remaining > 0)
       {
-        ssize_t rv = sendfile64(m_handle, fd, &offset, c_block_size);
+        size_t count = (size_t)std::min((int64_t)c_block_size, remaining);
+        ssize_t rv = sendfile64(m_handle, fd, &offset, count);
 
-        if (rv == -1)
+        if (rv <= 0)
         {
           close(fd);
           return false;
@@ -298,28 +297,28 @@ namespace DUNE
 #else
       std::ifstream ifs(filename, std::ios::binary);
 
-      int64_t remaining = off_end;
-      if (off_beg > 0)
+      int64_t offset = (off_beg > 0) ? off_beg : 0;
+      int64_t remaining = off_end - offset + 1;
+      if (offset > 0)
       {
-        ifs.seekg(off_beg, std::ios::beg);
+        ifs.seekg(offset, std::ios::beg);
         if (ifs.fail())
           return false;
-
-        remaining -= off_beg;
       }
 
       char bfr[c_block_size];
-      int64_t rv = 0;
 
-      while (remaining >= 0)
+      while (remaining > 0)
       {
-        ifs.read(bfr, c_block_size);
-        rv = write(bfr, ifs.gcount());
-
-        if (rv == -1)
+        ifs.read(bfr, std::min((int64_t)c_block_size, remaining));
+        int64_t count = ifs.gcount();
+        if (count <= 0)
           return false;
 
-        remaining -= rv;
+        for (int64_t sent = 0; sent < count; )
+          sent += write(bfr + sent, count - sent);
+
+        remaining -= count;
       }
 
       return true;
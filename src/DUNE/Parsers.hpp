@@ -39,6 +39,8 @@ namespace DUNE
 
 #include <DUNE/Parsers/Config.hpp>
 #include <DUNE/Parsers/PD4.hpp>
+#include <DUNE/Parsers/NMEATokenizer.hpp>
+#include <DUNE/Parsers/NMEADispatcher.hpp>
 #include <DUNE/Parsers/NMEAReader.hpp>
 #include <DUNE/Parsers/NMEASentence.hpp>
 #include <DUNE/Parsers/NMEAWriter.hpp>
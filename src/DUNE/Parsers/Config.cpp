@@ -209,7 +209,7 @@ namespace DUNE
     std::vector<std::string>
     Config::sections(void)
     {
-      Concurrency::ScopedRWLock(m_data_lock, false);
+      Concurrency::ScopedRWLock l(m_data_lock, false);
 
       std::vector<std::string> vec;
       for (Sections::iterator itr = m_data.begin(); itr != m_data.end(); ++itr)
@@ -220,7 +220,7 @@ namespace DUNE
     std::vector<std::string>
     Config::options(const std::string& section)
     {
-      Concurrency::ScopedRWLock(m_data_lock, false);
+      Concurrency::ScopedRWLock l(m_data_lock, false);
 
       Sections::const_iterator sitr = m_data.find(section);
 
@@ -239,7 +239,7 @@ namespace DUNE
     std::ostream&
     operator<<(std::ostream& os, const Config& cfg)
     {
-      Concurrency::ScopedRWLock(cfg.m_data_lock, false);
+      Concurrency::ScopedRWLock l(cfg.m_data_lock, false);
 
       Config::Sections::const_iterator sections;
       Config::Section::const_iterator labels;
@@ -82,7 +82,7 @@ namespace DUNE
       void
       set(const std::string& section, const std::string& option, const std::string& value)
       {
-        Concurrency::ScopedRWLock(m_data_lock, true);
+        Concurrency::ScopedRWLock l(m_data_lock, true);
         m_data[section][option] = value;
       }
 
@@ -93,8 +93,17 @@ namespace DUNE
       std::string
       get(const std::string& section, const std::string& option)
       {
-        Concurrency::ScopedRWLock(m_data_lock, false);
-        return m_data[section][option];
+        Concurrency::ScopedRWLock l(m_data_lock, false);
+
+        Sections::const_iterator sitr = m_data.find(section);
+        if (sitr == m_data.end())
+          return std::string();
+
+        Section::const_iterator itr = sitr->second.find(option);
+        if (itr == sitr->second.end())
+          return std::string();
+
+        return itr->second;
       }
 
       //! Set the option map of a given section.
@@ -103,7 +112,7 @@ namespace DUNE
       void
       setSection(const std::string& section, const std::map<std::string, std::string>& map)
       {
-        Concurrency::ScopedRWLock(m_data_lock, true);
+        Concurrency::ScopedRWLock l(m_data_lock, true);
         m_data[section] = map;
       }
 
@@ -113,8 +122,13 @@ namespace DUNE
       std::map<std::string, std::string>
       getSection(const std::string& section)
       {
-        Concurrency::ScopedRWLock(m_data_lock, false);
-        return m_data[section];
+        Concurrency::ScopedRWLock l(m_data_lock, false);
+
+        Sections::const_iterator sitr = m_data.find(section);
+        if (sitr == m_data.end())
+          return Section();
+
+        return sitr->second;
       }
 
       //! Retrieve the value of an option in a given section and perform type conversion.
@@ -126,7 +140,8 @@ namespace DUNE
       void
       get(const std::string& sec, const std::string& opt, const std::string& def, Type& var)
       {
-        Concurrency::ScopedRWLock(m_data_lock, false);
+        // Unknown options are stored with their default value.
+        Concurrency::ScopedRWLock l(m_data_lock, true);
         if (m_data[sec].find(opt) != m_data[sec].end())
         {
           if (castLexical(m_data[sec][opt], var))
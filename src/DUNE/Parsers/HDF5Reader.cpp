@@ -139,6 +139,64 @@ namespace DUNE
 #endif
     }
 
+    std::vector<size_t>
+    HDF5Reader::getDimensions(std::string const& path) const
+    {
+#ifdef DUNE_H5CPP_ENABLED
+      if (!dsetExists(m_file.get(), path))
+        throw std::runtime_error(
+            DTR("HDF5Reader::getDimensions(): The requested dataset does not "
+                "exist."));
+
+      auto dset = m_file->root().get_dataset(path);
+      auto dimensions =
+          hdf5::dataspace::Simple(dset.dataspace()).current_dimensions();
+
+      return std::vector<size_t>(std::begin(dimensions), std::end(dimensions));
+#else
+      (void)path;
+      return {};
+#endif
+    }
+
+    template<typename T>
+    std::vector<T>
+    HDF5Reader::getHyperslab(std::string const& path,
+                             std::vector<size_t> const& offset,
+                             std::vector<size_t> const& count) const
+    {
+#ifdef DUNE_H5CPP_ENABLED
+      if (!dsetExists(m_file.get(), path))
+        throw std::runtime_error(
+            DTR("HDF5Reader::getHyperslab(): The requested dataset does not "
+                "exist."));
+
+      if (offset.size() != count.size())
+        throw std::runtime_error(
+            DTR("HDF5Reader::getHyperslab(): offset and count dimensions do "
+                "not match."));
+
+      auto dset = m_file->root().get_dataset(path);
+
+      hdf5::Dimensions start(std::begin(offset), std::end(offset));
+      hdf5::Dimensions block(std::begin(count), std::end(count));
+      hdf5::dataspace::Hyperslab slab(start, block);
+
+      size_t size = std::accumulate(
+          std::begin(count), std::end(count), 1, std::multiplies<size_t>());
+
+      std::vector<T> data(size);
+      dset.read(data, slab);
+
+      return data;
+#else
+      (void)path;
+      (void)offset;
+      (void)count;
+      return {};
+#endif
+    }
+
     template<typename T>
     std::vector<T>
     HDF5Reader::getAttribute(std::string const& path,
@@ -177,6 +235,22 @@ namespace DUNE
     template HDF5Reader::HDF5Dataset<long double>
     HDF5Reader::getDataset(std::string const&) const;
 
+    // Template specialization declarations for getHyperslab
+    template std::vector<float>
+    HDF5Reader::getHyperslab(std::string const&,
+                             std::vector<size_t> const&,
+                             std::vector<size_t> const&) const;
+
+    template std::vector<double>
+    HDF5Reader::getHyperslab(std::string const&,
+                             std::vector<size_t> const&,
+                             std::vector<size_t> const&) const;
+
+    template std::vector<long double>
+    HDF5Reader::getHyperslab(std::string const&,
+                             std::vector<size_t> const&,
+                             std::vector<size_t> const&) const;
+
     // Template specialization declarations for getAttribute
     template std::vector<char>
     HDF5Reader::getAttribute<char>(std::string const&,
@@ -83,6 +83,23 @@ namespace DUNE
       HDF5Dataset<T>
       getDataset(std::string const& path) const;
 
+      //! Get the dimensions of a dataset without reading its data.
+      //! @param[in] path path to the dataset in the file.
+      //! @return number of points in each dimension.
+      std::vector<size_t>
+      getDimensions(std::string const& path) const;
+
+      //! Read a rectangular block (hyperslab) of a dataset.
+      //! @param[in] path path to the dataset in the file.
+      //! @param[in] offset indices of the first point of the block.
+      //! @param[in] count number of points of the block in each dimension.
+      //! @return the data values of the block in row-major (C-style) order.
+      template<typename T>
+      std::vector<T>
+      getHyperslab(std::string const& path,
+                   std::vector<size_t> const& offset,
+                   std::vector<size_t> const& count) const;
+
       //! Get an attribute.
       //! @param[in] path path to the node in the file where the attribute is
       //! stored.
@@ -0,0 +1,109 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_PARSERS_NMEA_DISPATCHER_HPP_INCLUDED_
+#define DUNE_PARSERS_NMEA_DISPATCHER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Parsers/NMEATokenizer.hpp>
+
+namespace DUNE
+{
+  namespace Parsers
+  {
+    //! Registry of handlers for NMEA sentences, selected by matching
+    //! the sentence code against patterns where '?' matches any
+    //! character (e.g., "G?GGA"). Handlers are tried in registration
+    //! order and dispatching does not allocate memory.
+    template <typename T>
+    class NMEADispatcher
+    {
+    public:
+      //! Sentence handler.
+      typedef void (T::*Handler)(const NMEATokenizer& stn);
+
+      //! Constructor.
+      //! @param[in] object object owning the handlers.
+      NMEADispatcher(T* object):
+        m_object(object)
+      { }
+
+      //! Register a sentence handler.
+      //! @param[in] pattern sentence code pattern.
+      //! @param[in] handler handler.
+      void
+      add(const std::string& pattern, Handler handler)
+      {
+        Entry entry;
+        entry.pattern = pattern;
+        entry.handler = handler;
+        m_entries.push_back(entry);
+      }
+
+      //! Call the handler of a sentence.
+      //! @param[in] stn tokenized sentence.
+      //! @return true if a handler was called, false otherwise.
+      bool
+      dispatch(const NMEATokenizer& stn) const
+      {
+        for (size_t i = 0; i < m_entries.size(); ++i)
+        {
+          if (stn.matches(0, m_entries[i].pattern.c_str()))
+          {
+            (m_object->*m_entries[i].handler)(stn);
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+    private:
+      //! Registered handler.
+      struct Entry
+      {
+        //! Sentence code pattern.
+        std::string pattern;
+        //! Handler.
+        Handler handler;
+      };
+
+      //! Object owning the handlers.
+      T* m_object;
+      //! Registered handlers.
+      std::vector<Entry> m_entries;
+    };
+  }
+}
+
+#endif
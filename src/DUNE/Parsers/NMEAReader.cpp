@@ -25,13 +25,11 @@
 // http://ec.europa.eu/idabc/eupl.html.                                     *
 //***************************************************************************
 // Author: Ricardo Martins                                                  *
-//***************************************************************************
 
 // ISO C++ 98 headers.
 #include <string>
-#include <sstream>
-#include <cstdio>
-#include <iostream>
+#include <cstring>
+#include <cstdlib>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -46,7 +44,8 @@ namespace DUNE
   namespace Parsers
   {
     NMEAReader::NMEAReader(const std::string& sentence):
-      m_field(0)
+      m_sentence(sentence),
+      m_field(1)
     {
       // Clean sentence beginning.
       size_t lead_idx = sentence.find_first_not_of(c_blanks);
@@ -56,94 +55,56 @@ namespace DUNE
       if (sentence[lead_idx] != '$')
         throw InvalidSentence("missing dollar sign", sentence.c_str());
 
-      // Clean sentence end.
-      size_t trail_idx = sentence.find_last_not_of(c_blanks);
-
-      // The calculation of length is off by one, but since we are
-      // getting rid of the dollar sign it's correct.
-      m_length = trail_idx - lead_idx;
-      ++lead_idx;
-
-      // Create proper string.
-      std::string proper = sentence.substr(lead_idx, m_length);
-
-      // Check if the sentence contains a checksum.
-      size_t csum_idx = proper.find_last_of('*');
-      if (csum_idx == m_length - 3)
+      switch (m_stn.parse(m_sentence, false))
       {
-        // Extract checksum.
-        uint8_t rcsum = parseChecksum(proper.c_str() + csum_idx + 1);
-
-        // Get rid of checksum.
-        m_length -= 3;
-        proper.resize(m_length);
-
-        // Compute checksum and count fields.
-        uint8_t ccsum = 0;
-        for (unsigned i = 0; i < m_length; ++i)
-          ccsum ^= proper[i];
+        case NMEATokenizer::NMEA_OK:
+          break;
 
-        //! Validate checksum.
-        if (ccsum != rcsum)
+        case NMEATokenizer::NMEA_CHECKSUM_MISMATCH:
         {
+          // Slow path: recompute checksums for the error message.
+          size_t csum_idx = m_sentence.find_last_of('*');
+          unsigned char ccsum = 0;
+          for (size_t i = lead_idx + 1; i < csum_idx; ++i)
+            ccsum ^= m_sentence[i];
+
+          unsigned rcsum = std::strtoul(m_sentence.substr(csum_idx + 1, 2).c_str(), NULL, 16);
           throw ChecksumMismatch(ccsum, rcsum);
         }
-      }
-      else
-      {
-        if (csum_idx != std::string::npos)
+
+        case NMEATokenizer::NMEA_TOO_MANY_FIELDS:
+          throw InvalidSentence("too many fields", sentence.c_str());
+
+        default:
           throw InvalidChecksum();
       }
 
-      //! Initialize input string stream.
-      m_stream.str(proper);
-
-      //! Extract code.
-      m_bfr = new char[m_length];
-      m_stream.get(m_bfr, m_length, ',');
-      if (m_stream.gcount() <= 0)
+      if (m_stn.isEmpty(0))
         throw InvalidCode();
-      ++m_field;
 
-      m_code = m_bfr;
+      m_stn.getString(0, m_code);
     }
 
     NMEAReader::~NMEAReader(void)
-    {
-      delete [] m_bfr;
-    }
+    { }
 
     NMEAReader&
     NMEAReader::skip(void)
     {
-      checkFieldStart();
-
-      m_stream.get(m_bfr, m_length, ',');
-
-      if (m_stream.fail())
-        throw ConversionError("discard type", m_field);
-
-      ++m_field;
-
+      nextField();
       return *this;
     }
 
     NMEAReader&
     NMEAReader::operator>>(bool& value)
     {
-      checkFieldStart();
+      unsigned field = nextValue("boolean");
 
-      if (m_stream.peek() == ',')
-      {
-        ++m_field;
-        throw ConversionError("boolean", m_field);
-      }
-
-      m_stream >> value;
-      if (m_stream.fail())
-        throw ConversionError("boolean", m_field);
+      unsigned tmp = 0;
+      if (!m_stn.readDecimal(field, tmp) || tmp > 1)
+        throw ConversionError("boolean", field);
 
-      ++m_field;
+      value = (tmp == 1);
 
       return *this;
     }
@@ -151,19 +112,10 @@ namespace DUNE
     NMEAReader&
     NMEAReader::operator>>(int& value)
     {
-      checkFieldStart();
-
-      if (m_stream.peek() == ',')
-      {
-        ++m_field;
-        throw ConversionError("int", m_field);
-      }
+      unsigned field = nextValue("integer");
 
-      m_stream >> value;
-      if (m_stream.fail())
-        throw ConversionError("integer", m_field);
-
-      ++m_field;
+      if (!m_stn.readDecimal(field, value))
+        throw ConversionError("integer", field);
 
       return *this;
     }
@@ -171,19 +123,10 @@ namespace DUNE
     NMEAReader&
     NMEAReader::operator>>(unsigned& value)
     {
-      checkFieldStart();
-
-      if (m_stream.peek() == ',')
-      {
-        ++m_field;
-        throw ConversionError("unsigned", m_field);
-      }
-
-      m_stream >> value;
-      if (m_stream.fail())
-        throw ConversionError("unsigned", m_field);
+      unsigned field = nextValue("unsigned");
 
-      ++m_field;
+      if (!m_stn.readDecimal(field, value))
+        throw ConversionError("unsigned", field);
 
       return *this;
     }
@@ -191,19 +134,10 @@ namespace DUNE
     NMEAReader&
     NMEAReader::operator>>(float& value)
     {
-      checkFieldStart();
-
-      if (m_stream.peek() == ',')
-      {
-        ++m_field;
-        throw ConversionError("float", m_field);
-      }
-
-      m_stream >> value;
-      if (m_stream.fail())
-        throw ConversionError("float", m_field);
+      unsigned field = nextValue("float");
 
-      ++m_field;
+      if (!m_stn.readNumber(field, value))
+        throw ConversionError("float", field);
 
       return *this;
     }
@@ -211,19 +145,10 @@ namespace DUNE
     NMEAReader&
     NMEAReader::operator>>(double& value)
     {
-      checkFieldStart();
-
-      if (m_stream.peek() == ',')
-      {
-        ++m_field;
-        throw ConversionError("double", m_field);
-      }
+      unsigned field = nextValue("double");
 
-      m_stream >> value;
-      if (m_stream.fail())
-        throw ConversionError("double", m_field);
-
-      ++m_field;
+      if (!m_stn.readNumber(field, value))
+        throw ConversionError("double", field);
 
       return *this;
     }
@@ -231,22 +156,7 @@ namespace DUNE
     NMEAReader&
     NMEAReader::operator>>(std::string& value)
     {
-      checkFieldStart();
-
-      if (m_stream.peek() == ',')
-      {
-        value = "";
-      }
-      else
-      {
-        m_bfr[0] = 0;
-        m_stream.get(m_bfr, m_length, ',');
-        if (m_stream.fail() && !m_stream.eof())
-          throw ConversionError("string", m_field);
-        value.assign(m_bfr);
-      }
-
-      ++m_field;
+      m_stn.getString(nextField(), value);
 
       return *this;
     }
@@ -254,44 +164,27 @@ namespace DUNE
     bool
     NMEAReader::eos(void)
     {
-      return (m_stream.eof() || m_stream.peek() == EOF);
+      return m_field >= m_stn.getFieldCount();
     }
 
-    void
-    NMEAReader::checkFieldStart(void)
+    unsigned
+    NMEAReader::nextField(void)
     {
-      int c = m_stream.get();
-
-      if (m_stream.eof())
+      if (eos())
         throw ReaderError("trying to extract fields past the end of the sentence");
 
-      if (c != ',')
-        throw ReaderError(Utils::String::str("expecting ',' but got '%c'", c));
+      return m_field++;
     }
 
-    unsigned char
-    NMEAReader::parseChecksum(const char* str)
+    unsigned
+    NMEAReader::nextValue(const char* type)
     {
-      unsigned char result = 0;
-      unsigned shift = 4;
-
-      for (unsigned i = 0; i < 2; ++i)
-      {
-        unsigned char byte = str[i];
-
-        if (byte >= '0' && byte <= '9')
-          result |= (byte - '0') << shift;
-        else if (byte >= 'a' && byte <= 'f')
-          result |= (byte - 'a' + 10) << shift;
-        else if (byte >= 'A' && byte <= 'F')
-          result |= (byte - 'A' + 10) << shift;
-        else
-          throw InvalidChecksum();
+      unsigned field = nextField();
 
-        shift = 0;
-      }
+      if (m_stn.isEmpty(field))
+        throw ConversionError(type, field);
 
-      return result;
+      return field;
     }
   }
 }
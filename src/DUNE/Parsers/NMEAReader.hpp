@@ -25,17 +25,16 @@
 // http://ec.europa.eu/idabc/eupl.html.                                     *
 //***************************************************************************
 // Author: Ricardo Martins                                                  *
-//***************************************************************************
 
 #ifndef DUNE_PARSERS_NMEA_READER_HPP_INCLUDED_
 #define DUNE_PARSERS_NMEA_READER_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
 #include <string>
-#include <sstream>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/Parsers/NMEATokenizer.hpp>
 
 namespace DUNE
 {
@@ -118,26 +117,25 @@ namespace DUNE
       eos(void);
 
     private:
-      //! Input stream.
-      std::istringstream m_stream;
+      //! Copy of the sentence (referenced by the tokenizer).
+      std::string m_sentence;
+      //! Sentence fields.
+      NMEATokenizer m_stn;
       //! Sentence code.
       std::string m_code;
-      //! Sentence length in bytes.
-      unsigned m_length;
       //! Current field number.
       unsigned m_field;
-      //! Internal buffer.
-      char* m_bfr;
-
-      //! Check if we can convert the next field.
-      void
-      checkFieldStart(void);
-
-      //! Parse NMEA checksum.
-      //! @param checksum in ASCII format.
-      //! @return checksum in unsigned char format.
-      unsigned char
-      parseChecksum(const char* str);
+
+      //! Get the index of the next field to extract.
+      //! @return field index.
+      unsigned
+      nextField(void);
+
+      //! Get the index of the next field to convert.
+      //! @param type name of the conversion type.
+      //! @return field index.
+      unsigned
+      nextValue(const char* type);
     };
   }
 }
@@ -0,0 +1,421 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Parsers/NMEATokenizer.hpp>
+
+namespace DUNE
+{
+  namespace Parsers
+  {
+    //! Exact powers of ten representable in double precision.
+    static const double c_pow10[] =
+    {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    //! Largest mantissa that can be exactly represented in double
+    //! precision.
+    static const uint64_t c_max_exact_mantissa = (uint64_t)1 << 53;
+    //! Largest mantissa that can accumulate another digit.
+    static const uint64_t c_max_mantissa = (UINT64_MAX - 9) / 10;
+
+    //! Convert a hexadecimal digit.
+    //! @param[in] c character.
+    //! @return digit value or -1 if not a hexadecimal digit.
+    static int
+    hexDigit(char c)
+    {
+      if (c >= '0' && c <= '9')
+        return c - '0';
+      if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+      if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+      return -1;
+    }
+
+    //! Test if a character is a decimal digit.
+    //! @param[in] c character.
+    //! @return true if c is a digit, false otherwise.
+    static inline bool
+    isDigit(char c)
+    {
+      return c >= '0' && c <= '9';
+    }
+
+    //! Test if a character can trail a sentence.
+    //! @param[in] c character.
+    //! @return true if c is a blank, false otherwise.
+    static inline bool
+    isBlank(char c)
+    {
+      return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\0';
+    }
+
+    NMEATokenizer::NMEATokenizer(void):
+      m_count(0)
+    { }
+
+    NMEATokenizer::Result
+    NMEATokenizer::parse(const char* data, size_t size, bool checksum)
+    {
+      m_count = 0;
+
+      const char* end = data + size;
+      const char* start = data;
+      while (start < end && *start != '$' && *start != '!')
+        ++start;
+
+      if (start == end)
+        return NMEA_NO_START;
+
+      while (end > start && isBlank(end[-1]))
+        --end;
+
+      const char* body = start + 1;
+      const char* body_end = end;
+
+      if (end - body >= 3 && end[-3] == '*')
+      {
+        int hi = hexDigit(end[-2]);
+        int lo = hexDigit(end[-1]);
+        if (hi < 0 || lo < 0)
+          return NMEA_INVALID_CHECKSUM;
+
+        body_end = end - 3;
+
+        uint8_t ccsum = 0;
+        for (const char* p = body; p < body_end; ++p)
+          ccsum ^= (uint8_t)*p;
+
+        if (ccsum != ((hi << 4) | lo))
+          return NMEA_CHECKSUM_MISMATCH;
+      }
+      else if (std::memchr(body, '*', end - body) != NULL)
+      {
+        return NMEA_INVALID_CHECKSUM;
+      }
+      else if (checksum)
+      {
+        return NMEA_NO_CHECKSUM;
+      }
+
+      const char* field = body;
+      for (const char* p = body; ; ++p)
+      {
+        if (p != body_end && *p != ',')
+          continue;
+
+        if (m_count == c_max_fields)
+        {
+          m_count = 0;
+          return NMEA_TOO_MANY_FIELDS;
+        }
+
+        m_fields[m_count] = field;
+        m_sizes[m_count] = p - field;
+        ++m_count;
+        field = p + 1;
+
+        if (p == body_end)
+          break;
+      }
+
+      return NMEA_OK;
+    }
+
+    const char*
+    NMEATokenizer::getResultString(Result result)
+    {
+      switch (result)
+      {
+        case NMEA_OK:
+          return "valid sentence";
+        case NMEA_NO_START:
+          return "missing start delimiter";
+        case NMEA_NO_CHECKSUM:
+          return "missing checksum";
+        case NMEA_INVALID_CHECKSUM:
+          return "no proper checksum found";
+        case NMEA_CHECKSUM_MISMATCH:
+          return "checksum mismatch";
+        case NMEA_TOO_MANY_FIELDS:
+          return "too many fields";
+      }
+
+      return "unknown error";
+    }
+
+    bool
+    NMEATokenizer::matches(unsigned index, const char* pattern) const
+    {
+      if (index >= m_count)
+        return false;
+
+      const char* field = m_fields[index];
+      size_t size = m_sizes[index];
+
+      for (size_t i = 0; i < size; ++i)
+      {
+        if (pattern[i] == '\0')
+          return false;
+
+        if (pattern[i] != '?' && pattern[i] != field[i])
+          return false;
+      }
+
+      return pattern[size] == '\0';
+    }
+
+    bool
+    NMEATokenizer::readTime(unsigned index, double& value) const
+    {
+      size_t size = getFieldSize(index);
+      if (size < 6)
+        return false;
+
+      const char* f = m_fields[index];
+      for (unsigned i = 0; i < 4; ++i)
+      {
+        if (!isDigit(f[i]))
+          return false;
+      }
+
+      unsigned h = (f[0] - '0') * 10 + (f[1] - '0');
+      unsigned m = (f[2] - '0') * 10 + (f[3] - '0');
+
+      double s = 0;
+      if (!isDigit(f[4]) || parseNumber(f + 4, f + size, s) != f + size)
+        return false;
+
+      if (h > 23 || m > 59 || s >= 61)
+        return false;
+
+      value = h * 3600 + m * 60 + s;
+      return true;
+    }
+
+    const char*
+    NMEATokenizer::parseDecimal(const char* first, const char* last, int64_t& value)
+    {
+      const char* p = first;
+      bool negative = false;
+
+      if (p < last && (*p == '-' || *p == '+'))
+      {
+        negative = (*p == '-');
+        ++p;
+      }
+
+      const char* digits = p;
+      uint64_t tmp = 0;
+      for (; p < last && isDigit(*p); ++p)
+      {
+        if (tmp > c_max_mantissa)
+          return NULL;
+        tmp = tmp * 10 + (*p - '0');
+      }
+
+      if (p == digits)
+        return NULL;
+
+      if (negative)
+      {
+        if (tmp > (uint64_t)INT64_MAX + 1)
+          return NULL;
+        value = (int64_t)(0 - tmp);
+      }
+      else
+      {
+        if (tmp > (uint64_t)INT64_MAX)
+          return NULL;
+        value = (int64_t)tmp;
+      }
+
+      return p;
+    }
+
+    const char*
+    NMEATokenizer::parseNumber(const char* first, const char* last, double& value)
+    {
+      const char* p = first;
+      bool negative = false;
+
+      if (p < last && (*p == '-' || *p == '+'))
+      {
+        negative = (*p == '-');
+        ++p;
+      }
+
+      uint64_t mantissa = 0;
+      int exponent = 0;
+      bool digits = false;
+
+      // Integer part.
+      for (; p < last && isDigit(*p); ++p)
+      {
+        digits = true;
+        if (mantissa <= c_max_mantissa)
+          mantissa = mantissa * 10 + (*p - '0');
+        else
+          ++exponent;
+      }
+
+      // Fractional part.
+      if (p < last && *p == '.')
+      {
+        for (++p; p < last && isDigit(*p); ++p)
+        {
+          digits = true;
+          if (mantissa <= c_max_mantissa)
+          {
+            mantissa = mantissa * 10 + (*p - '0');
+            --exponent;
+          }
+        }
+      }
+
+      if (!digits)
+        return NULL;
+
+      // Exponent (ignored if not followed by digits).
+      if (p < last && (*p == 'e' || *p == 'E'))
+      {
+        const char* q = p + 1;
+        bool exp_negative = false;
+        if (q < last && (*q == '-' || *q == '+'))
+        {
+          exp_negative = (*q == '-');
+          ++q;
+        }
+
+        if (q < last && isDigit(*q))
+        {
+          int exp = 0;
+          for (; q < last && isDigit(*q); ++q)
+          {
+            if (exp < 10000)
+              exp = exp * 10 + (*q - '0');
+          }
+
+          exponent += exp_negative ? -exp : exp;
+          p = q;
+        }
+      }
+
+      // A single rounding when both the mantissa and the power of
+      // ten are exact, as is the case for typical NMEA fields.
+      double result = (double)mantissa;
+      if (exponent != 0)
+      {
+        if (mantissa <= c_max_exact_mantissa && exponent >= -22 && exponent <= 22)
+        {
+          if (exponent < 0)
+            result /= c_pow10[-exponent];
+          else
+            result *= c_pow10[exponent];
+        }
+        else
+        {
+          result *= std::pow(10.0, exponent);
+        }
+      }
+
+      value = negative ? -result : result;
+      return p;
+    }
+
+    bool
+    NMEATokenizer::readField(unsigned index, int64_t& value) const
+    {
+      size_t size = getFieldSize(index);
+      if (size == 0)
+        return false;
+
+      const char* f = m_fields[index];
+      return parseDecimal(f, f + size, value) == f + size;
+    }
+
+    bool
+    NMEATokenizer::readField(unsigned index, double& value) const
+    {
+      size_t size = getFieldSize(index);
+      if (size == 0)
+        return false;
+
+      const char* f = m_fields[index];
+      return parseNumber(f, f + size, value) == f + size;
+    }
+
+    bool
+    NMEATokenizer::readCoordinate(unsigned index, char positive, char negative,
+                                  double limit, double& value) const
+    {
+      size_t size = getFieldSize(index);
+      if (size == 0 || getFieldSize(index + 1) != 1)
+        return false;
+
+      char hemisphere = m_fields[index + 1][0];
+      if (hemisphere != positive && hemisphere != negative)
+        return false;
+
+      // Degrees are all integer digits but the last two.
+      const char* f = m_fields[index];
+      const char* dot = (const char*)std::memchr(f, '.', size);
+      const char* minutes = (dot == NULL ? f + size : dot) - 2;
+      if (minutes < f)
+        return false;
+
+      unsigned degrees = 0;
+      for (const char* p = f; p < minutes; ++p)
+      {
+        if (!isDigit(*p))
+          return false;
+        degrees = degrees * 10 + (*p - '0');
+      }
+
+      double mins = 0;
+      if (!isDigit(*minutes) || parseNumber(minutes, f + size, mins) != f + size)
+        return false;
+
+      double result = degrees + mins / 60.0;
+      if (mins >= 60.0 || result > limit)
+        return false;
+
+      value = (hemisphere == negative) ? -result : result;
+      return true;
+    }
+  }
+}
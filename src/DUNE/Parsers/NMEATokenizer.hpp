@@ -0,0 +1,305 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_PARSERS_NMEA_TOKENIZER_HPP_INCLUDED_
+#define DUNE_PARSERS_NMEA_TOKENIZER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <string>
+#include <limits>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Parsers
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM NMEATokenizer;
+
+    //! In-place NMEA 0183 sentence tokenizer. Fields are referenced
+    //! directly in the caller's buffer, which must outlive the
+    //! tokenizer's use, and no memory is allocated while parsing or
+    //! converting fields. Field zero is the sentence code (e.g.,
+    //! GPGGA) and the checksum is not part of the fields.
+    class NMEATokenizer
+    {
+    public:
+      //! Maximum number of fields in a sentence.
+      static const unsigned c_max_fields = 64;
+
+      //! Result of parsing a sentence.
+      enum Result
+      {
+        //! Valid sentence.
+        NMEA_OK,
+        //! Start delimiter ('$' or '!') not found.
+        NMEA_NO_START,
+        //! Sentence has no checksum and one is required.
+        NMEA_NO_CHECKSUM,
+        //! Checksum is malformed or misplaced.
+        NMEA_INVALID_CHECKSUM,
+        //! Checksum does not match sentence contents.
+        NMEA_CHECKSUM_MISMATCH,
+        //! Sentence has more than c_max_fields fields.
+        NMEA_TOO_MANY_FIELDS
+      };
+
+      //! Constructor.
+      NMEATokenizer(void);
+
+      //! Tokenize a sentence. Noise before the start delimiter and
+      //! blanks after the checksum are ignored.
+      //! @param[in] data sentence.
+      //! @param[in] size sentence length.
+      //! @param[in] checksum true if a checksum is required.
+      //! @return parsing result.
+      Result
+      parse(const char* data, size_t size, bool checksum);
+
+      //! Tokenize a null terminated sentence.
+      //! @param[in] sentence sentence.
+      //! @param[in] checksum true if a checksum is required.
+      //! @return parsing result.
+      Result
+      parse(const char* sentence, bool checksum = true)
+      {
+        return parse(sentence, std::strlen(sentence), checksum);
+      }
+
+      //! Tokenize a sentence.
+      //! @param[in] sentence sentence.
+      //! @param[in] checksum true if a checksum is required.
+      //! @return parsing result.
+      Result
+      parse(const std::string& sentence, bool checksum = true)
+      {
+        return parse(sentence.data(), sentence.size(), checksum);
+      }
+
+      // Fields would reference a destroyed temporary.
+      Result
+      parse(std::string&& sentence, bool checksum = true) = delete;
+
+      //! Get a printable description of a parsing result.
+      //! @param[in] result parsing result.
+      //! @return description.
+      static const char*
+      getResultString(Result result);
+
+      //! Get number of fields, including the sentence code.
+      //! @return number of fields.
+      unsigned
+      getFieldCount(void) const
+      {
+        return m_count;
+      }
+
+      //! Get the beginning of a field (not null terminated).
+      //! @param[in] index field index.
+      //! @return pointer to field contents.
+      const char*
+      getField(unsigned index) const
+      {
+        return m_fields[index];
+      }
+
+      //! Get length of a field.
+      //! @param[in] index field index.
+      //! @return field length (zero if field does not exist).
+      size_t
+      getFieldSize(unsigned index) const
+      {
+        if (index >= m_count)
+          return 0;
+
+        return m_sizes[index];
+      }
+
+      //! Copy a field to a string.
+      //! @param[in] index field index.
+      //! @param[out] value string.
+      void
+      getString(unsigned index, std::string& value) const
+      {
+        value.assign(m_fields[index], getFieldSize(index));
+      }
+
+      //! Test if a field is missing or empty.
+      //! @param[in] index field index.
+      //! @return true if field is empty, false otherwise.
+      bool
+      isEmpty(unsigned index) const
+      {
+        return getFieldSize(index) == 0;
+      }
+
+      //! Test if a field equals a string.
+      //! @param[in] index field index.
+      //! @param[in] str null terminated string.
+      //! @return true if field is equal to str, false otherwise.
+      bool
+      isEqual(unsigned index, const char* str) const
+      {
+        size_t size = std::strlen(str);
+        return index < m_count && m_sizes[index] == size
+        && std::memcmp(m_fields[index], str, size) == 0;
+      }
+
+      //! Test if a field matches a pattern where '?' matches any
+      //! character (e.g., "G?GGA" matches GPGGA and GNGGA).
+      //! @param[in] index field index.
+      //! @param[in] pattern null terminated pattern.
+      //! @return true if field matches pattern, false otherwise.
+      bool
+      matches(unsigned index, const char* pattern) const;
+
+      //! Convert a field to a decimal integer.
+      //! @param[in] index field index.
+      //! @param[out] value integer (unchanged on failure).
+      //! @return true if successful, false otherwise.
+      template <typename T>
+      bool
+      readDecimal(unsigned index, T& value) const
+      {
+        int64_t tmp = 0;
+        if (!readField(index, tmp))
+          return false;
+
+        if (tmp < (int64_t)std::numeric_limits<T>::min()
+            || (tmp > 0 && (uint64_t)tmp > (uint64_t)std::numeric_limits<T>::max()))
+          return false;
+
+        value = (T)tmp;
+        return true;
+      }
+
+      //! Convert a field to a floating point number.
+      //! @param[in] index field index.
+      //! @param[out] value number (unchanged on failure).
+      //! @return true if successful, false otherwise.
+      template <typename T>
+      bool
+      readNumber(unsigned index, T& value) const
+      {
+        double tmp = 0;
+        if (!readField(index, tmp))
+          return false;
+
+        value = (T)tmp;
+        return true;
+      }
+
+      //! Convert a pair of fields in the format 'ddmm.mmmm,N' to a
+      //! latitude.
+      //! @param[in] index index of the first field.
+      //! @param[out] value latitude in degrees.
+      //! @return true if successful, false otherwise.
+      bool
+      readLatitude(unsigned index, double& value) const
+      {
+        return readCoordinate(index, 'N', 'S', 90, value);
+      }
+
+      //! Convert a pair of fields in the format 'dddmm.mmmm,E' to a
+      //! longitude.
+      //! @param[in] index index of the first field.
+      //! @param[out] value longitude in degrees.
+      //! @return true if successful, false otherwise.
+      bool
+      readLongitude(unsigned index, double& value) const
+      {
+        return readCoordinate(index, 'E', 'W', 180, value);
+      }
+
+      //! Convert a field in the format 'hhmmss[.sss]' to a time of
+      //! day.
+      //! @param[in] index field index.
+      //! @param[out] value seconds since midnight.
+      //! @return true if successful, false otherwise.
+      bool
+      readTime(unsigned index, double& value) const;
+
+      //! Parse a decimal integer in the style of std::from_chars.
+      //! @param[in] first beginning of the text.
+      //! @param[in] last end of the text.
+      //! @param[out] value integer (unchanged on failure).
+      //! @return pointer past the last parsed character or NULL if
+      //! no integer could be parsed.
+      static const char*
+      parseDecimal(const char* first, const char* last, int64_t& value);
+
+      //! Parse a decimal floating point number (with optional sign,
+      //! fraction and exponent) in the style of std::from_chars.
+      //! @param[in] first beginning of the text.
+      //! @param[in] last end of the text.
+      //! @param[out] value number (unchanged on failure).
+      //! @return pointer past the last parsed character or NULL if
+      //! no number could be parsed.
+      static const char*
+      parseNumber(const char* first, const char* last, double& value);
+
+    private:
+      //! Beginning of each field.
+      const char* m_fields[c_max_fields];
+      //! Length of each field.
+      size_t m_sizes[c_max_fields];
+      //! Number of fields.
+      unsigned m_count;
+
+      //! Convert a whole field to an integer.
+      //! @param[in] index field index.
+      //! @param[out] value integer.
+      //! @return true if successful, false otherwise.
+      bool
+      readField(unsigned index, int64_t& value) const;
+
+      //! Convert a whole field to a floating point number.
+      //! @param[in] index field index.
+      //! @param[out] value number.
+      //! @return true if successful, false otherwise.
+      bool
+      readField(unsigned index, double& value) const;
+
+      //! Convert a coordinate and hemisphere pair of fields.
+      //! @param[in] index index of the coordinate field.
+      //! @param[in] positive positive hemisphere.
+      //! @param[in] negative negative hemisphere.
+      //! @param[in] limit maximum absolute value in degrees.
+      //! @param[out] value coordinate in degrees.
+      //! @return true if successful, false otherwise.
+      bool
+      readCoordinate(unsigned index, char positive, char negative, double limit, double& value) const;
+    };
+  }
+}
+
+#endif
@@ -27,13 +27,47 @@
 // Author: Pedro Calado                                                     *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cstring>
+
 // DUNE headers.
+#include <DUNE/Algorithms/MD5.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
 #include <DUNE/Plans/TimeProfile.hpp>
 
 namespace DUNE
 {
   namespace Plans
   {
+    //! Thread computing the geometry of every stride-th maneuver
+    //! of a list of jobs.
+    class TimeProfile::GeometryWorker: public Concurrency::Thread
+    {
+    public:
+      typedef std::vector<std::pair<const IMC::Message*, Geometry*> > JobList;
+
+      GeometryWorker(TimeProfile* profile, const JobList& jobs,
+                     size_t first, size_t stride):
+        m_profile(profile),
+        m_jobs(jobs),
+        m_first(first),
+        m_stride(stride)
+      { }
+
+    private:
+      TimeProfile* m_profile;
+      const JobList& m_jobs;
+      size_t m_first;
+      size_t m_stride;
+
+      void
+      run(void)
+      {
+        for (size_t i = m_first; i < m_jobs.size(); i += m_stride)
+          m_profile->computeGeometry(m_jobs[i].first, *m_jobs[i].second);
+      }
+    };
+
     float
     TimeProfile::distance2D(const Position& new_pos, const Position& last_pos)
     {
@@ -205,8 +239,6 @@ namespace DUNE
       pos.z = maneuver->z;
       pos.z_units = maneuver->z_units;
 
-      IMC::MessageList<IMC::PathPoint>::const_iterator itr = maneuver->points.begin();
-
       if (!maneuver->points.size())
       {
         // Update speed profile
@@ -217,17 +249,16 @@ namespace DUNE
       }
       else
       {
+        Geometry local;
+        const Geometry* geom = getGeometry(maneuver, local);
+
         // Iterate point list
-        for (; itr != maneuver->points.end(); itr++)
+        for (size_t i = 0; i < geom->lats.size(); ++i)
         {
-          if ((*itr) == NULL)
-            continue;
+          pos.lat = geom->lats[i];
+          pos.lon = geom->lons[i];
 
-          pos.lat = maneuver->lat;
-          pos.lon = maneuver->lon;
-          Coordinates::WGS84::displace((*itr)->x, (*itr)->y, &pos.lat, &pos.lon);
-
-          float travelled = distance3D(pos, last_pos);
+          float travelled = (i == 0) ? distance3D(pos, last_pos) : geom->legs[i - 1];
 
           last_pos = pos;
 
@@ -252,21 +283,16 @@ namespace DUNE
       if (speed == 0.0)
         return false;
 
-      Maneuvers::RowsStages* rstages = NULL;
-      try
-      {
-        rstages = new Maneuvers::RowsStages(maneuver, NULL);
-      }
-      catch (std::runtime_error& e)
-      {
+      Geometry local;
+      const Geometry* geom = getGeometry(maneuver, local);
+      if (!geom->valid)
         return false;
-      }
 
       Position pos;
       pos.z = maneuver->z;
       pos.z_units = maneuver->z_units;
 
-      return parseWorkerRowsStages(rstages, pos, last_pos, speed, maneuver->speed, maneuver->speed_units);
+      return parseWorkerRowsStages(*geom, pos, last_pos, speed, maneuver->speed, maneuver->speed_units);
     }
 
     bool
@@ -277,50 +303,36 @@ namespace DUNE
       if (speed == 0.0)
         return false;
 
-      // FIXME Avoid duplicated code
-      double hstep;
-      if (maneuver->angaperture <= 0)
-        hstep = 2 * maneuver->range;
-      else
-        hstep = 2 * maneuver->range * std::sin(maneuver->angaperture / 2);
-
-      Maneuvers::RowsStages* rstages = NULL;
-      try
-      {
-        rstages = new Maneuvers::RowsStages(maneuver->lat, maneuver->lon, maneuver->bearing,
-                                            maneuver->cross_angle, maneuver->width,
-                                            maneuver->length, hstep, maneuver->coff, 100,
-                                            maneuver->flags, NULL);
-      }
-      catch (std::runtime_error& e)
-      {
+      Geometry local;
+      const Geometry* geom = getGeometry(maneuver, local);
+      if (!geom->valid)
         return false;
-      }
 
       Position pos;
       pos.z = maneuver->z;
       pos.z_units = maneuver->z_units;
 
-      return parseWorkerRowsStages(rstages, pos, last_pos, speed, maneuver->speed, maneuver->speed_units);
+      return parseWorkerRowsStages(*geom, pos, last_pos, speed, maneuver->speed, maneuver->speed_units);
     }
 
     bool
-    TimeProfile::parseWorkerRowsStages(Maneuvers::RowsStages* rstages,
+    TimeProfile::parseWorkerRowsStages(const Geometry& geom,
         Position& pos, Position& last_pos, float speed, float man_speed,
         uint8_t man_speed_units)
     {
-      rstages->getFirstPoint(&pos.lat, &pos.lon);
+      pos.lat = geom.lats.front();
+      pos.lon = geom.lons.front();
 
       float distance = TimeProfile::distance3D(pos, last_pos);
       m_accum_dur->addDuration(distance / speed);
 
       last_pos = pos;
+      last_pos.lat = geom.lats.back();
+      last_pos.lon = geom.lons.back();
 
-      distance += rstages->getDistance(&last_pos.lat, &last_pos.lon);
-
-      std::vector<float>::const_iterator itr = rstages->getDistancesBegin();
+      std::vector<float>::const_iterator itr = geom.legs.begin();
 
-      for (; itr != rstages->getDistancesEnd(); ++itr)
+      for (; itr != geom.legs.end(); ++itr)
       {
         // compensate with path controller's eta factor
         float travelled = compensate(*itr, speed);
@@ -465,6 +477,8 @@ namespace DUNE
         return;
       }
 
+      prepare(nodes);
+
       Position pos;
       extractPosition(state, pos);
 
@@ -571,5 +585,171 @@ namespace DUNE
       m_finite_duration = true;
       return;
     }
+
+    bool
+    TimeProfile::computeGeometry(const IMC::Message* maneuver, Geometry& geom)
+    {
+      geom.valid = false;
+      geom.lats.clear();
+      geom.lons.clear();
+      geom.legs.clear();
+
+      switch (maneuver->getId())
+      {
+        case DUNE_IMC_FOLLOWPATH:
+        {
+          const IMC::FollowPath* m = static_cast<const IMC::FollowPath*>(maneuver);
+          Coordinates::LocalFrame frame(m->lat, m->lon);
+
+          Position pos;
+          pos.z = m->z;
+          pos.z_units = m->z_units;
+          Position last_pos = pos;
+
+          IMC::MessageList<IMC::PathPoint>::const_iterator itr = m->points.begin();
+          for (; itr != m->points.end(); ++itr)
+          {
+            if ((*itr) == NULL)
+              continue;
+
+            frame.fromNE((*itr)->x, (*itr)->y, &pos.lat, &pos.lon);
+
+            if (!geom.lats.empty())
+              geom.legs.push_back(distance3D(pos, last_pos));
+
+            geom.lats.push_back(pos.lat);
+            geom.lons.push_back(pos.lon);
+            last_pos = pos;
+          }
+
+          geom.valid = true;
+          return true;
+        }
+
+        case DUNE_IMC_ROWS:
+        case DUNE_IMC_ROWSCOVERAGE:
+        {
+          Maneuvers::RowsStages* rstages = NULL;
+          try
+          {
+            if (maneuver->getId() == DUNE_IMC_ROWS)
+            {
+              rstages = new Maneuvers::RowsStages(static_cast<const IMC::Rows*>(maneuver), NULL);
+            }
+            else
+            {
+              const IMC::RowsCoverage* m = static_cast<const IMC::RowsCoverage*>(maneuver);
+
+              double hstep;
+              if (m->angaperture <= 0)
+                hstep = 2 * m->range;
+              else
+                hstep = 2 * m->range * std::sin(m->angaperture / 2);
+
+              rstages = new Maneuvers::RowsStages(m->lat, m->lon, m->bearing,
+                                                  m->cross_angle, m->width,
+                                                  m->length, hstep, m->coff, 100,
+                                                  m->flags, NULL);
+            }
+          }
+          catch (std::runtime_error& e)
+          {
+            return true;
+          }
+
+          double lat;
+          double lon;
+          rstages->getFirstPoint(&lat, &lon);
+          geom.lats.push_back(lat);
+          geom.lons.push_back(lon);
+
+          rstages->getDistance(&lat, &lon);
+          geom.lats.push_back(lat);
+          geom.lons.push_back(lon);
+
+          geom.legs.assign(rstages->getDistancesBegin(), rstages->getDistancesEnd());
+          delete rstages;
+
+          geom.valid = true;
+          return true;
+        }
+
+        default:
+          return false;
+      }
+    }
+
+    void
+    TimeProfile::prepare(const std::vector<IMC::PlanManeuver*>& nodes)
+    {
+      m_prepared.clear();
+
+      if (m_geometries.size() > c_max_geometries)
+        m_geometries.clear();
+
+      GeometryWorker::JobList jobs;
+      std::vector<uint8_t> bfr;
+      uint8_t digest[16];
+
+      std::vector<IMC::PlanManeuver*>::const_iterator itr = nodes.begin();
+      for (; itr != nodes.end(); ++itr)
+      {
+        if ((*itr)->data.isNull())
+          break;
+
+        const IMC::Message* msg = (*itr)->data.get();
+        uint16_t id = msg->getId();
+        if (id != DUNE_IMC_FOLLOWPATH && id != DUNE_IMC_ROWS && id != DUNE_IMC_ROWSCOVERAGE)
+          continue;
+
+        // Key geometries by the maneuver's contents.
+        bfr.resize(sizeof(id) + msg->getPayloadSerializationSize());
+        std::memcpy(&bfr[0], &id, sizeof(id));
+        msg->serializeFields(&bfr[sizeof(id)]);
+        Algorithms::MD5::compute(&bfr[0], bfr.size(), digest);
+        std::string key((const char*)digest, sizeof(digest));
+
+        GeometryCache::iterator gitr = m_geometries.find(key);
+        if (gitr == m_geometries.end())
+        {
+          gitr = m_geometries.insert(std::make_pair(key, Geometry())).first;
+          jobs.push_back(std::make_pair(msg, &gitr->second));
+        }
+
+        m_prepared[msg] = &gitr->second;
+      }
+
+      size_t workers = std::min((size_t)m_workers, jobs.size());
+      if (workers <= 1)
+      {
+        for (size_t i = 0; i < jobs.size(); ++i)
+          computeGeometry(jobs[i].first, *jobs[i].second);
+        return;
+      }
+
+      std::vector<GeometryWorker*> threads;
+      for (size_t i = 0; i < workers; ++i)
+      {
+        threads.push_back(new GeometryWorker(this, jobs, i, workers));
+        threads.back()->start();
+      }
+
+      for (size_t i = 0; i < workers; ++i)
+      {
+        threads[i]->join();
+        delete threads[i];
+      }
+    }
+
+    const TimeProfile::Geometry*
+    TimeProfile::getGeometry(const IMC::Message* maneuver, Geometry& geom)
+    {
+      std::map<const IMC::Message*, const Geometry*>::const_iterator itr = m_prepared.find(maneuver);
+      if (itr != m_prepared.end())
+        return itr->second;
+
+      computeGeometry(maneuver, geom);
+      return &geom;
+    }
   }
 }
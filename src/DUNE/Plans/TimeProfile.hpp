@@ -30,6 +30,12 @@
 #ifndef DUNE_PLANS_TIME_PROFILE_HPP_INCLUDED_
 #define DUNE_PLANS_TIME_PROFILE_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/Coordinates.hpp>
 #include <DUNE/IMC.hpp>
@@ -49,6 +55,8 @@ namespace DUNE
     static const float c_fix_time = 7.0f;
     //! Typical pitch value for elevator maneuver
     static const float c_rated_pitch = 0.2617993877991494f;
+    //! Maximum number of cached maneuver geometries
+    static const unsigned c_max_geometries = 256;
 
     // Export DLL Symbol.
     class DUNE_DLL_SYM TimeProfile;
@@ -98,6 +106,24 @@ namespace DUNE
         std::vector<float> durations;
       };
 
+      //! Position independent geometry of a maneuver, i.e., its
+      //! waypoints and the length of the legs between them
+      struct Geometry
+      {
+        Geometry(void):
+          valid(false)
+        { }
+
+        //! True if the maneuver could be expanded
+        bool valid;
+        //! Waypoint latitudes
+        std::vector<double> lats;
+        //! Waypoint longitudes
+        std::vector<double> lons;
+        //! Length of the legs between waypoints
+        std::vector<float> legs;
+      };
+
       //! Mapping between maneuver IDs and their profiles
       typedef std::map< std::string, Profile> ProfileMap;
       //! Const iterator for this map
@@ -109,7 +135,8 @@ namespace DUNE
         m_speed_model(speed_model),
         m_speed_vec(NULL),
         m_valid_model(true),
-        m_finite_duration(false)
+        m_finite_duration(false),
+        m_workers(1)
       {
         if (m_speed_model == NULL)
           m_valid_model = false;
@@ -185,7 +212,38 @@ namespace DUNE
         return m_finite_duration;
       }
 
+      //! Set the number of threads used to compute the geometry
+      //! of path and rows maneuvers
+      //! @param[in] count number of worker threads
+      inline void
+      setWorkers(unsigned count)
+      {
+        m_workers = std::max(1u, count);
+      }
+
+      //! Number of maneuver geometries kept in cache
+      //! @return size of the geometry cache
+      inline size_t
+      getCachedGeometries(void) const
+      {
+        return m_geometries.size();
+      }
+
+      //! Compute the geometry of a maneuver. Only FollowPath, Rows
+      //! and RowsCoverage maneuvers have a geometry
+      //! @param[in] maneuver maneuver message
+      //! @param[out] geom computed geometry
+      //! @return true if the maneuver has a geometry, false otherwise
+      bool
+      computeGeometry(const IMC::Message* maneuver, Geometry& geom);
+
     private:
+      //! Worker thread computing maneuver geometries
+      class GeometryWorker;
+
+      //! Geometries indexed by the MD5 of their maneuvers
+      typedef std::map<std::string, Geometry> GeometryCache;
+
       //! Struct of bathymetric info for a certain location
       struct BathymetricInfo
       {
@@ -462,8 +520,21 @@ namespace DUNE
         return true;
       }
 
+      //! Fill geometries of the plan maneuvers, using the cache and
+      //! computing missing ones in worker threads
+      //! @param[in] nodes vector of plan maneuver nodes
+      void
+      prepare(const std::vector<IMC::PlanManeuver*>& nodes);
+
+      //! Get the geometry of a maneuver of the plan being parsed
+      //! @param[in] maneuver maneuver message
+      //! @param[out] geom storage if geometry was not prepared
+      //! @return pointer to geometry
+      const Geometry*
+      getGeometry(const IMC::Message* maneuver, Geometry& geom);
+
       //! Parse worker for Rows and RowsCoverage maneuver
-      //! @param[in] rstages pointer to RowsStages
+      //! @param[in] geom geometry of the maneuver
       //! @param[in] pos position of the maneuver
       //! @param[in] last_pos last position to consider when computing duration
       //! @param[in] speed calculated speed
@@ -471,7 +542,7 @@ namespace DUNE
       //! @param[in] man_speed_units maneuver speed units
       //! @return true if parse successfully, false otherwise
       bool
-      parseWorkerRowsStages(Maneuvers::RowsStages* rstages, Position& pos,
+      parseWorkerRowsStages(const Geometry& geom, Position& pos,
           Position& last_pos, float speed, float man_speed,
           uint8_t man_speed_units);
 
@@ -489,6 +560,12 @@ namespace DUNE
       bool m_valid_model;
       //! Has finite duration
       bool m_finite_duration;
+      //! Cache of maneuver geometries
+      GeometryCache m_geometries;
+      //! Geometries of the maneuvers of the plan being parsed
+      std::map<const IMC::Message*, const Geometry*> m_prepared;
+      //! Number of worker threads
+      unsigned m_workers;
     };
   }
 }
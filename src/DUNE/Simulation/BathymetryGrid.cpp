@@ -0,0 +1,365 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Math/Angles.hpp>
+#include <DUNE/Parsers/Config.hpp>
+#include <DUNE/FileSystem/Exceptions.hpp>
+#include <DUNE/FileSystem/MappedFile.hpp>
+#include <DUNE/Simulation/BathymetryGrid.hpp>
+#include <DUNE/Utils/String.hpp>
+
+namespace DUNE
+{
+  namespace Simulation
+  {
+    //! Magic identifier.
+    static const char c_magic[8] = {'D', 'U', 'N', 'E', 'B', 'T', 'G', '\0'};
+    //! Format version.
+    static const uint32_t c_version = 1;
+    //! Tile size as a power of two (64 x 64 cells).
+    static const uint32_t c_tile_shift = 6;
+    //! Offset of the first tile in the binary file.
+    static const size_t c_data_offset = 128;
+    //! Number of bisection steps used to refine ray intersections.
+    static const unsigned c_bisections = 8;
+
+    const char* BathymetryGrid::c_extension = ".grid";
+
+    void
+    BathymetryGrid::readConfig(const std::string& path, double& lat, double& lon,
+                               std::vector<Sample>& samples)
+    {
+      Parsers::Config cfg(path.c_str());
+      std::vector<std::string> lines;
+      cfg.get("Bathymetry", "Data", "", lines);
+      cfg.get("Bathymetry", "Latitude (degrees)", "0.0", lat);
+      cfg.get("Bathymetry", "Longitude (degrees)", "0.0", lon);
+
+      lat = Math::Angles::radians(lat);
+      lon = Math::Angles::radians(lon);
+
+      samples.clear();
+      samples.reserve(lines.size());
+
+      for (size_t i = 0; i < lines.size(); ++i)
+      {
+        std::vector<double> v;
+        Utils::String::split(lines[i], " ", v);
+        if (v.size() < 3)
+          continue;
+
+        Sample sample;
+        sample.x = v[0];
+        sample.y = v[1];
+        sample.depth = v[2];
+        samples.push_back(sample);
+      }
+    }
+
+    BathymetryGrid::BathymetryGrid(double lat, double lon,
+                                   const std::vector<Sample>& samples,
+                                   double resolution, double fill_radius):
+      m_file(NULL)
+    {
+      if (samples.empty())
+        throw Error("no samples");
+
+      if (resolution <= 0.0)
+        throw Error("invalid resolution");
+
+      double n_min = samples[0].x;
+      double n_max = samples[0].x;
+      double e_min = samples[0].y;
+      double e_max = samples[0].y;
+
+      for (size_t i = 1; i < samples.size(); ++i)
+      {
+        n_min = std::min(n_min, samples[i].x);
+        n_max = std::max(n_max, samples[i].x);
+        e_min = std::min(e_min, samples[i].y);
+        e_max = std::max(e_max, samples[i].y);
+      }
+
+      std::memcpy(m_header.magic, c_magic, sizeof(c_magic));
+      m_header.version = c_version;
+      m_header.tile_shift = c_tile_shift;
+      m_header.rows = (uint32_t)std::floor((n_max - n_min) / resolution + 0.5) + 1;
+      m_header.cols = (uint32_t)std::floor((e_max - e_min) / resolution + 0.5) + 1;
+      m_header.lat = lat;
+      m_header.lon = lon;
+      m_header.north = n_min;
+      m_header.east = e_min;
+      m_header.resolution = resolution;
+      setupLayout();
+
+      const uint32_t rows = m_header.rows;
+      const uint32_t cols = m_header.cols;
+      const size_t count = (size_t)rows * cols;
+
+      // Average samples that fall on the same node.
+      std::vector<double> sums(count, 0.0);
+      std::vector<uint32_t> hits(count, 0);
+
+      for (size_t i = 0; i < samples.size(); ++i)
+      {
+        uint32_t r = (uint32_t)std::floor((samples[i].x - n_min) / resolution + 0.5);
+        uint32_t c = (uint32_t)std::floor((samples[i].y - e_min) / resolution + 0.5);
+        size_t idx = (size_t)r * cols + c;
+        sums[idx] += samples[i].depth;
+        ++hits[idx];
+      }
+
+      // Fill holes by propagating the nearest node with data
+      // (multi-source breadth-first search bounded by fill_radius).
+      const size_t npos = std::numeric_limits<size_t>::max();
+      const float nan = std::numeric_limits<float>::quiet_NaN();
+      const double max_d2 = (fill_radius / resolution) * (fill_radius / resolution);
+      std::vector<float> dense(count, nan);
+      std::vector<size_t> source(count, npos);
+      std::vector<size_t> queue;
+      queue.reserve(count);
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        if (hits[i] == 0)
+          continue;
+
+        dense[i] = (float)(sums[i] / hits[i]);
+        source[i] = i;
+        queue.push_back(i);
+      }
+
+      for (size_t head = 0; head < queue.size(); ++head)
+      {
+        size_t idx = queue[head];
+        long r = (long)(idx / cols);
+        long c = (long)(idx % cols);
+        long sr = (long)(source[idx] / cols);
+        long sc = (long)(source[idx] % cols);
+
+        for (long dr = -1; dr <= 1; ++dr)
+        {
+          for (long dc = -1; dc <= 1; ++dc)
+          {
+            long nr = r + dr;
+            long nc = c + dc;
+            if (nr < 0 || nc < 0 || nr >= (long)rows || nc >= (long)cols)
+              continue;
+
+            size_t nidx = (size_t)nr * cols + nc;
+            if (source[nidx] != npos)
+              continue;
+
+            double d2 = (double)((nr - sr) * (nr - sr) + (nc - sc) * (nc - sc));
+            if (d2 > max_d2)
+              continue;
+
+            source[nidx] = source[idx];
+            dense[nidx] = dense[source[idx]];
+            queue.push_back(nidx);
+          }
+        }
+      }
+
+      // Rearrange in tiles.
+      m_storage.assign((size_t)m_header.tiles_n * m_header.tiles_e * m_tile_cells, nan);
+
+      for (uint32_t r = 0; r < rows; ++r)
+      {
+        for (uint32_t c = 0; c < cols; ++c)
+        {
+          size_t tile = (r >> c_tile_shift) * m_header.tiles_e + (c >> c_tile_shift);
+          size_t offset = ((r & m_tile_mask) << c_tile_shift) | (c & m_tile_mask);
+          m_storage[tile * m_tile_cells + offset] = dense[(size_t)r * cols + c];
+        }
+      }
+
+      m_cells = &m_storage[0];
+    }
+
+    BathymetryGrid::BathymetryGrid(const std::string& path):
+      m_file(new FileSystem::MappedFile(path))
+    {
+      try
+      {
+        if (m_file->size() < c_data_offset)
+          throw Error("file is too small: " + path);
+
+        std::memcpy(&m_header, m_file->data(), sizeof(Header));
+
+        if (std::memcmp(m_header.magic, c_magic, sizeof(c_magic)) != 0)
+          throw Error("invalid file: " + path);
+
+        if (m_header.version != c_version)
+          throw Error("unsupported version: " + path);
+
+        if (m_header.rows == 0 || m_header.cols == 0 || m_header.resolution <= 0.0)
+          throw Error("invalid dimensions: " + path);
+
+        setupLayout();
+
+        size_t bytes = (size_t)m_header.tiles_n * m_header.tiles_e * m_tile_cells * sizeof(float);
+        if (m_file->size() < c_data_offset + bytes)
+          throw Error("file is truncated: " + path);
+      }
+      catch (...)
+      {
+        delete m_file;
+        throw;
+      }
+
+      m_cells = reinterpret_cast<const float*>(m_file->data() + c_data_offset);
+      m_file->adviseRandom();
+    }
+
+    BathymetryGrid::~BathymetryGrid(void)
+    {
+      delete m_file;
+    }
+
+    void
+    BathymetryGrid::setupLayout(void)
+    {
+      uint32_t tile_size = 1 << m_header.tile_shift;
+      m_tile_mask = tile_size - 1;
+      m_tile_cells = (size_t)tile_size * tile_size;
+      m_header.tiles_n = (m_header.rows + m_tile_mask) >> m_header.tile_shift;
+      m_header.tiles_e = (m_header.cols + m_tile_mask) >> m_header.tile_shift;
+    }
+
+    void
+    BathymetryGrid::save(const std::string& path) const
+    {
+      std::FILE* fd = std::fopen(path.c_str(), "wb");
+      if (fd == NULL)
+        throw FileSystem::FileWriteError(path);
+
+      uint8_t head[c_data_offset] = {0};
+      std::memcpy(head, &m_header, sizeof(Header));
+
+      size_t count = (size_t)m_header.tiles_n * m_header.tiles_e * m_tile_cells;
+      bool ok = std::fwrite(head, sizeof(head), 1, fd) == 1
+      && std::fwrite(m_cells, sizeof(float), count, fd) == count;
+
+      if (std::fclose(fd) != 0 || !ok)
+        throw FileSystem::FileWriteError(path);
+    }
+
+    bool
+    BathymetryGrid::depth(double x, double y, double& depth) const
+    {
+      double fr = (x - m_header.north) / m_header.resolution;
+      double fc = (y - m_header.east) / m_header.resolution;
+
+      if (!(fr >= 0.0 && fc >= 0.0))
+        return false;
+
+      uint32_t r = (uint32_t)fr;
+      uint32_t c = (uint32_t)fc;
+      if (r >= m_header.rows || c >= m_header.cols)
+        return false;
+
+      uint32_t r1 = std::min(r + 1, m_header.rows - 1);
+      uint32_t c1 = std::min(c + 1, m_header.cols - 1);
+      double tr = fr - r;
+      double tc = fc - c;
+
+      const float values[4] = {cell(r, c), cell(r, c1), cell(r1, c), cell(r1, c1)};
+      const double weights[4] = {(1.0 - tr) * (1.0 - tc), (1.0 - tr) * tc,
+                                 tr * (1.0 - tc), tr * tc};
+
+      // Nodes without data are left out and the remaining weights
+      // renormalized.
+      double sum = 0.0;
+      double weight = 0.0;
+      for (unsigned i = 0; i < 4; ++i)
+      {
+        if (std::isnan(values[i]))
+          continue;
+
+        sum += weights[i] * values[i];
+        weight += weights[i];
+      }
+
+      if (weight <= 0.0)
+        return false;
+
+      depth = sum / weight;
+      return true;
+    }
+
+    bool
+    BathymetryGrid::intersect(double x, double y, double z, double heading, double pitch,
+                              double max_range, double& range) const
+    {
+      double dx = std::cos(pitch) * std::cos(heading);
+      double dy = std::cos(pitch) * std::sin(heading);
+      double dz = -std::sin(pitch);
+      double step = m_header.resolution * 0.5;
+      double prev = 0.0;
+      double bottom = 0.0;
+
+      while (prev < max_range)
+      {
+        double t = std::min(prev + step, max_range);
+
+        if (depth(x + t * dx, y + t * dy, bottom) && z + t * dz >= bottom)
+        {
+          double lo = prev;
+          double hi = t;
+
+          for (unsigned i = 0; i < c_bisections; ++i)
+          {
+            double mid = (lo + hi) * 0.5;
+            if (depth(x + mid * dx, y + mid * dy, bottom) && z + mid * dz >= bottom)
+              hi = mid;
+            else
+              lo = mid;
+          }
+
+          range = hi;
+          return true;
+        }
+
+        prev = t;
+      }
+
+      return false;
+    }
+  }
+}
@@ -0,0 +1,250 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_SIMULATION_BATHYMETRY_GRID_HPP_INCLUDED_
+#define DUNE_SIMULATION_BATHYMETRY_GRID_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  // Forward declarations.
+  namespace FileSystem { class MappedFile; }
+
+  namespace Simulation
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM BathymetryGrid;
+
+    //! Regular raster of depth values, stored in square tiles of
+    //! contiguous cells. Grids can be built in memory from scattered
+    //! samples or memory-mapped from a binary file, in which case
+    //! only the tiles that are actually queried are paged in.
+    //!
+    //! Grid coordinates are north/east offsets, in meters, relative
+    //! to a WGS-84 reference point. Depths are positive downwards.
+    class BathymetryGrid
+    {
+    public:
+      //! Grid errors.
+      class Error: public std::runtime_error
+      {
+      public:
+        Error(const std::string& msg):
+          std::runtime_error("bathymetry grid: " + msg)
+        { }
+      };
+
+      //! Scattered depth sample.
+      struct Sample
+      {
+        //! North offset.
+        double x;
+        //! East offset.
+        double y;
+        //! Depth.
+        double depth;
+      };
+
+      //! Binary file extension.
+      static const char* c_extension;
+
+      //! Read scattered samples from a bathymetry configuration file
+      //! (section 'Bathymetry', with options 'Latitude (degrees)',
+      //! 'Longitude (degrees)' and 'Data').
+      //! @param[in] path configuration file.
+      //! @param[out] lat reference latitude (rad).
+      //! @param[out] lon reference longitude (rad).
+      //! @param[out] samples scattered samples.
+      static void
+      readConfig(const std::string& path, double& lat, double& lon,
+                 std::vector<Sample>& samples);
+
+      //! Build a grid from scattered samples. Each sample contributes
+      //! to the nearest grid node, nodes without samples take the
+      //! value of the nearest node with data no further than
+      //! 'fill_radius' away.
+      //! @param[in] lat reference latitude (rad).
+      //! @param[in] lon reference longitude (rad).
+      //! @param[in] samples scattered samples.
+      //! @param[in] resolution grid cell size (m).
+      //! @param[in] fill_radius hole filling radius (m).
+      BathymetryGrid(double lat, double lon,
+                     const std::vector<Sample>& samples,
+                     double resolution, double fill_radius);
+
+      //! Memory-map a grid previously written with save().
+      //! @param[in] path binary grid file.
+      BathymetryGrid(const std::string& path);
+
+      //! Destructor.
+      ~BathymetryGrid(void);
+
+      //! Write grid to a binary file.
+      //! @param[in] path destination file.
+      void
+      save(const std::string& path) const;
+
+      //! Compute depth at a given position using bilinear
+      //! interpolation of the surrounding grid nodes.
+      //! @param[in] x north offset.
+      //! @param[in] y east offset.
+      //! @param[out] depth interpolated depth.
+      //! @return true if the position has data, false otherwise.
+      bool
+      depth(double x, double y, double& depth) const;
+
+      //! March a ray until it crosses the bottom.
+      //! @param[in] x north offset of ray origin.
+      //! @param[in] y east offset of ray origin.
+      //! @param[in] z depth of ray origin.
+      //! @param[in] heading ray heading (rad).
+      //! @param[in] pitch ray pitch, positive upwards (rad).
+      //! @param[in] max_range maximum range (m).
+      //! @param[out] range range to the intersection.
+      //! @return true if the ray intersects the bottom, false otherwise.
+      bool
+      intersect(double x, double y, double z, double heading, double pitch,
+                double max_range, double& range) const;
+
+      //! Get reference latitude.
+      //! @return latitude (rad).
+      double
+      getLatitude(void) const
+      {
+        return m_header.lat;
+      }
+
+      //! Get reference longitude.
+      //! @return longitude (rad).
+      double
+      getLongitude(void) const
+      {
+        return m_header.lon;
+      }
+
+      //! Get grid resolution.
+      //! @return cell size (m).
+      double
+      getResolution(void) const
+      {
+        return m_header.resolution;
+      }
+
+      //! Get number of grid nodes along the north axis.
+      //! @return number of rows.
+      unsigned
+      getRows(void) const
+      {
+        return m_header.rows;
+      }
+
+      //! Get number of grid nodes along the east axis.
+      //! @return number of columns.
+      unsigned
+      getColumns(void) const
+      {
+        return m_header.cols;
+      }
+
+    private:
+      //! On-disk header.
+      struct Header
+      {
+        //! Magic identifier.
+        char magic[8];
+        //! Format version.
+        uint32_t version;
+        //! Tile size (cells) as a power of two.
+        uint32_t tile_shift;
+        //! Number of rows.
+        uint32_t rows;
+        //! Number of columns.
+        uint32_t cols;
+        //! Number of tiles along the north axis.
+        uint32_t tiles_n;
+        //! Number of tiles along the east axis.
+        uint32_t tiles_e;
+        //! Reference latitude (rad).
+        double lat;
+        //! Reference longitude (rad).
+        double lon;
+        //! North offset of the first row.
+        double north;
+        //! East offset of the first column.
+        double east;
+        //! Cell size.
+        double resolution;
+      };
+
+      //! Grid header.
+      Header m_header;
+      //! Mapped file, if any.
+      FileSystem::MappedFile* m_file;
+      //! Tile storage for grids built in memory.
+      std::vector<float> m_storage;
+      //! Pointer to the first cell of the first tile.
+      const float* m_cells;
+      //! Cells per tile.
+      size_t m_tile_cells;
+      //! Mask to extract the in-tile index.
+      uint32_t m_tile_mask;
+
+      //! Compute layout parameters from header.
+      void
+      setupLayout(void);
+
+      //! Retrieve the value of a grid node.
+      //! @param[in] r row.
+      //! @param[in] c column.
+      //! @return node value (NaN if no data).
+      float
+      cell(uint32_t r, uint32_t c) const
+      {
+        size_t tile = (r >> m_header.tile_shift) * m_header.tiles_e + (c >> m_header.tile_shift);
+        return m_cells[tile * m_tile_cells + (((r & m_tile_mask) << m_header.tile_shift) | (c & m_tile_mask))];
+      }
+
+      //! Non-copyable.
+      BathymetryGrid(const BathymetryGrid&);
+
+      //! Non-assignable.
+      BathymetryGrid&
+      operator=(const BathymetryGrid&);
+    };
+  }
+}
+
+#endif
@@ -41,6 +41,7 @@
 #include <DUNE/Math/Constants.hpp>
 #include <DUNE/Math/General.hpp>
 #include <DUNE/Math/Matrix.hpp>
+#include <DUNE/Simulation/UAVModel.hpp>
 #include <DUNE/Tasks/Task.hpp>
 
 namespace DUNE
@@ -249,14 +250,14 @@ namespace DUNE
       //! This method updates the simulated state with the defined time step.
       //! @param[in] timestep - time step for the update
       //! @return the updated state
-      UAVSimulation
+      UAVSimulation&
       update(const double& timestep);
 
       //! This method updates the simulated state with the defined time step and controls.
       //! @param[in] timestep - time step for the update
       //! @param[in] bank_cmd - applied bank command
       //! @return the updated state
-      UAVSimulation
+      UAVSimulation&
       update(const double& timestep, const double& bank_cmd);
 
       //! This method updates the simulated state with the defined time step and controls.
@@ -264,7 +265,7 @@ namespace DUNE
       //! @param[in] bank_cmd - applied bank command
       //! @param[in] airspeed_cmd - applied airspeed command
       //! @return the updated state
-      UAVSimulation
+      UAVSimulation&
       update(const double& timestep, const double& bank_cmd, const double& airspeed_cmd);
 
       //! This method updates the simulated state with the defined time step and controls.
@@ -273,7 +274,7 @@ namespace DUNE
       //! @param[in] airspeed_cmd - applied airspeed command
       //! @param[in] altitude_cmd - applied altitude command
       //! @return the updated state
-      UAVSimulation
+      UAVSimulation&
       update(const double& timestep, const double& bank_cmd, const double& airspeed_cmd, const double& altitude_cmd);
 
       /*
@@ -437,94 +438,13 @@ namespace DUNE
       double m_timestep_lim;
 
     private:
-      //! Vehicle position
-      DUNE::Math::Matrix m_position;
-      //! Vehicle velocity vector
-      DUNE::Math::Matrix m_velocity;
-      //! Vehicle velocity vector relative to the wind, in the ground reference frame
-      DUNE::Math::Matrix m_uav2wind_gnd_frm;
-
-      //! Kinematic models' variables
-      //! Vehicle model parameters and respective initialization flags
-      //! - Bank time constant
-      double m_bank_time_cst;
-      bool m_bank_time_cst_f;
-      //! - Airspeed time constant
-      double m_speed_time_cst;
-      bool m_speed_time_cst_f;
-      //! - Altitude time constant
-      double m_alt_time_cst;
-      bool m_alt_time_cst_f;
-      //! Vehicle operation limits and respective initialization flags
-      //! - Bank rate
-      double m_bank_rate_lim;
-      bool m_bank_rate_lim_f;
-      //! - Longitudinal acceleration
-      double m_lon_accel_lim;
-      bool m_lon_accel_lim_f;
-      //! - Vertical slope
-      double m_vert_slope_lim;
-      bool m_vert_slope_lim_f;
-
-      //! Control commands
-      //! - Bank
-      double m_bank_cmd;
-      //! - Airspeed
-      double m_airspeed_cmd;
-      //! - Altitude
-      double m_altitude_cmd;
-      //! - Flight path angle
-      double m_fpa_cmd;
-      //! - Pitch
-      double m_pitch_cmd;
-      //! Control commands initialization flags
-      //! - Airspeed
-      bool m_airspeed_cmd_ini;
-      //! - Altitude
-      bool m_altitude_cmd_ini;
-      //! - Flight path angle
-      bool m_fpa_cmd_ini;
-      //! - Pitch
-      bool m_pitch_cmd_ini;
-
-      //! Airstream data
-      double m_airspeed;
-      double m_ang_attack;
-      double m_sideslip;
-
-      //! Simulation optimization variables
-      double m_cos_yaw;
-      double m_sin_yaw;
-      double m_cos_pitch;
-      double m_sin_pitch;
-      double m_cos_roll;
-      double m_sin_roll;
-      double m_cos_course;
-      double m_sin_course;
-      double m_cos_fl_path_ang;
-      double m_sin_fl_path_ang;
-
-      //! Simulation update functions
-      void
-      integratePosition(const double& timestep);
-
-      void
-      calcUAV2AirData(void);
-
-      void
-      updateVelocity(void);
-
-      void
-      update3DOF(const double& timestep);
-
-      void
-      update4DOF_Bank(const double& timestep);
-
-      void
-      update4DOF_Alt(const double& timestep);
+      //! Vehicle state, model parameters and commands.
+      UAVModel m_model;
 
+      //! Apply the public simulation settings (type, wind and time
+      //! step limit) to the model.
       void
-      update5DOF(const double& timestep);
+      sync(void);
 
       /*
       //! This method acts as destructor.
@@ -0,0 +1,439 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Math/Angles.hpp>
+#include <DUNE/Math/Constants.hpp>
+#include <DUNE/Math/General.hpp>
+#include <DUNE/Simulation/UAVBatch.hpp>
+
+namespace DUNE
+{
+  namespace Simulation
+  {
+    //! Minimum stride of the state buffer.
+    static const size_t c_min_stride = 16;
+
+    //! Compute a stride of the state buffer able to hold a number of
+    //! vehicles. Strides are multiples of a cache line and arrays are
+    //! kept from starting at multiples of 4 KiB from each other, which
+    //! would make them compete for the same cache sets.
+    static size_t
+    computeStride(size_t count)
+    {
+      size_t stride = (count + 7) & ~(size_t)7;
+      if (stride < c_min_stride)
+        stride = c_min_stride;
+      if ((stride * sizeof(double)) % 4096 == 0)
+        stride += 8;
+      return stride;
+    }
+
+    UAVBatch::UAVBatch(UAVModel::Type type):
+      m_type(type),
+      m_size(0),
+      m_stride(0)
+    { }
+
+    void
+    UAVBatch::reserve(size_t count)
+    {
+      if (count <= m_stride)
+        return;
+
+      size_t stride = computeStride(count);
+      std::vector<double> state(FIELD_COUNT * stride, 0.0);
+      for (size_t f = 0; f < FIELD_COUNT; ++f)
+      {
+        for (size_t i = 0; i < m_size; ++i)
+          state[f * stride + i] = m_state[f * m_stride + i];
+      }
+
+      m_state.swap(state);
+      m_stride = stride;
+
+      m_params.reserve(count);
+      m_cmds.reserve(count);
+      m_status.reserve(count);
+      m_active.resize(stride);
+      m_dt.resize(stride);
+      m_yaw.resize(stride);
+    }
+
+    size_t
+    UAVBatch::add(const UAVModel& model)
+    {
+      if (model.getType() != m_type)
+        throw std::runtime_error("UAV batch: model type mismatch");
+
+      if (m_size == m_stride)
+        reserve(m_size * 2 + 1);
+
+      store(m_size, model.getState());
+      m_params.push_back(model.getParameters());
+      m_cmds.push_back(model.getCommands());
+      m_status.push_back(UAVModel::STATUS_OK);
+
+      return m_size++;
+    }
+
+    void
+    UAVBatch::clear(void)
+    {
+      m_size = 0;
+      m_params.clear();
+      m_cmds.clear();
+      m_status.clear();
+    }
+
+    void
+    UAVBatch::load(size_t index, UAVModel::State& state) const
+    {
+      const double* d = &m_state[index];
+      const size_t n = m_stride;
+
+      for (unsigned i = 0; i < 6; ++i)
+      {
+        state.position[i] = d[(FIELD_POSITION + i) * n];
+        state.velocity[i] = d[(FIELD_VELOCITY + i) * n];
+      }
+
+      for (unsigned i = 0; i < 3; ++i)
+      {
+        state.wind[i] = d[(FIELD_WIND + i) * n];
+        state.uav2wind[i] = d[(FIELD_UAV2WIND + i) * n];
+      }
+
+      state.airspeed = d[FIELD_AIRSPEED * n];
+      state.ang_attack = d[FIELD_ANG_ATTACK * n];
+      state.sideslip = d[FIELD_SIDESLIP * n];
+      state.cos_yaw = d[FIELD_COS_YAW * n];
+      state.sin_yaw = d[FIELD_SIN_YAW * n];
+      state.cos_pitch = d[FIELD_COS_PITCH * n];
+      state.sin_pitch = d[FIELD_SIN_PITCH * n];
+    }
+
+    void
+    UAVBatch::store(size_t index, const UAVModel::State& state)
+    {
+      double* d = &m_state[index];
+      const size_t n = m_stride;
+
+      for (unsigned i = 0; i < 6; ++i)
+      {
+        d[(FIELD_POSITION + i) * n] = state.position[i];
+        d[(FIELD_VELOCITY + i) * n] = state.velocity[i];
+      }
+
+      for (unsigned i = 0; i < 3; ++i)
+      {
+        d[(FIELD_WIND + i) * n] = state.wind[i];
+        d[(FIELD_UAV2WIND + i) * n] = state.uav2wind[i];
+      }
+
+      d[FIELD_AIRSPEED * n] = state.airspeed;
+      d[FIELD_ANG_ATTACK * n] = state.ang_attack;
+      d[FIELD_SIDESLIP * n] = state.sideslip;
+      d[FIELD_COS_YAW * n] = state.cos_yaw;
+      d[FIELD_SIN_YAW * n] = state.sin_yaw;
+      d[FIELD_COS_PITCH * n] = state.cos_pitch;
+      d[FIELD_SIN_PITCH * n] = state.sin_pitch;
+    }
+
+    size_t
+    UAVBatch::update(double timestep)
+    {
+      const bool alt_model = (m_type == UAVModel::TYPE_4DOF_ALT || m_type == UAVModel::TYPE_5DOF);
+      const bool bank_model = (m_type == UAVModel::TYPE_4DOF_BANK || m_type == UAVModel::TYPE_5DOF);
+
+      double* x[6];
+      double* v[6];
+      for (unsigned k = 0; k < 6; ++k)
+      {
+        x[k] = field(FIELD_POSITION + k);
+        v[k] = field(FIELD_VELOCITY + k);
+      }
+
+      double* w[3];
+      double* u[3];
+      for (unsigned k = 0; k < 3; ++k)
+      {
+        w[k] = field(FIELD_WIND + k);
+        u[k] = field(FIELD_UAV2WIND + k);
+      }
+
+      double* as = field(FIELD_AIRSPEED);
+      double* aoa = field(FIELD_ANG_ATTACK);
+      double* ss = field(FIELD_SIDESLIP);
+      double* cy = field(FIELD_COS_YAW);
+      double* sy = field(FIELD_SIN_YAW);
+      double* cp = field(FIELD_COS_PITCH);
+      double* sp = field(FIELD_SIN_PITCH);
+      double* dt = &m_dt[0];
+      double* yaw = &m_yaw[0];
+      unsigned char* active = &m_active[0];
+
+      // Check commands and parameters, and apply the time step limit.
+      size_t updated = 0;
+      for (size_t i = 0; i < m_size; ++i)
+      {
+        const UAVModel::Parameters& p = m_params[i];
+        m_status[i] = UAVModel::check(m_type, p, m_cmds[i]);
+        dt[i] = timestep;
+        active[i] = 0;
+
+        if (m_status[i] != UAVModel::STATUS_OK)
+          continue;
+
+        ++updated;
+
+        if (p.timestep_lim > 0.0 && timestep > p.timestep_lim)
+          dt[i] = p.timestep_lim;
+
+        if (!(dt[i] <= 0) && m_type != UAVModel::TYPE_NONE)
+          active[i] = 1;
+      }
+
+      // Wind effects and air data.
+      for (size_t i = 0; i < m_size; ++i)
+      {
+        if (!active[i])
+          continue;
+
+        if (m_type == UAVModel::TYPE_3DOF)
+          v[2][i] = w[2][i];
+
+        double n = 0;
+        for (unsigned k = 0; k < 3; ++k)
+        {
+          u[k][i] = v[k][i] - w[k][i];
+          n += u[k][i] * u[k][i];
+        }
+
+        as[i] = std::sqrt(n);
+        aoa[i] = std::atan(u[2][i] / u[0][i]);
+        ss[i] = std::asin(u[1][i] / as[i]);
+      }
+
+      // Vertical position and Euler angles.
+      for (size_t i = 0; i < m_size; ++i)
+      {
+        if (!active[i])
+          continue;
+
+        yaw[i] = x[5][i];
+        for (unsigned k = 2; k < 6; ++k)
+          x[k][i] += v[k][i] * dt[i];
+        x[3][i] = Math::Angles::normalizeRadian(x[3][i]);
+        x[5][i] = Math::Angles::normalizeRadian(x[5][i]);
+      }
+
+      for (size_t i = 0; i < m_size; ++i)
+      {
+        if (!active[i])
+          continue;
+
+        cy[i] = std::cos(x[5][i]);
+        sy[i] = std::sin(x[5][i]);
+        if (alt_model)
+        {
+          cp[i] = std::cos(x[4][i]);
+          sp[i] = std::sin(x[4][i]);
+        }
+      }
+
+      // Horizontal position.
+      for (size_t i = 0; i < m_size; ++i)
+      {
+        if (!active[i])
+          continue;
+
+        if (std::abs(x[3][i]) < 0.1)
+        {
+          x[0][i] += v[0][i] * dt[i];
+          x[1][i] += v[1][i] * dt[i];
+        }
+        else
+        {
+          double d_turn_radius = as[i] / v[5][i];
+          x[0][i] += d_turn_radius * (sy[i] - std::sin(yaw[i])) + w[0][i] * dt[i];
+          x[1][i] += d_turn_radius * (std::cos(yaw[i]) - cy[i]) + w[1][i] * dt[i];
+        }
+      }
+
+      // Command effect.
+      for (size_t i = 0; i < m_size; ++i)
+      {
+        if (!active[i])
+          continue;
+
+        const UAVModel::Commands& c = m_cmds[i];
+        const UAVModel::Parameters& p = m_params[i];
+
+        if (bank_model)
+        {
+          // Turn rate
+          v[5][i] = Math::c_gravity * std::tan(x[3][i]) / as[i];
+
+          // - Horizontal acceleration command
+          double d_lon_accel = (c.airspeed - as[i]) / p.speed_time_cst;
+          if (p.lon_accel_lim_f)
+            d_lon_accel = Math::trimValue(d_lon_accel, - p.lon_accel_lim, p.lon_accel_lim);
+          as[i] += d_lon_accel * dt[i];
+          // - Roll rate command
+          v[3][i] = (c.bank - x[3][i]) / p.bank_time_cst;
+          if (p.bank_rate_lim_f)
+            v[3][i] = Math::trimValue(v[3][i], - p.bank_rate_lim, p.bank_rate_lim);
+        }
+        else
+        {
+          as[i] = c.airspeed;
+          x[3][i] = c.bank;
+        }
+
+        if (alt_model)
+        {
+          // - Vertical rate command
+          if (c.altitude_ini)
+            v[2][i] = ( - c.altitude - x[2][i]) / p.alt_time_cst;
+          else
+            v[2][i] = - std::sin(c.fpa) * as[i];
+          if (p.vert_slope_lim_f)
+          {
+            double d_vert_rate_lim = p.vert_slope_lim * as[i];
+            v[2][i] = Math::trimValue(v[2][i], - d_vert_rate_lim, d_vert_rate_lim);
+          }
+          else
+            v[2][i] = Math::trimValue(v[2][i], - as[i], as[i]);
+
+          // - Computing flight path angle
+          sp[i] = - v[2][i] / as[i];
+          cp[i] = std::sqrt(1 - sp[i] * sp[i]);
+          x[4][i] = Math::Angles::normalizeRadian(std::asin(sp[i]) * 2) / 2;
+        }
+        else if (bank_model)
+        {
+          // Wind effects
+          v[2][i] = w[2][i];
+        }
+
+        if (!bank_model)
+        {
+          // Turn rate
+          v[5][i] = Math::c_gravity * std::tan(x[3][i]) / as[i];
+        }
+      }
+
+      // Velocity relative to the wind and to the ground.
+      for (size_t i = 0; i < m_size; ++i)
+      {
+        if (!active[i])
+          continue;
+
+        u[0][i] = as[i] * cy[i] * cp[i];
+        u[1][i] = as[i] * sy[i] * cp[i];
+        u[2][i] = - as[i] * sp[i];
+        for (unsigned k = 0; k < 3; ++k)
+          v[k][i] = u[k][i] + w[k][i];
+      }
+
+      return updated;
+    }
+
+    void
+    UAVBatch::getState(size_t index, UAVModel::State& state) const
+    {
+      load(index, state);
+    }
+
+    void
+    UAVBatch::setWind(size_t index, const double* wind)
+    {
+      for (unsigned i = 0; i < 3; ++i)
+        m_state[(FIELD_WIND + i) * m_stride + index] = wind[i];
+    }
+
+    bool
+    UAVBatch::commandBank(size_t index, double bank_cmd)
+    {
+      if (Math::isNaN(bank_cmd))
+        return false;
+
+      m_cmds[index].bank = bank_cmd;
+      return true;
+    }
+
+    bool
+    UAVBatch::commandAirspeed(size_t index, double airspeed_cmd)
+    {
+      if (Math::isNaN(airspeed_cmd))
+        return false;
+
+      m_cmds[index].airspeed = airspeed_cmd;
+      m_cmds[index].airspeed_ini = true;
+      return true;
+    }
+
+    bool
+    UAVBatch::commandAlt(size_t index, double altitude_cmd)
+    {
+      if (Math::isNaN(altitude_cmd))
+        return false;
+
+      UAVModel::Commands& c = m_cmds[index];
+      c.altitude = altitude_cmd;
+      c.altitude_ini = true;
+      c.fpa_ini = false;
+      c.pitch_ini = false;
+
+      if (m_type == UAVModel::TYPE_3DOF || m_type == UAVModel::TYPE_4DOF_BANK)
+        m_state[(FIELD_POSITION + 2) * m_stride + index] = - altitude_cmd;
+
+      return true;
+    }
+
+    bool
+    UAVBatch::commandFPA(size_t index, double fpa_cmd)
+    {
+      if (Math::isNaN(fpa_cmd))
+        return false;
+
+      UAVModel::Commands& c = m_cmds[index];
+      c.fpa = fpa_cmd;
+      c.altitude_ini = false;
+      c.fpa_ini = true;
+      c.pitch_ini = false;
+      return true;
+    }
+  }
+}
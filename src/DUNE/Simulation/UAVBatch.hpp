@@ -0,0 +1,228 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_SIMULATION_UAV_BATCH_HPP_INCLUDED_
+#define DUNE_SIMULATION_UAV_BATCH_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Simulation/UAVModel.hpp>
+
+namespace DUNE
+{
+  namespace Simulation
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM UAVBatch;
+
+    //! Batch of vehicles of the same model type, stepped together.
+    //! The state is kept as a structure of arrays in a single buffer
+    //! and updates run each stage of the model over all vehicles in
+    //! turn, on contiguous arrays. Each vehicle goes through the same
+    //! operations as in UAVModel::step(), so results are identical to
+    //! stepping each vehicle with its own UAVModel.
+    class UAVBatch
+    {
+    public:
+      //! Constructor.
+      //! @param[in] type model type of all vehicles.
+      UAVBatch(UAVModel::Type type);
+
+      //! Reserve storage for a number of vehicles.
+      //! @param[in] count number of vehicles.
+      void
+      reserve(size_t count);
+
+      //! Add a vehicle.
+      //! @param[in] model initial state, parameters and commands.
+      //! @return vehicle index.
+      //! @throw std::runtime_error if the model type differs from the
+      //! batch type.
+      size_t
+      add(const UAVModel& model);
+
+      //! Remove all vehicles.
+      void
+      clear(void);
+
+      //! Get the number of vehicles.
+      //! @return number of vehicles.
+      size_t
+      size(void) const
+      {
+        return m_size;
+      }
+
+      //! Update the state of all vehicles.
+      //! @param[in] timestep time step.
+      //! @return number of vehicles whose state was updated.
+      size_t
+      update(double timestep);
+
+      //! Get the result of the last update of a vehicle.
+      //! @param[in] index vehicle index.
+      //! @return update status.
+      UAVModel::Status
+      getStatus(size_t index) const
+      {
+        return (UAVModel::Status)m_status[index];
+      }
+
+      //! Get an element of the position vector of a vehicle.
+      //! @param[in] index vehicle index.
+      //! @param[in] element element index (0 to 5).
+      //! @return element value.
+      double
+      getPosition(size_t index, unsigned element) const
+      {
+        return m_state[(FIELD_POSITION + element) * m_stride + index];
+      }
+
+      //! Get an element of the velocity vector of a vehicle.
+      //! @param[in] index vehicle index.
+      //! @param[in] element element index (0 to 5).
+      //! @return element value.
+      double
+      getVelocity(size_t index, unsigned element) const
+      {
+        return m_state[(FIELD_VELOCITY + element) * m_stride + index];
+      }
+
+      //! Get the airspeed of a vehicle.
+      //! @param[in] index vehicle index.
+      //! @return airspeed.
+      double
+      getAirspeed(size_t index) const
+      {
+        return m_state[FIELD_AIRSPEED * m_stride + index];
+      }
+
+      //! Get the full state of a vehicle.
+      //! @param[in] index vehicle index.
+      //! @param[out] state vehicle state.
+      void
+      getState(size_t index, UAVModel::State& state) const;
+
+      //! Set the wind velocity seen by a vehicle.
+      //! @param[in] index vehicle index.
+      //! @param[in] wind wind velocity vector (3 elements).
+      void
+      setWind(size_t index, const double* wind);
+
+      //! Set the bank command of a vehicle.
+      //! @param[in] index vehicle index.
+      //! @param[in] bank_cmd bank command.
+      //! @return false if the command is not a number.
+      bool
+      commandBank(size_t index, double bank_cmd);
+
+      //! Set the airspeed command of a vehicle.
+      //! @param[in] index vehicle index.
+      //! @param[in] airspeed_cmd airspeed command.
+      //! @return false if the command is not a number.
+      bool
+      commandAirspeed(size_t index, double airspeed_cmd);
+
+      //! Set the altitude command of a vehicle.
+      //! @param[in] index vehicle index.
+      //! @param[in] altitude_cmd altitude command.
+      //! @return false if the command is not a number.
+      bool
+      commandAlt(size_t index, double altitude_cmd);
+
+      //! Set the flight path angle command of a vehicle.
+      //! @param[in] index vehicle index.
+      //! @param[in] fpa_cmd flight path angle command.
+      //! @return false if the command is not a number.
+      bool
+      commandFPA(size_t index, double fpa_cmd);
+
+    private:
+      //! Offsets of the state variables in the state buffer, in
+      //! units of the stride.
+      enum Fields
+      {
+        FIELD_POSITION = 0,
+        FIELD_VELOCITY = 6,
+        FIELD_WIND = 12,
+        FIELD_UAV2WIND = 15,
+        FIELD_AIRSPEED = 18,
+        FIELD_ANG_ATTACK,
+        FIELD_SIDESLIP,
+        FIELD_COS_YAW,
+        FIELD_SIN_YAW,
+        FIELD_COS_PITCH,
+        FIELD_SIN_PITCH,
+        FIELD_COUNT
+      };
+
+      //! Model type.
+      UAVModel::Type m_type;
+      //! Number of vehicles.
+      size_t m_size;
+      //! Distance between consecutive state variables in the buffer.
+      size_t m_stride;
+      //! State, one array of m_stride values per state variable.
+      std::vector<double> m_state;
+      //! Model parameters.
+      std::vector<UAVModel::Parameters> m_params;
+      //! Control commands.
+      std::vector<UAVModel::Commands> m_cmds;
+      //! Status of the last update.
+      std::vector<unsigned char> m_status;
+      //! Vehicles whose state changes in the current update.
+      std::vector<unsigned char> m_active;
+      //! Time step of each vehicle in the current update.
+      std::vector<double> m_dt;
+      //! Yaw angle of each vehicle before the current update.
+      std::vector<double> m_yaw;
+
+      //! Get the array of a state variable.
+      //! @param[in] field state variable.
+      //! @return pointer to the first element.
+      double*
+      field(unsigned field)
+      {
+        return &m_state[field * m_stride];
+      }
+
+      void
+      load(size_t index, UAVModel::State& state) const;
+
+      void
+      store(size_t index, const UAVModel::State& state);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,458 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/Math/Angles.hpp>
+#include <DUNE/Math/Constants.hpp>
+#include <DUNE/Math/General.hpp>
+#include <DUNE/Simulation/UAVModel.hpp>
+
+namespace DUNE
+{
+  namespace Simulation
+  {
+    //! Update the air data from the velocity and the wind.
+    static inline void
+    calcAirData(UAVModel::State& s)
+    {
+      // Vehicle velocity vector, relative to the wind, in the ground reference frame
+      for (unsigned i = 0; i < 3; ++i)
+        s.uav2wind[i] = s.velocity[i] - s.wind[i];
+
+      // Airspeed
+      double n = 0;
+      for (unsigned i = 0; i < 3; ++i)
+        n += s.uav2wind[i] * s.uav2wind[i];
+      s.airspeed = std::sqrt(n);
+      // Angle-of-Attack
+      s.ang_attack = std::atan(s.uav2wind[2] / s.uav2wind[0]);
+      // Sideslip
+      s.sideslip = std::asin(s.uav2wind[1] / s.airspeed);
+    }
+
+    //! Integrate the position and attitude.
+    static inline void
+    integratePosition(UAVModel::Type type, UAVModel::State& s, double timestep)
+    {
+      double d_initial_yaw = s.position[5];
+      // Vertical position and Euler angles state update
+      for (unsigned i = 2; i < 6; ++i)
+        s.position[i] += s.velocity[i] * timestep;
+      s.position[3] = Math::Angles::normalizeRadian(s.position[3]);
+      s.position[5] = Math::Angles::normalizeRadian(s.position[5]);
+      // Optimization variables
+      s.cos_yaw = std::cos(s.position[5]);
+      s.sin_yaw = std::sin(s.position[5]);
+      if (type == UAVModel::TYPE_5DOF || type == UAVModel::TYPE_4DOF_ALT)
+      {
+        s.cos_pitch = std::cos(s.position[4]);
+        s.sin_pitch = std::sin(s.position[4]);
+      }
+
+      // Horizontal position state update
+      if (std::abs(s.position[3]) < 0.1)
+      {
+        s.position[0] += s.velocity[0] * timestep;
+        s.position[1] += s.velocity[1] * timestep;
+      }
+      else
+      {
+        double d_turn_radius = s.airspeed / s.velocity[5];
+        s.position[0] += d_turn_radius * (s.sin_yaw - std::sin(d_initial_yaw)) + s.wind[0] * timestep;
+        s.position[1] += d_turn_radius * (std::cos(d_initial_yaw) - s.cos_yaw) + s.wind[1] * timestep;
+      }
+    }
+
+    //! Update the velocity from the airspeed and attitude.
+    static inline void
+    updateVelocity(UAVModel::State& s)
+    {
+      // UAV velocity components relative to the wind over the ground reference frame
+      s.uav2wind[0] = s.airspeed * s.cos_yaw * s.cos_pitch;
+      s.uav2wind[1] = s.airspeed * s.sin_yaw * s.cos_pitch;
+      s.uav2wind[2] = - s.airspeed * s.sin_pitch;
+      // UAV velocity components relative to the ground over the ground reference frame
+      for (unsigned i = 0; i < 3; ++i)
+        s.velocity[i] = s.uav2wind[i] + s.wind[i];
+    }
+
+    //! Apply the bank and airspeed dynamics.
+    static inline void
+    updateBankSpeed(UAVModel::State& s, const UAVModel::Parameters& p,
+                    const UAVModel::Commands& c, double timestep)
+    {
+      // Turn rate
+      s.velocity[5] = Math::c_gravity * std::tan(s.position[3]) / s.airspeed;
+
+      // Command effect
+      // - Horizontal acceleration command
+      double d_lon_accel = (c.airspeed - s.airspeed) / p.speed_time_cst;
+      if (p.lon_accel_lim_f)
+        d_lon_accel = Math::trimValue(d_lon_accel, - p.lon_accel_lim, p.lon_accel_lim);
+      s.airspeed += d_lon_accel * timestep;
+      // - Roll rate command
+      s.velocity[3] = (c.bank - s.position[3]) / p.bank_time_cst;
+      if (p.bank_rate_lim_f)
+        s.velocity[3] = Math::trimValue(s.velocity[3], - p.bank_rate_lim, p.bank_rate_lim);
+    }
+
+    //! Apply the altitude dynamics.
+    static inline void
+    updateAltitude(UAVModel::State& s, const UAVModel::Parameters& p, const UAVModel::Commands& c)
+    {
+      // - Vertical rate command
+      if (c.altitude_ini)
+        s.velocity[2] = ( - c.altitude - s.position[2]) / p.alt_time_cst;
+      else
+        s.velocity[2] = - std::sin(c.fpa) * s.airspeed;
+      if (p.vert_slope_lim_f)
+      {
+        double d_vert_rate_lim = p.vert_slope_lim * s.airspeed;
+        s.velocity[2] = Math::trimValue(s.velocity[2], - d_vert_rate_lim, d_vert_rate_lim);
+      }
+      else
+        // The vertical speed should not exceed the airspeed, even if there is no specified vertical slope limit
+        s.velocity[2] = Math::trimValue(s.velocity[2], - s.airspeed, s.airspeed);
+
+      // - Computing flight path angle
+      s.sin_pitch = - s.velocity[2] / s.airspeed;
+      s.cos_pitch = std::sqrt(1 - s.sin_pitch * s.sin_pitch);
+      s.position[4] = Math::Angles::normalizeRadian(std::asin(s.sin_pitch) * 2) / 2;
+    }
+
+    UAVModel::UAVModel(Type type):
+      m_type(type)
+    {
+      reset();
+    }
+
+    UAVModel::Type
+    UAVModel::getType(const std::string& name)
+    {
+      if (name == "3DOF")
+        return TYPE_3DOF;
+      if (name == "4DOF_alt")
+        return TYPE_4DOF_ALT;
+      if (name == "4DOF_bank")
+        return TYPE_4DOF_BANK;
+      if (name == "5DOF")
+        return TYPE_5DOF;
+
+      return TYPE_NONE;
+    }
+
+    void
+    UAVModel::reset(void)
+    {
+      for (unsigned i = 0; i < 6; ++i)
+      {
+        m_state.position[i] = 0.0;
+        m_state.velocity[i] = 0.0;
+      }
+
+      for (unsigned i = 0; i < 3; ++i)
+      {
+        m_state.wind[i] = 0.0;
+        m_state.uav2wind[i] = 0.0;
+      }
+
+      m_state.airspeed = 0.0;
+      m_state.ang_attack = 0.0;
+      m_state.sideslip = 0.0;
+      m_state.cos_yaw = 1.0;
+      m_state.sin_yaw = 0.0;
+      m_state.cos_pitch = 1.0;
+      m_state.sin_pitch = 0.0;
+
+      m_params.bank_time_cst = 0.0;
+      m_params.bank_time_cst_f = false;
+      m_params.speed_time_cst = 0.0;
+      m_params.speed_time_cst_f = false;
+      m_params.alt_time_cst = 0.0;
+      m_params.alt_time_cst_f = false;
+      m_params.bank_rate_lim = 0.0;
+      m_params.bank_rate_lim_f = false;
+      m_params.lon_accel_lim = 0.0;
+      m_params.lon_accel_lim_f = false;
+      m_params.vert_slope_lim = 0.0;
+      m_params.vert_slope_lim_f = false;
+      m_params.timestep_lim = 1.0;
+
+      m_cmds.bank = 0.0;
+      m_cmds.airspeed = 0.0;
+      m_cmds.altitude = 0.0;
+      m_cmds.fpa = 0.0;
+      m_cmds.pitch = 0.0;
+      m_cmds.airspeed_ini = false;
+      m_cmds.altitude_ini = false;
+      m_cmds.fpa_ini = false;
+      m_cmds.pitch_ini = false;
+    }
+
+    void
+    UAVModel::setCtrl(double bank_time_cst, double speed_time_cst)
+    {
+      m_params.bank_time_cst = bank_time_cst;
+      m_params.bank_time_cst_f = true;
+      m_params.speed_time_cst = speed_time_cst;
+      m_params.speed_time_cst_f = true;
+    }
+
+    void
+    UAVModel::setAltCtrl(double alt_time_cst)
+    {
+      m_params.alt_time_cst = alt_time_cst;
+      m_params.alt_time_cst_f = true;
+    }
+
+    void
+    UAVModel::setBankRateLim(double bank_rate_lim)
+    {
+      m_params.bank_rate_lim = bank_rate_lim;
+      m_params.bank_rate_lim_f = (bank_rate_lim > 0);
+    }
+
+    void
+    UAVModel::setAccelLim(double lon_accel_lim)
+    {
+      m_params.lon_accel_lim = lon_accel_lim;
+      m_params.lon_accel_lim_f = (lon_accel_lim > 0);
+    }
+
+    void
+    UAVModel::setVertSlopeLim(double vert_slope_lim)
+    {
+      m_params.vert_slope_lim = vert_slope_lim;
+      m_params.vert_slope_lim_f = (vert_slope_lim > 0);
+    }
+
+    void
+    UAVModel::setWind(const double* wind)
+    {
+      for (unsigned i = 0; i < 3; ++i)
+        m_state.wind[i] = wind[i];
+    }
+
+    void
+    UAVModel::setPosition(const double* pos, unsigned count)
+    {
+      for (unsigned i = 0; i < count && i < 6; ++i)
+        m_state.position[i] = pos[i];
+
+      // Reset the pitch angle for the simulations that do not update it
+      if (m_type == TYPE_3DOF || m_type == TYPE_4DOF_BANK)
+        m_state.position[4] = 0;
+
+      m_state.cos_pitch = std::cos(m_state.position[4]);
+      m_state.sin_pitch = std::sin(m_state.position[4]);
+    }
+
+    void
+    UAVModel::setVelocity(const double* vel, unsigned count)
+    {
+      for (unsigned i = 0; i < count && i < 6; ++i)
+        m_state.velocity[i] = vel[i];
+
+      // Reset the vertical velocity for the simulations that do not update it
+      if (m_type == TYPE_3DOF || m_type == TYPE_4DOF_BANK)
+        m_state.velocity[2] = 0;
+      // Reset the pitch angular rate, no model updates it
+      m_state.velocity[4] = 0;
+
+      calcAirData(m_state);
+    }
+
+    bool
+    UAVModel::commandBank(double bank_cmd)
+    {
+      if (Math::isNaN(bank_cmd))
+        return false;
+
+      m_cmds.bank = bank_cmd;
+      return true;
+    }
+
+    bool
+    UAVModel::commandAirspeed(double airspeed_cmd)
+    {
+      if (Math::isNaN(airspeed_cmd))
+        return false;
+
+      m_cmds.airspeed = airspeed_cmd;
+      m_cmds.airspeed_ini = true;
+      return true;
+    }
+
+    bool
+    UAVModel::commandAlt(double altitude_cmd)
+    {
+      if (Math::isNaN(altitude_cmd))
+        return false;
+
+      m_cmds.altitude = altitude_cmd;
+      if (m_type == TYPE_3DOF || m_type == TYPE_4DOF_BANK)
+        m_state.position[2] = - altitude_cmd;
+      m_cmds.altitude_ini = true;
+      m_cmds.fpa_ini = false;
+      m_cmds.pitch_ini = false;
+      return true;
+    }
+
+    bool
+    UAVModel::commandFPA(double fpa_cmd)
+    {
+      if (Math::isNaN(fpa_cmd))
+        return false;
+
+      m_cmds.fpa = fpa_cmd;
+      m_cmds.altitude_ini = false;
+      m_cmds.fpa_ini = true;
+      m_cmds.pitch_ini = false;
+      return true;
+    }
+
+    bool
+    UAVModel::commandPitch(double pitch_cmd)
+    {
+      if (Math::isNaN(pitch_cmd))
+        return false;
+
+      m_cmds.pitch = pitch_cmd;
+      m_cmds.altitude_ini = false;
+      m_cmds.fpa_ini = false;
+      m_cmds.pitch_ini = true;
+      return true;
+    }
+
+    UAVModel::Status
+    UAVModel::check(Type type, const Parameters& p, const Commands& c)
+    {
+      // Check if model has the required commands
+      if (!c.airspeed_ini)
+        return STATUS_NO_AIRSPEED_CMD;
+
+      switch (type)
+      {
+        case TYPE_4DOF_ALT:
+          if (!c.altitude_ini && !c.fpa_ini)
+            return STATUS_NO_ALTITUDE_CMD;
+          if (!p.alt_time_cst_f)
+            return STATUS_NO_ALT_TIME_CST;
+          break;
+
+        case TYPE_4DOF_BANK:
+          if (!p.bank_time_cst_f)
+            return STATUS_NO_PARAMETERS;
+          break;
+
+        case TYPE_5DOF:
+          if (!c.altitude_ini && !c.fpa_ini)
+            return STATUS_NO_ALTITUDE_CMD;
+          if (!p.bank_time_cst_f && !p.speed_time_cst_f && !p.alt_time_cst_f)
+            return STATUS_NO_PARAMETERS;
+          if (!p.alt_time_cst_f)
+            return STATUS_NO_ALT_TIME_CST;
+          break;
+
+        default:
+          break;
+      }
+
+      return STATUS_OK;
+    }
+
+    UAVModel::Status
+    UAVModel::step(Type type, State& s, const Parameters& p, const Commands& c, double timestep)
+    {
+      Status status = check(type, p, c);
+      if (status != STATUS_OK)
+        return status;
+
+      // Time step control
+      if (p.timestep_lim > 0.0 && timestep > p.timestep_lim)
+        timestep = p.timestep_lim;
+
+      if (timestep <= 0 || type == TYPE_NONE)
+        return STATUS_OK;
+
+      // Wind effects
+      if (type == TYPE_3DOF)
+        s.velocity[2] = s.wind[2];
+
+      calcAirData(s);
+
+      //==========================================================================
+      // Aircraft Dynamics
+      //==========================================================================
+
+      integratePosition(type, s, timestep);
+
+      switch (type)
+      {
+        case TYPE_3DOF:
+          // Command effect
+          s.airspeed = c.airspeed;
+          s.position[3] = c.bank;
+          // Turn rate
+          s.velocity[5] = Math::c_gravity * std::tan(s.position[3]) / s.airspeed;
+          break;
+
+        case TYPE_4DOF_ALT:
+          // Command effect
+          s.airspeed = c.airspeed;
+          s.position[3] = c.bank;
+          updateAltitude(s, p, c);
+          // Turn rate
+          s.velocity[5] = Math::c_gravity * std::tan(s.position[3]) / s.airspeed;
+          break;
+
+        case TYPE_4DOF_BANK:
+          updateBankSpeed(s, p, c, timestep);
+          // Wind effects
+          s.velocity[2] = s.wind[2];
+          break;
+
+        case TYPE_5DOF:
+          updateBankSpeed(s, p, c, timestep);
+          updateAltitude(s, p, c);
+          break;
+
+        case TYPE_NONE:
+          break;
+      }
+
+      updateVelocity(s);
+
+      return STATUS_OK;
+    }
+  }
+}
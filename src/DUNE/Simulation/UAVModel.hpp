@@ -0,0 +1,345 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_SIMULATION_UAV_MODEL_HPP_INCLUDED_
+#define DUNE_SIMULATION_UAV_MODEL_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Simulation
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM UAVModel;
+
+    //! Kinematic UAV models with fixed-size state. These are the
+    //! models of UAVSimulation without heap allocations, so that
+    //! they can be stepped at high rates or in large numbers (see
+    //! UAVBatch).
+    class UAVModel
+    {
+    public:
+      //! Model types.
+      enum Type
+      {
+        //! 3 DOF, commanded bank and airspeed.
+        TYPE_3DOF,
+        //! 4 DOF with altitude dynamics.
+        TYPE_4DOF_ALT,
+        //! 4 DOF with bank and airspeed dynamics.
+        TYPE_4DOF_BANK,
+        //! 5 DOF with bank, airspeed and altitude dynamics.
+        TYPE_5DOF,
+        //! Model without dynamics.
+        TYPE_NONE
+      };
+
+      //! Result of an update.
+      enum Status
+      {
+        //! State was updated.
+        STATUS_OK,
+        //! Airspeed command is missing.
+        STATUS_NO_AIRSPEED_CMD,
+        //! Altitude or flight path angle command is missing.
+        STATUS_NO_ALTITUDE_CMD,
+        //! Model time constants are missing.
+        STATUS_NO_PARAMETERS,
+        //! Altitude time constant is missing.
+        STATUS_NO_ALT_TIME_CST
+      };
+
+      //! Evolving state of a vehicle.
+      struct State
+      {
+        //! Position and attitude (x, y, z, roll, pitch, yaw).
+        double position[6];
+        //! Velocity relative to the ground and angular rates.
+        double velocity[6];
+        //! Wind velocity.
+        double wind[3];
+        //! Velocity relative to the wind, in the ground frame.
+        double uav2wind[3];
+        //! Airspeed.
+        double airspeed;
+        //! Angle of attack.
+        double ang_attack;
+        //! Sideslip angle.
+        double sideslip;
+        //! Cosine and sine of the yaw and pitch angles.
+        double cos_yaw;
+        double sin_yaw;
+        double cos_pitch;
+        double sin_pitch;
+      };
+
+      //! Vehicle model parameters and operation limits. Each value
+      //! is only used if its flag is set.
+      struct Parameters
+      {
+        //! Bank time constant.
+        double bank_time_cst;
+        bool bank_time_cst_f;
+        //! Airspeed time constant.
+        double speed_time_cst;
+        bool speed_time_cst_f;
+        //! Altitude time constant.
+        double alt_time_cst;
+        bool alt_time_cst_f;
+        //! Bank rate limit.
+        double bank_rate_lim;
+        bool bank_rate_lim_f;
+        //! Longitudinal acceleration limit.
+        double lon_accel_lim;
+        bool lon_accel_lim_f;
+        //! Vertical slope limit.
+        double vert_slope_lim;
+        bool vert_slope_lim_f;
+        //! Maximum time step (disabled if not positive).
+        double timestep_lim;
+      };
+
+      //! Control commands and their initialization flags.
+      struct Commands
+      {
+        double bank;
+        double airspeed;
+        double altitude;
+        double fpa;
+        double pitch;
+        bool airspeed_ini;
+        bool altitude_ini;
+        bool fpa_ini;
+        bool pitch_ini;
+      };
+
+      //! Constructor.
+      //! Create a model with null initial state.
+      //! @param[in] type model type.
+      UAVModel(Type type = TYPE_3DOF);
+
+      //! Get the model type named as in UAVSimulation ("3DOF",
+      //! "4DOF_alt", "4DOF_bank" or "5DOF").
+      //! @param[in] name type name.
+      //! @return model type, TYPE_NONE for other names.
+      static Type
+      getType(const std::string& name);
+
+      //! Reset state, parameters and commands.
+      void
+      reset(void);
+
+      //! Set the model type.
+      //! @param[in] type model type.
+      void
+      setType(Type type)
+      {
+        m_type = type;
+      }
+
+      //! Get the model type.
+      //! @return model type.
+      Type
+      getType(void) const
+      {
+        return m_type;
+      }
+
+      //! Set the model control parameters.
+      //! @param[in] bank_time_cst bank angle time constant.
+      //! @param[in] speed_time_cst airspeed time constant.
+      void
+      setCtrl(double bank_time_cst, double speed_time_cst);
+
+      //! Set the altitude control parameter.
+      //! @param[in] alt_time_cst altitude time constant.
+      void
+      setAltCtrl(double alt_time_cst);
+
+      //! Set the bank rate limit (disabled if not positive).
+      //! @param[in] bank_rate_lim bank rate limit.
+      void
+      setBankRateLim(double bank_rate_lim);
+
+      //! Set the longitudinal acceleration limit (disabled if not
+      //! positive).
+      //! @param[in] lon_accel_lim longitudinal acceleration limit.
+      void
+      setAccelLim(double lon_accel_lim);
+
+      //! Set the vertical slope limit (disabled if not positive).
+      //! @param[in] vert_slope_lim vertical slope limit.
+      void
+      setVertSlopeLim(double vert_slope_lim);
+
+      //! Set the maximum time step of an update.
+      //! @param[in] timestep_lim time step limit (disabled if not
+      //! positive).
+      void
+      setTimeStepLim(double timestep_lim)
+      {
+        m_params.timestep_lim = timestep_lim;
+      }
+
+      //! Set the wind velocity.
+      //! @param[in] wind wind velocity vector (3 elements).
+      void
+      setWind(const double* wind);
+
+      //! Set the first elements of the position vector.
+      //! @param[in] pos position values.
+      //! @param[in] count number of values (up to 6).
+      void
+      setPosition(const double* pos, unsigned count);
+
+      //! Set the first elements of the velocity vector.
+      //! @param[in] vel velocity values.
+      //! @param[in] count number of values (up to 6).
+      void
+      setVelocity(const double* vel, unsigned count);
+
+      //! Set the bank command.
+      //! @param[in] bank_cmd bank command.
+      //! @return false if the command is not a number.
+      bool
+      commandBank(double bank_cmd);
+
+      //! Set the airspeed command.
+      //! @param[in] airspeed_cmd airspeed command.
+      //! @return false if the command is not a number.
+      bool
+      commandAirspeed(double airspeed_cmd);
+
+      //! Set the altitude command.
+      //! @param[in] altitude_cmd altitude command.
+      //! @return false if the command is not a number.
+      bool
+      commandAlt(double altitude_cmd);
+
+      //! Set the flight path angle command.
+      //! @param[in] fpa_cmd flight path angle command.
+      //! @return false if the command is not a number.
+      bool
+      commandFPA(double fpa_cmd);
+
+      //! Set the pitch command.
+      //! @param[in] pitch_cmd pitch command.
+      //! @return false if the command is not a number.
+      bool
+      commandPitch(double pitch_cmd);
+
+      //! Update the state.
+      //! @param[in] timestep time step.
+      //! @return update status.
+      Status
+      update(double timestep)
+      {
+        return step(m_type, m_state, m_params, m_cmds, timestep);
+      }
+
+      //! Check if a vehicle has the commands and parameters required
+      //! by a model.
+      //! @param[in] type model type.
+      //! @param[in] params model parameters.
+      //! @param[in] cmds control commands.
+      //! @return STATUS_OK if the state can be updated.
+      static Status
+      check(Type type, const Parameters& params, const Commands& cmds);
+
+      //! Update the state of a vehicle.
+      //! @param[in] type model type.
+      //! @param[in,out] state vehicle state.
+      //! @param[in] params model parameters.
+      //! @param[in] cmds control commands.
+      //! @param[in] timestep time step.
+      //! @return update status.
+      static Status
+      step(Type type, State& state, const Parameters& params, const Commands& cmds, double timestep);
+
+      //! Get the position vector (6 elements).
+      //! @return position vector.
+      const double*
+      getPosition(void) const
+      {
+        return m_state.position;
+      }
+
+      //! Get the velocity vector (6 elements).
+      //! @return velocity vector.
+      const double*
+      getVelocity(void) const
+      {
+        return m_state.velocity;
+      }
+
+      //! Get the airspeed.
+      //! @return airspeed.
+      double
+      getAirspeed(void) const
+      {
+        return m_state.airspeed;
+      }
+
+      const State&
+      getState(void) const
+      {
+        return m_state;
+      }
+
+      const Parameters&
+      getParameters(void) const
+      {
+        return m_params;
+      }
+
+      const Commands&
+      getCommands(void) const
+      {
+        return m_cmds;
+      }
+
+    private:
+      //! Model type.
+      Type m_type;
+      //! Vehicle state.
+      State m_state;
+      //! Model parameters.
+      Parameters m_params;
+      //! Control commands.
+      Commands m_cmds;
+    };
+  }
+}
+
+#endif
@@ -67,10 +67,18 @@
 #  include <devctl.h>
 #endif
 
+#if defined(DUNE_SYS_HAS_ALLOCA_H)
+#  include <alloca.h>
+#endif
+
 #if defined(DUNE_SYS_HAS_SYS_MMAN_H)
 #  include <sys/mman.h>
 #endif
 
+#if defined(DUNE_SYS_HAS_TIME_H)
+#  include <time.h>
+#endif
+
 #if defined(DUNE_OS_RTEMS)
 extern "C" int
 getrusage(int who, struct rusage* r_usage);
@@ -80,6 +88,10 @@ namespace DUNE
 {
   namespace System
   {
+    //! Stride used to touch the stack. Pages are never smaller than
+    //! this so every page in the prefaulted range gets touched.
+    static const size_t c_stack_page_size = 4096;
+
 #if defined(DUNE_OS_LINUX)
     //! Number of useful fields in /proc/stat.
     static const unsigned c_proc_stat_values = 8;
@@ -180,6 +192,20 @@ namespace DUNE
       return proc_delta * 100 / global_delta;
     }
 
+    double
+    Resources::getThreadProcessorTime(void)
+    {
+#if defined(DUNE_SYS_HAS_CLOCK_GETTIME) && defined(CLOCK_THREAD_CPUTIME_ID)
+      timespec ts;
+      if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+        return -1;
+
+      return ts.tv_sec + ts.tv_nsec / Time::c_nsec_per_sec_fp;
+#else
+      return -1;
+#endif
+    }
+
     void
     Resources::lockMemory(void)
     {
@@ -223,6 +249,18 @@ namespace DUNE
 #else
       (void)addr;
       (void)length;
+#endif
+    }
+ 
+    void
+    Resources::prefaultStack(size_t size)
+    {
+#if defined(DUNE_SYS_HAS_ALLOCA_H)
+      volatile uint8_t* stack = static_cast<volatile uint8_t*>(alloca(size));
+      for (size_t i = 0; i < size; i += c_stack_page_size)
+        stack[i] = 0;
+#else
+      (void)size;
 #endif
     }
   }
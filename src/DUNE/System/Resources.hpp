@@ -57,6 +57,12 @@ namespace DUNE
       int
       getProcessorUsage(void);
 
+      //! Retrieve the CPU time consumed by the calling thread.
+      //! @return CPU time in seconds or -1 if not implemented in the
+      //! current platform.
+      static double
+      getThreadProcessorTime(void);
+
       //! Make all memory pages mapped by the address space of the
       //! current process to be memory-resident until unlocked or until
       //! the process exits.
@@ -83,6 +89,14 @@ namespace DUNE
       static void
       unlockMemory(const void* addr, size_t length);
 
+      //! Touch the top of the calling thread's stack so that the
+      //! pages backing it are mapped before time critical code runs.
+      //! Combined with lockMemory() this avoids page faults caused by
+      //! stack growth.
+      //! @param[in] size number of bytes of stack to prefault.
+      static void
+      prefaultStack(size_t size);
+
     private:
       //! Last process's CPU time.
       uint64_t m_last_proc_time;
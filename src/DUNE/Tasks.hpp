@@ -43,8 +43,11 @@ namespace DUNE
 #include <DUNE/Tasks/Periodic.hpp>
 #include <DUNE/Tasks/Profiles.hpp>
 #include <DUNE/Tasks/Task.hpp>
+#include <DUNE/Tasks/LogBackend.hpp>
+#include <DUNE/Tasks/Tracer.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Manager.hpp>
+#include <DUNE/Tasks/Startup.hpp>
 #include <DUNE/Tasks/AbstractConsumer.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
 #include <DUNE/Tasks/AbstractCreator.hpp>
@@ -66,6 +66,11 @@ namespace DUNE
       virtual const char*
       getName(void) const = 0;
 
+      //! Retrieve the main entity identifier of the task.
+      //! @return main entity identifier.
+      virtual unsigned int
+      getEntityId(void) const = 0;
+
       //! Send an human-readable informational message to all
       //! configured output channels and files.
       //! @param format string format (similar to printf(3)).
@@ -0,0 +1,1005 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Concurrency/TLS.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Delay.hpp>
+#include <DUNE/Tasks/LogBackend.hpp>
+#include <DUNE/Tasks/Task.hpp>
+
+#if defined(DUNE_SYS_HAS___SYNC_SYNCHRONIZE)
+#  define DUNE_LOG_BACKEND_ASYNC
+#endif
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    //! Maximum length of formatted messages.
+    static const size_t c_text_max_size = 1024;
+    //! Idle time between polls of the rings in milliseconds.
+    static const unsigned c_poll_period = 5;
+
+    //! Tags of captured arguments.
+    enum LogArgumentTag
+    {
+      TAG_SIGNED = 'i',
+      TAG_UNSIGNED = 'u',
+      TAG_DOUBLE = 'f',
+      TAG_LONG_DOUBLE = 'L',
+      TAG_POINTER = 'p',
+      TAG_STRING = 's'
+    };
+
+    //! Length modifiers of conversion specifications.
+    enum LogLengthModifier
+    {
+      LEN_NONE,
+      LEN_HH,
+      LEN_H,
+      LEN_L,
+      LEN_LL,
+      LEN_LONG_DOUBLE,
+      LEN_Z,
+      LEN_J,
+      LEN_T
+    };
+
+    //! Parsed conversion specification.
+    struct LogSpecification
+    {
+      //! First character after the '%'.
+      const char* begin;
+      //! First character of the length modifier.
+      const char* length_begin;
+      //! First character after the conversion specifier.
+      const char* end;
+      //! Length modifier.
+      LogLengthModifier length;
+      //! Conversion specifier.
+      char conversion;
+      //! Number of '*' in width and precision.
+      unsigned stars;
+    };
+
+    //! Parse a conversion specification.
+    //! @param[in] str pointer to the character following '%'.
+    //! @param[out] spec parsed specification.
+    //! @return true on success, false otherwise.
+    static bool
+    parseSpecification(const char* str, LogSpecification& spec)
+    {
+      spec.begin = str;
+      spec.stars = 0;
+
+      while (*str != 0 && std::strchr("-+ #0'", *str) != NULL)
+        ++str;
+
+      if (*str == '*')
+      {
+        ++spec.stars;
+        ++str;
+      }
+      else
+      {
+        while (*str >= '0' && *str <= '9')
+          ++str;
+      }
+
+      if (*str == '.')
+      {
+        ++str;
+        if (*str == '*')
+        {
+          ++spec.stars;
+          ++str;
+        }
+        else
+        {
+          while (*str >= '0' && *str <= '9')
+            ++str;
+        }
+      }
+
+      spec.length_begin = str;
+      spec.length = LEN_NONE;
+      switch (*str)
+      {
+        case 'h':
+          spec.length = (str[1] == 'h') ? LEN_HH : LEN_H;
+          str += (spec.length == LEN_HH) ? 2 : 1;
+          break;
+        case 'l':
+          spec.length = (str[1] == 'l') ? LEN_LL : LEN_L;
+          str += (spec.length == LEN_LL) ? 2 : 1;
+          break;
+        case 'q':
+          spec.length = LEN_LL;
+          ++str;
+          break;
+        case 'L':
+          spec.length = LEN_LONG_DOUBLE;
+          ++str;
+          break;
+        case 'z':
+          spec.length = LEN_Z;
+          ++str;
+          break;
+        case 'j':
+          spec.length = LEN_J;
+          ++str;
+          break;
+        case 't':
+          spec.length = LEN_T;
+          ++str;
+          break;
+        default:
+          break;
+      }
+
+      if (*str == 0)
+        return false;
+
+      spec.conversion = *str;
+      spec.end = str + 1;
+      return true;
+    }
+
+    //! Bounded writer of captured arguments.
+    class LogWriter
+    {
+    public:
+      LogWriter(char* bfr, size_t size):
+        m_bfr(bfr),
+        m_size(size),
+        m_pos(0),
+        m_ok(true)
+      { }
+
+      void
+      put(const void* data, size_t size)
+      {
+        if (!m_ok || m_pos + size > m_size)
+        {
+          m_ok = false;
+          return;
+        }
+
+        std::memcpy(m_bfr + m_pos, data, size);
+        m_pos += size;
+      }
+
+      template <typename T>
+      void
+      put(char tag, T value)
+      {
+        put(&tag, 1);
+        put(&value, sizeof(T));
+      }
+
+      size_t
+      getSize(void) const
+      {
+        return m_ok ? m_pos : 0;
+      }
+
+    private:
+      char* m_bfr;
+      size_t m_size;
+      size_t m_pos;
+      bool m_ok;
+    };
+
+    //! Bounded reader of captured arguments.
+    class LogReader
+    {
+    public:
+      LogReader(const char* data, size_t size):
+        m_data(data),
+        m_size(size),
+        m_pos(0)
+      { }
+
+      bool
+      skip(size_t size)
+      {
+        if (m_pos + size > m_size)
+          return false;
+
+        m_pos += size;
+        return true;
+      }
+
+      template <typename T>
+      bool
+      get(char tag, T& value)
+      {
+        if (m_pos + 1 + sizeof(T) > m_size || m_data[m_pos] != tag)
+          return false;
+
+        std::memcpy(&value, m_data + m_pos + 1, sizeof(T));
+        m_pos += 1 + sizeof(T);
+        return true;
+      }
+
+      const char*
+      getPointer(void) const
+      {
+        return m_data + m_pos;
+      }
+
+    private:
+      const char* m_data;
+      size_t m_size;
+      size_t m_pos;
+    };
+
+    //! Bounded, always NUL terminated, output string.
+    class LogOutput
+    {
+    public:
+      LogOutput(char* bfr, size_t size):
+        m_bfr(bfr),
+        m_size(size),
+        m_pos(0)
+      {
+        m_bfr[0] = 0;
+      }
+
+      void
+      append(const char* str, size_t size)
+      {
+        size = std::min(size, m_size - 1 - m_pos);
+        std::memcpy(m_bfr + m_pos, str, size);
+        m_pos += size;
+        m_bfr[m_pos] = 0;
+      }
+
+      template <typename T>
+      void
+      format(const char* spec, T value)
+      {
+        int rv = std::snprintf(m_bfr + m_pos, m_size - m_pos, spec, value);
+        if (rv > 0)
+          m_pos += std::min((size_t)rv, m_size - 1 - m_pos);
+      }
+
+    private:
+      char* m_bfr;
+      size_t m_size;
+      size_t m_pos;
+    };
+
+    size_t
+    LogBackend::pack(char* bfr, size_t size, const char* format, std::va_list ap)
+    {
+      LogWriter w(bfr, size);
+      w.put(format, std::strlen(format) + 1);
+
+      const char* ptr = format;
+      while (*ptr != 0)
+      {
+        if (*ptr++ != '%')
+          continue;
+
+        LogSpecification spec;
+        if (!parseSpecification(ptr, spec))
+          return 0;
+
+        ptr = spec.end;
+        if (spec.conversion == '%')
+          continue;
+
+        for (unsigned i = 0; i < spec.stars; ++i)
+          w.put(TAG_SIGNED, (int64_t)va_arg(ap, int));
+
+        switch (spec.conversion)
+        {
+          case 'd':
+          case 'i':
+            switch (spec.length)
+            {
+              case LEN_NONE:
+                w.put(TAG_SIGNED, (int64_t)va_arg(ap, int));
+                break;
+              case LEN_HH:
+                w.put(TAG_SIGNED, (int64_t)(signed char)va_arg(ap, int));
+                break;
+              case LEN_H:
+                w.put(TAG_SIGNED, (int64_t)(short)va_arg(ap, int));
+                break;
+              case LEN_L:
+                w.put(TAG_SIGNED, (int64_t)va_arg(ap, long));
+                break;
+              case LEN_LL:
+                w.put(TAG_SIGNED, (int64_t)va_arg(ap, long long));
+                break;
+              case LEN_Z:
+                w.put(TAG_SIGNED, (int64_t)(std::ptrdiff_t)va_arg(ap, size_t));
+                break;
+              case LEN_J:
+                w.put(TAG_SIGNED, (int64_t)va_arg(ap, intmax_t));
+                break;
+              case LEN_T:
+                w.put(TAG_SIGNED, (int64_t)va_arg(ap, std::ptrdiff_t));
+                break;
+              default:
+                return 0;
+            }
+            break;
+
+          case 'u':
+          case 'o':
+          case 'x':
+          case 'X':
+            switch (spec.length)
+            {
+              case LEN_NONE:
+                w.put(TAG_UNSIGNED, (uint64_t)va_arg(ap, unsigned));
+                break;
+              case LEN_HH:
+                w.put(TAG_UNSIGNED, (uint64_t)(unsigned char)va_arg(ap, unsigned));
+                break;
+              case LEN_H:
+                w.put(TAG_UNSIGNED, (uint64_t)(unsigned short)va_arg(ap, unsigned));
+                break;
+              case LEN_L:
+                w.put(TAG_UNSIGNED, (uint64_t)va_arg(ap, unsigned long));
+                break;
+              case LEN_LL:
+                w.put(TAG_UNSIGNED, (uint64_t)va_arg(ap, unsigned long long));
+                break;
+              case LEN_Z:
+                w.put(TAG_UNSIGNED, (uint64_t)va_arg(ap, size_t));
+                break;
+              case LEN_J:
+                w.put(TAG_UNSIGNED, (uint64_t)va_arg(ap, uintmax_t));
+                break;
+              case LEN_T:
+                w.put(TAG_UNSIGNED, (uint64_t)va_arg(ap, std::ptrdiff_t));
+                break;
+              default:
+                return 0;
+            }
+            break;
+
+          case 'c':
+            if (spec.length != LEN_NONE)
+              return 0;
+            w.put(TAG_SIGNED, (int64_t)va_arg(ap, int));
+            break;
+
+          case 'f':
+          case 'F':
+          case 'e':
+          case 'E':
+          case 'g':
+          case 'G':
+          case 'a':
+          case 'A':
+            if (spec.length == LEN_LONG_DOUBLE)
+              w.put(TAG_LONG_DOUBLE, va_arg(ap, long double));
+            else if (spec.length == LEN_NONE || spec.length == LEN_L)
+              w.put(TAG_DOUBLE, va_arg(ap, double));
+            else
+              return 0;
+            break;
+
+          case 's':
+            {
+              if (spec.length != LEN_NONE)
+                return 0;
+
+              const char* str = va_arg(ap, const char*);
+              if (str == NULL)
+                str = "(null)";
+
+              // Longer strings would be truncated when formatting.
+              uint32_t len = 0;
+              while (len < c_text_max_size && str[len] != 0)
+                ++len;
+
+              w.put(TAG_STRING, len);
+              w.put(str, len);
+            }
+            break;
+
+          case 'p':
+            if (spec.length != LEN_NONE)
+              return 0;
+            w.put(TAG_POINTER, va_arg(ap, void*));
+            break;
+
+          default:
+            // Unsupported conversion (including %n).
+            return 0;
+        }
+      }
+
+      return w.getSize();
+    }
+
+    void
+    LogBackend::unpack(const char* data, size_t size, char* bfr, size_t bfr_size)
+    {
+      LogOutput out(bfr, bfr_size);
+
+      const char* format = data;
+      const void* nul = std::memchr(data, 0, size);
+      if (nul == NULL)
+        return;
+
+      LogReader r(data, size);
+      r.skip((const char*)nul - data + 1);
+
+      const char* ptr = format;
+      while (*ptr != 0)
+      {
+        const char* next = std::strchr(ptr, '%');
+        if (next == NULL)
+        {
+          out.append(ptr, std::strlen(ptr));
+          break;
+        }
+
+        out.append(ptr, next - ptr);
+        ptr = next + 1;
+
+        LogSpecification spec;
+        if (!parseSpecification(ptr, spec))
+          break;
+
+        ptr = spec.end;
+        if (spec.conversion == '%')
+        {
+          out.append("%", 1);
+          continue;
+        }
+
+        // Rebuild the specification with '*' replaced by the
+        // captured values and the length normalized to the type
+        // used to capture the argument.
+        char fmt[64] = {'%'};
+        size_t fmt_len = 1;
+        for (const char* c = spec.begin; c != spec.length_begin; ++c)
+        {
+          if (*c != '*')
+          {
+            if (fmt_len < sizeof(fmt) - 16)
+              fmt[fmt_len++] = *c;
+            continue;
+          }
+
+          int64_t value = 0;
+          if (!r.get(TAG_SIGNED, value))
+            return;
+          fmt_len += std::snprintf(fmt + fmt_len, sizeof(fmt) - fmt_len, "%d", (int)value);
+        }
+
+        switch (spec.conversion)
+        {
+          case 'd':
+          case 'i':
+          case 'u':
+          case 'o':
+          case 'x':
+          case 'X':
+            fmt[fmt_len++] = 'l';
+            fmt[fmt_len++] = 'l';
+            break;
+          case 'f':
+          case 'F':
+          case 'e':
+          case 'E':
+          case 'g':
+          case 'G':
+          case 'a':
+          case 'A':
+            if (spec.length == LEN_LONG_DOUBLE)
+              fmt[fmt_len++] = 'L';
+            break;
+          default:
+            break;
+        }
+
+        fmt[fmt_len++] = spec.conversion;
+        fmt[fmt_len] = 0;
+
+        switch (spec.conversion)
+        {
+          case 'd':
+          case 'i':
+            {
+              int64_t value = 0;
+              if (!r.get(TAG_SIGNED, value))
+                return;
+              out.format(fmt, (long long)value);
+            }
+            break;
+
+          case 'u':
+          case 'o':
+          case 'x':
+          case 'X':
+            {
+              uint64_t value = 0;
+              if (!r.get(TAG_UNSIGNED, value))
+                return;
+              out.format(fmt, (unsigned long long)value);
+            }
+            break;
+
+          case 'c':
+            {
+              int64_t value = 0;
+              if (!r.get(TAG_SIGNED, value))
+                return;
+              out.format(fmt, (int)value);
+            }
+            break;
+
+          case 's':
+            {
+              uint32_t len = 0;
+              if (!r.get(TAG_STRING, len))
+                return;
+
+              std::string str(r.getPointer(), len);
+              if (!r.skip(len))
+                return;
+              out.format(fmt, str.c_str());
+            }
+            break;
+
+          case 'p':
+            {
+              void* value = NULL;
+              if (!r.get(TAG_POINTER, value))
+                return;
+              out.format(fmt, value);
+            }
+            break;
+
+          default:
+            if (spec.length == LEN_LONG_DOUBLE)
+            {
+              long double value = 0;
+              if (!r.get(TAG_LONG_DOUBLE, value))
+                return;
+              out.format(fmt, value);
+            }
+            else
+            {
+              double value = 0;
+              if (!r.get(TAG_DOUBLE, value))
+                return;
+              out.format(fmt, value);
+            }
+            break;
+        }
+      }
+    }
+
+#if defined(DUNE_LOG_BACKEND_ASYNC)
+    //! Header of queued records.
+    struct LogRecordHeader
+    {
+      //! Record size including header.
+      uint32_t size;
+      //! Message type.
+      uint32_t type;
+      //! Source entity.
+      uint32_t eid;
+      //! Time of the message.
+      double time;
+      //! Originating task.
+      Task* task;
+    };
+
+    //! Single producer single consumer byte ring.
+    struct LogRing
+    {
+      LogRing(void):
+        head(0),
+        tail(0),
+        orphan(false)
+      { }
+
+      //! LogRing storage.
+      char data[LogBackend::c_ring_size];
+      //! Absolute write position (written by producer).
+      volatile uint64_t head;
+      //! Absolute read position (written by consumer).
+      volatile uint64_t tail;
+      //! True if the producer thread is gone.
+      volatile bool orphan;
+    };
+
+    //! Per-thread producer state.
+    struct LogProducer
+    {
+      LogProducer(void):
+        ring(NULL)
+      { }
+
+      ~LogProducer(void)
+      {
+        if (ring == NULL)
+          return;
+
+        __sync_synchronize();
+        ring->orphan = true;
+      }
+
+      //! LogRing of this thread.
+      LogRing* ring;
+    };
+
+    //! Background formatter.
+    class LogBackend::Worker: public Concurrency::Thread
+    {
+    public:
+      Worker(double rate):
+        m_rate(rate)
+      { }
+
+      //! Process all complete records currently queued.
+      //! @return true if any record was processed.
+      bool
+      drain(void);
+
+    private:
+      //! Token bucket of a task.
+      struct Bucket
+      {
+        //! Available tokens.
+        double tokens;
+        //! Time of last refill.
+        double time;
+        //! Number of suppressed entries.
+        unsigned suppressed;
+      };
+
+      //! Maximum LogBookEntry rate per task.
+      double m_rate;
+      //! Records of the current pass.
+      std::vector<char> m_records;
+      //! Record offsets sorted by time.
+      std::vector<std::pair<double, size_t> > m_index;
+      //! Token buckets.
+      std::map<const Task*, Bucket> m_buckets;
+
+      bool
+      admit(const LogRecordHeader& hdr);
+
+      void
+      run(void)
+      {
+        while (!isStopping())
+        {
+          if (!drain())
+            Time::Delay::waitMsec(c_poll_period);
+        }
+
+        drain();
+      }
+    };
+
+    //! Shared backend state.
+    struct LogState
+    {
+      LogState(void):
+        worker(NULL),
+        running(false)
+      { }
+
+      //! Protects rings and worker.
+      Concurrency::Mutex mutex;
+      //! Rings of all producer threads.
+      std::vector<LogRing*> rings;
+      //! Per-thread producer state.
+      Concurrency::TLS<LogProducer> producers;
+      //! Background thread.
+      Concurrency::Thread* worker;
+      //! True if records are being accepted.
+      volatile bool running;
+    };
+
+    static LogState&
+    getLogState(void)
+    {
+      static LogState state;
+      return state;
+    }
+
+    //! Copy bytes out of a ring, handling wrap around.
+    static void
+    copyFromRing(const LogRing& ring, uint64_t from, uint64_t to, std::vector<char>& dst)
+    {
+      size_t size = to - from;
+      size_t begin = from % LogBackend::c_ring_size;
+      size_t first = std::min(size, LogBackend::c_ring_size - begin);
+      dst.insert(dst.end(), ring.data + begin, ring.data + begin + first);
+      dst.insert(dst.end(), ring.data, ring.data + (size - first));
+    }
+
+    bool
+    LogBackend::Worker::admit(const LogRecordHeader& hdr)
+    {
+      if (m_rate <= 0)
+        return true;
+
+      std::map<const Task*, Bucket>::iterator itr = m_buckets.find(hdr.task);
+      if (itr == m_buckets.end())
+      {
+        Bucket b = {m_rate, hdr.time, 0};
+        itr = m_buckets.insert(std::make_pair(hdr.task, b)).first;
+      }
+
+      Bucket& b = itr->second;
+      b.tokens = std::min(m_rate, b.tokens + std::max(0.0, hdr.time - b.time) * m_rate);
+      b.time = std::max(b.time, hdr.time);
+
+      bool forced = (hdr.type == IMC::LogBookEntry::LBET_ERROR
+                     || hdr.type == IMC::LogBookEntry::LBET_CRITICAL);
+
+      if (b.tokens < 1.0 && !forced)
+      {
+        ++b.suppressed;
+        return false;
+      }
+
+      b.tokens = std::max(0.0, b.tokens - 1.0);
+
+      if (b.suppressed > 0)
+      {
+        char text[64];
+        std::snprintf(text, sizeof(text), "suppressed %u log book entries", b.suppressed);
+        publish(hdr.task, IMC::LogBookEntry::LBET_WARNING, hdr.eid, hdr.time, text, true);
+        b.suppressed = 0;
+      }
+
+      return true;
+    }
+
+    bool
+    LogBackend::Worker::drain(void)
+    {
+      LogState& state = getLogState();
+      std::vector<LogRing*> rings;
+      {
+        Concurrency::ScopedMutex l(state.mutex);
+        for (size_t i = 0; i < state.rings.size(); )
+        {
+          LogRing* ring = state.rings[i];
+          if (ring->orphan && ring->tail == ring->head)
+          {
+            delete ring;
+            state.rings.erase(state.rings.begin() + i);
+            continue;
+          }
+          ++i;
+        }
+        rings = state.rings;
+      }
+
+      m_records.clear();
+      m_index.clear();
+
+      std::vector<uint64_t> heads(rings.size());
+      for (size_t i = 0; i < rings.size(); ++i)
+      {
+        heads[i] = rings[i]->head;
+        __sync_synchronize();
+        copyFromRing(*rings[i], rings[i]->tail, heads[i], m_records);
+      }
+
+      for (size_t pos = 0; pos + sizeof(LogRecordHeader) <= m_records.size(); )
+      {
+        LogRecordHeader hdr;
+        std::memcpy(&hdr, &m_records[pos], sizeof(hdr));
+        m_index.push_back(std::make_pair(hdr.time, pos));
+        pos += hdr.size;
+      }
+
+      std::stable_sort(m_index.begin(), m_index.end());
+
+      char text[c_text_max_size];
+      for (size_t i = 0; i < m_index.size(); ++i)
+      {
+        LogRecordHeader hdr;
+        const char* rec = &m_records[m_index[i].second];
+        std::memcpy(&hdr, rec, sizeof(hdr));
+        LogBackend::unpack(rec + sizeof(hdr), hdr.size - sizeof(hdr), text, sizeof(text));
+        publish(hdr.task, (IMC::LogBookEntry::TypeEnum)hdr.type, hdr.eid, hdr.time, text, admit(hdr));
+      }
+
+      // Release ring space only after publishing, so that flush()
+      // can wait on the tail positions.
+      __sync_synchronize();
+      for (size_t i = 0; i < rings.size(); ++i)
+        rings[i]->tail = heads[i];
+
+      return !m_index.empty();
+    }
+#endif
+
+    void
+    LogBackend::publish(Task* task, IMC::LogBookEntry::TypeEnum type, unsigned eid,
+                        double time, const char* text, bool book)
+    {
+      task->writeLog(type, eid, time, text, book);
+    }
+
+    void
+    LogBackend::start(double rate)
+    {
+#if defined(DUNE_LOG_BACKEND_ASYNC)
+      LogState& state = getLogState();
+      Concurrency::ScopedMutex l(state.mutex);
+      if (state.worker != NULL)
+        return;
+
+      // Discard anything left behind by a previous run.
+      for (size_t i = 0; i < state.rings.size(); ++i)
+        state.rings[i]->tail = state.rings[i]->head;
+
+      state.worker = new Worker(rate);
+      state.worker->start();
+      __sync_synchronize();
+      state.running = true;
+#else
+      (void)rate;
+#endif
+    }
+
+    void
+    LogBackend::stop(void)
+    {
+#if defined(DUNE_LOG_BACKEND_ASYNC)
+      LogState& state = getLogState();
+      Concurrency::Thread* worker = NULL;
+      {
+        Concurrency::ScopedMutex l(state.mutex);
+        state.running = false;
+        __sync_synchronize();
+        worker = state.worker;
+        state.worker = NULL;
+      }
+
+      if (worker == NULL)
+        return;
+
+      worker->stopAndJoin();
+      delete worker;
+#endif
+    }
+
+    bool
+    LogBackend::isRunning(void)
+    {
+#if defined(DUNE_LOG_BACKEND_ASYNC)
+      return getLogState().running;
+#else
+      return false;
+#endif
+    }
+
+    bool
+    LogBackend::post(Task* task, IMC::LogBookEntry::TypeEnum type, unsigned eid,
+                     const char* format, std::va_list ap)
+    {
+#if defined(DUNE_LOG_BACKEND_ASYNC)
+      LogState& state = getLogState();
+      if (!state.running)
+        return false;
+
+      char rec[c_record_max_size];
+      LogRecordHeader hdr;
+      size_t size = pack(rec + sizeof(hdr), sizeof(rec) - sizeof(hdr), format, ap);
+      if (size == 0)
+        return false;
+
+      hdr.size = sizeof(hdr) + size;
+      hdr.type = type;
+      hdr.eid = eid;
+      hdr.time = Time::Clock::getSinceEpoch();
+      hdr.task = task;
+      std::memcpy(rec, &hdr, sizeof(hdr));
+
+      LogProducer& producer = state.producers.value();
+      if (producer.ring == NULL)
+      {
+        producer.ring = new LogRing;
+        Concurrency::ScopedMutex l(state.mutex);
+        state.rings.push_back(producer.ring);
+      }
+
+      LogRing& ring = *producer.ring;
+      uint64_t head = ring.head;
+      if (c_ring_size - (head - ring.tail) < hdr.size)
+        return false;
+
+      size_t begin = head % c_ring_size;
+      size_t first = std::min((size_t)hdr.size, c_ring_size - begin);
+      std::memcpy(ring.data + begin, rec, first);
+      std::memcpy(ring.data, rec + first, hdr.size - first);
+
+      __sync_synchronize();
+      ring.head = head + hdr.size;
+      return true;
+#else
+      (void)task;
+      (void)type;
+      (void)eid;
+      (void)format;
+      (void)ap;
+      return false;
+#endif
+    }
+
+    void
+    LogBackend::flush(void)
+    {
+#if defined(DUNE_LOG_BACKEND_ASYNC)
+      LogState& state = getLogState();
+      std::vector<std::pair<LogRing*, uint64_t> > marks;
+      {
+        Concurrency::ScopedMutex l(state.mutex);
+        if (state.worker == NULL)
+          return;
+
+        for (size_t i = 0; i < state.rings.size(); ++i)
+          marks.push_back(std::make_pair(state.rings[i], (uint64_t)state.rings[i]->head));
+      }
+
+      // Rings are only reclaimed once empty, so the pointers stay
+      // valid until their marks are reached.
+      for (size_t i = 0; i < marks.size(); ++i)
+      {
+        while (marks[i].first->tail < marks[i].second && isRunning())
+          Time::Delay::waitMsec(1);
+      }
+#endif
+    }
+  }
+}
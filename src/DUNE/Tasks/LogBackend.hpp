@@ -0,0 +1,131 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_LOG_BACKEND_HPP_INCLUDED_
+#define DUNE_TASKS_LOG_BACKEND_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstdarg>
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Definitions.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    // Forward declarations.
+    class Task;
+
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LogBackend;
+
+    //! Asynchronous backend for task log messages.
+    //!
+    //! While the backend is running, Task::inf() and friends only
+    //! capture the format string and arguments into a per-thread
+    //! lock-free ring. A single background thread formats queued
+    //! records in timestamp order, writes them to the terminal and
+    //! publishes LogBookEntry messages, limiting the rate of
+    //! published entries per task (errors are never suppressed).
+    //!
+    //! When the backend is not running, or a record cannot be
+    //! queued, tasks log synchronously as before.
+    class LogBackend
+    {
+    public:
+      //! Maximum size of a queued record in bytes.
+      static const size_t c_record_max_size = 2048;
+      //! Capacity of each per-thread ring in bytes.
+      static const size_t c_ring_size = 65536;
+
+      //! Start the backend thread.
+      //! @param[in] rate maximum number of LogBookEntry messages
+      //! published per task per second (zero disables the limit).
+      static void
+      start(double rate);
+
+      //! Format and publish all queued records and stop the
+      //! backend thread.
+      static void
+      stop(void);
+
+      //! Test if the backend thread is running.
+      //! @return true if running, false otherwise.
+      static bool
+      isRunning(void);
+
+      //! Queue a log message of a task.
+      //! @param[in] task task that produced the message.
+      //! @param[in] type message type.
+      //! @param[in] eid source entity.
+      //! @param[in] format printf-like format string.
+      //! @param[in] ap format arguments.
+      //! @return true if the message was queued, false if the
+      //! caller must log it synchronously.
+      static bool
+      post(Task* task, IMC::LogBookEntry::TypeEnum type, unsigned eid,
+           const char* format, std::va_list ap);
+
+      //! Wait until all records queued so far have been published.
+      static void
+      flush(void);
+
+      //! Capture a format string and its arguments.
+      //! @param[out] bfr destination buffer.
+      //! @param[in] size size of destination buffer.
+      //! @param[in] format printf-like format string.
+      //! @param[in] ap format arguments.
+      //! @return number of bytes written to bfr or zero if the
+      //! format is not supported or does not fit.
+      static size_t
+      pack(char* bfr, size_t size, const char* format, std::va_list ap);
+
+      //! Format previously captured arguments.
+      //! @param[in] data captured format and arguments.
+      //! @param[in] size size of captured data.
+      //! @param[out] bfr destination string buffer.
+      //! @param[in] bfr_size size of destination buffer.
+      static void
+      unpack(const char* data, size_t size, char* bfr, size_t bfr_size);
+
+    private:
+      class Worker;
+
+      //! Write a formatted message on behalf of a task.
+      static void
+      publish(Task* task, IMC::LogBookEntry::TypeEnum type, unsigned eid,
+              double time, const char* text, bool book);
+    };
+  }
+}
+
+#endif
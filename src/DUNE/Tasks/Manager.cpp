@@ -35,7 +35,11 @@
 #include <cstddef>
 
 // DUNE headers.
+#include <DUNE/Time/Clock.hpp>
 #include <DUNE/Time/Delay.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
 #include <DUNE/Tasks/Task.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Factory.hpp>
@@ -62,11 +66,56 @@ namespace DUNE
       }
     };
 
+    //! Thread creating and configuring tasks taken from a shared
+    //! list of creation jobs.
+    class Manager::CreationWorker: public Concurrency::Thread
+    {
+    public:
+      CreationWorker(Manager* manager, std::vector<CreationJob>& jobs,
+                     size_t& next, Concurrency::Mutex& lock):
+        m_manager(manager),
+        m_jobs(jobs),
+        m_next(next),
+        m_lock(lock)
+      { }
+
+    private:
+      Manager* m_manager;
+      std::vector<CreationJob>& m_jobs;
+      size_t& m_next;
+      Concurrency::Mutex& m_lock;
+
+      void
+      run(void)
+      {
+        while (true)
+        {
+          size_t index = 0;
+
+          {
+            Concurrency::ScopedMutex l(m_lock);
+            if (m_next >= m_jobs.size())
+              return;
+            index = m_next++;
+          }
+
+          m_manager->createTask(m_jobs[index]);
+        }
+      }
+    };
+
     Manager::Manager(Context& ctx):
       m_ctx(ctx)
     {
+      unsigned threads = 1;
+      double timeout = 0;
+      m_ctx.config.get("General", "Startup - Creation Threads", "4", threads);
+      m_ctx.config.get("General", "Startup - Phase Timeout", "10.0", timeout);
+      m_startup.setTimeout(timeout);
+
       // Get all sections.
       std::vector<std::string> vec = m_ctx.config.sections();
+      std::vector<std::string> enabled;
 
       for (unsigned int i = 0; i < vec.size(); ++i)
       {
@@ -90,41 +139,166 @@ namespace DUNE
         m_ctx.config.get(vec[i], "Enabled", "Never", profiles);
 
         if (ctx.profiles.isSelected(profiles))
-          createTask(vec[i]);
+          enabled.push_back(vec[i]);
+      }
+
+      createTasks(enabled, threads);
+    }
+
+    void
+    Manager::createTasks(const std::vector<std::string>& sections, unsigned threads)
+    {
+      std::vector<CreationJob> jobs(sections.size());
+      for (size_t i = 0; i < jobs.size(); ++i)
+      {
+        jobs[i].section = sections[i];
+        jobs[i].task = NULL;
+        jobs[i].begin = 0;
+        jobs[i].created = 0;
+        jobs[i].configured = 0;
+        jobs[i].invalid = false;
+        jobs[i].config_error = false;
+      }
+
+      // Task constructors and configuration loading only touch the
+      // task itself, the configuration and the (locked) message bus,
+      // so they can run concurrently.
+      size_t count = std::min(jobs.size(), static_cast<size_t>(threads));
+      if (count <= 1)
+      {
+        for (size_t i = 0; i < jobs.size(); ++i)
+          createTask(jobs[i]);
+      }
+      else
+      {
+        size_t next = 0;
+        Concurrency::Mutex lock;
+        std::vector<CreationWorker*> workers;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+          workers.push_back(new CreationWorker(this, jobs, next, lock));
+          workers.back()->start();
+        }
+
+        for (size_t i = 0; i < workers.size(); ++i)
+        {
+          workers[i]->join();
+          delete workers[i];
+        }
       }
+
+      for (size_t i = 0; i < jobs.size(); ++i)
+      {
+        if (jobs[i].invalid)
+          throw InvalidTaskName(getTaskName(jobs[i].section));
+
+        if (jobs[i].task == NULL)
+          throw std::runtime_error(jobs[i].error);
+      }
+
+      // Entities are reserved in configuration order so that entity
+      // identifiers do not depend on creation timing.
+      for (size_t i = 0; i < jobs.size(); ++i)
+        addTask(jobs[i]);
     }
 
     void
-    Manager::createTask(const std::string& section)
+    Manager::createTask(CreationJob& job)
     {
-      std::string task_name = getTaskName(section);
+      std::string task_name = getTaskName(job.section);
+
+      job.begin = Time::Clock::get();
 
       if (!Factory::exists(task_name))
-        throw InvalidTaskName(task_name);
+      {
+        job.invalid = true;
+        return;
+      }
 
-      Task* task = Factory::produce(task_name, section, m_ctx);
-      if (task == NULL)
-        throw InvalidTaskName(task_name);
+      try
+      {
+        job.task = Factory::produce(task_name, job.section, m_ctx);
+      }
+      catch (std::exception& e)
+      {
+        job.error = e.what();
+        return;
+      }
+      catch (...)
+      {
+        job.error = DTR("unknown exception");
+        return;
+      }
+
+      job.created = Time::Clock::get();
+
+      if (job.task == NULL)
+      {
+        job.invalid = true;
+        return;
+      }
+
+      try
+      {
+        job.task->loadConfig();
+      }
+      catch (std::exception& e)
+      {
+        job.error = e.what();
+        job.config_error = true;
+      }
+      catch (...)
+      {
+        job.error = DTR("unknown exception");
+        job.config_error = true;
+      }
+
+      job.configured = Time::Clock::get();
+    }
+
+    void
+    Manager::addTask(CreationJob& job)
+    {
+      Task* task = job.task;
+
+      if (job.config_error)
+      {
+        task->err("%s", job.error.c_str());
+        return;
+      }
+
+      double begin = Time::Clock::get();
 
       try
       {
-        task->loadConfig();
         task->reserveEntities();
-        m_tasks[section] = task;
-        m_list.push_back(section);
       }
       catch (std::exception& e)
       {
         task->err("%s", e.what());
+        return;
       }
       catch (...)
       {
         task->err("%s", DTR("unknown exception"));
+        return;
       }
+
+      unsigned index = m_startup.add(job.section);
+      m_startup.record(index, Startup::PHASE_CREATE, job.begin, job.created);
+      m_startup.record(index, Startup::PHASE_CONFIGURE, job.created, job.configured);
+      m_startup.record(index, Startup::PHASE_RESERVE, begin, Time::Clock::get());
+
+      m_tasks[job.section] = task;
+      m_list.push_back(job.section);
     }
 
     Manager::~Manager(void)
     {
+      // Release tasks still waiting for each other.
+      m_startup.abort();
+
       // Request all tasks to stop.
       for (unsigned int i = 0; i < m_list.size(); ++i)
       {
@@ -171,13 +345,16 @@ namespace DUNE
     void
     Manager::start(void)
     {
-      std::map<std::string, Task*>::iterator itr;
-
-      for (itr = m_tasks.begin(); itr != m_tasks.end(); ++itr)
-        start(itr->first);
+      // Tasks are registered in the startup sequence in list order.
+      for (unsigned i = 0; i < m_list.size(); ++i)
+      {
+        m_tasks[m_list[i]]->setStartup(&m_startup, i);
+        if (!start(m_list[i]))
+          m_startup.leave(i);
+      }
     }
 
-    void
+    bool
     Manager::start(const std::string& section)
     {
       std::map<std::string, Task*>::iterator itr = m_tasks.find(section);
@@ -190,6 +367,7 @@ namespace DUNE
       {
         task->inf(DTR("starting"));
         task->start();
+        return true;
       }
       catch (std::exception& e)
       {
@@ -199,6 +377,8 @@ namespace DUNE
       {
         task->err(DTR("unknown exception"));
       }
+
+      return false;
     }
 
     std::string
@@ -258,6 +438,11 @@ namespace DUNE
     void
     Manager::lowerHogPriority(Task* task, int cpu_usage)
     {
+      // Real-time tasks are expected to be busy, their priority is
+      // configured explicitly.
+      if (task->hasRealTimePolicy())
+        return;
+
       try
       {
         unsigned current_priority = task->getPriority();
@@ -37,6 +37,7 @@
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/Tasks/Startup.hpp>
 
 namespace DUNE
 {
@@ -65,7 +66,8 @@ namespace DUNE
 
       //! Start a task with a given name.
       //! @param name task name.
-      void
+      //! @return true if the task was started, false otherwise.
+      bool
       start(const std::string& name);
 
       //! Stop a task with a given name.
@@ -110,7 +112,39 @@ namespace DUNE
       void
       adjustPriorities(void);
 
+      //! Retrieve the startup sequence of the managed tasks.
+      //! @return startup sequence.
+      Startup&
+      getStartup(void)
+      {
+        return m_startup;
+      }
+
     private:
+      //! Worker thread creating and configuring tasks.
+      class CreationWorker;
+
+      //! Creation of a single task.
+      struct CreationJob
+      {
+        //! Configuration section.
+        std::string section;
+        //! Created task.
+        Task* task;
+        //! Begin of task construction.
+        double begin;
+        //! End of task construction.
+        double created;
+        //! End of configuration loading.
+        double configured;
+        //! True if the task could not be produced.
+        bool invalid;
+        //! Error raised by the task's constructor or configuration.
+        std::string error;
+        //! True if the error was raised after construction.
+        bool config_error;
+      };
+
       struct TaskCpuUsage
       {
         //! Task object.
@@ -135,9 +169,25 @@ namespace DUNE
       std::priority_queue<TaskCpuUsage> m_cpu_usage_hogs;
       //! Buffer message to dispatch CPU usage of tasks.
       IMC::CpuUsage m_task_cpu_usage;
+      //! Startup sequence.
+      Startup m_startup;
+
+      //! Create and configure tasks, possibly in parallel.
+      //! @param[in] sections configuration sections of the tasks.
+      //! @param[in] threads maximum number of worker threads.
+      void
+      createTasks(const std::vector<std::string>& sections, unsigned threads);
+
+      //! Produce a task and load its configuration.
+      //! @param[in,out] job creation job.
+      void
+      createTask(CreationJob& job);
 
+      //! Reserve the entities of a created task and add it to the
+      //! list of managed tasks.
+      //! @param[in] job creation job.
       void
-      createTask(const std::string& section);
+      addTask(CreationJob& job);
 
       void
       lowerHogPriority(Task* task, int cpu_usage);
@@ -51,6 +51,13 @@ namespace DUNE
       .units(Units::Hertz)
       .defaultValue("1.0")
       .description(DTR("Frequency at which task is executed"));
+
+      param(DTR_RT("Jitter Report Period"), m_jitter_report)
+      .units(Units::Second)
+      .defaultValue("0")
+      .minimumValue("0")
+      .description(DTR("Period at which timing statistics of the task"
+                       " loop are reported, zero to disable"));
     }
 
     void
@@ -59,7 +66,9 @@ namespace DUNE
       double now = Time::Clock::get();
       double delay = (1 / m_frequency);
       double next_inv = now + delay;
+      double report_time = now;
       m_run_time = now;
+      m_jitter.reset();
 
       while (!stopping())
       {
@@ -68,6 +77,7 @@ namespace DUNE
         if (next_inv > now)
           Time::Delay::wait(next_inv - now);
 
+        double scheduled = next_inv;
         next_inv += delay;
         now = Time::Clock::get();
         m_run_time = now;
@@ -81,7 +91,31 @@ namespace DUNE
         }
 
         now = Time::Clock::get();
+        m_jitter.update(delay, scheduled, m_run_time, now);
+
+        if (m_jitter_report > 0 && now - report_time >= m_jitter_report)
+        {
+          reportJitter();
+          report_time = now;
+        }
       }
     }
+
+    void
+    Periodic::reportJitter(void)
+    {
+      const double c_ms = 1000.0;
+      const Time::JitterMonitor& j = m_jitter;
+
+      inf(DTR("period %0.3f ms (mean %0.3f ms), jitter %0.3f ms (max %0.3f ms),"
+              " latency %0.3f ms (max %0.3f ms), execution max %0.3f ms,"
+              " deadline misses %u of %u"),
+          c_ms / m_frequency, j.getMeanPeriod() * c_ms,
+          j.getJitterRMS() * c_ms, j.getMaximumJitter() * c_ms,
+          j.getMeanLatency() * c_ms, j.getMaximumLatency() * c_ms,
+          j.getMaximumExecution() * c_ms, j.getDeadlineMisses(), j.getCycles());
+
+      m_jitter.reset();
+    }
   }
 }
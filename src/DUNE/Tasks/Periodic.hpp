@@ -38,6 +38,7 @@
 
 // Local headers.
 #include <DUNE/Tasks/Task.hpp>
+#include <DUNE/Time/JitterMonitor.hpp>
 
 namespace DUNE
 {
@@ -95,6 +96,16 @@ namespace DUNE
         return m_run_count;
       }
 
+      //! Retrieve the timing statistics of the task loop since the
+      //! last jitter report. Only safe to inspect from the task's own
+      //! thread or after the task has stopped.
+      //! @return jitter monitor.
+      inline const Time::JitterMonitor&
+      getJitterMonitor(void) const
+      {
+        return m_jitter;
+      }
+
       //! The task to be executed on each cycle.
       virtual void
       task(void) = 0;
@@ -106,6 +117,14 @@ namespace DUNE
       double m_run_time;
       //! Task frequency (Hz).
       double m_frequency;
+      //! Jitter report period (s).
+      double m_jitter_report;
+      //! Timing statistics of the task loop.
+      Time::JitterMonitor m_jitter;
+
+      //! Report timing statistics and start a new measurement window.
+      void
+      reportJitter(void);
 
       //! Task entry point.
       void
@@ -35,6 +35,8 @@
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
+#include <DUNE/Tasks/Tracer.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
 
 namespace DUNE
 {
@@ -42,13 +44,23 @@ namespace DUNE
   {
     Recipient::Recipient(AbstractTask* task, Context& ctx):
       m_task(task),
-      m_ctx(ctx)
+      m_ctx(ctx),
+      m_conflated_count(0),
+      m_conflating(false)
     { }
 
     Recipient::~Recipient(void)
     {
       unbindAll();
 
+      // Queued tokens are deleted below.
+      std::map<uint64_t, Slot>::iterator itr = m_slots.begin();
+      for (; itr != m_slots.end(); ++itr)
+      {
+        if (itr->second.latest != itr->second.token)
+          delete itr->second.latest;
+      }
+
       while (!m_mqueue.empty())
       {
         IMC::Message* msg = m_mqueue.pop();
@@ -60,27 +72,41 @@ namespace DUNE
     void
     Recipient::unbindAll(void)
     {
-      std::map<uint32_t, std::vector<AbstractConsumer*> >::iterator itr = m_cbacks.begin();
+      std::map<uint32_t, std::vector<Binding> >::iterator itr = m_cbacks.begin();
 
       for (; itr != m_cbacks.end(); ++itr)
       {
         m_ctx.mbus.unregisterRecipient(m_task, itr->first);
 
         for (size_t i = 0; i < itr->second.size(); ++i)
-          delete itr->second[i];
+        {
+          delete itr->second[i].consumer;
+          delete itr->second[i].filter;
+        }
 
         itr->second.clear();
       }
     }
 
     void
-    Recipient::bind(uint32_t id, AbstractConsumer* consumer)
+    Recipient::bind(uint32_t id, AbstractConsumer* consumer, const IMC::DeliveryFilter* filter,
+                    bool conflate)
     {
-      std::map<uint32_t, std::vector<AbstractConsumer*> >::iterator itr = m_cbacks.find(id);
-      if (itr == m_cbacks.end())
-        m_ctx.mbus.registerRecipient(m_task, id);
+      if (conflate)
+      {
+        Concurrency::ScopedMutex l(m_slots_lock);
+        m_conflated.insert(id);
+        m_conflating = true;
+      }
+
+      Binding binding;
+      binding.consumer = consumer;
+      binding.filter = NULL;
+      if (filter != NULL && !filter->isEmpty())
+        binding.filter = new IMC::DeliveryFilter(*filter);
 
-      m_cbacks[id].push_back(consumer);
+      m_ctx.mbus.registerRecipient(m_task, id, binding.filter);
+      m_cbacks[id].push_back(binding);
     }
 
     void
@@ -93,6 +119,29 @@ namespace DUNE
     void
     Recipient::put(const IMC::Message* msg)
     {
+      if (m_conflating)
+      {
+        Concurrency::ScopedMutex l(m_slots_lock);
+        if (m_conflated.find(msg->getId()) != m_conflated.end())
+        {
+          IMC::Message* clone = msg->clone();
+          std::map<uint64_t, Slot>::iterator itr = m_slots.find(getConflationKey(msg));
+          if (itr != m_slots.end())
+          {
+            if (itr->second.latest != itr->second.token)
+              delete itr->second.latest;
+            itr->second.latest = clone;
+            ++m_conflated_count;
+            return;
+          }
+
+          Slot slot = {clone, clone};
+          m_slots[getConflationKey(msg)] = slot;
+          m_mqueue.push(clone);
+          return;
+        }
+      }
+
       m_mqueue.push(msg->clone());
     }
 
@@ -103,12 +152,40 @@ namespace DUNE
 
       for (unsigned int i = 0; i < size; ++i)
       {
-        const IMC::Message* msg = m_mqueue.pop();
+        IMC::Message* msg = m_mqueue.pop();
+        if (msg && m_conflating)
+        {
+          Concurrency::ScopedMutex l(m_slots_lock);
+          std::map<uint64_t, Slot>::iterator itr = m_slots.find(getConflationKey(msg));
+          if (itr != m_slots.end() && itr->second.token == msg)
+          {
+            if (itr->second.latest != msg)
+            {
+              delete msg;
+              msg = itr->second.latest;
+            }
+            m_slots.erase(itr);
+          }
+        }
+
         if (msg)
         {
-          uint32_t id = msg->getId();
-          for (size_t j = 0; j < m_cbacks[id].size(); ++j)
-            m_cbacks[id][j]->consume(msg);
+          bool traced = Tracer::isRunning();
+          if (traced)
+            Tracer::dequeued(msg, m_task->getEntityId());
+
+          std::vector<Binding>& cbacks = m_cbacks[msg->getId()];
+          for (size_t j = 0; j < cbacks.size(); ++j)
+          {
+            // The bus delivers messages matching any of the
+            // filters of this task, check the one of each consumer.
+            if (cbacks[j].filter == NULL || cbacks[j].filter->matches(msg))
+              cbacks[j].consumer->consume(msg);
+          }
+
+          if (traced)
+            Tracer::consumed(msg, m_task->getEntityId());
+
           delete msg;
         }
       }
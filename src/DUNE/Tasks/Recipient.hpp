@@ -32,12 +32,15 @@
 
 // ISO C++ 98 headers.
 #include <map>
+#include <set>
 #include <vector>
 
 // DUNE headers.
 #include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
 #include <DUNE/Tasks/Consumer.hpp>
 #include <DUNE/Tasks/AbstractTask.hpp>
+#include <DUNE/IMC/DeliveryFilter.hpp>
 
 namespace DUNE
 {
@@ -64,8 +67,27 @@ namespace DUNE
       void
       put(const IMC::Message*);
 
+      //! Register a consumer for a given message identifier.
+      //! @param[in] id message identifier.
+      //! @param[in] c consumer object.
+      //! @param[in] filter delivery filter or NULL to consume all
+      //! messages.
+      //! @param[in] conflate true to keep only the most recent
+      //! queued message per source system, source entity and
+      //! sub-identifier. Applies to all consumers of the message.
       void
-      bind(uint32_t id, AbstractConsumer* c);
+      bind(uint32_t id, AbstractConsumer* c, const IMC::DeliveryFilter* filter = NULL,
+           bool conflate = false);
+
+      //! Get the number of queued messages that were replaced by
+      //! a more recent instance before being consumed.
+      //! @return number of conflated messages.
+      unsigned
+      getConflatedCount(void)
+      {
+        Concurrency::ScopedMutex l(m_slots_lock);
+        return m_conflated_count;
+      }
 
       void
       waitForMessages(double timeout);
@@ -74,14 +96,54 @@ namespace DUNE
       runCallBacks(void);
 
     private:
+      //! Consumer and its delivery filter.
+      struct Binding
+      {
+        //! Consumer.
+        AbstractConsumer* consumer;
+        //! Delivery filter (NULL if none).
+        IMC::DeliveryFilter* filter;
+      };
+
+      //! Pending message of a conflated key. The first queued
+      //! instance keeps its position in the queue, while the
+      //! content is replaced by more recent instances.
+      struct Slot
+      {
+        //! Instance holding the position in the queue.
+        IMC::Message* token;
+        //! Most recent instance.
+        IMC::Message* latest;
+      };
+
       //! Task.
       AbstractTask* m_task;
       //! Context.
       Context& m_ctx;
       //! Callbacks.
-      std::map<uint32_t, std::vector<AbstractConsumer*> > m_cbacks;
+      std::map<uint32_t, std::vector<Binding> > m_cbacks;
       //! Message queue.
       Concurrency::TSQueue<IMC::Message*> m_mqueue;
+      //! Identifiers of conflated messages.
+      std::set<uint32_t> m_conflated;
+      //! Pending messages of conflated keys.
+      std::map<uint64_t, Slot> m_slots;
+      //! Number of conflated messages.
+      unsigned m_conflated_count;
+      //! True if some message is conflated.
+      volatile bool m_conflating;
+      //! Lock for conflation state.
+      Concurrency::Mutex m_slots_lock;
+
+      //! Get conflation key of a message.
+      static uint64_t
+      getConflationKey(const IMC::Message* msg)
+      {
+        return ((uint64_t)msg->getId() << 40)
+        | ((uint64_t)msg->getSource() << 24)
+        | ((uint64_t)msg->getSourceEntity() << 16)
+        | (uint64_t)msg->getSubId();
+      }
     };
   }
 }
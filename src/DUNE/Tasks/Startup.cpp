@@ -0,0 +1,230 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <iomanip>
+
+// DUNE headers.
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Tasks/Startup.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    //! Phase names.
+    static const char* c_phase_names[] =
+    {
+      "create",
+      "configure",
+      "reserve",
+      "resolve",
+      "acquire",
+      "initialize"
+    };
+
+    Startup::Startup(void):
+      m_epoch(Time::Clock::get()),
+      m_timeout(0),
+      m_aborted(false)
+    {
+      for (unsigned i = 0; i < PHASE_COUNT; ++i)
+        m_forced[i] = false;
+    }
+
+    void
+    Startup::setTimeout(double timeout)
+    {
+      m_cond.lock();
+      m_timeout = timeout;
+      m_cond.unlock();
+    }
+
+    unsigned
+    Startup::add(const std::string& name)
+    {
+      Entry entry;
+      entry.name = name;
+      entry.completed = 0;
+      entry.left = false;
+      for (unsigned i = 0; i < PHASE_COUNT; ++i)
+      {
+        entry.begin[i] = -1;
+        entry.end[i] = -1;
+      }
+
+      m_cond.lock();
+      m_entries.push_back(entry);
+      unsigned index = m_entries.size() - 1;
+      m_cond.unlock();
+
+      return index;
+    }
+
+    void
+    Startup::record(unsigned index, Phase phase, double begin, double end)
+    {
+      m_cond.lock();
+      mark(m_entries[index], phase, begin, end);
+      m_cond.unlock();
+    }
+
+    bool
+    Startup::arrive(unsigned index, Phase phase, double begin, std::vector<std::string>& late)
+    {
+      double now = Time::Clock::get();
+      bool timed_out = false;
+
+      m_cond.lock();
+      mark(m_entries[index], phase, begin, now);
+      m_cond.broadcast();
+
+      double deadline = now + m_timeout;
+      while (!m_aborted && !m_forced[phase] && !isPhaseDone(phase))
+      {
+        if (m_timeout <= 0)
+        {
+          m_cond.wait();
+          continue;
+        }
+
+        double remaining = deadline - Time::Clock::get();
+        if (remaining <= 0 || !m_cond.wait(remaining))
+        {
+          if (m_forced[phase] || isPhaseDone(phase))
+            break;
+
+          // Release everyone and report who is holding the phase.
+          for (unsigned i = 0; i < m_entries.size(); ++i)
+          {
+            if (!m_entries[i].left && m_entries[i].completed <= (unsigned)phase)
+              late.push_back(m_entries[i].name);
+          }
+
+          m_forced[phase] = true;
+          timed_out = true;
+          m_cond.broadcast();
+        }
+      }
+
+      m_cond.unlock();
+
+      return !timed_out;
+    }
+
+    void
+    Startup::leave(unsigned index)
+    {
+      m_cond.lock();
+      m_entries[index].left = true;
+      m_cond.broadcast();
+      m_cond.unlock();
+    }
+
+    void
+    Startup::abort(void)
+    {
+      m_cond.lock();
+      m_aborted = true;
+      m_cond.broadcast();
+      m_cond.unlock();
+    }
+
+    bool
+    Startup::isComplete(void)
+    {
+      m_cond.lock();
+      bool done = isPhaseDone(PHASE_INITIALIZE);
+      m_cond.unlock();
+      return done;
+    }
+
+    std::vector<Startup::Entry>
+    Startup::getEntries(void)
+    {
+      m_cond.lock();
+      std::vector<Entry> entries(m_entries);
+      m_cond.unlock();
+      return entries;
+    }
+
+    void
+    Startup::writeCSV(std::ostream& os)
+    {
+      std::vector<Entry> entries = getEntries();
+
+      os << "task,phase,begin,duration" << std::endl
+         << std::fixed << std::setprecision(6);
+
+      for (unsigned i = 0; i < entries.size(); ++i)
+      {
+        for (unsigned j = 0; j < PHASE_COUNT; ++j)
+        {
+          if (entries[i].end[j] < 0)
+            continue;
+
+          os << entries[i].name << ","
+             << c_phase_names[j] << ","
+             << entries[i].begin[j] << ","
+             << entries[i].end[j] - entries[i].begin[j] << std::endl;
+        }
+      }
+    }
+
+    const char*
+    Startup::getPhaseName(Phase phase)
+    {
+      if (phase >= PHASE_COUNT)
+        return "unknown";
+
+      return c_phase_names[phase];
+    }
+
+    bool
+    Startup::isPhaseDone(Phase phase) const
+    {
+      for (unsigned i = 0; i < m_entries.size(); ++i)
+      {
+        if (!m_entries[i].left && m_entries[i].completed <= (unsigned)phase)
+          return false;
+      }
+
+      return true;
+    }
+
+    void
+    Startup::mark(Entry& entry, Phase phase, double begin, double end)
+    {
+      entry.begin[phase] = begin - m_epoch;
+      entry.end[phase] = end - m_epoch;
+      if (entry.completed <= (unsigned)phase)
+        entry.completed = phase + 1;
+    }
+  }
+}
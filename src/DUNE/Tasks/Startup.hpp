@@ -0,0 +1,186 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_STARTUP_HPP_INCLUDED_
+#define DUNE_TASKS_STARTUP_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+#include <string>
+#include <ostream>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Startup;
+
+    //! Phased task startup. The task manager creates, configures and
+    //! reserves the entities of every task before any of them is
+    //! started. Once running, tasks go through entity resolution,
+    //! resource acquisition and resource initialization in lock-step:
+    //! no task enters a phase before all other tasks have finished the
+    //! previous one, have dropped out of the startup sequence (error
+    //! or restart) or the phase timeout has expired. The time spent by
+    //! each task in each phase is recorded to build a startup
+    //! timeline.
+    class Startup
+    {
+    public:
+      //! Startup phases.
+      enum Phase
+      {
+        //! Task construction.
+        PHASE_CREATE,
+        //! Configuration loading.
+        PHASE_CONFIGURE,
+        //! Entity reservation.
+        PHASE_RESERVE,
+        //! Entity resolution.
+        PHASE_RESOLVE,
+        //! Resource acquisition.
+        PHASE_ACQUIRE,
+        //! Resource initialization.
+        PHASE_INITIALIZE,
+        //! Number of phases.
+        PHASE_COUNT
+      };
+
+      //! Startup record of a single task.
+      struct Entry
+      {
+        //! Task name.
+        std::string name;
+        //! Begin of each phase (seconds since the start of the sequence).
+        double begin[PHASE_COUNT];
+        //! End of each phase (seconds since the start of the sequence).
+        double end[PHASE_COUNT];
+        //! Number of phases completed.
+        unsigned completed;
+        //! True if the task dropped out of the sequence.
+        bool left;
+      };
+
+      //! Constructor.
+      Startup(void);
+
+      //! Set the maximum amount of time a task waits for the
+      //! others at the end of a phase.
+      //! @param[in] timeout timeout in seconds (zero or negative to
+      //! wait forever).
+      void
+      setTimeout(double timeout);
+
+      //! Register a task.
+      //! @param[in] name task name.
+      //! @return index of the task in the sequence.
+      unsigned
+      add(const std::string& name);
+
+      //! Record the time spent by a task in a phase that does not
+      //! synchronize with the other tasks.
+      //! @param[in] index task index.
+      //! @param[in] phase startup phase.
+      //! @param[in] begin begin of phase (monotonic clock).
+      //! @param[in] end end of phase (monotonic clock).
+      void
+      record(unsigned index, Phase phase, double begin, double end);
+
+      //! Mark the end of a synchronized phase for a task and wait
+      //! for all other tasks to reach the same point.
+      //! @param[in] index task index.
+      //! @param[in] phase startup phase.
+      //! @param[in] begin begin of phase (monotonic clock).
+      //! @param[out] late names of the tasks that did not finish the
+      //! phase in time (only filled when false is returned).
+      //! @return false if the phase timed out while waiting for
+      //! other tasks, true otherwise.
+      bool
+      arrive(unsigned index, Phase phase, double begin, std::vector<std::string>& late);
+
+      //! Remove a task from the startup sequence. Other tasks will no
+      //! longer wait for it.
+      //! @param[in] index task index.
+      void
+      leave(unsigned index);
+
+      //! Release all waiting tasks and disable further waits.
+      void
+      abort(void);
+
+      //! Test if all tasks have finished startup or dropped out.
+      //! @return true if startup is complete, false otherwise.
+      bool
+      isComplete(void);
+
+      //! Retrieve a copy of the startup records.
+      //! @return startup records, in registration order.
+      std::vector<Entry>
+      getEntries(void);
+
+      //! Write the startup timeline in CSV format.
+      //! @param[in] os output stream.
+      void
+      writeCSV(std::ostream& os);
+
+      //! Retrieve the name of a phase.
+      //! @param[in] phase startup phase.
+      //! @return phase name.
+      static const char*
+      getPhaseName(Phase phase);
+
+    private:
+      //! Start of the sequence (monotonic clock).
+      double m_epoch;
+      //! Phase timeout.
+      double m_timeout;
+      //! Task records.
+      std::vector<Entry> m_entries;
+      //! Phases released before all tasks finished them.
+      bool m_forced[PHASE_COUNT];
+      //! True if the sequence was aborted.
+      bool m_aborted;
+      //! Lock and condition variable.
+      Concurrency::Condition m_cond;
+
+      bool
+      isPhaseDone(Phase phase) const;
+
+      void
+      mark(Entry& entry, Phase phase, double begin, double end);
+    };
+  }
+}
+
+#endif
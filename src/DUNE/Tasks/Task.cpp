@@ -38,10 +38,13 @@
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Time/PeriodicDelay.hpp>
 #include <DUNE/Time/Counter.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/System/Resources.hpp>
 #include <DUNE/Status/Messages.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Exceptions.hpp>
 #include <DUNE/Tasks/Task.hpp>
+#include <DUNE/Tasks/Tracer.hpp>
 #include <DUNE/Utils/XML.hpp>
 #include <DUNE/Entities/BasicEntity.hpp>
 #include <DUNE/Entities/EntityUtils.hpp>
@@ -63,9 +66,13 @@ namespace DUNE
       m_name(n),
       m_entity(NULL),
       m_debug_level(DEBUG_LEVEL_NONE),
-      m_honours_active(false)
+      m_honours_active(false),
+      m_startup(NULL),
+      m_startup_index(0)
     {
       m_args.priority = 10;
+      m_args.lock_memory = false;
+      m_args.stack_prefault = 0;
       m_args.act_time = 0;
       m_args.deact_time = 0;
       m_args.active = false;
@@ -78,6 +85,27 @@ namespace DUNE
       .defaultValue("10")
       .description(DTR("Execution priority"));
 
+      param(DTR_RT("Execution Policy"), m_args.exec_policy)
+      .defaultValue("Default")
+      .values("Default, FIFO, RR")
+      .description(DTR("Scheduling policy, 'FIFO' and 'RR' select a real-time"
+                       " class using the execution priority"));
+
+      param(DTR_RT("CPU Affinity"), m_args.affinity)
+      .defaultValue("")
+      .description(DTR("Processors on which this task is allowed to run,"
+                       " leave empty to allow all processors"));
+
+      param(DTR_RT("Lock Memory"), m_args.lock_memory)
+      .defaultValue("false")
+      .description(DTR("Lock process memory and prefault this task's stack"));
+
+      param(DTR_RT("Stack Prefault Size"), m_args.stack_prefault)
+      .defaultValue("128")
+      .maximumValue("1024")
+      .units(Units::Kibibyte)
+      .description(DTR("Amount of stack to prefault when locking memory"));
+
       param(DTR_RT("Activation Time"), m_args.act_time)
       .defaultValue("0");
 
@@ -357,6 +385,45 @@ namespace DUNE
       m_entity->failDeactivation(reason);
     }
 
+    void
+    Task::setupExecution(void)
+    {
+      if (hasRealTimePolicy())
+      {
+        Concurrency::Scheduler::Policy policy = Concurrency::Scheduler::POLICY_RR;
+        if (m_args.exec_policy == "FIFO")
+          policy = Concurrency::Scheduler::POLICY_FIFO;
+
+        try
+        {
+          Concurrency::Thread::setPriority(policy, m_args.priority);
+          debug("using %s scheduling with priority %u", m_args.exec_policy.c_str(), m_args.priority);
+        }
+        catch (std::exception& e)
+        {
+          war(DTR("failed to set real-time scheduling: %s"), e.what());
+        }
+      }
+
+      if (!m_args.affinity.empty())
+      {
+        try
+        {
+          setAffinity(m_args.affinity);
+        }
+        catch (std::exception& e)
+        {
+          war(DTR("failed to set processor affinity: %s"), e.what());
+        }
+      }
+
+      if (m_args.lock_memory)
+      {
+        System::Resources::lockMemory();
+        System::Resources::prefaultStack(m_args.stack_prefault * 1024);
+      }
+    }
+
     void
     Task::run(void)
     {
@@ -364,21 +431,20 @@ namespace DUNE
       prctl(PR_SET_NAME, getName(), 0, 0, 0);
 #endif
 
-      try
-      {
-        setPriority(m_args.priority);
-      }
-      catch (...)
-      { }
+      setupExecution();
 
       while (!stopping())
       {
         try
         {
+          double begin = Time::Clock::get();
           resolveEntities();
+          begin = finishStartupPhase(Startup::PHASE_RESOLVE, begin);
           releaseResources();
           acquireResources();
+          begin = finishStartupPhase(Startup::PHASE_ACQUIRE, begin);
           initializeResources();
+          finishStartupPhase(Startup::PHASE_INITIALIZE, begin);
 
           if (m_honours_active)
           {
@@ -392,6 +458,7 @@ namespace DUNE
         }
         catch (RestartNeeded& e)
         {
+          leaveStartup();
           unsigned delay = e.getDelay();
 
           if (e.isError())
@@ -423,12 +490,48 @@ namespace DUNE
         }
         catch (std::exception& e)
         {
+          leaveStartup();
           IMC::EntityState estate;
           setEntityState(IMC::EntityState::ESTA_FAILURE, e.what());
           dispatch(estate);
           err(DTR("task died with uncaught exception: %s: restarting"), e.what());
         }
       }
+
+      leaveStartup();
+    }
+
+    double
+    Task::finishStartupPhase(Startup::Phase phase, double begin)
+    {
+      if (m_startup == NULL)
+        return Time::Clock::get();
+
+      std::vector<std::string> late;
+      if (!m_startup->arrive(m_startup_index, phase, begin, late))
+      {
+        std::string names;
+        for (unsigned i = 0; i < late.size(); ++i)
+          names += (i == 0 ? "" : ", ") + late[i];
+
+        war(DTR("startup phase '%s' timed out waiting for: %s"),
+            Startup::getPhaseName(phase), names.c_str());
+      }
+
+      if (phase == Startup::PHASE_INITIALIZE)
+        m_startup = NULL;
+
+      return Time::Clock::get();
+    }
+
+    void
+    Task::leaveStartup(void)
+    {
+      if (m_startup == NULL)
+        return;
+
+      m_startup->leave(m_startup_index);
+      m_startup = NULL;
     }
 
     void
@@ -446,6 +549,11 @@ namespace DUNE
           msg->setSourceEntity(getEntityId());
       }
 
+      m_dispatched.add(1);
+
+      if (Tracer::isRunning())
+        Tracer::dispatched(msg, msg->getSourceEntity());
+
       if ((flags & DF_LOOP_BACK) == 0)
         m_ctx.mbus.dispatch(msg, this);
       else
@@ -651,6 +759,14 @@ namespace DUNE
     void
     Task::log(IMC::LogBookEntry::TypeEnum type, const char* format, std::va_list arg_list)
     {
+      std::va_list args;
+      va_copy(args, arg_list);
+      bool queued = LogBackend::post(this, type, getEntityId(), format, args);
+      va_end(args);
+
+      if (queued)
+        return;
+
       char bfr[c_log_message_max_size] = {0};
 
 #if defined(DUNE_SYS_HAS_VSNPRINTF)
@@ -663,35 +779,45 @@ namespace DUNE
       std::vsprintf(bfr, format, arg_list);
 #endif
 
-      IMC::LogBookEntry log_entry;
-      log_entry.setSourceEntity(getEntityId());
-      log_entry.type = type;
-      log_entry.text = bfr;
-      log_entry.context = getName();
-      log_entry.htime = Time::Clock::getSinceEpoch();
+      writeLog(type, getEntityId(), Time::Clock::getSinceEpoch(), bfr, true);
+    }
 
-      dispatch(log_entry);
+    void
+    Task::writeLog(IMC::LogBookEntry::TypeEnum type, unsigned eid, double time,
+                   const char* text, bool book)
+    {
+      if (book)
+      {
+        IMC::LogBookEntry log_entry;
+        log_entry.setSourceEntity(eid);
+        log_entry.type = type;
+        log_entry.text = text;
+        log_entry.context = getName();
+        log_entry.htime = time;
+
+        dispatch(log_entry);
+      }
 
       switch (type)
       {
         case IMC::LogBookEntry::LBET_INFO:
-          DUNE_MSG(getName(), bfr);
+          DUNE_MSG(getName(), text);
           break;
 
         case IMC::LogBookEntry::LBET_WARNING:
-          DUNE_WRN(getName(), bfr);
+          DUNE_WRN(getName(), text);
           break;
 
         case IMC::LogBookEntry::LBET_ERROR:
-          DUNE_ERR(getName(), bfr);
+          DUNE_ERR(getName(), text);
           break;
 
         case IMC::LogBookEntry::LBET_CRITICAL:
-          DUNE_ERR(getName(), bfr);
+          DUNE_ERR(getName(), text);
           break;
 
         case IMC::LogBookEntry::LBET_DEBUG:
-          DUNE_DEV(getName(), bfr);
+          DUNE_DEV(getName(), text);
           break;
       }
     }
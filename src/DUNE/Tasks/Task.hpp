@@ -35,12 +35,14 @@
 #include <string>
 #include <map>
 #include <stack>
+#include <vector>
 #include <cstdarg>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
 #include <DUNE/Concurrency/Thread.hpp>
 #include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
 #include <DUNE/Tasks/Consumer.hpp>
 #include <DUNE/IMC/Constants.hpp>
@@ -54,6 +56,8 @@
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/BasicParameterParser.hpp>
 #include <DUNE/Tasks/ParameterTable.hpp>
+#include <DUNE/Tasks/LogBackend.hpp>
+#include <DUNE/Tasks/Startup.hpp>
 #include <DUNE/Entities/BasicEntity.hpp>
 #include <DUNE/Entities/StatefulEntity.hpp>
 
@@ -94,6 +98,16 @@ namespace DUNE
       DEBUG_LEVEL_SPEW = 3
     };
 
+    //! Flags to change binding behaviour.
+    enum BindFlags
+    {
+      //! Keep only the most recent queued message per source
+      //! system, source entity and sub-identifier. Suitable for
+      //! state-style messages (EstimatedState, EntityState, etc.)
+      //! where only the latest value matters.
+      BF_CONFLATE = (1 << 0)
+    };
+
     //! Flags to change dispatching behaviour.
     enum DispatchFlags
     {
@@ -119,6 +133,10 @@ namespace DUNE
       virtual
       ~Task(void)
       {
+        // Queued log records may still refer to this task.
+        if (LogBackend::isRunning())
+          LogBackend::flush();
+
         while (!m_entities.empty())
         {
           delete m_entities.back();
@@ -245,6 +263,16 @@ namespace DUNE
         return m_args.priority;
       }
 
+      //! Test if the task runs in a real-time scheduling class, as
+      //! selected by the 'Execution Policy' parameter.
+      //! @return true if the task uses a real-time policy, false
+      //! otherwise.
+      bool
+      hasRealTimePolicy(void) const
+      {
+        return m_args.exec_policy == "FIFO" || m_args.exec_policy == "RR";
+      }
+
       //! Send an human-readable informational message to all
       //! configured output channels and files.
       //! @param format string format (similar to printf(3)).
@@ -328,6 +356,14 @@ namespace DUNE
         dispatch(msg, flags);
       }
 
+      //! Get the number of messages dispatched by this task.
+      //! @return number of messages.
+      int
+      getDispatchCount(void)
+      {
+        return m_dispatched.add(0);
+      }
+
       //! Queue a message for later consumption.
       //! @param msg message object.
       void
@@ -360,6 +396,19 @@ namespace DUNE
       void
       initializeResources(void);
 
+      //! Make the task take part in a phased startup sequence. The
+      //! task synchronizes with the other tasks of the sequence after
+      //! entity resolution, resource acquisition and resource
+      //! initialization the first time it runs.
+      //! @param[in] startup startup sequence.
+      //! @param[in] index index of the task in the sequence.
+      void
+      setStartup(Startup* startup, unsigned index)
+      {
+        m_startup = startup;
+        m_startup_index = index;
+      }
+
       //! Instruct task to update its run-time parameters.
       //! @param[in] act_deact if true this function will request
       //! activation/deactivation if the 'Active' parameter changed.
@@ -570,6 +619,32 @@ namespace DUNE
         bind(M::getIdStatic(), new Consumer<T, M>(*task_obj, consumer));
       }
 
+      //! Bind a message to a consumer method, receiving only
+      //! messages accepted by a delivery filter. Messages rejected by
+      //! the filter are discarded by the message bus before they are
+      //! queued.
+      //! @param task_obj consumer task.
+      //! @param filter delivery filter.
+      //! @param consumer consumer method.
+      template <typename M, typename T>
+      void
+      bind(T* task_obj, const IMC::DeliveryFilter& filter,
+           void (T::* consumer)(const M*) = &T::consume)
+      {
+        bind(M::getIdStatic(), new Consumer<T, M>(*task_obj, consumer), filter);
+      }
+
+      //! Bind a message to a consumer method with binding flags.
+      //! @param task_obj consumer task.
+      //! @param flags binding flags (see BindFlags).
+      //! @param consumer consumer method.
+      template <typename M, typename T>
+      void
+      bind(T* task_obj, BindFlags flags, void (T::* consumer)(const M*) = &T::consume)
+      {
+        bind(M::getIdStatic(), new Consumer<T, M>(*task_obj, consumer), IMC::DeliveryFilter(), flags);
+      }
+
       //! Bind multiple messages to a default consumer method.
       //! @param task_obj consumer object.
       //! @param list list of message identifiers.
@@ -582,6 +657,20 @@ namespace DUNE
           bind(list[i], new Consumer<T, IMC::Message>(*task_obj, func));
       }
 
+      //! Bind multiple messages to a default consumer method,
+      //! receiving only messages accepted by a delivery filter.
+      //! @param task_obj consumer object.
+      //! @param list list of message identifiers.
+      //! @param filter delivery filter.
+      template <typename T>
+      void
+      bind(T* task_obj, const std::vector<uint32_t>& list, const IMC::DeliveryFilter& filter)
+      {
+        void (T::* func)(const IMC::Message*) = &T::consume;
+        for (unsigned int i = 0; i < list.size(); ++i)
+          bind(list[i], new Consumer<T, IMC::Message>(*task_obj, func), filter);
+      }
+
       //! Bind multiple messages to a consumer method.
       //! @param task_obj consumer object.
       //! @param list list of message identifiers.
@@ -608,6 +697,21 @@ namespace DUNE
                new Consumer<T, IMC::Message>(*task_obj, func));
       }
 
+      //! Bind multiple messages to a default consumer method with
+      //! binding flags.
+      //! @param task_obj consumer task.
+      //! @param list list of message abbreviations.
+      //! @param flags binding flags (see BindFlags).
+      template <typename T>
+      void
+      bind(T* task_obj, const std::vector<std::string>& list, BindFlags flags)
+      {
+        void (T::* func)(const IMC::Message*) = &T::consume;
+        for (unsigned int i = 0; i < list.size(); ++i)
+          bind(IMC::Factory::getIdFromAbbrev(list[i]),
+               new Consumer<T, IMC::Message>(*task_obj, func), IMC::DeliveryFilter(), flags);
+      }
+
       //! Register a consumer for a given message identifier.
       //! @param[in] message_id message identifier.
       //! @param[in] consumer consumer object.
@@ -619,6 +723,26 @@ namespace DUNE
         m_recipient->bind(message_id, consumer);
       }
 
+      //! Register a consumer for a given message identifier with a
+      //! delivery filter.
+      //! @param[in] message_id message identifier.
+      //! @param[in] consumer consumer object.
+      //! @param[in] filter delivery filter.
+      //! @param[in] flags binding flags (see BindFlags).
+      void
+      bind(unsigned int message_id, AbstractConsumer* consumer, const IMC::DeliveryFilter& filter,
+           unsigned int flags = 0)
+      {
+        spew("registering consumer for '%s'",
+             IMC::Factory::getAbbrevFromId(message_id).c_str());
+
+        IMC::DeliveryFilter local(filter);
+        if (local.isLocalOnly())
+          local.setLocalSystem(getSystemId());
+
+        m_recipient->bind(message_id, consumer, &local, (flags & BF_CONFLATE) != 0);
+      }
+
       //! Request task to start/resume normal execution.
       void
       requestActivation(void);
@@ -769,6 +893,8 @@ namespace DUNE
       onMain(void) = 0;
 
     private:
+      friend class LogBackend;
+
       struct BasicArguments
       {
         //! Main entity label.
@@ -779,6 +905,14 @@ namespace DUNE
         uint16_t deact_time;
         //! Scheduling priority.
         unsigned int priority;
+        //! Scheduling policy.
+        std::string exec_policy;
+        //! Processors on which the task is allowed to run.
+        std::vector<unsigned> affinity;
+        //! True to lock the process memory.
+        bool lock_memory;
+        //! Amount of stack to prefault (KiB).
+        unsigned stack_prefault;
         //! True if task is active.
         bool active;
         //! Scope of 'Active' parameter.
@@ -807,6 +941,29 @@ namespace DUNE
       bool m_honours_active;
       //! Name of parameter section editor.
       std::string m_param_editor;
+      //! Startup sequence (NULL after startup).
+      Startup* m_startup;
+      //! Index of this task in the startup sequence.
+      unsigned m_startup_index;
+      //! Number of dispatched messages.
+      Concurrency::AtomicCounter m_dispatched;
+
+      //! Finish a startup phase, waiting for the other tasks of the
+      //! startup sequence.
+      //! @param[in] phase startup phase.
+      //! @param[in] begin begin of phase.
+      //! @return end of synchronization.
+      double
+      finishStartupPhase(Startup::Phase phase, double begin);
+
+      //! Drop out of the startup sequence.
+      void
+      leaveStartup(void);
+
+      //! Apply the scheduling policy, processor affinity and memory
+      //! locking options to the calling thread.
+      void
+      setupExecution(void);
 
       //! Report current entity states by dispatching EntityState
       //! messages. This function will at least report the state of
@@ -817,6 +974,17 @@ namespace DUNE
       void
       log(IMC::LogBookEntry::TypeEnum type, const char* format, std::va_list arg_list);
 
+      //! Write a formatted log message to the terminal and,
+      //! optionally, dispatch it as a LogBookEntry.
+      //! @param[in] type message type.
+      //! @param[in] eid source entity.
+      //! @param[in] time time of the message.
+      //! @param[in] text formatted message.
+      //! @param[in] book true to dispatch a LogBookEntry.
+      void
+      writeLog(IMC::LogBookEntry::TypeEnum type, unsigned eid, double time,
+               const char* text, bool book);
+
       void
       run(void);
 
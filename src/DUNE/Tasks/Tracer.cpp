@@ -0,0 +1,454 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Concurrency/TLS.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Delay.hpp>
+#include <DUNE/Tasks/Tracer.hpp>
+
+#if defined(DUNE_SYS_HAS___SYNC_SYNCHRONIZE)
+#  define DUNE_TRACER_ASYNC
+#endif
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    const char Tracer::c_magic[8] = {'D', 'U', 'N', 'E', 'T', 'R', 'C', '1'};
+
+#if defined(DUNE_TRACER_ASYNC)
+    //! Idle time between polls of the rings in milliseconds.
+    static const unsigned c_poll_period = 20;
+
+    //! Single producer single consumer event ring.
+    struct TraceRing
+    {
+      TraceRing(void):
+        head(0),
+        tail(0),
+        orphan(false)
+      { }
+
+      //! Events.
+      Tracer::Event data[Tracer::c_ring_size];
+      //! Absolute write position (written by producer).
+      volatile uint64_t head;
+      //! Absolute read position (written by consumer).
+      volatile uint64_t tail;
+      //! True if the producer thread is gone.
+      volatile bool orphan;
+    };
+
+    //! Per-thread producer state.
+    struct TraceProducer
+    {
+      TraceProducer(void):
+        ring(NULL)
+      {
+        cause.trace = 0;
+        cause.span = 0;
+      }
+
+      ~TraceProducer(void)
+      {
+        if (ring == NULL)
+          return;
+
+        __sync_synchronize();
+        ring->orphan = true;
+      }
+
+      //! Ring of this thread.
+      TraceRing* ring;
+      //! Trace context inherited by dispatched messages.
+      IMC::TraceContext cause;
+    };
+
+    //! Background trace file writer.
+    class Tracer::Writer: public Concurrency::Thread
+    {
+    public:
+      Writer(std::FILE* file):
+        m_file(file)
+      { }
+
+      //! Write all events currently queued.
+      //! @return true if any event was written.
+      bool
+      drain(void);
+
+    private:
+      //! Trace file.
+      std::FILE* m_file;
+
+      void
+      run(void)
+      {
+        while (!isStopping())
+        {
+          if (!drain())
+            Time::Delay::waitMsec(c_poll_period);
+        }
+
+        drain();
+      }
+    };
+
+    //! Shared tracer state.
+    struct TraceState
+    {
+      TraceState(void):
+        writer(NULL),
+        file(NULL),
+        entities(NULL),
+        dropped(0),
+        running(false)
+      { }
+
+      //! Protects rings, writer and file.
+      Concurrency::Mutex mutex;
+      //! Rings of all producer threads.
+      std::vector<TraceRing*> rings;
+      //! Per-thread producer state.
+      Concurrency::TLS<TraceProducer> producers;
+      //! Span identifiers.
+      Concurrency::AtomicCounter spans;
+      //! Background thread.
+      Concurrency::Thread* writer;
+      //! Trace file.
+      std::FILE* file;
+      //! Entity database.
+      Entities::EntityDataBase* entities;
+      //! Number of dropped events.
+      Concurrency::AtomicCounter dropped;
+      //! True if events are being accepted.
+      volatile bool running;
+    };
+
+    static TraceState&
+    getTraceState(void)
+    {
+      static TraceState state;
+      return state;
+    }
+
+    //! Get a new span identifier (never zero).
+    static uint32_t
+    nextSpan(TraceState& state)
+    {
+      uint32_t span = 0;
+      while (span == 0)
+        span = (uint32_t)state.spans.add(1);
+      return span;
+    }
+
+    bool
+    Tracer::Writer::drain(void)
+    {
+      TraceState& state = getTraceState();
+      std::vector<TraceRing*> rings;
+      {
+        Concurrency::ScopedMutex l(state.mutex);
+        for (size_t i = 0; i < state.rings.size(); )
+        {
+          TraceRing* ring = state.rings[i];
+          if (ring->orphan && ring->tail == ring->head)
+          {
+            delete ring;
+            state.rings.erase(state.rings.begin() + i);
+            continue;
+          }
+          ++i;
+        }
+        rings = state.rings;
+      }
+
+      bool written = false;
+      for (size_t i = 0; i < rings.size(); ++i)
+      {
+        TraceRing& ring = *rings[i];
+        uint64_t head = ring.head;
+        __sync_synchronize();
+        uint64_t tail = ring.tail;
+        if (tail == head)
+          continue;
+
+        size_t begin = tail % c_ring_size;
+        size_t count = head - tail;
+        size_t first = std::min(count, c_ring_size - begin);
+        std::fwrite(ring.data + begin, sizeof(Event), first, m_file);
+        std::fwrite(ring.data, sizeof(Event), count - first, m_file);
+
+        __sync_synchronize();
+        ring.tail = head;
+        written = true;
+      }
+
+      if (written)
+        std::fflush(m_file);
+
+      return written;
+    }
+#endif
+
+    Tracer::Cause::Cause(const IMC::TraceContext& ctx):
+      m_active(false)
+    {
+      m_previous.trace = 0;
+      m_previous.span = 0;
+
+#if defined(DUNE_TRACER_ASYNC)
+      TraceState& state = getTraceState();
+      if (!state.running || ctx.trace == 0)
+        return;
+
+      TraceProducer& producer = state.producers.value();
+      m_previous = producer.cause;
+      producer.cause = ctx;
+      m_active = true;
+#else
+      (void)ctx;
+#endif
+    }
+
+    Tracer::Cause::~Cause(void)
+    {
+#if defined(DUNE_TRACER_ASYNC)
+      if (m_active)
+        getTraceState().producers.value().cause = m_previous;
+#endif
+    }
+
+    void
+    Tracer::start(const std::string& file, Entities::EntityDataBase& entities)
+    {
+#if defined(DUNE_TRACER_ASYNC)
+      TraceState& state = getTraceState();
+      Concurrency::ScopedMutex l(state.mutex);
+      if (state.writer != NULL)
+        return;
+
+      std::FILE* fd = std::fopen(file.c_str(), "wb");
+      if (fd == NULL)
+        throw std::runtime_error(DTR("unable to open trace file: ") + file);
+
+      std::fwrite(c_magic, sizeof(c_magic), 1, fd);
+
+      // Discard anything left behind by a previous run.
+      for (size_t i = 0; i < state.rings.size(); ++i)
+        state.rings[i]->tail = state.rings[i]->head;
+
+      state.file = fd;
+      state.entities = &entities;
+      state.writer = new Writer(fd);
+      state.writer->start();
+      __sync_synchronize();
+      state.running = true;
+#else
+      (void)file;
+      (void)entities;
+#endif
+    }
+
+    void
+    Tracer::stop(void)
+    {
+#if defined(DUNE_TRACER_ASYNC)
+      TraceState& state = getTraceState();
+      Concurrency::Thread* writer = NULL;
+      {
+        Concurrency::ScopedMutex l(state.mutex);
+        state.running = false;
+        __sync_synchronize();
+        writer = state.writer;
+        state.writer = NULL;
+      }
+
+      if (writer == NULL)
+        return;
+
+      writer->stopAndJoin();
+      delete writer;
+
+      std::map<unsigned, std::string> labels = state.entities->entries();
+      std::map<unsigned, std::string>::const_iterator itr = labels.begin();
+      for (; itr != labels.end(); ++itr)
+      {
+        Event ev;
+        std::memset(&ev, 0, sizeof(ev));
+        ev.type = EV_LABEL;
+        ev.entity = itr->first;
+        ev.trace = itr->second.size();
+        std::fwrite(&ev, sizeof(ev), 1, state.file);
+        std::fwrite(itr->second.data(), 1, itr->second.size(), state.file);
+      }
+
+      std::fclose(state.file);
+      state.file = NULL;
+#endif
+    }
+
+    bool
+    Tracer::isRunning(void)
+    {
+#if defined(DUNE_TRACER_ASYNC)
+      return getTraceState().running;
+#else
+      return false;
+#endif
+    }
+
+    unsigned
+    Tracer::getDropped(void)
+    {
+#if defined(DUNE_TRACER_ASYNC)
+      return getTraceState().dropped.add(0);
+#else
+      return 0;
+#endif
+    }
+
+    void
+    Tracer::post(EventType type, const IMC::TraceContext& ctx, uint32_t parent,
+                 uint16_t id, unsigned eid)
+    {
+#if defined(DUNE_TRACER_ASYNC)
+      TraceState& state = getTraceState();
+      TraceProducer& producer = state.producers.value();
+      if (producer.ring == NULL)
+      {
+        producer.ring = new TraceRing;
+        Concurrency::ScopedMutex l(state.mutex);
+        state.rings.push_back(producer.ring);
+      }
+
+      TraceRing& ring = *producer.ring;
+      uint64_t head = ring.head;
+      if (head - ring.tail >= c_ring_size)
+      {
+        state.dropped.add(1);
+        return;
+      }
+
+      Event& ev = ring.data[head % c_ring_size];
+      ev.time = Time::Clock::getNsec();
+      ev.trace = ctx.trace;
+      ev.span = ctx.span;
+      ev.parent = parent;
+      ev.id = id;
+      ev.entity = eid;
+      ev.type = type;
+      std::memset(ev.padding, 0, sizeof(ev.padding));
+
+      __sync_synchronize();
+      ring.head = head + 1;
+#else
+      (void)type;
+      (void)ctx;
+      (void)parent;
+      (void)id;
+      (void)eid;
+#endif
+    }
+
+    void
+    Tracer::dispatched(IMC::Message* msg, unsigned eid)
+    {
+#if defined(DUNE_TRACER_ASYNC)
+      TraceState& state = getTraceState();
+      if (!state.running)
+        return;
+
+      const IMC::TraceContext& cause = state.producers.value().cause;
+      IMC::TraceContext ctx;
+      ctx.span = nextSpan(state);
+      ctx.trace = (cause.trace != 0) ? cause.trace : ctx.span;
+      msg->setTraceContext(ctx);
+      post(EV_DISPATCH, ctx, cause.span, msg->getId(), eid);
+#else
+      (void)msg;
+      (void)eid;
+#endif
+    }
+
+    void
+    Tracer::dequeued(const IMC::Message* msg, unsigned eid)
+    {
+#if defined(DUNE_TRACER_ASYNC)
+      TraceState& state = getTraceState();
+      if (!state.running)
+        return;
+
+      const IMC::TraceContext& ctx = msg->getTraceContext();
+      state.producers.value().cause = ctx;
+      if (ctx.trace != 0)
+        post(EV_DEQUEUE, ctx, 0, msg->getId(), eid);
+#else
+      (void)msg;
+      (void)eid;
+#endif
+    }
+
+    void
+    Tracer::consumed(const IMC::Message* msg, unsigned eid)
+    {
+#if defined(DUNE_TRACER_ASYNC)
+      TraceState& state = getTraceState();
+      if (!state.running)
+        return;
+
+      IMC::TraceContext& cause = state.producers.value().cause;
+      cause.trace = 0;
+      cause.span = 0;
+
+      const IMC::TraceContext& ctx = msg->getTraceContext();
+      if (ctx.trace != 0)
+        post(EV_CONSUME, ctx, 0, msg->getId(), eid);
+#else
+      (void)msg;
+      (void)eid;
+#endif
+    }
+  }
+}
@@ -0,0 +1,185 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_TRACER_HPP_INCLUDED_
+#define DUNE_TASKS_TRACER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/TraceContext.hpp>
+#include <DUNE/Entities/EntityDataBase.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Tracer;
+
+    //! Causal latency tracer of messages exchanged between tasks.
+    //!
+    //! While the tracer is running, every message dispatched by a
+    //! task gets a trace context. Messages dispatched while a task
+    //! is consuming a traced message (or inside a Cause scope)
+    //! inherit the trace of that message, otherwise they start a
+    //! new trace. Dispatch, dequeue and consume events are stored
+    //! in lock-free per-thread rings and a background thread
+    //! appends them to a binary trace file, from which per-chain
+    //! latencies can be rebuilt (see dune-tracestat).
+    //!
+    //! The trace file starts with the eight bytes of c_magic
+    //! followed by Event records. Label records (EV_LABEL) are
+    //! followed by the number of label bytes given in the trace
+    //! field.
+    class Tracer
+    {
+    public:
+      //! Event types.
+      enum EventType
+      {
+        //! Message dispatched to the bus by a task.
+        EV_DISPATCH = 1,
+        //! Message removed from the inbox of a task.
+        EV_DEQUEUE = 2,
+        //! All consumers of a task returned.
+        EV_CONSUME = 3,
+        //! Label of an entity.
+        EV_LABEL = 4
+      };
+
+      //! Trace event record.
+      struct Event
+      {
+        //! Monotonic time in nanoseconds.
+        uint64_t time;
+        //! Trace identifier.
+        uint32_t trace;
+        //! Span identifier.
+        uint32_t span;
+        //! Parent span (dispatch only, zero for the root).
+        uint32_t parent;
+        //! Message identifier.
+        uint16_t id;
+        //! Source entity (dispatch) or consumer entity.
+        uint16_t entity;
+        //! Event type.
+        uint8_t type;
+        //! Padding.
+        uint8_t padding[7];
+      };
+
+      //! Trace file signature.
+      static const char c_magic[8];
+      //! Capacity of each per-thread ring in events.
+      static const size_t c_ring_size = 2048;
+
+      //! Scoped cause of messages dispatched outside consumers,
+      //! for tasks that derive messages from cached inputs.
+      class Cause
+      {
+      public:
+        //! Make messages dispatched by this thread inherit a trace.
+        //! @param[in] ctx trace context of the cause.
+        Cause(const IMC::TraceContext& ctx);
+
+        //! Restore the previous cause.
+        ~Cause(void);
+
+      private:
+        //! Previous cause.
+        IMC::TraceContext m_previous;
+        //! True if the cause was set.
+        bool m_active;
+
+        //! Non-copyable.
+        Cause(const Cause&);
+
+        //! Non-assignable.
+        Cause&
+        operator=(const Cause&);
+      };
+
+      //! Start tracing.
+      //! @param[in] file trace file.
+      //! @param[in] entities entity database used to label events.
+      static void
+      start(const std::string& file, Entities::EntityDataBase& entities);
+
+      //! Write pending events and entity labels and stop tracing.
+      static void
+      stop(void);
+
+      //! Test if the tracer is running.
+      //! @return true if running, false otherwise.
+      static bool
+      isRunning(void);
+
+      //! Get the number of events that could not be queued.
+      //! @return number of dropped events.
+      static unsigned
+      getDropped(void);
+
+      //! Assign a trace context to a message about to be
+      //! dispatched and record the dispatch.
+      //! @param[in] msg message.
+      //! @param[in] eid source entity.
+      static void
+      dispatched(IMC::Message* msg, unsigned eid);
+
+      //! Record the removal of a message from a task inbox and make
+      //! it the cause of messages dispatched by this thread.
+      //! @param[in] msg message.
+      //! @param[in] eid consumer entity.
+      static void
+      dequeued(const IMC::Message* msg, unsigned eid);
+
+      //! Record the end of consumption of a message and clear the
+      //! cause of messages dispatched by this thread.
+      //! @param[in] msg message.
+      //! @param[in] eid consumer entity.
+      static void
+      consumed(const IMC::Message* msg, unsigned eid);
+
+    private:
+      class Writer;
+
+      //! Queue an event in the ring of the calling thread.
+      static void
+      post(EventType type, const IMC::TraceContext& ctx, uint32_t parent,
+           uint16_t id, unsigned eid);
+    };
+  }
+}
+
+#endif
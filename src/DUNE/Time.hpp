@@ -45,5 +45,6 @@ namespace DUNE
 #include <DUNE/Time/Utils.hpp>
 #include <DUNE/Time/Delta.hpp>
 #include <DUNE/Time/Counter.hpp>
+#include <DUNE/Time/JitterMonitor.hpp>
 
 #endif
@@ -0,0 +1,120 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/Time/JitterMonitor.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    JitterMonitor::JitterMonitor(void)
+    {
+      reset();
+    }
+
+    void
+    JitterMonitor::reset(void)
+    {
+      m_cycles = 0;
+      m_misses = 0;
+      m_last_start = -1.0;
+      m_periods = 0;
+      m_period_sum = 0;
+      m_jitter_sq_sum = 0;
+      m_jitter_max = 0;
+      m_latency_sum = 0;
+      m_latency_max = 0;
+      m_exec_max = 0;
+    }
+
+    void
+    JitterMonitor::update(double period, double scheduled, double start, double finish)
+    {
+      ++m_cycles;
+
+      if (m_last_start >= 0)
+      {
+        double measured = start - m_last_start;
+        double jitter = std::fabs(measured - period);
+        ++m_periods;
+        m_period_sum += measured;
+        m_jitter_sq_sum += jitter * jitter;
+        if (jitter > m_jitter_max)
+          m_jitter_max = jitter;
+      }
+
+      m_last_start = start;
+
+      double latency = start - scheduled;
+      if (latency < 0)
+        latency = 0;
+      m_latency_sum += latency;
+      if (latency > m_latency_max)
+        m_latency_max = latency;
+
+      double exec = finish - start;
+      if (exec > m_exec_max)
+        m_exec_max = exec;
+
+      if (finish > scheduled + period)
+        ++m_misses;
+    }
+
+    double
+    JitterMonitor::getMeanPeriod(void) const
+    {
+      if (m_periods == 0)
+        return 0;
+
+      return m_period_sum / m_periods;
+    }
+
+    double
+    JitterMonitor::getJitterRMS(void) const
+    {
+      if (m_periods == 0)
+        return 0;
+
+      return std::sqrt(m_jitter_sq_sum / m_periods);
+    }
+
+    double
+    JitterMonitor::getMeanLatency(void) const
+    {
+      if (m_cycles == 0)
+        return 0;
+
+      return m_latency_sum / m_cycles;
+    }
+  }
+}
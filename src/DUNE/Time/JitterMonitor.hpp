@@ -0,0 +1,152 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_TIME_JITTER_MONITOR_HPP_INCLUDED_
+#define DUNE_TIME_JITTER_MONITOR_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM JitterMonitor;
+
+    //! Timing statistics of a periodic activity. For every cycle the
+    //! caller supplies the time at which the cycle was scheduled to
+    //! start, the time at which it actually started and the time at
+    //! which it finished. From these the monitor derives the jitter
+    //! of the period between consecutive cycles, the release latency
+    //! (time between the scheduled and the actual start), the
+    //! execution time and the number of deadline misses (cycles that
+    //! finished after the next cycle was due).
+    class JitterMonitor
+    {
+    public:
+      //! Constructor.
+      JitterMonitor(void);
+
+      //! Discard all statistics.
+      void
+      reset(void);
+
+      //! Account for one cycle.
+      //! @param[in] period nominal period (s).
+      //! @param[in] scheduled time at which the cycle should have started (s).
+      //! @param[in] start time at which the cycle started (s).
+      //! @param[in] finish time at which the cycle finished (s).
+      void
+      update(double period, double scheduled, double start, double finish);
+
+      //! Retrieve the number of cycles accounted for.
+      //! @return number of cycles.
+      unsigned
+      getCycles(void) const
+      {
+        return m_cycles;
+      }
+
+      //! Retrieve the number of cycles that finished after the start
+      //! of the following cycle was due.
+      //! @return number of deadline misses.
+      unsigned
+      getDeadlineMisses(void) const
+      {
+        return m_misses;
+      }
+
+      //! Retrieve the mean period between consecutive cycles.
+      //! @return mean period (s) or 0 if less than two cycles ran.
+      double
+      getMeanPeriod(void) const;
+
+      //! Retrieve the largest absolute deviation of the measured
+      //! period from the nominal period.
+      //! @return maximum jitter (s).
+      double
+      getMaximumJitter(void) const
+      {
+        return m_jitter_max;
+      }
+
+      //! Retrieve the root mean square deviation of the measured
+      //! period from the nominal period.
+      //! @return RMS jitter (s).
+      double
+      getJitterRMS(void) const;
+
+      //! Retrieve the mean release latency.
+      //! @return mean latency (s).
+      double
+      getMeanLatency(void) const;
+
+      //! Retrieve the largest release latency.
+      //! @return maximum latency (s).
+      double
+      getMaximumLatency(void) const
+      {
+        return m_latency_max;
+      }
+
+      //! Retrieve the largest execution time.
+      //! @return maximum execution time (s).
+      double
+      getMaximumExecution(void) const
+      {
+        return m_exec_max;
+      }
+
+    private:
+      //! Number of cycles.
+      unsigned m_cycles;
+      //! Number of deadline misses.
+      unsigned m_misses;
+      //! Start of the previous cycle (negative if none).
+      double m_last_start;
+      //! Number of measured periods.
+      unsigned m_periods;
+      //! Sum of measured periods.
+      double m_period_sum;
+      //! Sum of squared period deviations.
+      double m_jitter_sq_sum;
+      //! Maximum absolute period deviation.
+      double m_jitter_max;
+      //! Sum of release latencies.
+      double m_latency_sum;
+      //! Maximum release latency.
+      double m_latency_max;
+      //! Maximum execution time.
+      double m_exec_max;
+    };
+  }
+}
+
+#endif
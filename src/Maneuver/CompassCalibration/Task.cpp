@@ -126,7 +126,7 @@ namespace Maneuver
         .description("Perform compass calibration if true");
 
         bindToManeuver<Task, IMC::CompassCalibration>();
-        bind<IMC::EstimatedState>(this);
+        bind<IMC::EstimatedState>(this, IMC::DeliveryFilter().localOnly());
         bind<IMC::EulerAngles>(this);
         bind<IMC::MagneticField>(this);
       }
@@ -257,9 +257,6 @@ namespace Maneuver
       void
       consume(const IMC::EstimatedState* msg)
       {
-        if (msg->getSource() != getSystemId())
-          return;
-
         m_estate = *msg;
 
         if (!m_yoyo_ing)
@@ -53,7 +53,7 @@ namespace Maneuver
         DUNE::Maneuvers::Maneuver(name, ctx)
       {
         bindToManeuver<Task, IMC::CoverArea>();
-        bind<IMC::EstimatedState>(this);
+        bind<IMC::EstimatedState>(this, IMC::DeliveryFilter().localOnly());
         //    bind<Task, IMC::EstimatedStreamVelocity>(*this);
 
         param("Laps", m_param_times)
@@ -388,9 +388,6 @@ namespace Maneuver
       void
       consume(const IMC::EstimatedState* msg)
       {
-        if (msg->getSource() != getSystemId())
-          return;
-
         m_estate = *msg;
 
         if (!isActive())
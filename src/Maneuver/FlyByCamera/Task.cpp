@@ -58,7 +58,7 @@ namespace Maneuver
         .description("Current Camera heading in respect to the vehicle")
         .defaultValue("0");
 
-        bind<IMC::EstimatedState>(this);
+        bind<IMC::EstimatedState>(this, IMC::DeliveryFilter().localOnly());
       }
 
       void
@@ -71,9 +71,6 @@ namespace Maneuver
       void
       consume(const IMC::EstimatedState* msg)
       {
-        if (msg->getSource() != getSystemId())
-          return;
-
         m_heading_c_current=msg->psi+(3.14/20);
         m_heading_v_desired=m_heading_c_current;
         m_heading_msg.value=m_heading_v_desired;
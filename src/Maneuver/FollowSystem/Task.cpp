@@ -119,7 +119,7 @@ namespace Maneuver
 
         bindToManeuver<Task, IMC::FollowSystem>();
         bind<IMC::RemoteState>(this);
-        bind<IMC::EstimatedState>(this, true); // consume even if inactive
+        bind<IMC::EstimatedState>(this, IMC::DeliveryFilter().localOnly(), true); // consume even if inactive
         bind<IMC::Announce>(this);
       }
 
@@ -143,9 +143,6 @@ namespace Maneuver
       void
       consume(const IMC::EstimatedState* msg)
       {
-        if (msg->getSource() != getSystemId())
-          return;
-
         // do not do a thing if the announce method is not active
         if (!m_args.announce_active)
           return;
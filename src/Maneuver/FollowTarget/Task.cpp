@@ -92,7 +92,7 @@ namespace Maneuver
         .description("Lateral gain controlling lateral convergence");
 
         bind<IMC::Target>(this);
-        bind<IMC::EstimatedState>(this);
+        bind<IMC::EstimatedState>(this, IMC::DeliveryFilter().localOnly());
         bind<IMC::EstimatedStreamVelocity>(this);
       }
 
@@ -157,9 +157,6 @@ namespace Maneuver
       void
       consume(const IMC::EstimatedState* msg)
       {
-        if (msg->getSource() != getSystemId())
-          return;
-
         m_estate = *msg;
         m_got_estate = true;
       }
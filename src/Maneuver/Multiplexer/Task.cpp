@@ -329,7 +329,7 @@ namespace Maneuver
           m_maneuvers[i] = NULL;
 
         bind<IMC::Brake>(this);
-        bind<IMC::EstimatedState>(this);
+        bind<IMC::EstimatedState>(this, IMC::DeliveryFilter().localOnly());
         bind<IMC::GpsFix>(this);
         bind<IMC::VehicleMedium>(this);
         bind<IMC::Throttle>(this);
@@ -471,9 +471,6 @@ namespace Maneuver
       void
       consume(const IMC::EstimatedState* msg)
       {
-        if (msg->getSource() != getSystemId())
-          return;
-
         m_maneuvers[m_type]->onEstimatedState(msg);
       }
 
@@ -94,7 +94,7 @@ namespace Maneuver
         .description("Process measured altitude values only if above this threshold");
 
         bindToManeuver<Task, IMC::RowsCoverage>();
-        bind<IMC::EstimatedState>(this);
+        bind<IMC::EstimatedState>(this, IMC::DeliveryFilter().localOnly());
       }
 
       //! Destructor
@@ -172,9 +172,6 @@ namespace Maneuver
       void
       consume(const IMC::EstimatedState* msg)
       {
-        if (msg->getSource() != getSystemId())
-          return;
-
         if (m_alt_avrg == NULL)
           return;
 
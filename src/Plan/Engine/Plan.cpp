@@ -39,7 +39,7 @@ namespace Plan
   {
     Plan::Plan(const IMC::PlanSpecification* spec, bool compute_progress,
                bool fpredict, float max_depth, Tasks::Task* task,
-               uint16_t min_cal_time, Parsers::Config* cfg):
+               uint16_t min_cal_time, Parsers::Config* cfg, unsigned workers):
       m_spec(spec),
       m_curr_node(NULL),
       m_compute_progress(compute_progress),
@@ -81,6 +81,7 @@ namespace Plan
       }
 
       m_profiles = new Plans::TimeProfile(m_speed_model);
+      m_profiles->setWorkers(workers);
       m_calib = new Calibration();
       m_rt_stat = new RunTimeStatistics(&m_post_stat);
     }
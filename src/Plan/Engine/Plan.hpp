@@ -75,9 +75,10 @@ namespace Plan
       //! @param[in] task pointer to task
       //! @param[in] min_cal_time minimum calibration time in s.
       //! @param[in] cfg pointer to config object
+      //! @param[in] workers number of threads used to profile maneuvers
       Plan(const IMC::PlanSpecification* spec, bool compute_progress,
            bool fpredict, float max_depth, Tasks::Task* task,
-           uint16_t min_cal_time, Parsers::Config* cfg);
+           uint16_t min_cal_time, Parsers::Config* cfg, unsigned workers = 1);
 
       //! Destructor
       ~Plan(void);
@@ -89,6 +89,8 @@ namespace Plan
       std::string label_gen;
       //! Absolute maximum depth.
       float max_depth;
+      //! Number of threads used to profile maneuvers.
+      unsigned profile_workers;
     };
 
     struct Task: public DUNE::Tasks::Task
@@ -176,6 +178,12 @@ namespace Plan
         .units(Units::Meter)
         .description("Radius for the station keeping");
 
+        param("Profile Worker Threads", m_args.profile_workers)
+        .defaultValue("2")
+        .minimumValue("1")
+        .description("Number of threads used to compute the geometry of"
+                     " path and rows maneuvers when profiling plans");
+
         param("IMU Entity Label", m_args.label_imu)
         .defaultValue("IMU")
         .description("Entity label of the IMU for fuel prediction");
@@ -229,7 +237,8 @@ namespace Plan
           m_args.speriod = 1.0 / m_args.speriod;
 
         if ((m_plan != NULL) && (paramChanged(m_args.progress) ||
-                                 paramChanged(m_args.calibration_time)))
+                                 paramChanged(m_args.calibration_time) ||
+                                 paramChanged(m_args.profile_workers)))
           throw RestartNeeded(DTR("restarting to relaunch plan parser"), 0, false);
       }
 
@@ -243,7 +252,8 @@ namespace Plan
       onResourceAcquisition(void)
       {
         m_plan = new Plan(&m_spec, m_args.progress, m_args.fpredict, m_args.max_depth,
-                          this, m_args.calibration_time, &m_ctx.config);
+                          this, m_args.calibration_time, &m_ctx.config,
+                          m_args.profile_workers);
       }
 
       void
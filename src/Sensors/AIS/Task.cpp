@@ -31,7 +31,6 @@
 #include <cstring>
 #include <algorithm>
 #include <cstddef>
-#include <sstream>
 #include <string>
 #include <vector>
 
@@ -53,10 +52,8 @@ namespace Sensors
 
     //! Read buffer size.
     static const size_t c_read_buffer_size = 82;
-    //! NMEA 5 body index.
-    static const size_t c_nmea5_body_index = 15;
-    //! NMEA 5 trailing chunk in first fragment.
-    static const size_t c_nmea5_trail = 5;
+    //! Number of fields of VDM/VDO sentences.
+    static const unsigned c_vdm_fields = 7;
     //! Line termination character.
     static const char c_line_term = '\n';
 
@@ -75,10 +72,12 @@ namespace Sensors
       Arguments m_args;
       //! Current line.
       std::string m_line;
-      //! Saved first part of NMEA 5 class message.
-      std::string m_nmea5_fg;
-      //! Waiting fragment.
-      bool m_nmea5_wait_fg;
+      //! Last tokenized sentence.
+      Parsers::NMEATokenizer m_stn;
+      //! Payload assembled from sentence fragments.
+      std::string m_payload;
+      //! Index of the last assembled fragment.
+      unsigned m_fragment;
       //! Vehicle Type.
       std::map<int, std::string> m_systems;
       //! Buffer
@@ -86,7 +85,8 @@ namespace Sensors
 
       Task(const std::string& name, Tasks::Context& ctx):
         Hardware::BasicDeviceDriver(name, ctx),
-        m_handle(NULL)
+        m_handle(NULL),
+        m_fragment(0)
       {
         // Define configuration parameters.
         paramActive(Tasks::Parameter::SCOPE_GLOBAL,
@@ -99,7 +99,6 @@ namespace Sensors
                      "or \"uart://DEVICE:BAUD\"");
 
         m_bfr.resize(c_read_buffer_size);
-        m_nmea5_wait_fg = false;
       }
 
       //! Try to connect to the device.
@@ -133,42 +132,63 @@ namespace Sensors
       }
 
       //! Process AIS NMEA message.
+      //! @param[in] nmea_msg sentence.
       void
-      process(std::string nmea_msg)
+      process(const std::string& nmea_msg)
       {
-        // Remove carriage return.
-        nmea_msg.erase(std::remove(nmea_msg.begin(), nmea_msg.end(), '\r'), nmea_msg.end());
-
-        // Log NMEA msg.
+        // Log NMEA msg (without carriage return).
         IMC::DevDataText text;
         text.value = nmea_msg;
+        text.value.erase(std::remove(text.value.begin(), text.value.end(), '\r'), text.value.end());
         dispatch(text);
 
-        // Get body of NMEA message.
-        std::string nmea_payload = GetBody(nmea_msg.c_str());
+        // !AIVDM,count,index,sequence,channel,payload,pad*hh
+        if (m_stn.parse(text.value) != Parsers::NMEATokenizer::NMEA_OK)
+          return;
 
-        // Static and Voyage Related Data, first fragment.
-        if (nmea_payload[0] == '5' && !m_nmea5_wait_fg)
-        {
-          nmea_msg.erase(nmea_msg.size() - c_nmea5_trail - 1, c_nmea5_trail);
-          m_nmea5_fg = nmea_msg;
-          m_nmea5_wait_fg = true;
+        unsigned count = 0;
+        unsigned index = 0;
+        unsigned pad = 0;
+        if (m_stn.getFieldCount() < c_vdm_fields
+            || !m_stn.readDecimal(1, count)
+            || !m_stn.readDecimal(2, index)
+            || !m_stn.readDecimal(6, pad))
           return;
-        }
 
-        // Static and Voyage Related Data, second fragment.
-        if (m_nmea5_wait_fg)
+        // Assemble multi-sentence payloads (e.g., Static and Voyage
+        // Related Data).
+        if (index == 1)
         {
-          nmea_msg.erase(0, c_nmea5_body_index);
-          nmea_msg = m_nmea5_fg.append(nmea_msg);
-          nmea_payload = GetBody(nmea_msg.c_str());
+          m_payload.clear();
         }
+        else if (index != m_fragment + 1)
+        {
+          m_fragment = 0;
+          return;
+        }
+
+        m_payload.append(m_stn.getField(5), m_stn.getFieldSize(5));
+        m_fragment = index;
+
+        if (index < count)
+          return;
+
+        m_fragment = 0;
+        decode(pad);
+      }
 
-        // Static and Voyage Related Data, second fragment.
-        if (m_nmea5_wait_fg)
+      //! Decode assembled AIS payload.
+      //! @param[in] pad number of padding bits.
+      void
+      decode(unsigned pad)
+      {
+        if (m_payload.empty())
+          return;
+
+        // Static and Voyage Related Data.
+        if (m_payload[0] == '5')
         {
-          m_nmea5_wait_fg = false;
-          Ais5 msg(nmea_payload.c_str(), GetPad(nmea_msg));
+          Ais5 msg(m_payload.c_str(), pad);
 
           // Add system MMSI and Type if not existent.
           std::map<int, std::string>::iterator itr = m_systems.find(msg.mmsi);
@@ -180,18 +200,15 @@ namespace Sensors
         }
 
         // Position Report Class A.
-        if ((nmea_payload[0] == '1') ||
-            (nmea_payload[0] == '2') ||
-            (nmea_payload[0] == '3'))
+        if ((m_payload[0] == '1') ||
+            (m_payload[0] == '2') ||
+            (m_payload[0] == '3'))
         {
-          Ais1_2_3 msg(nmea_payload.c_str(), GetPad(nmea_msg));
+          Ais1_2_3 msg(m_payload.c_str(), pad);
 
           // We are able to send a message with ship information.
           IMC::RemoteSensorInfo rsi;
-          std::ostringstream oss; 
-          oss << msg.mmsi;
-          
-          rsi.id = static_cast<std::ostringstream*>(&oss)->str();
+          rsi.id = String::str("%d", msg.mmsi);
 
           // Find ship type.
           std::map<int, std::string>::iterator itr = m_systems.find(msg.mmsi);
@@ -202,8 +219,6 @@ namespace Sensors
           rsi.lon = Angles::radians(msg.x);
           rsi.heading = Angles::radians(msg.cog);
           dispatch(rsi);
-
-          return;
         }
       }
 
@@ -29,7 +29,6 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
-#include <algorithm>
 #include <cstddef>
 #include <cstring>
 
@@ -113,13 +112,18 @@ namespace Sensors
       Reader* m_reader;
       //! Buffer forEntityState
       char m_bufer_entity[64];
+      //! Last tokenized sentence.
+      Parsers::NMEATokenizer m_stn;
+      //! Sentence handlers.
+      Parsers::NMEADispatcher<Task> m_handlers;
 
       Task(const std::string& name, Tasks::Context& ctx):
         Hardware::BasicDeviceDriver(name, ctx),
         m_handle(NULL),
         m_has_agvel(false),
         m_has_euler(false),
-        m_reader(NULL)
+        m_reader(NULL),
+        m_handlers(this)
       {
         // Define configuration parameters.
         paramActive(Tasks::Parameter::SCOPE_GLOBAL,
@@ -166,6 +170,16 @@ namespace Sensors
         // Use wait for messages
         setWaitForMessages(1.0);
 
+        // Register sentence handlers.
+        m_handlers.add("G?ZDA", &Task::interpretZDA);
+        m_handlers.add("G?GGA", &Task::interpretGGA);
+        m_handlers.add("G?VTG", &Task::interpretVTG);
+        m_handlers.add("PSAT", &Task::interpretPSAT);
+        m_handlers.add("PUBX", &Task::interpretPUBX);
+        m_handlers.add("G?HDM", &Task::interpretHDM);
+        m_handlers.add("G?HDT", &Task::interpretHDT);
+        m_handlers.add("G?ROT", &Task::interpretROT);
+
         // Initialize messages.
         clearMessages();
 
@@ -314,157 +328,46 @@ namespace Sensors
         return false;
       }
 
-      //! Read time from string.
-      //! @param[in] str string.
-      //! @param[out] dst time.
-      //! @return true if successful, false otherwise.
-      bool
-      readTime(const std::string& str, float& dst)
-      {
-        unsigned h = 0;
-        unsigned m = 0;
-        unsigned s = 0;
-        double sfp = 0;
-
-        if (std::sscanf(str.c_str(), "%02u%02u%lf", &h, &m, &sfp) != 3)
-        {
-          if (std::sscanf(str.c_str(), "%02u%02u%02u", &h, &m, &s) != 3)
-            return false;
-        }
-
-        dst = (h * 3600) + (m * 60) + s + sfp;
-
-        return true;
-      }
-
-      //! Read latitude from string.
-      //! @param[in] str input string.
-      //! @param[in] h either North (N) or South (S).
-      //! @param[out] dst latitude.
-      //! @return true if successful, false otherwise.
-      bool
-      readLatitude(const std::string& str, const std::string& h, double& dst)
-      {
-        int degrees = 0;
-        double minutes = 0;
-
-        if (std::sscanf(str.c_str(), "%02d%lf", &degrees, &minutes) != 2)
-          return false;
-
-        dst = Angles::convertDMSToDecimal(degrees, minutes);
-
-        if (h == "S")
-          dst = -dst;
-
-        return true;
-      }
-
-      //! Read longitude from string.
-      //! @param[in] str input string.
-      //! @param[in] h either West (W) or East (E).
-      //! @param[out] dst longitude.
-      //! @return true if successful, false otherwise.
-      double
-      readLongitude(const std::string& str, const std::string& h, double& dst)
-      {
-        int degrees = 0;
-        double minutes = 0;
-
-        if (std::sscanf(str.c_str(), "%03d%lf", &degrees, &minutes) != 2)
-          return false;
-
-        dst = Angles::convertDMSToDecimal(degrees, minutes);
-
-        if (h == "W")
-          dst = -dst;
-
-        return true;
-      }
-
-      //! Read decimal from input string.
-      //! @param[in] str input string.
-      //! @param[out] dst decimal.
-      //! @return true if successful, false otherwise.
-      template <typename T>
-      bool
-      readDecimal(const std::string& str, T& dst)
-      {
-        unsigned idx = 0;
-        while (str[idx] == '0')
-          ++idx;
-
-        return castLexical(std::string(str, idx), dst);
-      }
-
-      //! Read number from input string.
-      //! @param[in] str input string.
-      //! @param[out] dst number.
-      //! @return true if successful, false otherwise.
-      template <typename T>
-      bool
-      readNumber(const std::string& str, T& dst)
-      {
-        return castLexical(str, dst);
-      }
-
       //! Process sentence.
       //! @param[in] line line.
       void
       processSentence(const std::string& line)
       {
-        // Discard leading noise.
-        size_t sidx = 0;
-        for (sidx = 0; sidx < line.size(); ++sidx)
-        {
-          if (line[sidx] == '$')
-            break;
-        }
-
-        // Discard trailing noise.
-        size_t eidx = 0;
-        for (eidx = line.size() - 1; eidx > sidx; --eidx)
-        {
-          if (line[eidx] == '*')
-            break;
-        }
-
-        if (sidx >= eidx)
-          return;
-
-        // Compute checksum.
-        uint8_t ccsum = 0;
-        for (size_t i = sidx + 1; i < eidx; ++i)
-          ccsum ^= line[i];
-
-        // Validate checksum.
-        unsigned rcsum = 0;
-        if (std::sscanf(&line[0] + eidx + 1, "%02X", &rcsum) != 1)
+        Parsers::NMEATokenizer::Result rv = m_stn.parse(line);
+        if (rv == Parsers::NMEATokenizer::NMEA_NO_CHECKSUM)
         {
           trace("No checksum found, will not parse sentence.");
           return;
         }
 
-        if (ccsum != rcsum)
+        if (rv == Parsers::NMEATokenizer::NMEA_CHECKSUM_MISMATCH)
         {
           trace("Checksum field does not match computed checksum, will not "
                 "parse sentence.");
           return;
         }
 
-        // Split sentence
-        std::vector<std::string> parts;
-        String::split(line.substr(sidx + 1, eidx - sidx - 1), ",", parts);
+        if (rv != Parsers::NMEATokenizer::NMEA_OK)
+        {
+          trace("%s, will not parse sentence.", Parsers::NMEATokenizer::getResultString(rv));
+          return;
+        }
 
-        if (std::find(m_args.stn_order.begin(), m_args.stn_order.end(), parts[0]) != m_args.stn_order.end())
-          interpretSentence(parts);
+        for (size_t i = 0; i < m_args.stn_order.size(); ++i)
+        {
+          if (m_stn.isEqual(0, m_args.stn_order[i].c_str()))
+          {
+            interpretSentence();
+            return;
+          }
+        }
       }
 
-      //! Interpret given sentence.
-      //! @param[in] parts vector of strings from sentence.
+      //! Interpret last tokenized sentence.
       void
-      interpretSentence(std::vector<std::string>& parts)
+      interpretSentence(void)
       {
-        if (parts[0] == m_args.stn_order.front())
+        if (m_stn.isEqual(0, m_args.stn_order.front().c_str()))
         {
           clearMessages();
           m_fix.setTimeStamp();
@@ -472,42 +375,9 @@ namespace Sensors
           m_agvel.setTimeStamp(m_fix.getTimeStamp());
         }
 
-        if (hasNMEAMessageCode(parts[0], "ZDA"))
-        {
-          interpretZDA(parts);
-        }
-        else if (hasNMEAMessageCode(parts[0], "GGA"))
-        {
-          interpretGGA(parts);
-        }
-        else if (hasNMEAMessageCode(parts[0], "VTG"))
-        {
-          interpretVTG(parts);
-        }
-        else if (parts[0] == "PSAT")
-        {
-          if (parts[1] == "HPR")
-            interpretPSATHPR(parts);
-        }
-        else if (parts[0] == "PUBX")
-        {
-          if (parts[1] == "00")
-            interpretPUBX00(parts);
-        }
-        else if (hasNMEAMessageCode(parts[0], "HDM"))
-        {
-          interpretHDM(parts);
-        }
-        else if (hasNMEAMessageCode(parts[0], "HDT"))
-        {
-          interpretHDT(parts);
-        }
-        else if (hasNMEAMessageCode(parts[0], "ROT"))
-        {
-          interpretROT(parts);
-        }
+        m_handlers.dispatch(m_stn);
 
-        if (parts[0] == m_args.stn_order.back())
+        if (m_stn.isEqual(0, m_args.stn_order.back().c_str()))
         {
           m_wdog.reset();
           dispatch(m_fix);
@@ -538,49 +408,47 @@ namespace Sensors
         }
       }
 
-      bool
-      hasNMEAMessageCode(const std::string& str, const std::string& code)
-      {
-        return String::startsWith(str, "G") && String::endsWith(str, code);
-      }
-
       //! Interpret ZDA sentence (UTC date and time).
-      //! @param[in] parts vector of strings from sentence.
+      //! @param[in] stn sentence.
       void
-      interpretZDA(const std::vector<std::string>& parts)
+      interpretZDA(const Parsers::NMEATokenizer& stn)
       {
-        if (parts.size() < c_zda_fields)
+        if (stn.getFieldCount() < c_zda_fields)
         {
           war(DTR("invalid ZDA sentence"));
           return;
         }
 
         // Read time.
-        if (readTime(parts[1], m_fix.utc_time))
+        double time = 0;
+        if (stn.readTime(1, time))
+        {
+          m_fix.utc_time = time;
           m_fix.validity |= IMC::GpsFix::GFV_VALID_TIME;
+        }
 
         // Read date.
-        if (readDecimal(parts[2], m_fix.utc_day)
-            && readDecimal(parts[3], m_fix.utc_month)
-            && readDecimal(parts[4], m_fix.utc_year))
+        if (stn.readDecimal(2, m_fix.utc_day)
+            && stn.readDecimal(3, m_fix.utc_month)
+            && stn.readDecimal(4, m_fix.utc_year))
         {
           m_fix.validity |= IMC::GpsFix::GFV_VALID_DATE;
         }
       }
 
       //! Interpret GGA sentence (GPS fix data).
-      //! @param[in] parts vector of strings from sentence.
+      //! @param[in] stn sentence.
       void
-      interpretGGA(const std::vector<std::string>& parts)
+      interpretGGA(const Parsers::NMEATokenizer& stn)
       {
-        if (parts.size() < c_gga_fields)
+        if (stn.getFieldCount() < c_gga_fields)
         {
           war(DTR("invalid GGA sentence"));
           return;
         }
 
         int quality = 0;
-        readDecimal(parts[6], quality);
+        stn.readDecimal(6, quality);
         if (quality == 1)
         {
           m_fix.type = IMC::GpsFix::GFT_STANDALONE;
@@ -617,14 +485,14 @@ namespace Sensors
           }
         }
 
-        if (readLatitude(parts[2], parts[3], m_fix.lat)
-            && readLongitude(parts[4], parts[5], m_fix.lon)
-            && readNumber(parts[9], m_fix.height)
-            && readDecimal(parts[7], m_fix.satellites))
+        if (stn.readLatitude(2, m_fix.lat)
+            && stn.readLongitude(4, m_fix.lon)
+            && stn.readNumber(9, m_fix.height)
+            && stn.readDecimal(7, m_fix.satellites))
         {
           // Convert altitude above sea level to altitude above ellipsoid.
           double geoid_sep = 0;
-          if (readNumber(parts[11], geoid_sep))
+          if (stn.readNumber(11, geoid_sep))
             m_fix.height += geoid_sep;
 
           // Convert coordinates to radians.
@@ -637,36 +505,39 @@ namespace Sensors
           m_fix.validity &= ~IMC::GpsFix::GFV_VALID_POS;
         }
 
-        if (readNumber(parts[8], m_fix.hdop))
+        if (stn.readNumber(8, m_fix.hdop))
           m_fix.validity |= IMC::GpsFix::GFV_VALID_HDOP;
       }
 
-      //! Interpret PUBX00 sentence (navstar position).
-      //! @param[in] parts vector of strings from sentence.
+      //! Interpret PUBX sentences (only PUBX,00 navstar position).
+      //! @param[in] stn sentence.
       void
-      interpretPUBX00(const std::vector<std::string>& parts)
+      interpretPUBX(const Parsers::NMEATokenizer& stn)
       {
-        if (parts.size() < c_pubx00_fields)
+        if (!stn.isEqual(1, "00"))
+          return;
+
+        if (stn.getFieldCount() < c_pubx00_fields)
         {
           war(DTR("invalid PUBX,00 sentence"));
           return;
         }
 
-        if (parts[8] == "G3" || parts[8] == "G2")
+        if (stn.isEqual(8, "G3") || stn.isEqual(8, "G2"))
         {
           m_fix.type = IMC::GpsFix::GFT_STANDALONE;
           m_fix.validity |= IMC::GpsFix::GFV_VALID_POS;
         }
-        else if (parts[8] == "D3" || parts[8] == "D2")
+        else if (stn.isEqual(8, "D3") || stn.isEqual(8, "D2"))
         {
           m_fix.type = IMC::GpsFix::GFT_DIFFERENTIAL;
           m_fix.validity |= IMC::GpsFix::GFV_VALID_POS;
         }
 
-        if (readLatitude(parts[3], parts[4], m_fix.lat)
-            && readLongitude(parts[5], parts[6], m_fix.lon)
-            && readNumber(parts[7], m_fix.height)
-            && readDecimal(parts[18], m_fix.satellites))
+        if (stn.readLatitude(3, m_fix.lat)
+            && stn.readLongitude(5, m_fix.lon)
+            && stn.readNumber(7, m_fix.height)
+            && stn.readDecimal(18, m_fix.satellites))
         {
           // Convert coordinates to radians.
           m_fix.lat = Angles::radians(m_fix.lat);
@@ -678,71 +549,71 @@ namespace Sensors
           m_fix.validity &= ~IMC::GpsFix::GFV_VALID_POS;
         }
 
-        if (readNumber(parts[9], m_fix.hacc))
+        if (stn.readNumber(9, m_fix.hacc))
           m_fix.validity |= IMC::GpsFix::GFV_VALID_HACC;
 
-        if (readNumber(parts[10], m_fix.vacc))
+        if (stn.readNumber(10, m_fix.vacc))
           m_fix.validity |= IMC::GpsFix::GFV_VALID_VACC;
 
-        if (readNumber(parts[15], m_fix.hdop))
+        if (stn.readNumber(15, m_fix.hdop))
           m_fix.validity |= IMC::GpsFix::GFV_VALID_HDOP;
 
-        if (readNumber(parts[16], m_fix.vdop))
+        if (stn.readNumber(16, m_fix.vdop))
           m_fix.validity |= IMC::GpsFix::GFV_VALID_VDOP;
       }
 
       //! Interpret VTG sentence (course over ground).
-      //! @param[in] parts vector of strings from sentence.
+      //! @param[in] stn sentence.
       void
-      interpretVTG(const std::vector<std::string>& parts)
+      interpretVTG(const Parsers::NMEATokenizer& stn)
       {
-        if (parts.size() < c_vtg_fields)
+        if (stn.getFieldCount() < c_vtg_fields)
         {
           war(DTR("invalid VTG sentence"));
           return;
         }
 
-        if (readNumber(parts[1], m_fix.cog))
+        if (stn.readNumber(1, m_fix.cog))
         {
           m_fix.cog = Angles::normalizeRadian(Angles::radians(m_fix.cog));
           m_fix.validity |= IMC::GpsFix::GFV_VALID_COG;
         }
 
-        if (readNumber(parts[7], m_fix.sog))
+        if (stn.readNumber(7, m_fix.sog))
         {
           m_fix.sog *= 1000.0f / 3600.0f;
           m_fix.validity |= IMC::GpsFix::GFV_VALID_SOG;
         }
       }
 
-      //! Interpret VTG sentence (true heading).
-      //! @param[in] parts vector of strings from sentence.
+      //! Interpret HDT sentence (true heading).
+      //! @param[in] stn sentence.
       void
-      interpretHDT(const std::vector<std::string>& parts)
+      interpretHDT(const Parsers::NMEATokenizer& stn)
       {
-        if (parts.size() < c_hdt_fields)
+        if (stn.getFieldCount() < c_hdt_fields)
         {
           war(DTR("invalid HDT sentence"));
           return;
         }
 
-        if (readNumber(parts[1], m_euler.psi))
+        if (stn.readNumber(1, m_euler.psi))
           m_euler.psi = Angles::normalizeRadian(Angles::radians(m_euler.psi));
       }
 
       //! Interpret HDM sentence (Magnetic heading of
       //! the vessel derived from the true heading calculated).
-      //! @param[in] parts vector of strings from sentence.
+      //! @param[in] stn sentence.
       void
-      interpretHDM(const std::vector<std::string>& parts)
+      interpretHDM(const Parsers::NMEATokenizer& stn)
       {
-        if (parts.size() < c_hdm_fields)
+        if (stn.getFieldCount() < c_hdm_fields)
         {
           war(DTR("invalid HDM sentence"));
           return;
         }
 
-        if (readNumber(parts[1], m_euler.psi_magnetic))
+        if (stn.readNumber(1, m_euler.psi_magnetic))
         {
           m_euler.psi_magnetic = Angles::normalizeRadian(Angles::radians(m_euler.psi_magnetic));
           m_has_euler = true;
@@ -750,42 +621,46 @@ namespace Sensors
       }
 
       //! Interpret ROT sentence (rate of turn).
-      //! @param[in] parts vector of strings from sentence.
+      //! @param[in] stn sentence.
       void
-      interpretROT(const std::vector<std::string>& parts)
+      interpretROT(const Parsers::NMEATokenizer& stn)
       {
-        if (parts.size() < c_rot_fields)
+        if (stn.getFieldCount() < c_rot_fields)
         {
           war(DTR("invalid ROT sentence"));
           return;
         }
 
-        if (readNumber(parts[1], m_agvel.z))
+        if (stn.readNumber(1, m_agvel.z))
         {
           m_agvel.z = Angles::radians(m_agvel.z) / 60.0;
           m_has_agvel = true;
         }
       }
 
-      //! Interpret PSATHPR sentence (Proprietary NMEA message that
-      //! provides the heading, pitch, roll, and time in a single message).
-      //! @param[in] parts vector of strings from sentence.
+      //! Interpret PSAT sentences (only PSAT,HPR, a proprietary NMEA
+      //! message that provides the heading, pitch, roll, and time in
+      //! a single message).
+      //! @param[in] stn sentence.
       void
-      interpretPSATHPR(const std::vector<std::string>& parts)
+      interpretPSAT(const Parsers::NMEATokenizer& stn)
       {
-        if (parts.size() < c_psathpr_fields)
+        if (!stn.isEqual(1, "HPR"))
+          return;
+
+        if (stn.getFieldCount() < c_psathpr_fields)
         {
           war(DTR("invalid PSATHPR sentence"));
           return;
         }
 
-        if (readNumber(parts[4], m_euler.theta))
+        if (stn.readNumber(4, m_euler.theta))
         {
           m_euler.theta = Angles::normalizeRadian(Angles::radians(m_euler.theta));
           m_has_euler = true;
         }
 
-        if (readNumber(parts[5], m_euler.phi))
+        if (stn.readNumber(5, m_euler.phi))
         {
           m_euler.phi = Angles::normalizeRadian(Angles::radians(m_euler.phi));
           m_has_euler = true;
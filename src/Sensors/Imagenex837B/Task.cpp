@@ -80,6 +80,10 @@ namespace Sensors
   //!  - <em>Nadir Offset Angle</em>: When using Automatic Gain Control,
   //!    the sonar head must know if there is a physical mounting offset
   //!    and/or a roll angle present.
+  //!  - <em>Bulk Data Ring Size</em>: When non-zero, sonar payloads
+  //!    are stored in a shared memory ring of this size and SonarData
+  //!    messages carry only a handle to them (see
+  //!    DUNE::Concurrency::BulkRing).
   //!
   //! This driver will output raw data from the sonar for each measurement.
   //!
@@ -160,6 +164,8 @@ namespace Sensors
       std::string file_name;
       //! Number of seconds without data before reporting an error.
       double timeout_error;
+      //! Size of the bulk data ring.
+      unsigned bulk_ring_size;
     };
 
     //! List of available ranges.
@@ -200,6 +206,10 @@ namespace Sensors
       IMC::SonarData* m_data;
       //! External Control frame.
       ExternalControl* m_ec;
+      //! Bulk data ring.
+      BulkRing* m_ring;
+      //! Sonar payload while its handle is being dispatched.
+      std::vector<char> m_payload;
       //! Output switch data.
       uint8_t m_sdata[c_sdata_size];
       //! Header Return data.
@@ -227,7 +237,8 @@ namespace Sensors
         m_frame837(NULL),
         m_frame83P(NULL),
         m_data(NULL),
-        m_ec(NULL)
+        m_ec(NULL),
+        m_ring(NULL)
       {
         // Define configuration parameters.
         paramActive(Tasks::Parameter::SCOPE_MANEUVER,
@@ -355,6 +366,12 @@ namespace Sensors
         .units(Units::Second)
         .description("Number of seconds without data before reporting an error");
 
+        param("Bulk Data Ring Size", m_args.bulk_ring_size)
+        .defaultValue("0")
+        .units(Units::Kibibyte)
+        .description("Size of the shared memory ring used to pass sonar data"
+                     " to other tasks, zero to send data inline");
+
         // Initialize switch data.
         std::memset(m_sdata, 0, sizeof(m_sdata));
         m_sdata[0] = 0xfe;
@@ -499,6 +516,12 @@ namespace Sensors
       }
 
 
+      //! Destructor.
+      ~Task(void)
+      {
+        Memory::clear(m_ring);
+      }
+
       //! Try to connect to the device.
       //! @return true if connection was established, false otherwise.
       bool
@@ -506,6 +529,12 @@ namespace Sensors
       {
         onUpdateParameters();
 
+        if (m_ring == NULL && m_args.bulk_ring_size > 0)
+        {
+          std::string name = String::str("bulk-%s-%s", getSystemName(), getName());
+          m_ring = new BulkRing(name.c_str(), m_args.bulk_ring_size * 1024);
+        }
+
         try
         {
           if (m_ec == NULL)
@@ -973,11 +1002,29 @@ namespace Sensors
           writeToFile();
 
         if (m_data != NULL)
-          dispatch(m_data);
+          dispatchSonarData();
 
         m_wdog.reset();
       }
 
+      //! Dispatch sonar data. If the bulk data ring is enabled the
+      //! payload is stored in the ring and only its handle is sent.
+      void
+      dispatchSonarData(void)
+      {
+        BulkRing::Handle handle;
+        if (m_ring == NULL || !m_ring->write(&m_data->data[0], m_data->data.size(), handle))
+        {
+          dispatch(m_data);
+          return;
+        }
+
+        m_payload.swap(m_data->data);
+        BulkRing::encode(handle, m_data->data);
+        dispatch(m_data);
+        m_data->data.swap(m_payload);
+      }
+
       //! Check sonar range.
       void
       checkRange(void)
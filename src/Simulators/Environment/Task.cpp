@@ -33,9 +33,7 @@
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
-
-// Local headers.
-#include "QuadTree.hpp"
+#include <DUNE/Simulation/BathymetryGrid.hpp>
 
 namespace Simulators
 {
@@ -49,9 +47,6 @@ namespace Simulators
     using std::sin;
     using std::cos;
 
-    //! Number of points in the forward direction for bottom intersection
-    static const unsigned c_forward_points = 10;
-
     class PencilBeam
     {
     public:
@@ -143,6 +138,8 @@ namespace Simulators
       double oob_depth;
       //! Interpolation radius.
       double interp_radius;
+      //! Bathymetry grid resolution.
+      double grid_resolution;
       // Forward distance arguments
       //! Standard deviation of the forward distance estimates
       double fd_std_dev;
@@ -195,10 +192,8 @@ namespace Simulators
       double m_a_n, m_a_e, m_b_n, m_b_e;
       //! PRNG handle.
       Random::Generator* m_prng;
-      //! The tree.
-      QuadTree* m_qtree;
-      //! Reference latitude and longitude for data points.
-      double m_ref_lat, m_ref_lon;
+      //! Bathymetry grid.
+      DUNE::Simulation::BathymetryGrid* m_grid;
       //! NE offsets in regard to navigational reference.
       double m_off_n, m_off_e;
       //! Pencil beam object
@@ -209,7 +204,7 @@ namespace Simulators
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Periodic(name, ctx),
         m_prng(NULL),
-        m_qtree(NULL),
+        m_grid(NULL),
         m_pb(NULL)
       {
         param("Simulate - Bottom Distance", m_args.simulate_bd)
@@ -248,7 +243,17 @@ namespace Simulators
 
         param("Interpolation Radius", m_args.interp_radius)
         .units(Units::Meter)
-        .defaultValue("10.0");
+        .defaultValue("10.0")
+        .description("Maximum distance to a bathymetry sample for a grid"
+                     " node to be considered valid");
+
+        param("Grid Resolution", m_args.grid_resolution)
+        .units(Units::Meter)
+        .defaultValue("2.0")
+        .minimumValue("0.1")
+        .description("Cell size of the bathymetry grid built from"
+                     " scattered samples. Ignored when a binary grid"
+                     " file is available");
 
         param("Simulate Pier", m_args.simulate_pier)
         .defaultValue("false")
@@ -354,7 +359,7 @@ namespace Simulators
       onResourceRelease(void)
       {
         Memory::clear(m_prng);
-        Memory::clear(m_qtree);
+        Memory::clear(m_grid);
         Memory::clear(m_pb);
       }
 
@@ -401,50 +406,38 @@ namespace Simulators
       onResourceInitialization(void)
       {
         Utils::String::toLowerCase(m_args.location);
-        Path path = m_ctx.dir_cfg / "simulation" / ("bathymetry-" + m_args.location + ".ini");
-        DUNE::Parsers::Config cfg(path.c_str());
-        std::vector<std::string> lines;
-        cfg.get("Bathymetry", "Data", "", lines);
-        cfg.get("Bathymetry", "Latitude (degrees)", "", m_ref_lat);
-        cfg.get("Bathymetry", "Longitude (degrees)", "", m_ref_lon);
+        Path base = m_ctx.dir_cfg / "simulation" / ("bathymetry-" + m_args.location);
+        Path grid = base.str() + DUNE::Simulation::BathymetryGrid::c_extension;
 
-        debug("%s | %0.6f, %0.6f", m_args.location.c_str(), m_ref_lat, m_ref_lon);
-        debug("%s | %s", m_args.location.c_str(), path.c_str());
-        debug("%s | %lu %s", m_args.location.c_str(), (long unsigned int)lines.size(), "bathymetry values");
-
-        m_ref_lat = Angles::radians(m_ref_lat);
-        m_ref_lon = Angles::radians(m_ref_lon);
-
-        std::vector<QuadTree::Item> data;
-        QuadTree::Item item;
-        Bounds* bounds = 0;
-
-        for (unsigned i = 0; i < lines.size(); ++i)
+        if (grid.isFile())
         {
-          std::vector<double> v;
-          DUNE::Utils::String::split(lines[i], " ", v);
-          if (!bounds)
-            bounds = new Bounds(Point(v[0], v[1]));
-          else
-            bounds->cover(Point(v[0], v[1]));
-          item.x = v[0]; item.y = v[1]; item.value = v[2];
-          data.push_back(item);
+          debug("%s | %s", m_args.location.c_str(), grid.c_str());
+          m_grid = new DUNE::Simulation::BathymetryGrid(grid.str());
         }
+        else
+        {
+          Path path = base.str() + ".ini";
+          debug("%s | %s", m_args.location.c_str(), path.c_str());
 
-        std::stringstream ss;
-        ss << *bounds;
-        trace("bounds: %s", ss.str().c_str());
+          double lat = 0;
+          double lon = 0;
+          std::vector<DUNE::Simulation::BathymetryGrid::Sample> samples;
+          DUNE::Simulation::BathymetryGrid::readConfig(path.str(), lat, lon, samples);
 
-        // Fill the tree
-        m_qtree = new QuadTree(*bounds);
-        delete bounds;
+          debug("%s | %lu %s", m_args.location.c_str(),
+                (long unsigned int)samples.size(), "bathymetry values");
 
-        for (unsigned i = 0; i < data.size(); ++i)
-          m_qtree->insert(data[i]);
+          m_grid = new DUNE::Simulation::BathymetryGrid(lat, lon, samples,
+                                                        m_args.grid_resolution,
+                                                        m_args.interp_radius);
+        }
 
-        ss.clear();
-        ss << *m_qtree;
-        trace("tree elements: %s", ss.str().c_str());
+        debug("%s | %0.6f, %0.6f | %u x %u nodes, %0.2f m",
+              m_args.location.c_str(),
+              Angles::degrees(m_grid->getLatitude()),
+              Angles::degrees(m_grid->getLongitude()),
+              m_grid->getRows(), m_grid->getColumns(),
+              m_grid->getResolution());
 
         m_bd.beam_config.clear();
         m_bd.location.clear();
@@ -499,8 +492,8 @@ namespace Simulators
           return;
 
         // Get offsets for bathymetry
-        WGS84::displacement(m_ref_lat, m_ref_lon, 0, msg->lat, msg->lon, 0,
-                            &m_off_n, &m_off_e);
+        WGS84::displacement(m_grid->getLatitude(), m_grid->getLongitude(), 0,
+                            msg->lat, msg->lon, 0, &m_off_n, &m_off_e);
 
         trace("offsets to navigational reference | %0.2f %0.2f", m_off_n, m_off_e);
 
@@ -561,35 +554,14 @@ namespace Simulators
       double
       depthAt(double x, double y)
       {
-        Point p(x, y);
-        Bounds search_area(p, m_args.interp_radius);
-
-        std::vector<QuadTree::Item> items;
+        double depth = 0.0;
 
-        m_qtree->search(search_area, items);
-
-        if (items.size() == 0)
+        if (!m_grid->depth(x, y, depth))
         {
           trace("out of bounds");
           return m_args.oob_depth;
         }
 
-        trace("found %lu close data values", (long unsigned int)items.size());
-
-        // @todo interpolate rather than picking closest one
-        double dmin = p.distance(Point(items[0].x, items[0].y));
-        double depth = items[0].value;
-
-        for (unsigned int i = 1; i < items.size(); ++i)
-        {
-          double d = p.distance(Point(items[i].x, items[i].y));
-          if (d < dmin)
-          {
-            dmin = d;
-            depth = items[i].value;
-          }
-        }
-
         return depth + m_args.tide;
       }
 
@@ -615,7 +587,7 @@ namespace Simulators
           psi_offset = m_pb->update();
         }
 
-        m_fd.value = forwardRange(0.0) + error;
+        m_fd.value = forwardRange(psi_offset) + error;
         m_fd.value = trimValue(m_fd.value, m_args.min_range, m_args.max_range);
         m_fd.validity = IMC::Distance::DV_VALID;
         const IMC::DeviceState* ds = *m_fd.location.begin();
@@ -651,7 +623,7 @@ namespace Simulators
 
           if (m_args.intersect_method)
           {
-            range = std::min(range, bottomIntersection());
+            range = std::min(range, bottomIntersection(psi_offset));
           }
           else
           {
@@ -699,57 +671,23 @@ namespace Simulators
         return range;
       }
 
-      //! Compute the depths of c_forward_points in front of the vehicle
-      //! Use connections between these points as line segments
-      //! and intersect them with lower beam part of the echo sounder.
+      //! March the lower edge of the forward beam through the
+      //! bathymetry grid until it crosses the bottom.
+      //! @param[in] psi_offset heading offset of the beam.
       //! @return range after intersection
       double
-      bottomIntersection(void)
+      bottomIntersection(double psi_offset)
       {
-        double intersect_range = m_args.max_range;
-
-        double x_step = m_args.max_range / (double)c_forward_points;
-
-        std::vector<float> fwd_depths(c_forward_points);
-
-        fwd_depths[0] = depthAt(m_sstate.x + m_off_n, m_sstate.y + m_off_e);
-
-        // x and z coordinates of the end of the forward beam
-        double x_target, z_target;
-
-        x_target = m_args.max_range * cos(m_sstate.theta - m_args.forward_width / 2.0);
-        z_target = - m_args.max_range * sin(m_sstate.theta - m_args.forward_width / 2.0);
-        z_target += m_sstate.z; // SHOULD NOT BE Z BUT DEPTH
-
-        for (unsigned i = 1; i < c_forward_points; i++)
-        {
-          double xe = (double)i * x_step * cos(m_sstate.psi);
-          double ye = (double)i * x_step * sin(m_sstate.psi);
-
-          fwd_depths[i] = depthAt(m_sstate.x + m_off_n + xe, m_sstate.y + m_off_e + ye);
-
-          double bottom_x_1 = (double)(i - 1) * x_step;
-          double bottom_z_1 = fwd_depths[i - 1];
-
-          double bottom_x_2 = (double)i * x_step;
-          double bottom_z_2 = fwd_depths[i];
-
-          double x, z;
+        double range = m_args.max_range;
 
-          bool test_int = lineSegmentIntersect(LineSegParam<double>(0.0, m_sstate.z,
-                                                                    x_target, z_target,
-                                                                    bottom_x_1, bottom_z_1,
-                                                                    bottom_x_2, bottom_z_2),
-                                               &x, &z); // SHOULD NOT BE STATE.Z BUT DEPTH
+        if (!m_grid->intersect(m_sstate.x + m_off_n, m_sstate.y + m_off_e,
+                               m_sstate.z - m_args.tide,
+                               m_sstate.psi + psi_offset,
+                               m_sstate.theta - m_args.forward_width / 2.0,
+                               m_args.max_range, range))
+          return m_args.max_range;
 
-          if (test_int)
-          {
-            intersect_range = Math::norm(x, z - m_sstate.z); // SHOULD NOT BE Z BUT DEPTH
-            break;
-          }
-        }
-
-        return intersect_range;
+        return range;
       }
     };
   }
@@ -27,6 +27,8 @@
 // Author: Miguel Aguiar                                                    *
 //***************************************************************************
 
+#include <algorithm>
+
 #include "DUNE/Coordinates.hpp"
 #include "DUNE/I18N.hpp"
 
@@ -38,104 +40,107 @@ namespace Simulators
   {
     namespace StreamGenerator
     {
-      Gridded2DModelDataStreamGenerator::Gridded2DModelDataStreamGenerator(
+      template<size_t dim>
+      GriddedModelDataStreamGenerator<dim>::GriddedModelDataStreamGenerator(
           GriddedModelDataConfig const& config,
           double wx,
           double wy,
           double wz)
           : StreamGenerator(wx, wy, wz),
             m_file(config.filename),
-            m_u(0),
-            m_v(0),
             m_grid(m_file.getAttribute<double>(config.grid_path, "min"),
                    m_file.getAttribute<double>(config.grid_path, "max"),
-                   m_file.getAttribute<size_t>(config.grid_path, "npts"))
+                   m_file.getAttribute<size_t>(config.grid_path, "npts")),
+            m_u(m_grid,
+                tileShape(config.tile_size),
+                config.cache_budget,
+                loader(config.u_data_path)),
+            m_v(m_grid,
+                tileShape(config.tile_size),
+                config.cache_budget,
+                loader(config.v_data_path))
       {
-        auto data_u = m_file.getDataset<double>(config.u_data_path);
-        auto data_v = m_file.getDataset<double>(config.v_data_path);
+        auto dimensions_u = m_file.getDimensions(config.u_data_path);
+        auto dimensions_v = m_file.getDimensions(config.v_data_path);
 
-        if (data_u.dimensions != data_v.dimensions)
+        if (dimensions_u != dimensions_v)
           throw std::runtime_error(
-              DTR("Gridded2DModelDataStreamGenerator::"
-                  "Gridded2DModelDataStreamGenerator(): dimensions of velocity "
+              DTR("GriddedModelDataStreamGenerator::"
+                  "GriddedModelDataStreamGenerator(): dimensions of velocity "
                   "components do not match."));
 
-        if (data_u.dimensions.size() != 3)
-          throw std::runtime_error(
-              DTR("Gridded2DModelDataStreamGenerator::"
-                  "Gridded2DModelDataStreamGenerator(): data must be "
-                  "three-dimensional (2D space + time)."));
-
-        if (m_grid.getDimensions(0) != data_u.dimensions[0] ||
-            m_grid.getDimensions(1) != data_u.dimensions[1] ||
-            m_grid.getDimensions(2) != data_u.dimensions[2])
+        if (dimensions_u.size() != dim)
           throw std::runtime_error(
-              DTR("Gridded2DModelDataStreamGenerator::"
-                  "Gridded2DModelDataStreamGenerator(): data dimensions do not "
-                  "match grid dimensions."));
+              DTR("GriddedModelDataStreamGenerator::"
+                  "GriddedModelDataStreamGenerator(): data dimensionality does "
+                  "not match the model type."));
+
+        for (size_t i = 0; i < dim; ++i)
+        {
+          if (m_grid.getDimensions(i) != dimensions_u[i])
+            throw std::runtime_error(
+                DTR("GriddedModelDataStreamGenerator::"
+                    "GriddedModelDataStreamGenerator(): data dimensions do not "
+                    "match grid dimensions."));
+        }
+      }
 
-        m_u = std::move(data_u.data);
-        m_v = std::move(data_v.data);
+      template<size_t dim>
+      typename DUNE::Math::TiledGridData<dim>::Loader
+      GriddedModelDataStreamGenerator<dim>::loader(std::string const& path)
+      {
+        return [this, path](std::array<size_t, dim> const& first,
+                            std::array<size_t, dim> const& count,
+                            std::vector<double>& data) {
+          data = m_file.getHyperslab<double>(
+              path,
+              std::vector<size_t>(std::begin(first), std::end(first)),
+              std::vector<size_t>(std::begin(count), std::end(count)));
+        };
       }
 
-      inline double
-      interpolateLinear2d(double* values, double* delta)
+      template<size_t dim>
+      std::array<size_t, dim>
+      GriddedModelDataStreamGenerator<dim>::tileShape(size_t tile_size)
       {
-        return (1 - delta[0]) * (1 - delta[1]) * values[0] +
-               delta[0] * (1 - delta[1]) * values[1] +
-               delta[0] * delta[1] * values[2] +
-               (1 - delta[0]) * delta[1] * values[3];
+        // Horizontal dimensions are tiled with the configured size. Depth and
+        // time are tiled in pairs, which is enough to interpolate between
+        // consecutive levels and instants.
+        std::array<size_t, dim> shape;
+        shape.fill(2);
+        shape[0] = std::max<size_t>(tile_size, 2);
+        shape[1] = std::max<size_t>(tile_size, 2);
+        return shape;
       }
 
+      template<size_t dim>
       std::array<double, 3>
-      Gridded2DModelDataStreamGenerator::getVelocity(double lat,
-                                                     double lon,
-                                                     double,
-                                                     double time) const
+      GriddedModelDataStreamGenerator<dim>::getVelocity(double lat,
+                                                        double lon,
+                                                        double depth,
+                                                        double time) const
       {
-        // Find closest grid cell
-        auto corner_indices =
-            m_grid.getCorner({lat, lon, time + m_grid.getLower(2)});
-
-        // If vehicles is outside the grid, fall back to default stream velocity
-        for (auto i = 0; i < 3; ++i)
-          if (corner_indices[i] >= m_grid.getDimensions(i))
-            return getDefaultVelocity();
-
-        auto corner_point = m_grid.getCoordinates(corner_indices);
-
-        double delta[2] = {(lat - corner_point[0]) / m_grid.getSpacing(0),
-                           (lon - corner_point[1]) / m_grid.getSpacing(1)};
-
-        double u_values[4];
-        double v_values[4];
+        std::array<double, dim> point;
+        point[0] = lat;
+        point[1] = lon;
+        if (dim == 4)
+          point[2] = depth;
+        point[dim - 1] = time + m_grid.getLower(dim - 1);
 
         // Interpolate data to the current vehicle position and current time.
-        // This scheme uses nearest-neighbor interpolation in time and linear
-        // interpolation for the position.
-        // TODO Allow configurable interpolation schemes.
-
-        auto gridpoint = corner_indices;
-        u_values[0] = m_u[m_grid.getOffset(gridpoint)];
-        v_values[0] = m_v[m_grid.getOffset(gridpoint)];
-
-        gridpoint[0] += 1;
-        u_values[1] = m_u[m_grid.getOffset(gridpoint)];
-        v_values[1] = m_v[m_grid.getOffset(gridpoint)];
+        // If vehicle is outside the grid, fall back to default stream
+        // velocity.
+        double u_val = 0.0;
+        double v_val = 0.0;
 
-        gridpoint[1] += 1;
-        u_values[2] = m_u[m_grid.getOffset(gridpoint)];
-        v_values[2] = m_v[m_grid.getOffset(gridpoint)];
-
-        gridpoint[0] -= 1;
-        u_values[3] = m_u[m_grid.getOffset(gridpoint)];
-        v_values[3] = m_v[m_grid.getOffset(gridpoint)];
-
-        auto u_val = interpolateLinear2d(u_values, delta);
-        auto v_val = interpolateLinear2d(v_values, delta);
+        if (!m_u.interpolate(point, u_val) || !m_v.interpolate(point, v_val))
+          return getDefaultVelocity();
 
         return {v_val, u_val, 0.0};
       }
+
+      template class GriddedModelDataStreamGenerator<3>;
+      template class GriddedModelDataStreamGenerator<4>;
     }    // namespace StreamGenerator
   }      // namespace StreamVelocity
 }    // namespace Simulators
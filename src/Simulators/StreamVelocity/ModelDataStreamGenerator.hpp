@@ -35,6 +35,7 @@
 
 #include "DUNE/Parsers/HDF5Reader.hpp"
 #include "DUNE/Math/Grid.hpp"
+#include "DUNE/Math/TiledGridData.hpp"
 
 #include "StreamGenerator.hpp"
 
@@ -64,13 +65,27 @@ namespace Simulators
       {
         //! Path to the node in the file containing the grid parameters.
         std::string grid_path;
+        //! Maximum amount of memory used to hold the velocity values of
+        //! each component (bytes).
+        size_t cache_budget;
+        //! Number of gridpoints of a tile along each horizontal dimension.
+        size_t tile_size;
       };
 
-      //! Get stream velocity values from 2D (horizontal velocities) model data
-      //! on a cartesian grid.
-      //! Uses the HDF5 format to load the stream values.
-      class Gridded2DModelDataStreamGenerator : public StreamGenerator
+      //! Get stream velocity values from model data on a cartesian grid.
+      //! Uses the HDF5 format to load the stream values. The data is read
+      //! from the file in tiles, as needed, and only the most recently used
+      //! tiles are kept in memory.
+      //! @tparam dim number of dimensions of the data: 3 for 2D (horizontal)
+      //! velocities, given as (Lat, Lon, Time), or 4 for 3D velocities,
+      //! given as (Lat, Lon, Depth, Time).
+      template<size_t dim>
+      class GriddedModelDataStreamGenerator : public StreamGenerator
       {
+        static_assert(dim == 3 || dim == 4,
+                      "GriddedModelDataStreamGenerator: data must be "
+                      "three or four-dimensional.");
+
       public:
         //! Constructor.
         //! @param[in] config structure containing the configuration parameters
@@ -78,12 +93,12 @@ namespace Simulators
         //! @param[in] wx default stream speed in the North direction (m/s).
         //! @param[in] wy default stream speed in the East direction (m/s).
         //! @param[in] wz default stream speed in the Down direction (m/s).
-        Gridded2DModelDataStreamGenerator(GriddedModelDataConfig const& config,
-                                          double wx = 0.0,
-                                          double wy = 0.0,
-                                          double wz = 0.0);
+        GriddedModelDataStreamGenerator(GriddedModelDataConfig const& config,
+                                        double wx = 0.0,
+                                        double wy = 0.0,
+                                        double wz = 0.0);
 
-        ~Gridded2DModelDataStreamGenerator() = default;
+        ~GriddedModelDataStreamGenerator() = default;
 
         virtual std::array<double, 3>
         getVelocity(double lat,
@@ -91,15 +106,48 @@ namespace Simulators
                     double depth,
                     double time = 0.0) const override;
 
+        //! @return cache statistics of the velocity in the East direction.
+        typename DUNE::Math::TiledGridData<dim>::Statistics const&
+        getStatisticsU() const
+        {
+          return m_u.getStatistics();
+        }
+
+        //! @return cache statistics of the velocity in the North direction.
+        typename DUNE::Math::TiledGridData<dim>::Statistics const&
+        getStatisticsV() const
+        {
+          return m_v.getStatistics();
+        }
+
       private:
         DUNE::Parsers::HDF5Reader m_file;
+        //! Converts between grid indices and datapoint indices.
+        DUNE::Math::Grid<dim> m_grid;
         //! Velocity in the East direction.
-        std::vector<double> m_u;
+        mutable DUNE::Math::TiledGridData<dim> m_u;
         //! Velocity in the North direction.
-        std::vector<double> m_v;
-        //! Converts between grid indices and datapoint indices.
-        DUNE::Math::Grid<3> m_grid;
+        mutable DUNE::Math::TiledGridData<dim> m_v;
+
+        //! Create a tile loader for a dataset.
+        //! @param[in] path path to the dataset in the file.
+        //! @return tile loader.
+        typename DUNE::Math::TiledGridData<dim>::Loader
+        loader(std::string const& path);
+
+        //! Compute the shape of the tiles.
+        //! @param[in] tile_size number of gridpoints of a tile along each
+        //! horizontal dimension.
+        //! @return number of gridpoints of a tile along each dimension.
+        static std::array<size_t, dim>
+        tileShape(size_t tile_size);
       };
+
+      //! Stream velocity from 2D (horizontal velocities) model data.
+      using Gridded2DModelDataStreamGenerator = GriddedModelDataStreamGenerator<3>;
+      //! Stream velocity from 3D (horizontal velocities at several depths)
+      //! model data.
+      using Gridded3DModelDataStreamGenerator = GriddedModelDataStreamGenerator<4>;
     }    // namespace StreamGenerator
   }      // namespace StreamVelocity
 }    // namespace Simulators
@@ -53,15 +53,18 @@ namespace Simulators
         if (config.type == "Constant")
           return std::make_unique<StreamGenerator>(
               config.default_wx, config.default_wy, config.default_wz);
-        if (config.type == "Gridded 2D Model Data")
+        if (config.type == "Gridded 2D Model Data" ||
+            config.type == "Gridded 3D Model Data")
         {
           GriddedModelDataConfig mdcfg;
           mdcfg.filename = config.filename;
           // Path to the dataset in the file containing the velocity values in
-          // the East direction, given in m/s as u = u(Lat, Lon, Time).
+          // the East direction, given in m/s as u = u(Lat, Lon, Time) or
+          // u = u(Lat, Lon, Depth, Time).
           mdcfg.u_data_path = "u";
           // Path to the dataset in the file containing the velocity values in
-          // the North direction, given in m/s as v = v(Lat, Lon, Time).
+          // the North direction, given in m/s as v = v(Lat, Lon, Time) or
+          // v = v(Lat, Lon, Depth, Time).
           mdcfg.v_data_path = "v";
           //! Path to the node in the file containing the grid data.
           //! This node should include the following child nodes:
@@ -69,8 +72,15 @@ namespace Simulators
           //!   max - array with the upper grid limits.
           //!   npts - array with the number of points in each dimension.
           mdcfg.grid_path = "grid";
+          // Memory budget is shared by both velocity components.
+          mdcfg.cache_budget = config.cache_size * 1024 * 1024 / 2;
+          mdcfg.tile_size = config.tile_size;
 
-          return std::make_unique<Gridded2DModelDataStreamGenerator>(
+          if (config.type == "Gridded 2D Model Data")
+            return std::make_unique<Gridded2DModelDataStreamGenerator>(
+                mdcfg, config.default_wx, config.default_wy, config.default_wz);
+
+          return std::make_unique<Gridded3DModelDataStreamGenerator>(
               mdcfg, config.default_wx, config.default_wy, config.default_wz);
         }
         else
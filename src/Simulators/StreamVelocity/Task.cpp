@@ -67,6 +67,12 @@ namespace Simulators
       //! Path to file containing the data.
       std::string filename;
 
+      //! Maximum amount of memory used to hold model data (MiB).
+      unsigned cache_size;
+      //! Number of gridpoints of a tile of model data along each horizontal
+      //! dimension.
+      unsigned tile_size;
+
       //! Advance the simulation by some time, if using forecasted data.
       struct
       {
@@ -100,6 +106,7 @@ namespace Simulators
 
         param("Stream Velocity Source", m_args.type)
             .defaultValue("Constant")
+            .values("Constant, Gridded 2D Model Data, Gridded 3D Model Data")
             .description("Source of the stream speed values.");
 
         param("Default Speed North", m_args.default_wx)
@@ -121,6 +128,20 @@ namespace Simulators
             .defaultValue("")
             .description("Path to the file containg the stream velocity data.");
 
+        param("Cache Size", m_args.cache_size)
+            .defaultValue("64")
+            .minimumValue("1")
+            .description(
+                "Maximum amount of memory (MiB) used to hold model data. Data "
+                "is loaded from the file as needed.");
+
+        param("Tile Size", m_args.tile_size)
+            .defaultValue("32")
+            .minimumValue("2")
+            .description(
+                "Number of gridpoints along each horizontal dimension of the "
+                "blocks of model data loaded from the file.");
+
         param("Days Forward", m_args.date.days_fwd)
             .defaultValue("0")
             .description(
@@ -138,7 +138,7 @@ namespace Supervisors
           bind<IMC::GpsFix>(this);
           bind<IMC::Heartbeat>(this);
           bind<IMC::VehicleMedium>(this);
-          bind<IMC::EstimatedState>(this);
+          bind<IMC::EstimatedState>(this, Tasks::BF_CONFLATE);
           bind<IMC::PlanGeneration>(this);
           bind<IMC::PlanControl>(this);
           bind<IMC::Rpm>(this);
@@ -122,7 +122,7 @@ namespace Supervisors
         // Register handler routines.
         bind<IMC::EntityInfo>(this);
         bind<IMC::EntityActivationState>(this);
-        bind<IMC::EntityState>(this);
+        bind<IMC::EntityState>(this, Tasks::BF_CONFLATE);
         bind<IMC::EntityParameters>(this);
         bind<IMC::PowerChannelState>(this);
       }
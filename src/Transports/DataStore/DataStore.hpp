@@ -37,6 +37,9 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "SampleLog.hpp"
+
 namespace Transports
 {
   namespace DataStore
@@ -80,29 +83,18 @@ namespace Transports
       }
     };
 
-    class CompareSamples
-    {
-    public:
-      bool operator()(const DataSample* p1, const DataSample* p2) const
-      {
-        return p1->priority <= p2->priority && p1->timestamp < p2->timestamp;
-      }
-    };
-
     //! Translate a (global coordinates) Data Sample into an IMC HistoricSample message
     HistoricSample*
-    parse(DataSample* sample, double base_lat, double base_lon, long base_time)
+    parse(DataSample* sample, const LocalFrame& base, long base_time)
     {
       HistoricSample* s = new HistoricSample();
 
-      double lat1 = Angles::radians(base_lat);
       double lat2 = Angles::radians(sample->latDegs);
-      double lon1 = Angles::radians(base_lon);
       double lon2 = Angles::radians(sample->lonDegs);
       double x, y, z;
 
       // compute displacement to used relative to base coordinates
-      WGS84::displacement(lat1, lon1, 0, lat2, lon2, 0, &x, &y, &z);
+      base.toNED(lat2, lon2, 0, &x, &y, &z);
       s->x = (int16_t) x;
       s->y = (int16_t) y;
       s->z = (int16_t) (sample->zMeters * 10);
@@ -120,6 +112,7 @@ namespace Transports
     parse(const IMC::HistoricData* data, std::vector<DataSample*>& samples, std::vector<RemoteCommand*>& commands)
     {
       IMC::MessageList<RemoteData>::const_iterator it;
+      LocalFrame base(Angles::radians(data->base_lat), Angles::radians(data->base_lon));
 
       for (it = data->data.begin(); it != data->data.end(); it++)
       {
@@ -132,9 +125,8 @@ namespace Transports
           const HistoricSample* sample = static_cast<const HistoricSample*>(*it);
           DataSample* s = new DataSample();
 
-          double lat = Angles::radians(data->base_lat);
-          double lon = Angles::radians(data->base_lon);
-          WGS84::displace((sample)->x, (sample)->y, &lat, &lon);
+          double lat, lon;
+          base.fromNE((sample)->x, (sample)->y, &lat, &lon);
           s->latDegs = Angles::degrees(lat);
           s->lonDegs = Angles::degrees(lon);
           s->source = (sample)->sys_id;
@@ -146,7 +138,9 @@ namespace Transports
       }
     }
 
-    //! This class is used to store samples locally until they are forwarded to other node
+    //! This class is used to store samples locally until they are forwarded to other node.
+    //! Samples are kept on disk by a SampleLog and survive restarts; remote commands are
+    //! kept in memory.
     class DataStore
     {
     public:
@@ -156,21 +150,70 @@ namespace Transports
 
       ~DataStore(void)
       {
-        Concurrency::ScopedRWLock(m_lock, true);
-        while (!m_samples.empty())
-        {
-          delete m_samples.top();
-          m_samples.pop();
-        }
+        close();
+      }
+
+      //! Open the sample store, recovering samples from previous runs.
+      //! @param[in] folder directory of the sample store.
+      //! @param[in] segment_size maximum size of segment files.
+      //! @param[in] max_size maximum size of stored samples (0 for unlimited).
+      void
+      open(const Path& folder, uint32_t segment_size, uint64_t max_size)
+      {
+        Concurrency::ScopedRWLock l(m_lock, true);
+        bool clean = m_log.open(folder, segment_size, max_size);
+        m_task->inf("Recovered %u samples (%s).", (unsigned)m_log.size(),
+                    clean ? "index" : "segment scan");
+      }
+
+      //! Close the sample store and release remote commands.
+      void
+      close(void)
+      {
+        Concurrency::ScopedRWLock l(m_lock, true);
+        m_log.close();
+        for (size_t i = 0; i < m_commands.size(); ++i)
+          delete m_commands[i];
+        m_commands.clear();
+      }
+
+      //! Flush stored samples to disk.
+      void
+      sync(void)
+      {
+        Concurrency::ScopedRWLock l(m_lock, true);
+        m_log.sync();
+      }
+
+      //! Number of stored samples.
+      size_t
+      size(void)
+      {
+        Concurrency::ScopedRWLock l(m_lock, false);
+        return m_log.size();
       }
 
-      //! Add sample to this store
+      //! Add sample to this store. The store takes ownership of the sample.
       void
       addSample(DataSample* sample)
       {
-        Concurrency::ScopedRWLock(m_lock, true);
+        Concurrency::ScopedRWLock l(m_lock, true);
         m_task->debug("Adding sample %d/%f", sample->sample->getId(), sample->timestamp);
-        m_samples.push(sample);
+
+        if (m_log.isOpen())
+        {
+          SampleLog::Sample s;
+          s.lat = sample->latDegs;
+          s.lon = sample->lonDegs;
+          s.z = sample->zMeters;
+          s.timestamp = sample->timestamp;
+          s.priority = sample->priority;
+          s.source = sample->source;
+          s.msg = sample->sample;
+          m_log.add(s, sample->serializationSize());
+        }
+
+        delete sample;
       }
 
       //! Add a series of historic samples packed as an HistoricData message
@@ -193,6 +236,7 @@ namespace Transports
           if (Clock::getSinceEpoch() > timeout)
           {
             m_task->debug("Dropping expired remote command.");
+            delete *cmd;
             continue;
           }
 
@@ -207,10 +251,12 @@ namespace Transports
                           m_task->resolveSystemId((*cmd)->original_source));
 
             m_task->dispatch(msg, DF_KEEP_SRC_EID);
+            delete *cmd;
           }
           else
           {
             m_task->debug("Adding (multi-hop) remote command.");
+            Concurrency::ScopedRWLock l(m_lock, true);
             m_commands.push_back(*cmd);
           }
         }
@@ -225,6 +271,7 @@ namespace Transports
 
         // add commands for that destination
         std::vector<RemoteCommand*>::iterator cmd_it;
+        Concurrency::ScopedRWLock l(m_lock, true);
 
         cmd_it = m_commands.begin();
         while(cmd_it != m_commands.end()) {
@@ -234,6 +281,7 @@ namespace Transports
             {
               size -= ser_size;
               ret->data.push_back(*cmd_it);
+              delete *cmd_it;
               cmd_it = m_commands.erase(cmd_it);
               continue;
             }
@@ -242,9 +290,12 @@ namespace Transports
         }
 
         if (ret->data.size() == 0)
+        {
+          delete ret;
           return NULL;
-        else
-          return ret;
+        }
+
+        return ret;
       }
 
       //! Retrieve a series of sample that take up to 'size'
@@ -255,48 +306,54 @@ namespace Transports
         size -= BASE_HISTORY_SIZE; // base fields from HistoricData
         IMC::HistoricData* ret = new IMC::HistoricData();
 
-        std::vector<DataSample*> added, rejected;
+        std::vector<SampleLog::Entry> entries;
+        std::vector<uint64_t> seqs;
+        std::vector<DataSample*> added;
 
-        Concurrency::ScopedRWLock(m_lock, true);
-        while (!m_samples.empty() && size > MINIMUM_SAMPLE_SIZE)
-        {
-          // pop next sample
-          DataSample* sample = m_samples.top();
-          m_samples.pop();
+        Concurrency::ScopedRWLock l(m_lock, true);
+        m_log.select(size, MINIMUM_SAMPLE_SIZE, entries);
 
-          // check if there is space left for this sample
-          int sample_size = sample->serializationSize();
-          if (sample_size > size)
-          {
-            rejected.push_back(sample);
-          }
-          else
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+          SampleLog::Sample s;
+          seqs.push_back(entries[i].seq);
+          if (!m_log.read(entries[i], s))
           {
-            size -= sample_size;
-            added.push_back(sample);
+            m_task->war("Dropping unreadable sample %llu.", (unsigned long long)entries[i].seq);
+            continue;
           }
-        }
 
-        // add back samples that didn't fit on the message
-        std::vector<DataSample *>::iterator it;
-        for (it = rejected.begin(); it != rejected.end(); it++)
-        {
-          m_samples.push(*it);
+          DataSample* sample = new DataSample();
+          sample->latDegs = s.lat;
+          sample->lonDegs = s.lon;
+          sample->zMeters = s.z;
+          sample->timestamp = s.timestamp;
+          sample->priority = s.priority;
+          sample->source = s.source;
+          sample->sample = s.msg;
+          added.push_back(sample);
         }
 
+        m_log.remove(seqs);
+
         // no data can be added
         if (added.empty())
+        {
+          delete ret;
           return NULL;
+        }
 
         ret->base_lat = added.at(0)->latDegs;
         ret->base_lon = added.at(0)->lonDegs;
         ret->base_time = added.at(0)->timestamp;
 
+        LocalFrame base(Angles::radians(ret->base_lat), Angles::radians(ret->base_lon));
+
+        std::vector<DataSample *>::iterator it;
         for (it = added.begin(); it != added.end(); it++)
         {
           DataSample * sample = *it;
-          ret->data.push_back(
-              parse(sample, ret->base_lat, ret->base_lon, ret->base_time));
+          ret->data.push_back(parse(sample, base, ret->base_time));
           delete sample;
         }
 
@@ -304,7 +361,7 @@ namespace Transports
       }
 
     private:
-      std::priority_queue<DataSample *, std::vector<DataSample *> , CompareSamples> m_samples;
+      SampleLog m_log;
       std::vector<RemoteCommand* > m_commands;
       Concurrency::RWLock m_lock;
       Task* m_task;
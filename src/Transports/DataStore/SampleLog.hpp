@@ -0,0 +1,848 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Jose Pinto                                                       *
+//***************************************************************************
+
+#ifndef SRC_TRANSPORTS_DATASTORE_SAMPLELOG_HPP_
+#define SRC_TRANSPORTS_DATASTORE_SAMPLELOG_HPP_
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+namespace Transports
+{
+  namespace DataStore
+  {
+    using DUNE_NAMESPACES;
+
+    //! Record synchronization number.
+    static const uint16_t c_record_sync = 0x5344;
+    //! Size of record headers.
+    static const unsigned c_record_header_size = 12;
+    //! Size of the fixed part of sample records.
+    static const unsigned c_sample_header_size = 56;
+    //! Maximum size of record bodies.
+    static const uint32_t c_record_max_size = 1024 * 1024;
+    //! Index file signature.
+    static const char c_index_magic[8] = {'D', 'S', 'I', 'D', 'X', '0', '0', '1'};
+
+    //! Append-only, disk-backed store of samples.
+    //!
+    //! Samples are appended to numbered segment files as records with
+    //! the sample location, time, priority and serialized message.
+    //! Removing samples appends a record listing their sequence
+    //! numbers, so data is never rewritten in place. Only a compact
+    //! priority index of the live samples is kept in memory and
+    //! messages are read back from disk when samples are selected.
+    //!
+    //! Segments are deleted once they hold no live samples and every
+    //! older segment is gone, so removal records never outlive the
+    //! samples they refer to. Mostly empty segments are compacted by
+    //! copying their live records to the active segment.
+    //!
+    //! On a clean shutdown the index is saved next to the segments and
+    //! loaded on the next start. After a crash the segments are scanned
+    //! instead, stopping at the first incomplete or corrupted record.
+    //! Every start appends to a new segment, so records are never
+    //! written after a partially written one.
+    class SampleLog
+    {
+    public:
+      //! Record types.
+      enum RecordType
+      {
+        //! Sample.
+        RECORD_SAMPLE = 1,
+        //! List of removed samples.
+        RECORD_REMOVAL = 2
+      };
+
+      //! Index entry of a stored sample.
+      struct Entry
+      {
+        //! Sequence number.
+        uint64_t seq;
+        //! Sample priority.
+        int32_t priority;
+        //! Serialization size of the sample in HistoricData.
+        uint32_t size;
+        //! Sample timestamp.
+        double timestamp;
+        //! Segment holding the sample record.
+        uint32_t segment;
+        //! Offset of the sample record.
+        uint32_t offset;
+        //! Size of the sample record, including its header.
+        uint32_t length;
+      };
+
+      SampleLog(void):
+        m_file(NULL),
+        m_segment_size(1024 * 1024),
+        m_max_size(0),
+        m_next_seq(0),
+        m_live_bytes(0),
+        m_dirty(false)
+      { }
+
+      ~SampleLog(void)
+      {
+        close();
+      }
+
+      //! Open the store, recovering existing samples.
+      //! @param[in] folder directory of the segment files.
+      //! @param[in] segment_size maximum segment size in bytes.
+      //! @param[in] max_size maximum size of live samples in bytes,
+      //! zero for unlimited. Lowest priority samples are dropped first.
+      //! @return true if the index was loaded from a clean shutdown,
+      //! false if the segments had to be scanned.
+      bool
+      open(const Path& folder, uint32_t segment_size, uint64_t max_size)
+      {
+        close();
+
+        m_folder = folder;
+        m_segment_size = std::max(segment_size, (uint32_t)(64 * 1024));
+        m_max_size = max_size;
+        m_folder.create();
+
+        std::vector<uint32_t> ids;
+        listSegments(ids);
+
+        bool clean = loadIndex(ids);
+        if (!clean)
+        {
+          clearIndex();
+          for (size_t i = 0; i < ids.size(); ++i)
+            scanSegment(ids[i]);
+        }
+
+        if ((m_folder / "index").exists())
+          (m_folder / "index").remove();
+
+        uint32_t id = m_segments.empty() ? 0 : m_segments.rbegin()->first + 1;
+        createSegment(id);
+        reclaim();
+        return clean;
+      }
+
+      //! Close the store, saving the index.
+      void
+      close(void)
+      {
+        if (m_file == NULL)
+          return;
+
+        sync();
+        std::fclose(m_file);
+        m_file = NULL;
+
+        // Drop the active segment if nothing was written to it.
+        Segment& active = m_segments.rbegin()->second;
+        if (active.size == 0)
+        {
+          segmentPath(m_segments.rbegin()->first).remove();
+          m_segments.erase(m_segments.rbegin()->first);
+        }
+
+        saveIndex();
+        clearIndex();
+      }
+
+      //! Test if the store is open.
+      //! @return true if the store is open.
+      bool
+      isOpen(void) const
+      {
+        return m_file != NULL;
+      }
+
+      //! Number of stored samples.
+      //! @return number of samples.
+      size_t
+      size(void) const
+      {
+        return m_entries.size();
+      }
+
+      //! Total size of the stored samples.
+      //! @return size in bytes.
+      uint64_t
+      getLiveBytes(void) const
+      {
+        return m_live_bytes;
+      }
+
+      //! Number of segment files.
+      //! @return number of segments.
+      size_t
+      getSegmentCount(void) const
+      {
+        return m_segments.size();
+      }
+
+      //! Stored sample.
+      struct Sample
+      {
+        //! Sample location.
+        double lat, lon, z;
+        //! Sample timestamp.
+        double timestamp;
+        //! Sample priority.
+        int priority;
+        //! System that generated the sample.
+        int source;
+        //! Sample data.
+        IMC::Message* msg;
+      };
+
+      //! Append a sample.
+      //! @param[in] sample sample to store.
+      //! @param[in] size serialization size of the sample in
+      //! HistoricData, used to select samples.
+      //! @return sequence number of the sample.
+      uint64_t
+      add(const Sample& sample, uint32_t size)
+      {
+        uint32_t packet_size = sample.msg->getSerializationSize();
+        std::vector<uint8_t> body(c_sample_header_size + packet_size);
+
+        Entry entry;
+        entry.seq = m_next_seq++;
+        entry.priority = sample.priority;
+        entry.size = size;
+        entry.timestamp = sample.timestamp;
+
+        uint8_t* ptr = &body[0];
+        ptr += IMC::serialize(entry.seq, ptr);
+        ptr += IMC::serialize(entry.priority, ptr);
+        ptr += IMC::serialize(entry.size, ptr);
+        ptr += IMC::serialize(sample.timestamp, ptr);
+        ptr += IMC::serialize(sample.lat, ptr);
+        ptr += IMC::serialize(sample.lon, ptr);
+        ptr += IMC::serialize(sample.z, ptr);
+        ptr += IMC::serialize((int32_t)sample.source, ptr);
+        ptr += IMC::serialize((uint32_t)0, ptr);
+        IMC::Packet::serialize(sample.msg, ptr, packet_size);
+
+        entry.length = append(RECORD_SAMPLE, body);
+        entry.segment = m_segments.rbegin()->first;
+        entry.offset = m_segments.rbegin()->second.size - entry.length;
+        insert(entry);
+
+        // Keep the store within its size limit, dropping an extra eighth
+        // so that removals are batched.
+        if (m_max_size > 0 && m_live_bytes > m_max_size)
+        {
+          std::vector<uint64_t> seqs;
+          std::set<Key>::reverse_iterator itr = m_order.rbegin();
+          uint64_t live_bytes = m_live_bytes;
+          uint64_t target = m_max_size - m_max_size / 8;
+          for (; itr != m_order.rend() && live_bytes > target; ++itr)
+          {
+            live_bytes -= m_entries[itr->seq].length;
+            seqs.push_back(itr->seq);
+          }
+
+          remove(seqs);
+        }
+
+        return entry.seq;
+      }
+
+      //! Select the highest priority samples that fit in a given
+      //! serialization size.
+      //! @param[in] size available serialization size.
+      //! @param[in] min_size smallest serialization size of a sample.
+      //! @param[out] entries selected samples, in priority order.
+      void
+      select(int size, int min_size, std::vector<Entry>& entries) const
+      {
+        std::set<Key>::const_iterator itr = m_order.begin();
+        for (; itr != m_order.end() && size > min_size; ++itr)
+        {
+          const Entry& entry = m_entries.find(itr->seq)->second;
+          if ((int)entry.size > size)
+            continue;
+
+          size -= entry.size;
+          entries.push_back(entry);
+        }
+      }
+
+      //! Read a sample from disk.
+      //! @param[in] entry index entry of the sample.
+      //! @param[out] sample sample, the caller owns the message.
+      //! @return true if the record was read, false otherwise.
+      bool
+      read(const Entry& entry, Sample& sample) const
+      {
+        // The active segment may still have data in the write buffer.
+        if (m_file != NULL)
+          std::fflush(m_file);
+
+        std::FILE* fd = std::fopen(segmentPath(entry.segment).c_str(), "rb");
+        if (fd == NULL)
+          return false;
+
+        std::vector<uint8_t> record(entry.length);
+        bool ok = std::fseek(fd, entry.offset, SEEK_SET) == 0
+        && std::fread(&record[0], 1, record.size(), fd) == record.size();
+        std::fclose(fd);
+
+        if (!ok)
+          return false;
+
+        const uint8_t* ptr = &record[c_record_header_size];
+        uint16_t len = c_sample_header_size;
+        uint64_t seq = 0;
+        int32_t priority = 0;
+        uint32_t size = 0;
+        int32_t source = 0;
+        ptr += IMC::deserialize(seq, ptr, len);
+        ptr += IMC::deserialize(priority, ptr, len);
+        ptr += IMC::deserialize(size, ptr, len);
+        ptr += IMC::deserialize(sample.timestamp, ptr, len);
+        ptr += IMC::deserialize(sample.lat, ptr, len);
+        ptr += IMC::deserialize(sample.lon, ptr, len);
+        ptr += IMC::deserialize(sample.z, ptr, len);
+        ptr += IMC::deserialize(source, ptr, len);
+        ptr += sizeof(uint32_t);
+        sample.priority = priority;
+        sample.source = source;
+
+        if (seq != entry.seq)
+          return false;
+
+        try
+        {
+          uint32_t packet_size = entry.length - c_record_header_size - c_sample_header_size;
+          sample.msg = IMC::Packet::deserialize(ptr, packet_size);
+        }
+        catch (std::exception&)
+        {
+          return false;
+        }
+
+        return true;
+      }
+
+      //! Remove samples.
+      //! @param[in] seqs sequence numbers of the samples to remove.
+      void
+      remove(const std::vector<uint64_t>& seqs)
+      {
+        if (seqs.empty())
+          return;
+
+        std::vector<uint8_t> body(seqs.size() * sizeof(uint64_t));
+        for (size_t i = 0; i < seqs.size(); ++i)
+          IMC::serialize(seqs[i], &body[i * sizeof(uint64_t)]);
+
+        append(RECORD_REMOVAL, body);
+
+        for (size_t i = 0; i < seqs.size(); ++i)
+          erase(seqs[i]);
+
+        reclaim();
+      }
+
+      //! Flush written records to the storage device.
+      void
+      sync(void)
+      {
+        if (m_file == NULL || !m_dirty)
+          return;
+
+        std::fflush(m_file);
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+        fsync(fileno(m_file));
+#endif
+        m_dirty = false;
+      }
+
+    private:
+      //! Sample ordering key.
+      struct Key
+      {
+        int32_t priority;
+        double timestamp;
+        uint64_t seq;
+
+        //! Higher priorities first, then newer samples.
+        bool
+        operator<(const Key& other) const
+        {
+          if (priority != other.priority)
+            return priority > other.priority;
+          if (timestamp != other.timestamp)
+            return timestamp > other.timestamp;
+          return seq > other.seq;
+        }
+      };
+
+      //! Segment bookkeeping.
+      struct Segment
+      {
+        //! Segment file size.
+        uint64_t size;
+        //! Number of live samples.
+        uint32_t live;
+        //! Size of live sample records.
+        uint64_t live_bytes;
+
+        Segment(void):
+          size(0),
+          live(0),
+          live_bytes(0)
+        { }
+      };
+
+      //! Directory of the segment files.
+      Path m_folder;
+      //! Active segment file.
+      std::FILE* m_file;
+      //! Maximum segment size.
+      uint32_t m_segment_size;
+      //! Maximum size of live samples.
+      uint64_t m_max_size;
+      //! Next sequence number.
+      uint64_t m_next_seq;
+      //! Size of live sample records.
+      uint64_t m_live_bytes;
+      //! True if records were written since the last sync.
+      bool m_dirty;
+      //! Samples by sequence number.
+      std::map<uint64_t, Entry> m_entries;
+      //! Samples by priority.
+      std::set<Key> m_order;
+      //! Segments by number.
+      std::map<uint32_t, Segment> m_segments;
+
+      Path
+      segmentPath(uint32_t id) const
+      {
+        return m_folder / String::str("%08u.seg", id);
+      }
+
+      //! Get the segment numbers found on disk, in ascending order.
+      void
+      listSegments(std::vector<uint32_t>& ids)
+      {
+        Directory dir(m_folder);
+        const char* name = NULL;
+        while ((name = dir.readEntry(Directory::RD_FILE_NAME)) != NULL)
+        {
+          unsigned id = 0;
+          char end = 0;
+          if (std::strlen(name) == 12 && std::sscanf(name, "%08u.se%c", &id, &end) == 2 && end == 'g')
+            ids.push_back(id);
+        }
+
+        std::sort(ids.begin(), ids.end());
+      }
+
+      void
+      insert(const Entry& entry)
+      {
+        Key key = {entry.priority, entry.timestamp, entry.seq};
+        m_entries[entry.seq] = entry;
+        m_order.insert(key);
+        Segment& segment = m_segments[entry.segment];
+        ++segment.live;
+        segment.live_bytes += entry.length;
+        m_live_bytes += entry.length;
+      }
+
+      void
+      erase(uint64_t seq)
+      {
+        std::map<uint64_t, Entry>::iterator itr = m_entries.find(seq);
+        if (itr == m_entries.end())
+          return;
+
+        const Entry& entry = itr->second;
+        Key key = {entry.priority, entry.timestamp, entry.seq};
+        m_order.erase(key);
+        Segment& segment = m_segments[entry.segment];
+        --segment.live;
+        segment.live_bytes -= entry.length;
+        m_live_bytes -= entry.length;
+        m_entries.erase(itr);
+      }
+
+      void
+      clearIndex(void)
+      {
+        m_entries.clear();
+        m_order.clear();
+        m_segments.clear();
+        m_live_bytes = 0;
+        m_next_seq = 0;
+      }
+
+      void
+      createSegment(uint32_t id)
+      {
+        if (m_file != NULL)
+        {
+          sync();
+          std::fclose(m_file);
+        }
+
+        m_file = std::fopen(segmentPath(id).c_str(), "wb");
+        if (m_file == NULL)
+          throw System::Error(DTR("unable to create segment"), segmentPath(id).str());
+
+        m_segments[id] = Segment();
+      }
+
+      //! Append a record to the active segment.
+      //! @return record size, including the header.
+      uint32_t
+      append(RecordType type, const std::vector<uint8_t>& body)
+      {
+        uint32_t length = c_record_header_size + body.size();
+        if (m_segments.rbegin()->second.size > 0
+            && m_segments.rbegin()->second.size + length > m_segment_size)
+          createSegment(m_segments.rbegin()->first + 1);
+
+        uint8_t hdr[c_record_header_size];
+        uint8_t* ptr = hdr;
+        ptr += IMC::serialize(c_record_sync, ptr);
+        ptr += IMC::serialize((uint8_t)type, ptr);
+        ptr += IMC::serialize((uint8_t)0, ptr);
+        ptr += IMC::serialize((uint32_t)body.size(), ptr);
+        ptr += IMC::serialize(checksum(body), ptr);
+        ptr += IMC::serialize((uint16_t)0, ptr);
+
+        if (std::fwrite(hdr, 1, sizeof(hdr), m_file) != sizeof(hdr)
+            || std::fwrite(&body[0], 1, body.size(), m_file) != body.size()
+            || std::fflush(m_file) != 0)
+          throw System::Error(DTR("unable to write segment"), segmentPath(m_segments.rbegin()->first).str());
+
+        m_segments.rbegin()->second.size += length;
+        m_dirty = true;
+        return length;
+      }
+
+      static uint16_t
+      checksum(const std::vector<uint8_t>& body)
+      {
+        uint16_t crc = 0;
+        for (size_t i = 0; i < body.size(); i += 0xffff)
+          crc = Algorithms::CRC16::compute(&body[i], (uint16_t)std::min(body.size() - i, (size_t)0xffff), crc);
+        return crc;
+      }
+
+      //! Rebuild the index from the records of a segment.
+      void
+      scanSegment(uint32_t id)
+      {
+        std::FILE* fd = std::fopen(segmentPath(id).c_str(), "rb");
+        if (fd == NULL)
+          return;
+
+        Segment& segment = m_segments[id];
+        std::vector<uint8_t> body;
+        uint8_t hdr[c_record_header_size];
+
+        while (std::fread(hdr, 1, sizeof(hdr), fd) == sizeof(hdr))
+        {
+          const uint8_t* ptr = hdr;
+          uint16_t len = sizeof(hdr);
+          uint16_t sync = 0;
+          uint8_t type = 0;
+          uint8_t pad = 0;
+          uint32_t size = 0;
+          uint16_t crc = 0;
+          ptr += IMC::deserialize(sync, ptr, len);
+          ptr += IMC::deserialize(type, ptr, len);
+          ptr += IMC::deserialize(pad, ptr, len);
+          ptr += IMC::deserialize(size, ptr, len);
+          ptr += IMC::deserialize(crc, ptr, len);
+
+          if (sync != c_record_sync || size > c_record_max_size || size == 0)
+            break;
+
+          body.resize(size);
+          if (std::fread(&body[0], 1, size, fd) != size || checksum(body) != crc)
+            break;
+
+          uint32_t offset = segment.size;
+          segment.size += sizeof(hdr) + size;
+
+          if (type == RECORD_SAMPLE && size > c_sample_header_size)
+          {
+            Entry entry;
+            ptr = &body[0];
+            len = c_sample_header_size;
+            ptr += IMC::deserialize(entry.seq, ptr, len);
+            ptr += IMC::deserialize(entry.priority, ptr, len);
+            ptr += IMC::deserialize(entry.size, ptr, len);
+            ptr += IMC::deserialize(entry.timestamp, ptr, len);
+            entry.segment = id;
+            entry.offset = offset;
+            entry.length = sizeof(hdr) + size;
+
+            // Records copied by compaction replace the original.
+            erase(entry.seq);
+            insert(entry);
+            m_next_seq = std::max(m_next_seq, entry.seq + 1);
+          }
+          else if (type == RECORD_REMOVAL)
+          {
+            for (size_t i = 0; i + sizeof(uint64_t) <= body.size(); i += sizeof(uint64_t))
+            {
+              uint64_t seq = 0;
+              len = sizeof(uint64_t);
+              IMC::deserialize(seq, &body[i], len);
+              erase(seq);
+              m_next_seq = std::max(m_next_seq, seq + 1);
+            }
+          }
+        }
+
+        std::fclose(fd);
+      }
+
+      //! Delete segments that are no longer needed and compact the
+      //! oldest segment if most of it is dead.
+      void
+      reclaim(void)
+      {
+        while (m_segments.size() > 1)
+        {
+          uint32_t id = m_segments.begin()->first;
+          Segment& oldest = m_segments.begin()->second;
+
+          if (oldest.live > 0)
+          {
+            if (oldest.live_bytes * 2 > oldest.size)
+              break;
+
+            compact(id);
+            sync();
+          }
+
+          segmentPath(id).remove();
+          m_segments.erase(id);
+        }
+      }
+
+      //! Copy the live records of a segment to the active segment.
+      void
+      compact(uint32_t id)
+      {
+        std::vector<Entry> entries;
+        std::map<uint64_t, Entry>::const_iterator itr = m_entries.begin();
+        for (; itr != m_entries.end(); ++itr)
+        {
+          if (itr->second.segment == id)
+            entries.push_back(itr->second);
+        }
+
+        std::FILE* fd = std::fopen(segmentPath(id).c_str(), "rb");
+        if (fd == NULL)
+          throw System::Error(DTR("unable to open segment"), segmentPath(id).str());
+
+        std::vector<uint8_t> body;
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+          Entry entry = entries[i];
+          body.resize(entry.length - c_record_header_size);
+          if (std::fseek(fd, entry.offset + c_record_header_size, SEEK_SET) != 0
+              || std::fread(&body[0], 1, body.size(), fd) != body.size())
+          {
+            std::fclose(fd);
+            throw System::Error(DTR("unable to read segment"), segmentPath(id).str());
+          }
+
+          erase(entry.seq);
+          entry.length = append(RECORD_SAMPLE, body);
+          entry.segment = m_segments.rbegin()->first;
+          entry.offset = m_segments.rbegin()->second.size - entry.length;
+          insert(entry);
+        }
+
+        std::fclose(fd);
+      }
+
+      //! Load the index saved on a clean shutdown.
+      //! @param[in] ids segments found on disk.
+      //! @return true if the index matches the segments on disk.
+      bool
+      loadIndex(const std::vector<uint32_t>& ids)
+      {
+        std::FILE* fd = std::fopen((m_folder / "index").c_str(), "rb");
+        if (fd == NULL)
+          return false;
+
+        std::vector<uint8_t> data;
+        uint8_t bfr[4096];
+        size_t rv = 0;
+        while ((rv = std::fread(bfr, 1, sizeof(bfr), fd)) > 0)
+          data.insert(data.end(), bfr, bfr + rv);
+        std::fclose(fd);
+
+        const uint32_t c_segment_size = 12;
+        const uint32_t c_entry_size = 36;
+        if (data.size() < 24 || std::memcmp(&data[0], c_index_magic, 8) != 0)
+          return false;
+
+        const uint8_t* ptr = &data[8];
+        uint16_t len = 16;
+        uint32_t segments = 0;
+        uint32_t entries = 0;
+        ptr += IMC::deserialize(m_next_seq, ptr, len);
+        ptr += IMC::deserialize(segments, ptr, len);
+        ptr += IMC::deserialize(entries, ptr, len);
+
+        if (segments != ids.size()
+            || data.size() != 24 + segments * c_segment_size + entries * c_entry_size + 2)
+          return false;
+
+        std::vector<uint8_t> payload(data.begin(), data.end() - 2);
+        uint16_t crc = 0;
+        len = 2;
+        IMC::deserialize(crc, &data[data.size() - 2], len);
+        if (checksum(payload) != crc)
+          return false;
+
+        for (uint32_t i = 0; i < segments; ++i)
+        {
+          uint32_t id = 0;
+          uint64_t size = 0;
+          len = c_segment_size;
+          ptr += IMC::deserialize(id, ptr, len);
+          ptr += IMC::deserialize(size, ptr, len);
+
+          if (id != ids[i] || (uint64_t)segmentPath(id).size() != size)
+          {
+            clearIndex();
+            return false;
+          }
+
+          m_segments[id].size = size;
+        }
+
+        for (uint32_t i = 0; i < entries; ++i)
+        {
+          Entry entry;
+          len = c_entry_size;
+          ptr += IMC::deserialize(entry.seq, ptr, len);
+          ptr += IMC::deserialize(entry.priority, ptr, len);
+          ptr += IMC::deserialize(entry.size, ptr, len);
+          ptr += IMC::deserialize(entry.timestamp, ptr, len);
+          ptr += IMC::deserialize(entry.segment, ptr, len);
+          ptr += IMC::deserialize(entry.offset, ptr, len);
+          ptr += IMC::deserialize(entry.length, ptr, len);
+
+          if (m_segments.find(entry.segment) == m_segments.end())
+          {
+            clearIndex();
+            return false;
+          }
+
+          insert(entry);
+        }
+
+        return true;
+      }
+
+      //! Save the index, to be loaded on the next start.
+      void
+      saveIndex(void)
+      {
+        std::vector<uint8_t> data(24 + m_segments.size() * 12 + m_entries.size() * 36);
+        std::memcpy(&data[0], c_index_magic, 8);
+        uint8_t* ptr = &data[8];
+        ptr += IMC::serialize(m_next_seq, ptr);
+        ptr += IMC::serialize((uint32_t)m_segments.size(), ptr);
+        ptr += IMC::serialize((uint32_t)m_entries.size(), ptr);
+
+        std::map<uint32_t, Segment>::const_iterator sitr = m_segments.begin();
+        for (; sitr != m_segments.end(); ++sitr)
+        {
+          ptr += IMC::serialize(sitr->first, ptr);
+          ptr += IMC::serialize(sitr->second.size, ptr);
+        }
+
+        std::map<uint64_t, Entry>::const_iterator eitr = m_entries.begin();
+        for (; eitr != m_entries.end(); ++eitr)
+        {
+          const Entry& entry = eitr->second;
+          ptr += IMC::serialize(entry.seq, ptr);
+          ptr += IMC::serialize(entry.priority, ptr);
+          ptr += IMC::serialize(entry.size, ptr);
+          ptr += IMC::serialize(entry.timestamp, ptr);
+          ptr += IMC::serialize(entry.segment, ptr);
+          ptr += IMC::serialize(entry.offset, ptr);
+          ptr += IMC::serialize(entry.length, ptr);
+        }
+
+        uint8_t crc[2];
+        IMC::serialize(checksum(data), crc);
+        data.insert(data.end(), crc, crc + 2);
+
+        // Write to a temporary file first so the index is never partial.
+        Path tmp = m_folder / "index.tmp";
+        std::FILE* fd = std::fopen(tmp.c_str(), "wb");
+        if (fd == NULL)
+          return;
+
+        bool ok = std::fwrite(&data[0], 1, data.size(), fd) == data.size()
+        && std::fflush(fd) == 0;
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+        ok = ok && fsync(fileno(fd)) == 0;
+#endif
+        std::fclose(fd);
+
+        if (ok)
+          std::rename(tmp.c_str(), (m_folder / "index").c_str());
+        else
+          tmp.remove();
+      }
+    };
+  }
+}
+
+#endif
@@ -71,6 +71,12 @@ namespace Transports
       //! Variable priorities will result in older
       //! data being sent through low bandwidth connections
       bool variable_priorities;
+
+      //! Maximum size of sample store segment files
+      unsigned segment_size;
+
+      //! Maximum size of stored samples (0 == unlimited)
+      unsigned max_storage;
     };
 
     struct Task: public DUNE::Tasks::Task
@@ -156,6 +162,18 @@ namespace Transports
         .description("Apply variable priorities to local samples")
         .defaultValue("true");
 
+        param("Segment Size", m_args.segment_size)
+        .description("Maximum size of the files where samples are stored")
+        .units(Units::Byte)
+        .defaultValue("1048576")
+        .minimumValue("65536");
+
+        param("Maximum Storage Size", m_args.max_storage)
+        .description("Maximum size of stored samples, lowest priority samples"
+                     " are dropped first. 0 means unlimited")
+        .units(Units::Byte)
+        .defaultValue("67108864");
+
         m_wifi_forward_timer.setTop(m_args.wifi_forward_period);
         m_acoustic_forward_timer.setTop(m_args.acoustic_forward_period);
         m_any_forward_timer.setTop(m_args.any_forward_period);
@@ -208,6 +226,18 @@ namespace Transports
         m_iridium_upload_timer.setTop(m_args.iridium_upload_period);
       }
 
+      void
+      onResourceAcquisition(void)
+      {
+        m_store.open(m_ctx.dir_db / getName(), m_args.segment_size, m_args.max_storage);
+      }
+
+      void
+      onResourceRelease(void)
+      {
+        m_store.close();
+      }
+
       void
       onResourceInitialization(void)
       {
@@ -488,6 +518,7 @@ namespace Transports
         while (!stopping())
         {
           waitForMessages(1.0);
+          m_store.sync();
 
           std::stringstream ss;
 
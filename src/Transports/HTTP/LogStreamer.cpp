@@ -0,0 +1,382 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "LogStreamer.hpp"
+
+namespace Transports
+{
+  namespace HTTP
+  {
+    using DUNE_NAMESPACES;
+
+    //! Maximum size of a packet.
+    static const size_t c_max_packet_size = DUNE_IMC_CONST_HEADER_SIZE + 65535 + DUNE_IMC_CONST_FOOTER_SIZE;
+
+    //! Parse a number, accepting the "0x" prefix.
+    static double
+    parseNumber(const std::string& key, const std::string& value)
+    {
+      char* end = NULL;
+      double rv = (value.compare(0, 2, "0x") == 0)
+      ? (double)std::strtoul(value.c_str(), &end, 16)
+      : std::strtod(value.c_str(), &end);
+
+      if (value.empty() || *end != 0)
+        throw std::runtime_error(String::str(DTR("invalid value for '%s': %s"), key.c_str(), value.c_str()));
+
+      return rv;
+    }
+
+    LogFilter::LogFilter(void):
+      begin(-1),
+      end(-1),
+      decimation(0),
+      compression(Compression::METHOD_UNKNOWN)
+    { }
+
+    void
+    LogFilter::parse(const std::string& query)
+    {
+      std::vector<std::string> args;
+      String::split(query, "&", args);
+
+      for (size_t i = 0; i < args.size(); ++i)
+      {
+        if (args[i].empty())
+          continue;
+
+        size_t sep = args[i].find('=');
+        std::string key = args[i].substr(0, sep);
+        std::string value = (sep == std::string::npos) ? "" : args[i].substr(sep + 1);
+        std::vector<std::string> list;
+        String::split(value, ",", list);
+
+        if (key == "msg")
+        {
+          for (size_t j = 0; j < list.size(); ++j)
+          {
+            try
+            {
+              messages.insert(IMC::Factory::getIdFromAbbrev(list[j]));
+            }
+            catch (std::exception&)
+            {
+              throw std::runtime_error(String::str(DTR("unknown message: %s"), list[j].c_str()));
+            }
+          }
+        }
+        else if (key == "entity")
+        {
+          entities.insert(list.begin(), list.end());
+        }
+        else if (key == "src")
+        {
+          for (size_t j = 0; j < list.size(); ++j)
+            sources.insert((uint16_t)parseNumber(key, list[j]));
+        }
+        else if (key == "from")
+        {
+          begin = parseNumber(key, value);
+        }
+        else if (key == "to")
+        {
+          end = parseNumber(key, value);
+        }
+        else if (key == "decimate")
+        {
+          decimation = parseNumber(key, value);
+        }
+        else if (key == "compress")
+        {
+          if (value == "gzip")
+            compression = Compression::METHOD_GZIP;
+          else if (value == "bzip2")
+            compression = Compression::METHOD_BZIP2;
+          else if (value != "none")
+            throw std::runtime_error(String::str(DTR("unsupported compression: %s"), value.c_str()));
+        }
+        else
+        {
+          throw std::runtime_error(String::str(DTR("unknown argument: %s"), key.c_str()));
+        }
+      }
+    }
+
+    LogStreamer::LogStreamer(const std::string& file, const LogFilter& filter):
+      m_file(file),
+      m_filter(filter),
+      m_read(0),
+      m_written(0)
+    {
+      m_size = FileSystem::Path(file).size();
+      if (m_size < 0)
+        throw std::runtime_error(DTR("log not found"));
+
+      m_method = Compression::Factory::detect(file.c_str());
+    }
+
+    bool
+    LogStreamer::select(const IMC::Header& hdr, const uint8_t* packet)
+    {
+      uint32_t entity = ((uint32_t)hdr.src << 8) | hdr.src_ent;
+
+      // Entity information is always forwarded, readers need it to
+      // resolve entity labels.
+      if (hdr.mgid == IMC::EntityInfo::getIdStatic())
+      {
+        IMC::EntityInfo info;
+        try
+        {
+          IMC::Packet::deserialize(packet, DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE, &info);
+          m_labels[((uint32_t)hdr.src << 8) | info.id] = info.label;
+        }
+        catch (std::exception&)
+        { }
+
+        return true;
+      }
+
+      if (m_filter.begin >= 0 && hdr.timestamp < m_filter.begin)
+        return false;
+
+      if (m_filter.end >= 0 && hdr.timestamp > m_filter.end)
+        return false;
+
+      if (!m_filter.messages.empty() && m_filter.messages.find(hdr.mgid) == m_filter.messages.end())
+        return false;
+
+      if (!m_filter.sources.empty() && m_filter.sources.find(hdr.src) == m_filter.sources.end())
+        return false;
+
+      if (!m_filter.entities.empty())
+      {
+        std::map<uint32_t, std::string>::const_iterator itr = m_labels.find(entity);
+        if (itr == m_labels.end() || m_filter.entities.find(itr->second) == m_filter.entities.end())
+          return false;
+      }
+
+      if (m_filter.decimation > 0)
+      {
+        uint64_t key = ((uint64_t)hdr.mgid << 32) | entity;
+        std::map<uint64_t, double>::iterator itr = m_last.find(key);
+        if (itr != m_last.end() && hdr.timestamp - itr->second < m_filter.decimation)
+          return false;
+
+        m_last[key] = hdr.timestamp;
+      }
+
+      return true;
+    }
+
+    void
+    LogStreamer::run(std::ostream& os)
+    {
+      m_labels.clear();
+      m_last.clear();
+      m_read = 0;
+      m_written = 0;
+
+      std::ifstream raw;
+      Compression::FileInput* input = NULL;
+      std::istream* is = &raw;
+      if (m_method == Compression::METHOD_UNKNOWN)
+        raw.open(m_file.c_str(), std::ios::binary);
+      else
+        is = input = new Compression::FileInput(m_file.c_str(), m_method);
+
+      Compression::FilterOutput* output = NULL;
+      std::ostream* out = &os;
+      if (m_filter.compression != Compression::METHOD_UNKNOWN)
+        out = output = new Compression::FilterOutput(os, m_filter.compression);
+
+      std::vector<uint8_t> bfr(c_max_packet_size);
+      char* data = (char*)&bfr[0];
+      int64_t position = 0;
+
+      try
+      {
+        while (true)
+        {
+          // Plain logs may be growing, stop at the initial size.
+          if (input == NULL && position + DUNE_IMC_CONST_HEADER_SIZE > m_size)
+            break;
+
+          is->read(data, DUNE_IMC_CONST_HEADER_SIZE);
+          if (is->eof() || is->gcount() < DUNE_IMC_CONST_HEADER_SIZE)
+            break;
+
+          IMC::Header hdr;
+          IMC::Packet::deserializeHeader(hdr, &bfr[0], DUNE_IMC_CONST_HEADER_SIZE);
+
+          int64_t size = DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+          if (input == NULL && position + size > m_size)
+            break;
+
+          is->read(data + DUNE_IMC_CONST_HEADER_SIZE, size - DUNE_IMC_CONST_HEADER_SIZE);
+          if (is->gcount() < size - DUNE_IMC_CONST_HEADER_SIZE)
+            break;
+
+          position += size;
+          ++m_read;
+
+          if (select(hdr, &bfr[0]))
+          {
+            out->write(data, size);
+            ++m_written;
+          }
+        }
+      }
+      catch (std::exception& e)
+      {
+        // Truncated or corrupted data, stream what was decoded so far.
+        DUNE_WRN("LogStreamer", m_file << ": " << e.what());
+      }
+
+      delete output;
+      delete input;
+      os.flush();
+    }
+
+    void
+    writeAll(TCPSocket& sock, const char* data, size_t size)
+    {
+      size_t done = 0;
+      while (done < size)
+        done += sock.write(data + done, size - done);
+    }
+
+    RangeOutput::RangeOutput(std::streambuf* next, uint64_t first, uint64_t last):
+      m_next(next),
+      m_first(first),
+      m_last(last),
+      m_count(0)
+    { }
+
+    RangeOutput::int_type
+    RangeOutput::overflow(int_type c)
+    {
+      if (c != traits_type::eof())
+      {
+        char ch = traits_type::to_char_type(c);
+        xsputn(&ch, 1);
+      }
+
+      return traits_type::not_eof(c);
+    }
+
+    std::streamsize
+    RangeOutput::xsputn(const char* data, std::streamsize size)
+    {
+      uint64_t begin = m_count;
+      uint64_t end = m_count + size - 1;
+      m_count += size;
+
+      if (m_next == NULL || size <= 0 || end < m_first || begin > m_last)
+        return size;
+
+      uint64_t first = std::max(begin, m_first);
+      uint64_t last = std::min(end, m_last);
+      m_next->sputn(data + (first - begin), last - first + 1);
+      return size;
+    }
+
+    int
+    RangeOutput::sync(void)
+    {
+      return (m_next == NULL) ? 0 : m_next->pubsync();
+    }
+
+    SocketOutput::SocketOutput(TCPSocket& sock):
+      m_sock(sock)
+    {
+      setp(m_bfr, m_bfr + c_buffer_size);
+    }
+
+    SocketOutput::int_type
+    SocketOutput::overflow(int_type c)
+    {
+      sync();
+
+      if (c != traits_type::eof())
+      {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+      }
+
+      return traits_type::not_eof(c);
+    }
+
+    int
+    SocketOutput::sync(void)
+    {
+      size_t size = pptr() - pbase();
+      if (size == 0)
+        return 0;
+
+      write(pbase(), size);
+      setp(m_bfr, m_bfr + c_buffer_size);
+      return 0;
+    }
+
+    void
+    SocketOutput::write(const char* data, size_t size)
+    {
+      writeAll(m_sock, data, size);
+    }
+
+    void
+    ChunkedOutput::write(const char* data, size_t size)
+    {
+      char hdr[32];
+      int len = std::snprintf(hdr, sizeof(hdr), "%lx\r\n", (unsigned long)size);
+      writeAll(m_sock, hdr, len);
+      writeAll(m_sock, data, size);
+      writeAll(m_sock, "\r\n", 2);
+    }
+
+    void
+    ChunkedOutput::finish(void)
+    {
+      sync();
+      writeAll(m_sock, "0\r\n\r\n", 5);
+    }
+  }
+}
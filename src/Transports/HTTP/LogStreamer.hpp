@@ -0,0 +1,235 @@
+//***************************************************************************
+// Copyright 2007-2024 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef TRANSPORTS_HTTP_LOG_STREAMER_HPP_INCLUDED_
+#define TRANSPORTS_HTTP_LOG_STREAMER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <set>
+#include <string>
+#include <ostream>
+#include <streambuf>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace HTTP
+  {
+    //! Selection of the messages of a streamed log.
+    struct LogFilter
+    {
+      //! Message identifiers (empty to select all).
+      std::set<uint16_t> messages;
+      //! Source entity labels (empty to select all).
+      std::set<std::string> entities;
+      //! Source systems (empty to select all).
+      std::set<uint16_t> sources;
+      //! Start of the time window (negative if open).
+      double begin;
+      //! End of the time window (negative if open).
+      double end;
+      //! Minimum period between messages of the same type, source
+      //! and source entity in seconds (zero to disable).
+      double decimation;
+      //! Compression of the output (METHOD_UNKNOWN for none).
+      DUNE::Compression::Methods compression;
+
+      LogFilter(void);
+
+      //! Parse the query string of a request. Supported arguments
+      //! are msg, entity and src (comma separated lists), from and
+      //! to (seconds since the epoch), decimate (seconds) and
+      //! compress (gzip or bzip2).
+      //! @param[in] query query string (without the '?').
+      //! @throw std::runtime_error on invalid arguments.
+      void
+      parse(const std::string& query);
+    };
+
+    //! Decodes an LSF log and writes the packets selected by a
+    //! filter. Packets are copied verbatim, only the header is
+    //! decoded to decide if a packet is selected.
+    class LogStreamer
+    {
+    public:
+      //! Prepare streaming of a log. Only the data present when the
+      //! streamer is created is streamed, so that consecutive runs
+      //! produce the same output while the log is being written.
+      //! @param[in] file log file (plain or compressed).
+      //! @param[in] filter message selection.
+      //! @throw std::runtime_error if the log cannot be read.
+      LogStreamer(const std::string& file, const LogFilter& filter);
+
+      //! Stream the selected packets.
+      //! @param[in] os output stream.
+      void
+      run(std::ostream& os);
+
+      //! Get the number of packets read by the last run.
+      //! @return number of packets.
+      unsigned
+      getRead(void) const
+      {
+        return m_read;
+      }
+
+      //! Get the number of packets written by the last run.
+      //! @return number of packets.
+      unsigned
+      getWritten(void) const
+      {
+        return m_written;
+      }
+
+    private:
+      //! Log file.
+      std::string m_file;
+      //! Message selection.
+      LogFilter m_filter;
+      //! Compression of the log.
+      DUNE::Compression::Methods m_method;
+      //! Size of the log when the streamer was created.
+      int64_t m_size;
+      //! Entity labels by source system and entity.
+      std::map<uint32_t, std::string> m_labels;
+      //! Time of last selected packet by message, source and entity.
+      std::map<uint64_t, double> m_last;
+      //! Number of packets read.
+      unsigned m_read;
+      //! Number of packets written.
+      unsigned m_written;
+
+      bool
+      select(const DUNE::IMC::Header& hdr, const uint8_t* packet);
+    };
+
+    //! Stream buffer that counts bytes and writes the ones inside a
+    //! range to another stream buffer.
+    class RangeOutput: public std::streambuf
+    {
+    public:
+      //! Constructor.
+      //! @param[in] next destination or NULL to only count bytes.
+      //! @param[in] first offset of the first byte to write.
+      //! @param[in] last offset of the last byte to write.
+      RangeOutput(std::streambuf* next, uint64_t first = 0, uint64_t last = (uint64_t)-1);
+
+      //! Get total number of bytes written (including dropped ones).
+      //! @return number of bytes.
+      uint64_t
+      getCount(void) const
+      {
+        return m_count;
+      }
+
+    protected:
+      int_type
+      overflow(int_type c);
+
+      std::streamsize
+      xsputn(const char* data, std::streamsize size);
+
+      int
+      sync(void);
+
+    private:
+      //! Destination.
+      std::streambuf* m_next;
+      //! Offset of the first byte to write.
+      uint64_t m_first;
+      //! Offset of the last byte to write.
+      uint64_t m_last;
+      //! Number of bytes written.
+      uint64_t m_count;
+    };
+
+    //! Buffered stream buffer writing to a socket.
+    class SocketOutput: public std::streambuf
+    {
+    public:
+      //! Size of the buffer in bytes.
+      static const size_t c_buffer_size = 16384;
+
+      SocketOutput(DUNE::Network::TCPSocket& sock);
+
+      virtual
+      ~SocketOutput(void)
+      { }
+
+    protected:
+      //! Socket.
+      DUNE::Network::TCPSocket& m_sock;
+
+      int_type
+      overflow(int_type c);
+
+      int
+      sync(void);
+
+      //! Write buffered data to the socket.
+      //! @param[in] data data.
+      //! @param[in] size size of data.
+      virtual void
+      write(const char* data, size_t size);
+
+    private:
+      //! Buffer.
+      char m_bfr[c_buffer_size];
+    };
+
+    //! Stream buffer writing HTTP chunks to a socket.
+    class ChunkedOutput: public SocketOutput
+    {
+    public:
+      ChunkedOutput(DUNE::Network::TCPSocket& sock):
+        SocketOutput(sock)
+      { }
+
+      //! Write pending data and the last chunk.
+      void
+      finish(void);
+
+    protected:
+      void
+      write(const char* data, size_t size);
+    };
+
+    //! Write a buffer to a socket, retrying short writes.
+    //! @param[in] sock socket.
+    //! @param[in] data data.
+    //! @param[in] size size of data.
+    void
+    writeAll(DUNE::Network::TCPSocket& sock, const char* data, size_t size);
+  }
+}
+
+#endif
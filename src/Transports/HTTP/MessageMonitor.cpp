@@ -98,49 +98,50 @@ namespace Transports
       if (m_msgs.empty())
         return &m_msgs_json;
 
-      std::ostringstream os;
-      os << m_meta
-         << "  'dune_time_current': '" << std::setprecision(12) << Clock::getSinceEpoch() << "',\n";
+      m_json.assign(m_meta);
+      m_json += String::str("  'dune_time_current': '%0.12g',\n", Clock::getSinceEpoch());
 
       if (m_entities.empty())
       {
-        os << "  'dune_entities': { },\n";
+        m_json += "  'dune_entities': { },\n";
       }
       else
       {
-        os << "  'dune_entities': {\n";
+        m_json += "  'dune_entities': {\n";
         EntityMap::iterator itr = m_entities.begin();
-        os << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
-        ++itr;
         for (; itr != m_entities.end(); ++itr)
-          os << ",\n" << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
-        os << "\n},";
+        {
+          if (itr != m_entities.begin())
+            m_json += ",\n";
+          m_json += String::str("%u : {\"label\": \"%s\"}", itr->first, itr->second.c_str());
+        }
+        m_json += "\n},";
       }
 
-      os << "  'dune_messages': [\n";
+      m_json += "  'dune_messages': [\n";
+
+      IMC::JSONWriter writer(m_json);
 
       std::map<unsigned, IMC::Message*>::iterator itr = m_msgs.begin();
-      itr->second->toJSON(os);
+      writer.write(*itr->second);
       ++itr;
 
       for (; itr != m_msgs.end(); ++itr)
       {
-        os << ",\n";
-        itr->second->toJSON(os);
+        m_json += ",\n";
+        writer.write(*itr->second);
       }
 
       for (PowerChannelMap::iterator pitr = m_power_channels.begin(); pitr != m_power_channels.end(); ++pitr)
       {
-        os << ",\n";
-        pitr->second->toJSON(os);
+        m_json += ",\n";
+        writer.write(*pitr->second);
       }
 
-      os << "\n]"
-         << "\n};";
+      m_json += "\n]\n};";
 
       GzipCompressor cmp;
-      std::string str = os.str();
-      cmp.compress(m_msgs_json, (char*)str.c_str(), (unsigned long)str.size());
+      cmp.compress(m_msgs_json, (char*)m_json.data(), (unsigned long)m_json.size());
 
       return &m_msgs_json;
     }
@@ -178,27 +179,21 @@ namespace Transports
       if (m_logbook.empty())
         return &m_logbook_json;
 
-      std::ostringstream os;
-      unsigned int itr = 0;
-
-      os << "var logbook = {\n"
-         <<"'dune_logbook': [\n";
-      m_logbook[itr]->toJSON(os);
-      ++itr;
+      m_json.assign("var logbook = {\n'dune_logbook': [\n");
 
-      for (; itr != m_logbook.size(); ++itr)
+      IMC::JSONWriter writer(m_json);
+      for (unsigned int itr = 0; itr != m_logbook.size(); ++itr)
       {
-        os << ",\n";
-        m_logbook[itr]->toJSON(os);
+        if (itr > 0)
+          m_json += ",\n";
+        writer.write(*m_logbook[itr]);
       }
 
-      os << "\n]"
-         << "\n};";
+      m_json += "\n]\n};";
 
       // gzip compress
       GzipCompressor cmp;
-      std::string str = os.str();
-      cmp.compress(m_logbook_json, (char*)str.c_str(), (unsigned long)str.size());
+      cmp.compress(m_logbook_json, (char*)m_json.data(), (unsigned long)m_json.size());
 
       return &m_logbook_json;
     }
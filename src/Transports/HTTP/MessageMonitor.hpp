@@ -104,6 +104,8 @@ namespace Transports
       uint64_t m_last_logbook_json;
       // Number of logbook messages to show.
       unsigned int m_log_entry;
+      // JSON text buffer (reused between snapshots).
+      std::string m_json;
 
       void
       updatePowerChannel(const DUNE::IMC::PowerChannelState* msg);
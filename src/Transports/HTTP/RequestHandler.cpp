@@ -43,17 +43,19 @@
 
 // Local headers.
 #include "RequestHandler.hpp"
+#include "LogStreamer.hpp"
 
 #define SERVER_VERSION "Server: DUNE/" DUNE_VERSION_STR "\r\n"
-#define STATUS_LINE_100 "HTTP/1.0 100 Continue\r\n"
-#define STATUS_LINE_200 "HTTP/1.0 200 OK\r\n"
-#define STATUS_LINE_201 "HTTP/1.0 201 Created\r\n"
-#define STATUS_LINE_206 "HTTP/1.0 206 Partial Content\r\n"
-#define STATUS_LINE_403 "HTTP/1.0 403 Forbidden\r\n"
-#define STATUS_LINE_404 "HTTP/1.0 404 Not Found\r\n"
-#define STATUS_LINE_416 "HTTP/1.0 416 Requested Range Not Satisfiable\r\n"
-#define STATUS_LINE_500 "HTTP/1.0 500 Internal Server Error\r\n"
-#define STATUS_LINE_503 "HTTP/1.0 503 Service Unavailable\r\n"
+#define STATUS_LINE_100 "HTTP/1.1 100 Continue\r\n"
+#define STATUS_LINE_200 "HTTP/1.1 200 OK\r\n"
+#define STATUS_LINE_201 "HTTP/1.1 201 Created\r\n"
+#define STATUS_LINE_206 "HTTP/1.1 206 Partial Content\r\n"
+#define STATUS_LINE_400 "HTTP/1.1 400 Bad Request\r\n"
+#define STATUS_LINE_403 "HTTP/1.1 403 Forbidden\r\n"
+#define STATUS_LINE_404 "HTTP/1.1 404 Not Found\r\n"
+#define STATUS_LINE_416 "HTTP/1.1 416 Requested Range Not Satisfiable\r\n"
+#define STATUS_LINE_500 "HTTP/1.1 500 Internal Server Error\r\n"
+#define STATUS_LINE_503 "HTTP/1.1 503 Service Unavailable\r\n"
 
 namespace Transports
 {
@@ -70,8 +72,14 @@ namespace Transports
       // Start header.
       std::stringstream ss;
       ss << status_line
-         << SERVER_VERSION
-         << "Content-Length: " << length << "\r\n"
+         << SERVER_VERSION;
+
+      if (length < 0)
+        ss << "Transfer-Encoding: chunked\r\n";
+      else
+        ss << "Content-Length: " << length << "\r\n";
+
+      ss << "Connection: " << (m_keep_alive.value() ? "keep-alive" : "close") << "\r\n"
          << "Cache-Control: " << "max-age=1, must-revalidate" << "\r\n"
          << "Last-Modified: " << now << "\r\n"
          << "Expires: " << now << "\r\n"
@@ -89,7 +97,7 @@ namespace Transports
       ss << "\r\n";
 
       std::string res = ss.str();
-      sock->write(res.c_str(), res.size());
+      writeAll(*sock, res.c_str(), res.size());
     }
 
     void
@@ -113,6 +121,13 @@ namespace Transports
       sock->write("Created", 7);
     }
 
+    void
+    RequestHandler::sendResponse400(TCPSocket* sock, const std::string& message)
+    {
+      sendHeader(sock, STATUS_LINE_400, message.size());
+      sock->write(message.c_str(), message.size());
+    }
+
     void
     RequestHandler::sendResponse403(TCPSocket* sock)
     {
@@ -158,7 +173,7 @@ namespace Transports
 
       while (remaining > 0)
       {
-        rv = sock->write(data, size);
+        rv = sock->write(data + size - remaining, remaining);
 
         if (rv < 0)
         {
@@ -217,6 +232,53 @@ namespace Transports
         DUNE_ERR("HTTPHandle", "failed to send file: " << System::Error::getLastMessage());
     }
 
+    void
+    RequestHandler::sendStream(TCPSocket* sock, LogStreamer& streamer, HeaderFieldsMap& hdr_fields, int64_t off_beg, int64_t off_end)
+    {
+      if ((off_beg < 0) && (off_end < 0))
+      {
+        sendHeader(sock, STATUS_LINE_200, -1, &hdr_fields);
+
+        ChunkedOutput chunked(*sock);
+        std::ostream os(&chunked);
+        streamer.run(os);
+        chunked.finish();
+        return;
+      }
+
+      // Size of the output is only known after decoding.
+      RangeOutput counter(NULL);
+      std::ostream cos(&counter);
+      streamer.run(cos);
+      int64_t size = counter.getCount();
+
+      if (off_beg < 0)
+        off_beg = 0;
+
+      if ((off_end < 0) || (off_end >= size))
+        off_end = size - 1;
+
+      if (off_beg > off_end)
+      {
+        sendResponse416(sock);
+        return;
+      }
+
+      std::ostringstream range;
+      range << "bytes "
+            << off_beg << "-" << off_end
+            << "/" << size;
+
+      hdr_fields.insert(std::make_pair("Content-Range", range.str()));
+      sendHeader(sock, STATUS_LINE_206, off_end - off_beg + 1, &hdr_fields);
+
+      SocketOutput output(*sock);
+      RangeOutput partial(&output, off_beg, off_end);
+      std::ostream os(&partial);
+      streamer.run(os);
+      output.pubsync();
+    }
+
     void
     RequestHandler::handleGET(TCPSocket* sock, Utils::TupleList& headers, const char* uri)
     {
@@ -241,9 +303,11 @@ namespace Transports
       sendResponse404(sock);
     }
 
-    void
+    bool
     RequestHandler::handleRequest(TCPSocket* sock)
     {
+      m_keep_alive = false;
+
       char mtd[16];
       char uri[512];
       char bfr[c_max_request_size] = {0};
@@ -281,7 +345,7 @@ namespace Transports
       if (size <= 0)
       {
         DUNE_WRN("HTTP", "request too short");
-        return;
+        return false;
       }
 
       char* hdr = new char[size + 1];
@@ -291,8 +355,22 @@ namespace Transports
       Utils::TupleList headers(hdr, ":", "\r\n", true);
 
       // Parse request line.
-      if (std::sscanf(hdr, "%s %s %*s", mtd, uri) == 2)
+      char ver[16] = {0};
+      if (std::sscanf(hdr, "%15s %511s %15s", mtd, uri, ver) >= 2)
       {
+        // Only requests without a body are known to leave the
+        // connection in a consistent state.
+        std::string conn = headers.get("connection");
+        String::toLowerCase(conn);
+
+        if (std::strcmp(mtd, "GET") == 0)
+        {
+          if (std::strcmp(ver, "HTTP/1.1") == 0)
+            m_keep_alive = (conn != "close");
+          else
+            m_keep_alive = (conn == "keep-alive");
+        }
+
         std::string uri_dec = URL::decode(uri);
         const char* uri_clean = uri_dec.c_str();
 
@@ -311,6 +389,8 @@ namespace Transports
       }
 
       delete[] hdr;
+
+      return m_keep_alive.value();
     }
   }
 }
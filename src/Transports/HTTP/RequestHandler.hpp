@@ -44,6 +44,8 @@ namespace Transports
   {
     using DUNE_NAMESPACES;
 
+    class LogStreamer;
+
     class RequestHandler
     {
     public:
@@ -65,6 +67,12 @@ namespace Transports
       virtual void
       handlePUT(TCPSocket* sock, Utils::TupleList& headers, const char* uri);
 
+      //! Send a response header.
+      //! @param[in] sock socket.
+      //! @param[in] status_line status line.
+      //! @param[in] length content length or a negative value to
+      //! use chunked transfer encoding.
+      //! @param[in] hdr_fields extra header fields.
       void
       sendHeader(TCPSocket* sock, const char* status_line, int64_t length, HeaderFieldsMap* hdr_fields = 0);
 
@@ -74,6 +82,9 @@ namespace Transports
       void
       sendResponse201(TCPSocket* sock);
 
+      void
+      sendResponse400(TCPSocket* sock, const std::string& message);
+
       void
       sendResponse200(TCPSocket* sock);
 
@@ -110,8 +121,28 @@ namespace Transports
       void
       sendFile(TCPSocket* sock, const std::string& file, HeaderFieldsMap& hdr_fields, int64_t off_beg = -1, int64_t off_end = -1);
 
+      //! Stream a filtered log. Without a range the output is sent
+      //! while the log is decoded, using chunked transfer encoding.
+      //! With a range the log is decoded twice, first to find the
+      //! size of the output and then to send the requested bytes.
+      //! @param[in] sock socket.
+      //! @param[in] streamer log streamer.
+      //! @param[in] hdr_fields extra header fields.
+      //! @param[in] off_beg offset of the first byte or -1.
+      //! @param[in] off_end offset of the last byte or -1.
       void
+      sendStream(TCPSocket* sock, LogStreamer& streamer, HeaderFieldsMap& hdr_fields, int64_t off_beg = -1, int64_t off_end = -1);
+
+      //! Read and handle one request.
+      //! @param[in] sock socket.
+      //! @return true if the connection should be kept open for
+      //! further requests, false otherwise.
+      bool
       handleRequest(TCPSocket* sock);
+
+    private:
+      //! Persistence of the connection handled by each thread.
+      Concurrency::TLS<bool> m_keep_alive;
     };
   }
 }
@@ -32,6 +32,7 @@
 #include <fstream>
 #include <queue>
 #include <iostream>
+#include <algorithm>
 
 // DUNE headers.
 #include <DUNE/Streams/Terminal.hpp>
@@ -47,17 +48,28 @@ namespace Transports
 {
   namespace HTTP
   {
+    //! Time to wait for the next request before returning a
+    //! persistent connection to the server.
+    static const double c_linger = 0.2;
+    //! Maximum number of idle persistent connections.
+    static const size_t c_max_idle = 64;
+    //! Granularity of the server polling loop.
+    static const double c_poll_slice = 0.1;
+
     class Handler: public Concurrency::Thread
     {
     public:
-      Handler(RequestHandler& hdler, Concurrency::TSQueue<TCPSocket*>& queue):
+      Handler(RequestHandler& hdler, Concurrency::TSQueue<TCPSocket*>& queue,
+              Concurrency::TSQueue<TCPSocket*>& returned):
         m_handler(hdler),
-        m_queue(queue)
+        m_queue(queue),
+        m_returned(returned)
       { }
 
     private:
       RequestHandler& m_handler;
       Concurrency::TSQueue<TCPSocket*>& m_queue;
+      Concurrency::TSQueue<TCPSocket*>& m_returned;
 
       void
       run(void)
@@ -74,20 +86,32 @@ namespace Transports
           if (!sock)
             continue;
 
+          bool keep_alive = false;
+
           try
           {
-            m_handler.handleRequest(sock);
+            // Serve requests that follow closely on the same
+            // connection without going through the server.
+            keep_alive = m_handler.handleRequest(sock);
+            while (keep_alive && !isStopping() && IO::Poll::poll(*sock, c_linger))
+              keep_alive = m_handler.handleRequest(sock);
           }
           catch (...)
-          { }
+          {
+            keep_alive = false;
+          }
 
-          delete sock;
+          if (keep_alive)
+            m_returned.push(sock);
+          else
+            delete sock;
         }
       }
     };
 
-    Server::Server(int port, unsigned threads, RequestHandler& handler):
-      m_handler(handler)
+    Server::Server(int port, unsigned threads, RequestHandler& handler, double keep_alive):
+      m_handler(handler),
+      m_keep_alive(keep_alive)
     {
       m_sock.bind(port);
       m_sock.listen(1024);
@@ -95,7 +119,7 @@ namespace Transports
 
       for (unsigned int i = 0; i < threads; ++i)
       {
-        Concurrency::Thread* t = new Handler(handler, m_queue);
+        Concurrency::Thread* t = new Handler(handler, m_queue, m_returned);
         m_pool.push_back(t);
         t->start();
       }
@@ -123,23 +147,88 @@ namespace Transports
         if (sock)
           delete sock;
       }
+
+      TCPSocket* sock = NULL;
+      while (m_returned.pop(sock))
+        delete sock;
+
+      std::map<TCPSocket*, double>::iterator itr = m_idle.begin();
+      for (; itr != m_idle.end(); ++itr)
+        delete itr->first;
+    }
+
+    void
+    Server::closeIdle(TCPSocket* sock)
+    {
+      m_poll.remove(*sock);
+      m_idle.erase(sock);
     }
 
     void
     Server::poll(double timeout)
     {
-      if (m_poll.poll(timeout))
+      // Poll in small slices so that connections returned by the
+      // worker threads are watched without much delay.
+      double deadline = Clock::get() + timeout;
+
+      while (true)
       {
-        if (m_poll.wasTriggered(m_sock))
+        double now = Clock::get();
+
+        TCPSocket* sock = NULL;
+        while (m_returned.pop(sock))
         {
-          try
+          if (m_idle.size() >= c_max_idle)
+          {
+            delete sock;
+            continue;
+          }
+
+          m_idle[sock] = now + m_keep_alive;
+          m_poll.add(*sock);
+        }
+
+        double remaining = deadline - now;
+        if (remaining < 0)
+          break;
+
+        bool ready = m_poll.poll(std::min(remaining, c_poll_slice));
+        if (ready)
+        {
+          if (m_poll.wasTriggered(m_sock))
+          {
+            try
+            {
+              TCPSocket* nc = m_sock.accept();
+              m_queue.push(nc);
+            }
+            catch (std::runtime_error& e)
+            {
+              DUNE_ERR("Server", e.what());
+            }
+          }
+        }
+
+        // Hand over connections with pending requests and close
+        // connections that have been idle for too long.
+        now = Clock::get();
+        std::map<TCPSocket*, double>::iterator itr = m_idle.begin();
+        while (itr != m_idle.end())
+        {
+          TCPSocket* idle = itr->first;
+          bool triggered = ready && m_poll.wasTriggered(*idle);
+          bool expired = itr->second < now;
+          ++itr;
+
+          if (triggered)
           {
-            TCPSocket* nc = m_sock.accept();
-            m_queue.push(nc);
+            closeIdle(idle);
+            m_queue.push(idle);
           }
-          catch (std::runtime_error& e)
+          else if (expired)
           {
-            DUNE_ERR("Server", e.what());
+            closeIdle(idle);
+            delete idle;
           }
         }
       }
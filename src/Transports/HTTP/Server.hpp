@@ -31,6 +31,7 @@
 #define TRANSPORTS_HTTP_SERVER_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
+#include <map>
 #include <vector>
 
 // DUNE headers.
@@ -50,7 +51,9 @@ namespace Transports
       //! @param port listening port.
       //! @param threads number of worker threads.
       //! @param handler HTTP request handler.
-      Server(int port, unsigned threads, RequestHandler& handler);
+      //! @param keep_alive time in seconds an idle persistent
+      //! connection is kept open.
+      Server(int port, unsigned threads, RequestHandler& handler, double keep_alive = 5.0);
 
       //! Destructor.
       ~Server(void);
@@ -67,8 +70,17 @@ namespace Transports
       std::vector<Concurrency::Thread*> m_pool;
       //! Socket queue.
       Concurrency::TSQueue<TCPSocket*> m_queue;
+      //! Persistent connections returned by the worker threads.
+      Concurrency::TSQueue<TCPSocket*> m_returned;
+      //! Idle persistent connections and their expiration times.
+      std::map<TCPSocket*, double> m_idle;
+      //! Idle time of persistent connections.
+      double m_keep_alive;
       //! I/O multiplexing.
       IO::Poll m_poll;
+
+      void
+      closeIdle(TCPSocket* sock);
     };
   }
 }
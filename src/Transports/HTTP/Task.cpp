@@ -40,6 +40,7 @@
 #include <DUNE/DUNE.hpp>
 
 // Local headers.
+#include "LogStreamer.hpp"
 #include "MessageMonitor.hpp"
 #include "RequestHandler.hpp"
 #include "Server.hpp"
@@ -59,6 +60,8 @@ namespace Transports
       unsigned port;
       //! Number of worker threads.
       unsigned threads;
+      //! Idle time of persistent connections.
+      double keep_alive;
       //! List of messages to transport.
       std::vector<std::string> messages;
     };
@@ -96,6 +99,11 @@ namespace Transports
         .defaultValue("5")
         .description("Number of worker threads");
 
+        param("Keep-Alive Timeout", m_args.keep_alive)
+        .defaultValue("5.0")
+        .units(Units::Second)
+        .description("Time an idle persistent connection is kept open");
+
         param("Transports", m_args.messages)
         .defaultValue("")
         .description("List of messages to transport");
@@ -109,7 +117,7 @@ namespace Transports
       void
       onResourceAcquisition(void)
       {
-        bind(this, m_args.messages);
+        bind(this, m_args.messages, Tasks::BF_CONFLATE);
 
         uint16_t last_port = m_args.port + c_max_port_tries;
 
@@ -118,7 +126,7 @@ namespace Transports
           try
           {
             inf(DTR("listening on %s:%u"), Address(Address::Any).c_str(), port);
-            m_server = new Server(port, m_args.threads, *this);
+            m_server = new Server(port, m_args.threads, *this, m_args.keep_alive);
 
             // Initialize and dispatch AnnounceService.
             std::vector<Interface> itfs = Interface::get();
@@ -210,6 +218,8 @@ namespace Transports
             handlePowerChannel(sock, headers, uri);
           else if (matchURL(uri, "/dune/state/logbook.js", true))
             showLogBook(sock, headers, uri);
+          else if (matchURL(uri, "/dune/logs/", true))
+            sendLog(sock, headers, uri);
           else
             sendResponse404(sock);
         }
@@ -260,11 +270,15 @@ namespace Transports
         }
       }
 
-      void
-      sendStaticFile(TCPSocket* sock, TupleList& headers, const Path& file)
+      //! Parse the range header of a request.
+      //! @param[in] headers request headers.
+      //! @param[out] beg offset of the first byte or -1.
+      //! @param[out] end offset of the last byte or -1.
+      static void
+      parseRange(TupleList& headers, int64_t& beg, int64_t& end)
       {
-        int64_t beg = -1;
-        int64_t end = -1;
+        beg = -1;
+        end = -1;
 
         std::string range = headers.get("range");
         if (range.compare(0, 6, "bytes=") == 0)
@@ -272,12 +286,26 @@ namespace Transports
           std::vector<std::string> parts;
           String::split(range.substr(6), "-", parts);
 
-          std::istringstream p0(parts[0]);
-          p0 >> beg;
+          if (parts.size() > 0)
+          {
+            std::istringstream p0(parts[0]);
+            p0 >> beg;
+          }
 
-          std::istringstream p1(parts[1]);
-          p1 >> end;
+          if (parts.size() > 1)
+          {
+            std::istringstream p1(parts[1]);
+            p1 >> end;
+          }
         }
+      }
+
+      void
+      sendStaticFile(TCPSocket* sock, TupleList& headers, const Path& file)
+      {
+        int64_t beg = -1;
+        int64_t end = -1;
+        parseRange(headers, beg, end);
 
         RequestHandler::HeaderFieldsMap hdr;
         std::string ext = file.extension();
@@ -291,6 +319,70 @@ namespace Transports
         sendFile(sock, file.str(), hdr, beg, end);
       }
 
+      //! Send a log file. Without a query string the file is sent
+      //! as is, otherwise the query selects the messages to stream
+      //! (see LogFilter::parse).
+      void
+      sendLog(TCPSocket* sock, TupleList& headers, const char* uri)
+      {
+        std::string name = String::getRemaining("/dune/logs/", uri);
+        std::string query;
+
+        size_t sep = name.find('?');
+        if (sep != std::string::npos)
+        {
+          query = name.substr(sep + 1);
+          name.erase(sep);
+        }
+
+        if (name.empty() || name.find("..") != std::string::npos)
+        {
+          sendResponse403(sock);
+          return;
+        }
+
+        Path file = m_ctx.dir_log / name;
+
+        int64_t beg = -1;
+        int64_t end = -1;
+        parseRange(headers, beg, end);
+
+        RequestHandler::HeaderFieldsMap hdr;
+        hdr["Content-Type"] = "application/octet-stream";
+
+        if (query.empty())
+        {
+          sendFile(sock, file.str(), hdr, beg, end);
+          return;
+        }
+
+        LogFilter filter;
+        try
+        {
+          filter.parse(query);
+        }
+        catch (std::runtime_error& e)
+        {
+          sendResponse400(sock, e.what());
+          return;
+        }
+
+        if (!file.isFile())
+        {
+          sendResponse404(sock);
+          return;
+        }
+
+        if (filter.compression == Compression::METHOD_GZIP)
+          hdr["Content-Type"] = "application/gzip";
+        else if (filter.compression == Compression::METHOD_BZIP2)
+          hdr["Content-Type"] = "application/x-bzip2";
+
+        LogStreamer streamer(file.str(), filter);
+        sendStream(sock, streamer, hdr, beg, end);
+        debug("streamed %s: %u of %u messages", name.c_str(), streamer.getWritten(), streamer.getRead());
+      }
+
       void
       getMessage(TCPSocket* sock, TupleList& headers, const char* uri)
       {
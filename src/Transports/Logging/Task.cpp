@@ -78,6 +78,8 @@ namespace Transports
       Path m_lsf_file;
       // Serialization buffer.
       ByteBuffer m_buffer;
+      // Metadata of messages with payloads in bulk data rings.
+      IMC::SonarData m_bulk;
       // Logging control message.
       IMC::LoggingControl m_log_ctl;
       // True if logging is enabled.
@@ -432,10 +434,60 @@ namespace Transports
         if (m_lsf == NULL)
           return;
 
+        if (logBulkMessage(msg))
+          return;
+
         IMC::Packet::serialize(msg, m_buffer);
         m_lsf->write(m_buffer.getBufferSigned(), m_buffer.getSize());
       }
 
+      //! Log a message whose payload was stored in a bulk data ring.
+      //! The packet is written in three pieces (header and fields,
+      //! payload, footer) with the payload read in place from the ring.
+      //! @param[in] msg message.
+      //! @return true if message was logged, false if it does not
+      //! reference a bulk payload.
+      bool
+      logBulkMessage(const IMC::Message* msg)
+      {
+        if (msg->getId() != IMC::SonarData::getIdStatic())
+          return false;
+
+        const IMC::SonarData* sonar = static_cast<const IMC::SonarData*>(msg);
+        BulkRing::Handle handle;
+        if (!BulkRing::decode(sonar->data, handle))
+          return false;
+
+        m_bulk = *sonar;
+        m_bulk.data.clear();
+
+        BulkRing::Access access(handle);
+        unsigned size = access.isValid() ? access.getSize() : 0;
+        if (m_bulk.getSerializationSize() + size > DUNE_IMC_CONST_MAX_SIZE)
+          size = 0;
+
+        if (size == 0)
+          debug("bulk payload of %s is no longer available", msg->getName());
+
+        IMC::Packet::serialize(&m_bulk, m_buffer);
+
+        // Patch payload and data field sizes, data is the last field.
+        uint8_t* bfr = m_buffer.getBuffer();
+        uint16_t n = m_buffer.getSize() - DUNE_IMC_CONST_FOOTER_SIZE;
+        IMC::serialize((uint16_t)(m_bulk.getPayloadSerializationSize() + size), bfr + 4);
+        IMC::serialize((uint16_t)size, bfr + n - 2);
+
+        uint8_t footer[DUNE_IMC_CONST_FOOTER_SIZE];
+        uint16_t crc = Algorithms::CRC16::compute(bfr, n);
+        crc = Algorithms::CRC16::compute((const uint8_t*)access.getData(), size, crc);
+        IMC::serialize(crc, footer);
+
+        m_lsf->write(m_buffer.getBufferSigned(), n);
+        m_lsf->write(access.getData(), size);
+        m_lsf->write((const char*)footer, sizeof(footer));
+        return true;
+      }
+
       void
       onMain(void)
       {
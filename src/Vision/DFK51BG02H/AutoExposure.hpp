@@ -70,6 +70,18 @@ namespace Vision
         return  (128.0 * count)/(0.299 * ar + 0.587 * ag + 0.114 * ab);
       }
 
+      //! Calculate the gain update from the mean luma of an image.
+      //! @param[in] luma mean luma (0 - 255).
+      float
+      exposureCorrectionLuma(double luma)
+      {
+        if (luma < 1.0)
+          luma = 1.0;
+
+        // Calculate the exposure time multiplier
+        return 128.0 / luma;
+      }
+
     private:
     };
   }
@@ -32,13 +32,11 @@
 
 // ISO C++ 98 headers.
 #include <queue>
+#include <cstring>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
-// Local headers.
-#include "Frame.hpp"
-
 // Import namespaces.
 using DUNE_NAMESPACES;
 
@@ -52,10 +50,20 @@ namespace Vision
     public:
       //! Constructor.
       //! @param[in] task parent task.
+      //! @param[in] pipeline frame pipeline providing frame buffers.
       //! @param[in] port UDP listening port.
+      //! @param[in] width frame width.
+      //! @param[in] height frame height.
+      //! @param[in] packets expected number of packets per frame.
       //! @param[in] buffer_capacity packet buffer capacity.
-      GVSP(DUNE::Tasks::Task* task, uint16_t port, unsigned buffer_capacity = 16384):
+      GVSP(DUNE::Tasks::Task* task, FramePipeline& pipeline, uint16_t port,
+           unsigned width, unsigned height, unsigned packets,
+           unsigned buffer_capacity = 16384):
         m_task(task),
+        m_pipeline(pipeline),
+        m_width(width),
+        m_height(height),
+        m_packets(packets),
         m_buffer_capacity(buffer_capacity),
         m_count(0)
       {
@@ -67,67 +75,38 @@ namespace Vision
       ~GVSP(void)
       {
         delete [] m_buffer;
-      }
 
-      //! Enqueue dirty frame.
-      //! @param[in] frame dirty frame.
-      void
-      enqueueDirty(Frame* frame)
-      {
-        m_lock.lock();
-        m_dirty.push(frame);
-        m_lock.unlock();
-        m_cond.broadcast();
+        while (!m_captured.empty())
+        {
+          m_pipeline.discard(m_captured.front());
+          m_captured.pop();
+        }
       }
 
-      //! Dequeue dirty frame.
-      //! @return frame dirty frame or NULL if none is available.
-      Frame*
-      dequeueDirty(void)
+      //! Dequeue captured frame.
+      //! @return captured frame or NULL if none is available.
+      ImageFrame*
+      dequeueCaptured(void)
       {
         ScopedMutex l(m_lock);
-        if (m_dirty.empty())
+        if (m_captured.empty())
           return NULL;
 
-        Frame* frame = m_dirty.front();
-        m_dirty.pop();
+        ImageFrame* frame = m_captured.front();
+        m_captured.pop();
         return frame;
       }
 
-      //! Wait for a dirty frame to be available.
+      //! Wait for a captured frame to be available.
       //! @param[in] timeout maximum amount of time to wait.
       void
-      waitDirty(double timeout)
+      waitCaptured(double timeout)
       {
         m_cond.lock();
         m_cond.wait(timeout);
         m_cond.unlock();
       }
 
-      //! Enqueue clean frame.
-      //! @param[in] frame clean frame.
-      void
-      enqueueClean(Frame* frame)
-      {
-        m_lock.lock();
-        m_clean.push(frame);
-        m_lock.unlock();
-      }
-
-      //! Dequeue clean frame.
-      //! @return clean frame or NULL if none is available.
-      Frame*
-      dequeueClean(void)
-      {
-        ScopedMutex l(m_lock);
-        if (m_clean.empty())
-          return NULL;
-
-        Frame* frame = m_clean.front();
-        m_clean.pop();
-        return frame;
-      }
-
     private:
       //! GVSP header size.
       static const size_t c_header_size = 44;
@@ -135,6 +114,14 @@ namespace Vision
       static const size_t c_footer_size = 16;
       //! Parent task.
       DUNE::Tasks::Task* m_task;
+      //! Frame pipeline.
+      FramePipeline& m_pipeline;
+      //! Frame width.
+      unsigned m_width;
+      //! Frame height.
+      unsigned m_height;
+      //! Expected number of packets per frame.
+      unsigned m_packets;
       //! Internal packet buffer.
       uint8_t* m_buffer;
       //! Internal packet buffer capacity.
@@ -148,14 +135,41 @@ namespace Vision
       //! Lock to protect concurrent access to queues.
       Mutex m_lock;
       //! Queue of captured but not yet processed frames.
-      std::queue<Frame*> m_dirty;
-      //! Queue of frames that can be used for new captures.
-      std::queue<Frame*> m_clean;
+      std::queue<ImageFrame*> m_captured;
+
+      //! Enqueue captured frame.
+      //! @param[in] frame captured frame.
+      void
+      enqueueCaptured(ImageFrame* frame)
+      {
+        m_lock.lock();
+        m_captured.push(frame);
+        m_lock.unlock();
+        m_cond.broadcast();
+      }
+
+      //! Write packet to frame.
+      //! @param[in] frame destination frame.
+      //! @param[in] nr packet number.
+      //! @param[in] data packet data.
+      //! @param[in] size packet size.
+      void
+      writePacket(ImageFrame* frame, unsigned nr, const uint8_t* data, unsigned size)
+      {
+        unsigned capacity = m_width * m_height;
+        unsigned offset = (nr - 1) * size;
+        if (nr == 0 || offset >= capacity)
+          return;
+
+        std::memcpy(frame->getData() + offset, data, std::min(size, capacity - offset));
+        ++m_count;
+      }
 
       void
       run(void)
       {
-        Frame* frame = NULL;
+        ImageFrame* frame = NULL;
+        bool dropping = false;
 
         while (!isStopping())
         {
@@ -167,18 +181,28 @@ namespace Vision
           if (rv == c_header_size)
           {
             m_count = 0;
-            frame = dequeueClean();
-            if (frame == NULL)
-            {
-              m_task->err(DTR("buffer overrun"));
-              break;
-            }
+            if (frame != NULL)
+              m_pipeline.discard(frame);
 
-            frame->setTimeStamp();
+            // Without free buffers the frame is dropped (and counted
+            // by the pool) instead of stalling the stream.
+            frame = m_pipeline.acquire();
+            dropping = (frame == NULL);
+            if (dropping)
+              continue;
+
+            frame->setImage(m_width, m_height, ImageFrame::FMT_BAYER_GBRG);
+            frame->setTimeStamp(Clock::getSinceEpoch());
           }
           else if (rv == c_footer_size)
           {
-            enqueueDirty(frame);
+            if (frame == NULL)
+              continue;
+
+            if (m_count < m_packets)
+              m_task->war(DTR("lost at least %d packets"), m_packets - m_count);
+
+            enqueueCaptured(frame);
             frame = NULL;
           }
           else
@@ -187,14 +211,17 @@ namespace Vision
             {
               uint16_t packet_number = 0;
               ByteCopy::fromBE(packet_number, m_buffer + 6);
-              m_count += frame->writePacket(packet_number, m_buffer + 8, rv - 8);
+              writePacket(frame, packet_number, m_buffer + 8, rv - 8);
             }
-            else
+            else if (!dropping)
             {
               m_task->err(DTR("null frame"));
             }
           }
         }
+
+        if (frame != NULL)
+          m_pipeline.discard(frame);
       }
     };
   }
@@ -28,7 +28,7 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
-#include <queue>
+#include <fstream>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
@@ -56,9 +56,12 @@ namespace Vision
   //! RGB32 output, the camera is only able to output images in Y800
   //! (Grayscale) and %Bayer 8 GBRG (GBGB.. RGRG..), IC Capture does
   //! the conversion from %Bayer 8 to RGB24 and RGB32 formats. In
-  //! this device driver we convert %Bayer 8 to YUV420 and then to
-  //! JPEG, this approach is faster than converting to RGB24 and
-  //! yields smaller JPEGs.
+  //! this device driver frames are captured into a pool of reusable
+  //! buffers and handed to a Media::FramePipeline, which converts
+  //! %Bayer 8 to YUV420 and then to JPEG in parallel encoder
+  //! threads, embedding Exif metadata (capture time and GPS
+  //! position) before writing each image. When all buffers are in
+  //! use, incoming frames are dropped.
   //!
   //! Other limitations of this camera include:
   //!  - No packet retransmission capabilities, which means that if
@@ -140,6 +143,8 @@ namespace Vision
       unsigned strobe_duration;
       //! Store as raw
       bool store_raw;
+      //! Number of JPEG encoder threads.
+      unsigned encoders;
       //! White-balance Filter: B factor.
       float b_factor;
       //! White-balance Filter: R factor.
@@ -161,20 +166,18 @@ namespace Vision
       GVCP* m_gvcp;
       //! %GVSP.
       GVSP* m_gvsp;
-      //! RGB24 buffer.
-      uint8_t* m_rgb24_bfr;
+      //! Frame buffers.
+      FramePool* m_pool;
+      //! Frame pipeline.
+      FramePipeline* m_pipeline;
       //! Keep-alive counter.
       Counter<double> m_kalive;
       //! %Destination log folder.
       Path m_log_dir;
-      //! Array of frames.
-      std::queue<Frame*> m_frames;
       //! PGM header.
       std::string m_pgm_header;
-      //! Compressor.
-      JPEGCompressor m_jpeg;
-      //! Bayer decoder.
-      BayerDecoder m_debayer;
+      //! Last GPS fix.
+      IMC::GpsFix m_fix;
       // White-balance filter.
       WhiteBalance m_white;
       // Exposure time.
@@ -186,9 +189,10 @@ namespace Vision
         Tasks::Task(name, ctx),
         m_gvcp(NULL),
         m_gvsp(NULL),
+        m_pool(NULL),
+        m_pipeline(NULL),
         m_kalive(0.5),
         m_log_dir(ctx.dir_log),
-        m_debayer(BayerDecoder::TILE_GBRG),
         m_white(c_width, c_height)
       {
         // Retrieve configuration values.
@@ -275,24 +279,31 @@ namespace Vision
         .defaultValue("false")
         .description("Store raw image data in PGM format");
 
+        param("Encoder Threads", m_args.encoders)
+        .defaultValue("2")
+        .minimumValue("1")
+        .maximumValue("8")
+        .description("Number of threads used to convert and compress frames");
+
         param("White Balance - B Factor", m_args.b_factor)
         .defaultValue("1.0");
 
         param("White Balance - R Factor", m_args.r_factor)
         .defaultValue("1.0");
 
-        m_rgb24_bfr = new uint8_t[c_width * c_height * 3];
-
         // Initialize PGM header.
         m_pgm_header = String::str("P5 %u %u 255\n", c_width, c_height);
 
+        m_fix.validity = 0;
+
+        bind<IMC::GpsFix>(this);
         bind<IMC::LoggingControl>(this);
       }
 
       //! Destructor.
       ~Task(void)
       {
-        delete [] m_rgb24_bfr;
+        onResourceRelease();
       }
 
       //! Update internal parameters.
@@ -303,29 +314,23 @@ namespace Vision
         m_white.setRFactor(m_args.r_factor);
         m_white.setBFactor(m_args.b_factor);
 
-        // Bayer decoder.
-        m_debayer.setMethod(BayerDecoder::METHOD_BILINEAR);
+        if (m_pipeline != NULL)
+          m_pipeline->setQuality(m_args.jpeg_quality);
       }
 
       //! Acquire resources and buffers.
       void
       onResourceAcquisition(void)
       {
-        // Initialize JPEG compressor.
-        m_jpeg.setInputDimensions(c_width, c_height);
-        m_jpeg.setInputColorSpace(JPEGCompressor::CS_RGB);
-        m_jpeg.setOutputColorSpace(JPEGCompressor::CS_YUV);
+        m_pool = new FramePool(m_args.buffer_count, c_width * c_height);
+        m_pipeline = new FramePipeline(*m_pool, m_args.encoders);
+        m_pipeline->setMethod(BayerDecoder::METHOD_BILINEAR);
+        m_pipeline->setQuality(m_args.jpeg_quality);
+        m_pipeline->start();
 
         m_gvcp = new GVCP(m_args.raddr);
-        m_gvsp = new GVSP(this, m_args.port);
+        m_gvsp = new GVSP(this, *m_pipeline, m_args.port, c_width, c_height, c_pkts_per_frame);
         m_gvsp->start();
-
-        for (unsigned i = 0; i < m_args.buffer_count; ++i)
-        {
-          Frame* frame = new Frame(c_width * c_height);
-          m_gvsp->enqueueClean(frame);
-          m_frames.push(frame);
-        }
       }
 
       //! Release allocated resources.
@@ -341,12 +346,16 @@ namespace Vision
           m_gvsp = NULL;
         }
 
-        while (!m_frames.empty())
+        if (m_pipeline != NULL)
         {
-          Frame* frame = m_frames.front();
-          m_frames.pop();
-          delete frame;
+          FramePipeline::Statistics stats = m_pipeline->getStatistics();
+          if (stats.submitted > 0)
+            debug("frames: %u stored, %u dropped, %u failed",
+                  stats.completed, stats.dropped, stats.failed);
         }
+
+        Memory::clear(m_pipeline);
+        Memory::clear(m_pool);
       }
 
       //! Initialize resources and start capturing frames.
@@ -404,6 +413,16 @@ namespace Vision
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_IDLE);
       }
 
+      void
+      consume(const IMC::GpsFix* msg)
+      {
+        if (msg->getSource() != getSystemId())
+          return;
+
+        if (msg->validity & IMC::GpsFix::GFV_VALID_POS)
+          m_fix = *msg;
+      }
+
       void
       consume(const IMC::LoggingControl* msg)
       {
@@ -438,11 +457,22 @@ namespace Vision
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_IDLE);
       }
 
+      //! Fill the Exif metadata of a captured frame.
+      //! @param[in] frame captured frame.
       void
-      onMain(void)
+      setMetadata(ImageFrame* frame)
       {
-        Frame* frame = NULL;
+        Exif& exif = frame->getExif();
+        exif.setCamera("The Imaging Source", "DFK 51BG02.H");
+        exif.setTime(frame->getTimeStamp());
+
+        if (m_fix.validity & IMC::GpsFix::GFV_VALID_POS)
+          exif.setPosition(m_fix.lat, m_fix.lon, m_fix.height);
+      }
 
+      void
+      onMain(void)
+      {
         while (!stopping())
         {
           if (m_kalive.overflow())
@@ -461,53 +491,50 @@ namespace Vision
 
           consumeMessages();
 
-          frame = m_gvsp->dequeueDirty();
+          ImageFrame* frame = m_gvsp->dequeueCaptured();
           if (frame == NULL)
           {
-            m_gvsp->waitDirty(0.5);
+            m_gvsp->waitCaptured(0.5);
             continue;
           }
 
-          unsigned pkt_count = frame->getPacketCount();
-          if (pkt_count < c_pkts_per_frame)
-            war(DTR("lost at least %d packets"), c_pkts_per_frame - pkt_count);
-
-          if (isActive())
+          if (!isActive())
           {
-            m_white.filter(frame->getData());
-            double timestamp = frame->getTimeStamp();
-            Path file = m_log_dir / String::str("%0.4f.jpg", timestamp);
+            m_pipeline->discard(frame);
+            continue;
+          }
 
-            {
-              m_debayer.decodeToRGB24(frame->getData(), m_rgb24_bfr, c_width, c_height);
-              m_jpeg.compress(m_rgb24_bfr, m_args.jpeg_quality);
-              std::ofstream jpg(file.c_str(), std::ios::binary);
-              jpg.write((char*)m_jpeg.imageData(), m_jpeg.imageSize());
-            }
+          m_white.filter(frame->getData());
+          double timestamp = frame->getTimeStamp();
 
-            if (m_args.store_raw)
-            {
-              file = m_log_dir / String::str("%0.4f.pgm", timestamp);
-              std::ofstream pgm(file.c_str(), std::ios::binary);
-              pgm.write(m_pgm_header.c_str(), m_pgm_header.size());
-              pgm.write((char*)frame->getData(), c_width * c_height);
-            }
-
-            if (m_args.ae)
-            {
-              float correction = m_ae.exposureCorrection(m_rgb24_bfr, c_width * c_height);
-              // Smooth out the exposure (make it slower varying), halve the deltaEV
-              correction = std::sqrt(correction);
-              m_exposure = Math::trimValue(m_exposure * correction, 0.0001, m_args.exposure_time);
-
-              if (m_exposure >= m_args.ae_min)
-                m_gvcp->setExposureTime(m_exposure);
-              else
-                m_gvcp->setExposureTime(m_args.ae_min);
-            }
+          if (m_args.store_raw)
+          {
+            Path file = m_log_dir / String::str("%0.4f.pgm", timestamp);
+            std::ofstream pgm(file.c_str(), std::ios::binary);
+            pgm.write(m_pgm_header.c_str(), m_pgm_header.size());
+            pgm.write((char*)frame->getData(), c_width * c_height);
           }
 
-          m_gvsp->enqueueClean(frame);
+          frame->setPath((m_log_dir / String::str("%0.4f.jpg", timestamp)).str());
+          setMetadata(frame);
+          m_pipeline->submit(frame);
+
+          if (m_args.ae)
+          {
+            double luma = m_pipeline->getMeanLuma();
+            if (luma < 0)
+              continue;
+
+            float correction = m_ae.exposureCorrectionLuma(luma);
+            // Smooth out the exposure (make it slower varying), halve the deltaEV
+            correction = std::sqrt(correction);
+            m_exposure = Math::trimValue(m_exposure * correction, 0.0001, m_args.exposure_time);
+
+            if (m_exposure >= m_args.ae_min)
+              m_gvcp->setExposureTime(m_exposure);
+            else
+              m_gvcp->setExposureTime(m_args.ae_min);
+          }
         }
       }
     };